@@ -0,0 +1,270 @@
+/**
+ * @file       eFSP_COBS.h
+ *
+ * @brief      Consistent Overhead Byte Stuffing encoder and decoder
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_COBS_H
+#define EFSP_COBS_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Every frame starts and ends with a delimiter, that never appear inside an encoded frame */
+#define EFSP_COBS_DELIM                                                 ( ( uint8_t ) 0x00u )
+
+/* Biggest number of data bytes after a code byte. An encoded frame of N bytes is at most
+ * N + 2 + ( N / EFSP_COBS_MAXBLOCK ) + 1 bytes long */
+#define EFSP_COBS_MAXBLOCK                                              ( ( uint32_t ) 0xFEu )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_COBS_RES_OK = 0,
+    e_eFSP_COBS_RES_BADPARAM,
+    e_eFSP_COBS_RES_BADPOINTER,
+	e_eFSP_COBS_RES_CORRUPTCTX,
+    e_eFSP_COBS_RES_OUTOFMEM,
+    e_eFSP_COBS_RES_BADFRAME,
+    e_eFSP_COBS_RES_FRAMEENDED,
+    e_eFSP_COBS_RES_FRAMERESTART,
+    e_eFSP_COBS_RES_NOINITLIB,
+    e_eFSP_COBS_RES_NOINITFRAME
+}e_eFSP_COBS_RES;
+
+typedef enum
+{
+    e_eFSP_COBS_ENCSM_NOFRAME = 0,
+    e_eFSP_COBS_ENCSM_SOF,
+    e_eFSP_COBS_ENCSM_CODE,
+    e_eFSP_COBS_ENCSM_DATA,
+    e_eFSP_COBS_ENCSM_EOF,
+    e_eFSP_COBS_ENCSM_ENDED
+}e_eFSP_COBS_ENCSM;
+
+typedef enum
+{
+    e_eFSP_COBS_DECSM_WAITSOF = 0,
+    e_eFSP_COBS_DECSM_CODE,
+    e_eFSP_COBS_DECSM_DATA,
+    e_eFSP_COBS_DECSM_ENDED,
+    e_eFSP_COBS_DECSM_BAD
+}e_eFSP_COBS_DECSM;
+
+typedef struct
+{
+    bool_t            bIsInit;
+	uint8_t*          puBuff;
+	uint32_t          uBuffL;
+    uint32_t          uFrameL;
+    uint32_t          uFrameEncL;
+    uint32_t          uCntr;
+    uint32_t          uBlkL;
+    uint32_t          uSentL;
+    bool_t            bZero;
+    e_eFSP_COBS_ENCSM eSt;
+}t_eFSP_COBS_EncCtx;
+
+typedef struct
+{
+    bool_t            bIsInit;
+	uint8_t*          puBuff;
+	uint32_t          uBuffL;
+    uint32_t          uCntr;
+    uint32_t          uBlkL;
+    bool_t            bZero;
+    bool_t            bCode;
+    e_eFSP_COBS_DECSM eSt;
+}t_eFSP_COBS_DecCtx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the encoder context. The frame to encode is placed by the user in p_puBuff, and is encoded
+ *              a chunk at time without any other memory. Every run of non zero bytes is preceded by a code byte with
+ *              its length, so the overhead is one byte every EFSP_COBS_MAXBLOCK bytes plus the two delimiters.
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[in]   p_puBuff        - Pointer to the memory area that contains the frame to encode
+ * @param[in]   p_uBuffL        - Dimension in byte of p_puBuff
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_InitEncCtx(t_eFSP_COBS_EncCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL);
+
+/**
+ * @brief       Start the encoding of a frame of p_uFrameL bytes placed at the start of the memory area
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[in]   p_uFrameL       - Size of the frame, not zero and not bigger than the memory area
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_NewEncFrame(t_eFSP_COBS_EncCtx* const p_ptCtx, const uint32_t p_uFrameL);
+
+/**
+ * @brief       Restart the encoding of the current frame from the first byte
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_COBS_RES_NOINITFRAME    - No frame to restart
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_RestartEncFrame(t_eFSP_COBS_EncCtx* const p_ptCtx);
+
+/**
+ * @brief       Retrive the number of encoded bytes still to get, delimiters included
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[out]  p_puRemL        - Pointer to a uint32_t variable where the number of bytes will be placed
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_COBS_RES_NOINITFRAME    - No frame started
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_GetEncRemL(t_eFSP_COBS_EncCtx* const p_ptCtx, uint32_t* const p_puRemL);
+
+/**
+ * @brief       Retrive the next chunk of the encoded frame
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[out]  p_puEncBuff     - Pointer to the buffer where the encoded chunk will be placed
+ * @param[in]   p_uMaxBufL      - Size of p_puEncBuff
+ * @param[out]  p_puGettedL     - Pointer to a uint32_t variable where the size of the chunk will be placed
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_COBS_RES_NOINITFRAME    - No frame started
+ *		        e_eFSP_COBS_RES_FRAMEENDED     - The last byte of the frame has been retrived
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly, more bytes to retrive
+ */
+e_eFSP_COBS_RES eFSP_COBS_GetEncChunk(t_eFSP_COBS_EncCtx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                      const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL);
+
+/**
+ * @brief       Initialize the decoder context. The decoded frame is stored in p_puBuff.
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[in]   p_puBuff        - Pointer to the memory area where the decoded frame will be placed
+ * @param[in]   p_uBuffL        - Dimension in byte of p_puBuff
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_InitDecCtx(t_eFSP_COBS_DecCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL);
+
+/**
+ * @brief       Discard the current frame and wait the delimiter of a new one
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_NewDecFrame(t_eFSP_COBS_DecCtx* const p_ptCtx);
+
+/**
+ * @brief       Retrive the bytes decoded till now
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the location of the decoded bytes will be placed
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the number of decoded bytes will be placed
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_GetDecData(t_eFSP_COBS_DecCtx* const p_ptCtx, uint8_t** p_ppuData,
+                                     uint32_t* const p_puDataL);
+
+/**
+ * @brief       Retrive the state of the decoder
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[out]  p_pbWaitSof     - Filled with true if the decoder is still waiting the first delimiter
+ * @param[out]  p_pbEnded       - Filled with true if a full frame is decoded
+ * @param[out]  p_pbBad         - Filled with true if the frame is bad
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_GetDecState(t_eFSP_COBS_DecCtx* const p_ptCtx, bool_t* const p_pbWaitSof,
+                                      bool_t* const p_pbEnded, bool_t* const p_pbBad);
+
+/**
+ * @brief       Decode a chunk of an encoded frame. Bytes before the first delimiter are discarded, and more
+ *              delimiters before the first code byte are ignored. A delimiter inside a block discard the data
+ *              received and start a new frame.
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[in]   p_puEncBuff     - Pointer to the encoded chunk
+ * @param[in]   p_uEncL         - Size of the encoded chunk
+ * @param[out]  p_puUsedL       - Pointer to a uint32_t variable where the number of used bytes will be placed
+ *
+ * @return      e_eFSP_COBS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_COBS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_COBS_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_COBS_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_COBS_RES_OUTOFMEM       - The memory area can not contain the frame
+ *		        e_eFSP_COBS_RES_BADFRAME       - Empty frame, call eFSP_COBS_NewDecFrame
+ *		        e_eFSP_COBS_RES_FRAMERESTART   - A new frame started, the previous one was not complete
+ *		        e_eFSP_COBS_RES_FRAMEENDED     - Frame ended, the bytes after the delimiter are not used
+ *              e_eFSP_COBS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_COBS_RES eFSP_COBS_InsEncChunk(t_eFSP_COBS_DecCtx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                      const uint32_t p_uEncL, uint32_t* const p_puUsedL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_COBS_H */
@@ -0,0 +1,106 @@
+/**
+ * @file       eFSP_DLT.h
+ *
+ * @brief      In place delta encoder and decoder of the message payload against a base payload
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_DLT_H
+#define EFSP_DLT_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* The stream is a sequence of tokens made of up to EFSP_DLT_MAXLIT bytes of the XOR between data and base followed
+ * by a control byte. The upper bits of the control byte are the number of these bytes, the lower bits the number of
+ * following bytes, up to EFSP_DLT_MAXSAME, that are equal to the base. The length of the data is the one of the base */
+#define EFSP_DLT_MAXLIT                                                 ( ( uint32_t ) 0x07u )
+#define EFSP_DLT_MAXSAME                                                ( ( uint32_t ) 0x1Fu )
+#define EFSP_DLT_LITSHIFT                                               ( ( uint32_t ) 0x05u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_DLT_RES_OK = 0,
+    e_eFSP_DLT_RES_BADPARAM,
+    e_eFSP_DLT_RES_BADPOINTER,
+    e_eFSP_DLT_RES_OUTOFMEM,
+    e_eFSP_DLT_RES_BADFRAME,
+    e_eFSP_DLT_RES_NOGAIN
+}e_eFSP_DLT_RES;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Replace p_puData with the difference from p_puBase, a base of the same length. No memory other than the
+ *              stack of the function is used. The data is encoded only if the stream is shorter than the data and
+ *              never overwrite data that is still needed, this is checked before writing anything, so the data is left
+ *              untouched otherwise.
+ *
+ * @param[in]   p_puData        - Pointer to the data to encode, replaced by the stream
+ * @param[in]   p_puBase        - Pointer to the base, p_uDataL bytes
+ * @param[in]   p_uDataL        - Number of bytes of data
+ * @param[out]  p_puDltL        - Pointer to a uint32_t variable where the length of the stream will be placed
+ *
+ * @return      e_eFSP_DLT_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSP_DLT_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSP_DLT_RES_NOGAIN          - The data is too different from the base, it was left as it is
+ *              e_eFSP_DLT_RES_OK              - Operation ended correctly
+ */
+e_eFSP_DLT_RES eFSP_DLT_Encode(uint8_t* p_puData, const uint8_t* p_puBase, const uint32_t p_uDataL,
+                               uint32_t* const p_puDltL);
+
+/**
+ * @brief       Rebuild in place the data from a stream placed at the start of p_puArea and the same base used by the
+ *              encoder. The data is rebuilt starting from the end, so the memory area must contain only the data. The
+ *              stream is fully checked before writing anything, so the memory area is left untouched in case of error.
+ *
+ * @param[in]   p_puArea        - Pointer to the memory area that contains the stream, replaced by the data
+ * @param[in]   p_uAreaL        - Dimension in byte of p_puArea
+ * @param[in]   p_puBase        - Pointer to the base
+ * @param[in]   p_uBaseL        - Number of bytes of the base, and of the rebuilt data
+ * @param[in]   p_uDltL         - Number of bytes of the stream
+ *
+ * @return      e_eFSP_DLT_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSP_DLT_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSP_DLT_RES_OUTOFMEM        - The memory area can not contain the data
+ *		        e_eFSP_DLT_RES_BADFRAME        - The stream is malformed
+ *              e_eFSP_DLT_RES_OK              - Operation ended correctly
+ */
+e_eFSP_DLT_RES eFSP_DLT_Decode(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint8_t* p_puBase,
+                               const uint32_t p_uBaseL, const uint32_t p_uDltL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_DLT_H */
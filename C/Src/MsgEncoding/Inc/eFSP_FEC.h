@@ -0,0 +1,126 @@
+/**
+ * @file       eFSP_FEC.h
+ *
+ * @brief      In place Reed-Solomon forward error correction of interleaved blocks of an encoded frame
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_FEC_H
+#define EFSP_FEC_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Reed-Solomon code over GF(256), with primitive polynomial 0x11D and alpha^0 as first root of the generator. There is
+ * a codeword every EFSP_FEC_BLOCKL bytes of data, and the whole frame, data followed by parity, is interleaved byte by
+ * byte between the codewords. A burst of errors is spread on all the codewords, and every codeword correct up to half
+ * of its parity bytes */
+#define EFSP_FEC_BLOCKL                                                 ( ( uint32_t ) 0x20u )
+#define EFSP_FEC_MAXPAR                                                 ( ( uint32_t ) 0x10u )
+#define EFSP_FEC_GFN                                                    ( ( uint32_t ) 0xFFu )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_FEC_RES_OK = 0,
+    e_eFSP_FEC_RES_BADPARAM,
+    e_eFSP_FEC_RES_BADPOINTER,
+    e_eFSP_FEC_RES_OUTOFMEM,
+    e_eFSP_FEC_RES_BADFRAME
+}e_eFSP_FEC_RES;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Get the number of parity bytes added to p_uDataL bytes of data
+ *
+ * @param[in]   p_uDataL        - Number of bytes of data
+ * @param[in]   p_uParL         - Parity bytes of every codeword, zero when the data is not protected
+ *
+ * @return      Number of parity bytes
+ */
+uint32_t eFSP_FEC_GetParL(const uint32_t p_uDataL, const uint32_t p_uParL);
+
+/**
+ * @brief       Get the biggest number of bytes of data that can be placed, with its parity, in p_uFrameL bytes. When
+ *              p_uFrameL is the size of a protected frame, this is the size of its data.
+ *
+ * @param[in]   p_uFrameL       - Number of bytes of the frame
+ * @param[in]   p_uParL         - Parity bytes of every codeword, zero when the data is not protected
+ *
+ * @return      Number of bytes of data
+ */
+uint32_t eFSP_FEC_GetDataL(const uint32_t p_uFrameL, const uint32_t p_uParL);
+
+/**
+ * @brief       Append to the data placed at the start of p_puArea the parity of its codewords. No memory other than
+ *              the stack of the function is used.
+ *
+ * @param[in]   p_puArea        - Pointer to the memory area that contains the data
+ * @param[in]   p_uAreaL        - Dimension in byte of p_puArea
+ * @param[in]   p_uDataL        - Number of bytes of data
+ * @param[in]   p_uParL         - Parity bytes of every codeword, from 2 to EFSP_FEC_MAXPAR
+ * @param[out]  p_puFrameL      - Pointer to a uint32_t variable where the size of data and parity will be placed
+ *
+ * @return      e_eFSP_FEC_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSP_FEC_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FEC_RES_OUTOFMEM        - The memory area can not contain the parity
+ *              e_eFSP_FEC_RES_OK              - Operation ended correctly
+ */
+e_eFSP_FEC_RES eFSP_FEC_Encode(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uDataL,
+                               const uint32_t p_uParL, uint32_t* const p_puFrameL);
+
+/**
+ * @brief       Correct in place the errors of a protected frame, the data is left at the start of it. Every codeword
+ *              is corrected when it has no more than half of p_uParL wrong bytes, so the frame could be corrected
+ *              only in part when e_eFSP_FEC_RES_BADFRAME is returned.
+ *
+ * @param[in]   p_puFrame       - Pointer to the frame
+ * @param[in]   p_uFrameL       - Number of bytes of the frame, data and parity
+ * @param[in]   p_uParL         - Parity bytes of every codeword, from 2 to EFSP_FEC_MAXPAR
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the number of bytes of data will be placed
+ * @param[out]  p_puFixN        - Pointer to a uint32_t variable where the number of corrected bytes will be placed
+ *
+ * @return      e_eFSP_FEC_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSP_FEC_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FEC_RES_BADFRAME        - The size is not the one of a protected frame, or there are too
+ *                                               many errors
+ *              e_eFSP_FEC_RES_OK              - Operation ended correctly
+ */
+e_eFSP_FEC_RES eFSP_FEC_Decode(uint8_t* p_puFrame, const uint32_t p_uFrameL, const uint32_t p_uParL,
+                               uint32_t* const p_puDataL, uint32_t* const p_puFixN);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_FEC_H */
@@ -0,0 +1,107 @@
+/**
+ * @file       eFSP_LZSS.h
+ *
+ * @brief      In place LZSS compressor and decompressor of the message payload
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_LZSS_H
+#define EFSP_LZSS_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* The compressed stream starts with the uncompressed length as a varint, followed by tokens. A control byte lower
+ * than EFSP_LZSS_MATCHFLAG is followed by control + 1 literal bytes, otherwise the lower bits are the length of a
+ * match minus EFSP_LZSS_MINMATCH, and the next byte is the distance of the match minus one */
+#define EFSP_LZSS_MATCHFLAG                                             ( ( uint8_t ) 0x80u )
+#define EFSP_LZSS_MINMATCH                                              ( ( uint32_t ) 0x03u )
+#define EFSP_LZSS_MAXMATCH                                              ( ( uint32_t ) 0x82u )
+#define EFSP_LZSS_MAXLIT                                                ( ( uint32_t ) 0x80u )
+#define EFSP_LZSS_WINDOW                                                ( ( uint32_t ) 0x100u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_LZSS_RES_OK = 0,
+    e_eFSP_LZSS_RES_BADPARAM,
+    e_eFSP_LZSS_RES_BADPOINTER,
+    e_eFSP_LZSS_RES_OUTOFMEM,
+    e_eFSP_LZSS_RES_BADFRAME,
+    e_eFSP_LZSS_RES_NOGAIN
+}e_eFSP_LZSS_RES;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Compress p_puData in place. No memory other than the stack of the function is used: the matches are
+ *              searched in the last EFSP_LZSS_WINDOW bytes of data not yet overwritten by the compressed stream.
+ *              The data is compressed only if the stream is shorter than the data and never overwrite data that is
+ *              still needed, this is checked before writing anything, so the data is left untouched otherwise.
+ *
+ * @param[in]   p_puData        - Pointer to the data to compress, replaced by the compressed stream
+ * @param[in]   p_uDataL        - Number of bytes of data
+ * @param[out]  p_puCmpL        - Pointer to a uint32_t variable where the length of the compressed stream will be
+ *                                placed
+ *
+ * @return      e_eFSP_LZSS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_LZSS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_LZSS_RES_NOGAIN         - The data can not be compressed, it was left as it is
+ *              e_eFSP_LZSS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_LZSS_RES eFSP_LZSS_Compress(uint8_t* p_puData, const uint32_t p_uDataL, uint32_t* const p_puCmpL);
+
+/**
+ * @brief       Decompress in place a stream placed at the start of p_puArea. The tokens are moved at the end of the
+ *              memory area and the data is rebuilt from the start, so the memory area must contain the uncompressed
+ *              data, and some more bytes when the data compress better at the start than at the end. The stream is
+ *              fully checked before writing anything, so the memory area is left untouched in case of error.
+ *
+ * @param[in]   p_puArea        - Pointer to the memory area that contains the stream, replaced by the data
+ * @param[in]   p_uAreaL        - Dimension in byte of p_puArea
+ * @param[in]   p_uCmpL         - Number of bytes of the compressed stream
+ * @param[out]  p_puDecL        - Pointer to a uint32_t variable where the length of the data will be placed
+ *
+ * @return      e_eFSP_LZSS_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_LZSS_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_LZSS_RES_OUTOFMEM       - The memory area can not contain the data
+ *		        e_eFSP_LZSS_RES_BADFRAME       - The stream is malformed
+ *              e_eFSP_LZSS_RES_OK             - Operation ended correctly
+ */
+e_eFSP_LZSS_RES eFSP_LZSS_Decompress(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uCmpL,
+                                     uint32_t* const p_puDecL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_LZSS_H */
@@ -23,6 +23,11 @@ extern "C" {
  **********************************************************************************************************************/
 #include "eFSP_TYPE.h"
 #include "eCU_BUNSTF.h"
+#include "eFSP_COBS.h"
+#include "eFSP_TRSP.h"
+#include "eFSP_LZSS.h"
+#include "eFSP_DLT.h"
+#include "eFSP_FEC.h"
 
 
 
@@ -55,8 +60,23 @@ typedef enum
 typedef struct
 {
     t_eCU_BUNSTF_Ctx    tBUNSTFCtx;
+    t_eFSP_COBS_DecCtx  tCOBSCtx;
+    t_eFSP_TRSP_DecCtx  tTRSPCtx;
     f_eFSP_MSGD_CrcCb   fCrc;
     t_eFSP_MSGD_CrcCtx* ptCrcCtx;
+    uint32_t            uCrcL;
+    uint32_t            uLenL;
+    uint32_t            uFrm;
+    uint32_t            uWhtL;
+    uint32_t            uCmpL;
+    uint32_t            uDecL;
+    uint32_t            uDltL;
+    uint8_t*            puDltBase;
+    uint32_t            uDltBaseL;
+    uint32_t            uDltUseL;
+    uint8_t             uDltSeq;
+    uint32_t            uFecL;
+    uint32_t            uFecCutL;
 }t_eFSP_MSGD_Ctx;
 
 
@@ -65,7 +85,9 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the data decoder context
+ * @brief       Initialize the data decoder context. The header profile is EFSP_HDR_CRC32 and EFSP_HDR_LEN32, the
+ *              framing engine is EFSP_FRM_ESC, the whitening is EFSP_HDR_WHTNONE, the compression is
+ *              EFSP_HDR_CMPNONE, the delta frames are disabled and the forward error correction is EFSP_FEC_NONE
  *
  * @param[in]   p_ptCtx      - Msg decoder context
  * @param[in]   p_puBuff     - Pointer to a memory area that we will use to save decoded data
@@ -91,6 +113,120 @@ e_eFSP_MSGD_RES eFSP_MSGD_InitCtx(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puB
  */
 e_eFSP_MSGD_RES eFSP_MSGD_IsInit(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
+/**
+ * @brief       Select the header profile of the received messages, it must be the same of the encoder. Only the lower
+ *              p_uCrcL bytes of the CRC returned by the callback are checked, and no CRC is checked with
+ *              EFSP_HDR_CRCNONE. With EFSP_HDR_LENVAR the size of the header is known only when the last byte of the
+ *              varint length is received. Call this function before starting a new message, a message already in
+ *              progress is parsed with the new profile.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[in]   p_uCrcL         - EFSP_HDR_CRCNONE, EFSP_HDR_CRC16 or EFSP_HDR_CRC32
+ * @param[in]   p_uLenL         - EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32 or EFSP_HDR_LENVAR
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB      - Need to init the data decoder context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_SetHeader(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL);
+
+/**
+ * @brief       Select the framing engine of the received messages, it must be the same of the encoder. The message in
+ *              progress is discarded and a new one is started with the new engine. With EFSP_FRM_TRSP a bad frame,
+ *              even one with a wrong CRC, is never reported: the decoder search the next sync sequence in the data
+ *              already received, so a frame that starts inside the raw payload of a corrupted one is not lost.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[in]   p_uFrm          - EFSP_FRM_ESC, EFSP_FRM_COBS or EFSP_FRM_TRSP
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB      - Need to init the data decoder context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_SetFraming(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uFrm);
+
+/**
+ * @brief       Select the whitening of the received messages, it must be the same of the encoder. With EFSP_HDR_WHT
+ *              the header has a byte after the length with the XOR mask of the payload, and the payload is restored
+ *              in the memory area when the frame ends, before checking the CRC. Call this function before starting a
+ *              new message, a message already in progress is parsed with the new setting.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[in]   p_uWhtL         - EFSP_HDR_WHTNONE or EFSP_HDR_WHT
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB      - Need to init the data decoder context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_SetWhitening(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uWhtL);
+
+/**
+ * @brief       Select the compression of the received messages, it must be the same of the encoder. With EFSP_HDR_CMP
+ *              the header has a byte after the mask that tell if the payload is compressed. A compressed payload is
+ *              decompressed in place when the frame ends with a correct CRC, eFSP_MSGD_GetDecodedData and
+ *              eFSP_MSGD_GetDecodedLen return the decompressed payload, and eFSP_MSGD_GetDeclaredLen the received one.
+ *              The payload is rebuilt from the start of the payload area, so the memory area must contain the header,
+ *              the decompressed payload and a few more bytes when the payload compress better at its start: a payload
+ *              that can not be decompressed is a bad frame. Call this function before starting a new message.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[in]   p_uCmpL         - EFSP_HDR_CMPNONE or EFSP_HDR_CMP
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB      - Need to init the data decoder context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_SetCompression(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uCmpL);
+
+/**
+ * @brief       Enable the delta frames, the encoder must enable them too. The header has two bytes after the
+ *              compression flag with the kind of frame and the sequence number of the key frame. A key frame is copied
+ *              in p_puBase when it fits, a difference is rebuilt in place from the last key frame when the frame ends
+ *              with a correct CRC, after the decompression, and eFSP_MSGD_GetDecodedData and eFSP_MSGD_GetDecodedLen
+ *              return the rebuilt payload. A difference from a key frame that was not received, because it was lost or
+ *              too big for p_puBase, is a bad frame: the encoder send a new key frame after some differences, or can
+ *              be asked to send it with eFSP_MSGE_ResetDelta. The memory area must contain the header and the rebuilt
+ *              payload. Call this function before starting a new message.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[in]   p_puBase        - Pointer to a memory area where the last key frame will be kept
+ * @param[in]   p_uBaseL        - Dimension in byte of p_puBase
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB      - Need to init the data decoder context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_SetDelta(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL);
+
+/**
+ * @brief       Select the forward error correction, the encoder must use the same setting. When the frame ends the
+ *              errors are corrected in place, up to p_uFecL / 2 wrong bytes for every block of EFSP_FEC_BLOCKL bytes of
+ *              the message, and the parity is dropped before removing the whitening and checking the CRC. A frame that
+ *              can not be corrected is a bad frame. The header can be wrong till the frame ends, so the length is not
+ *              used to discard the frame while it is received. The memory area must contain the parity too. Call this
+ *              function before starting a new message.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[in]   p_uFecL         - EFSP_FEC_NONE, EFSP_FEC_RS4, EFSP_FEC_RS8 or EFSP_FEC_RS16
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB      - Need to init the data decoder context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_SetFec(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uFecL);
+
 /**
  * @brief       Start receiving a new message, loosing the previous stored decoded msg frame. Clear even error state
  *
@@ -137,6 +273,24 @@ e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedData(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t
  */
 e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint32_t* const p_puRetrivedL);
 
+/**
+ * @brief       Retrive the payload size declared in the header of the frame under decoding. The value is available
+ *              as soon as the whole header is received, so the caller can know how much data is still on the way
+ *              before the end of the frame. The declared size is not verified until the whole frame is received.
+ *
+ * @param[in]   p_ptCtx         - Msg decoder context
+ * @param[out]  p_pbIsKnown     - Pointer to a bool_t variable that will be filled with true if the header is received
+ * @param[out]  p_puDeclaredL   - Pointer to a uint32_t variable where the declared payload size will be placed, zero
+ *                                if the header is not received yet
+ *
+ * @return      e_eFSP_MSGD_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGD_RES_NOINITLIB    	- Need to init context before taking some action
+ *		        e_eFSP_MSGD_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGD_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGD_RES eFSP_MSGD_GetDeclaredLen(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsKnown,
+                                         uint32_t* const p_puDeclaredL);
+
 /**
  * @brief       Retrive if the MsgDecoder is currently waiting for the Start of frame.
  *
@@ -237,14 +391,16 @@ e_eFSP_MSGD_RES eFSP_MSGD_GetMostEffDatLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint3
  *                                             situation clear old data and restart the frame, witouth the need to call
  *                                             any other function. In this situation bear in mind that some data could
  *                                             be left out the parsing and so we need to reparse that data with another
- *                                             call of eFSP_MSGD_InsEncChunk.
+ *                                             call of eFSP_MSGD_InsEncChunk. With EFSP_FRM_TRSP this is returned even
+ *                                             when the frame is bad: the data already received is searched for the
+ *                                             next sync sequence, and the decoding continue from there.
  *				e_eFSP_MSGD_RES_CRCCLBKERROR - The crc callback returned an error when the decoder were verifing CRC
  *              e_eFSP_MSGD_RES_OK           - Operation ended correctly. The chunk is parsed correclty but the frame is
  *                                             not finished yet. In this situation p_puUsedEncB is always reported with
  *                                             a value equals to p_uEncL.
  */
-e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puEncArea, const uint32_t p_uEncL,
-                                      uint32_t* const p_puUsedEncB);
+e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t* p_puEncArea,
+                                      const uint32_t p_uEncL, uint32_t* const p_puUsedEncB);
 
 #ifdef __cplusplus
 } /* extern "C" */
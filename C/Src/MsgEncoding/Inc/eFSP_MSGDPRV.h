@@ -34,6 +34,7 @@ typedef enum
     e_eFSP_MSGDPRV_SM_INSERTCHUNK,
     e_eFSP_MSGDPRV_SM_ENDCHECK,
     e_eFSP_MSGDPRV_SM_OKCHECK,
+    e_eFSP_MSGDPRV_SM_RESYNC,
     e_eFSP_MSGDPRV_SM_ELABDONE
 }e_eFSP_MSGDPRV_SM;
 
@@ -23,6 +23,11 @@ extern "C" {
  **********************************************************************************************************************/
 #include "eFSP_TYPE.h"
 #include "eCU_BSTF.h"
+#include "eFSP_COBS.h"
+#include "eFSP_TRSP.h"
+#include "eFSP_LZSS.h"
+#include "eFSP_DLT.h"
+#include "eFSP_FEC.h"
 
 
 
@@ -53,8 +58,24 @@ typedef enum
 typedef struct
 {
     t_eCU_BSTF_Ctx      tBSTFCtx;
+    t_eFSP_COBS_EncCtx  tCOBSCtx;
+    t_eFSP_TRSP_EncCtx  tTRSPCtx;
     f_eFSP_MSGE_CrcCb   fCrc;
     t_eFSP_MSGE_CrcCtx* ptCrcCtx;
+    uint32_t            uCrcL;
+    uint32_t            uLenL;
+    uint32_t            uFrm;
+    uint32_t            uWhtL;
+    uint32_t            uCmpL;
+    uint32_t            uDltL;
+    uint8_t*            puDltBase;
+    uint32_t            uDltBaseL;
+    uint32_t            uDltUseL;
+    uint32_t            uDltKeyN;
+    uint32_t            uDltN;
+    uint8_t             uDltSeq;
+    uint32_t            uFecL;
+    bool_t              bPayLost;
 }t_eFSP_MSGE_Ctx;
 
 
@@ -63,7 +84,9 @@ typedef struct
  * GLOBAL PROTOTYPES
  **********************************************************************************************************************/
 /**
- * @brief       Initialize the message encoder context
+ * @brief       Initialize the message encoder context. The header profile is EFSP_HDR_CRC32 and EFSP_HDR_LEN32, the
+ *              framing engine is EFSP_FRM_ESC, the whitening is EFSP_HDR_WHTNONE, the compression is
+ *              EFSP_HDR_CMPNONE, the delta frames are disabled and the forward error correction is EFSP_FEC_NONE
  *
  * @param[in]   p_ptCtx    - Message Encoder context
  * @param[in]   p_puBuff   - Pointer to a memory area that we will use to encode message
@@ -89,6 +112,154 @@ e_eFSP_MSGE_RES eFSP_MSGE_InitCtx(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p_puB
  */
 e_eFSP_MSGE_RES eFSP_MSGE_IsInit(t_eFSP_MSGE_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
 
+/**
+ * @brief       Select the header profile of the next messages. The CRC is stored on p_uCrcL bytes, a CRC16 callback
+ *              can be used with EFSP_HDR_CRC16 because only the lower bytes of the CRC are stored, and EFSP_HDR_CRCNONE
+ *              drop the CRC for links that are already protected. The payload length is stored on p_uLenL bytes, and
+ *              limit the size of the payload. With EFSP_HDR_LENVAR the length is a varint as short as the length
+ *              allow: the payload is copied after EFSP_HDR_LENVARMAX bytes and eFSP_MSGE_NewMessage move it near the
+ *              header, so it must be copied again before every new message. Call this function before copying the
+ *              payload of the next message, the position returned by eFSP_MSGE_GetWherePutData depends on the header.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ * @param[in]   p_uCrcL         - EFSP_HDR_CRCNONE, EFSP_HDR_CRC16 or EFSP_HDR_CRC32
+ * @param[in]   p_uLenL         - EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32 or EFSP_HDR_LENVAR
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function, or if the
+ *                                               buffer can not contain the header and some payload
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_SetHeader(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL);
+
+/**
+ * @brief       Select the framing engine of the next messages. With EFSP_FRM_ESC every SOF, EOF and ESC byte of the
+ *              frame is escaped, so a frame can double its size. With EFSP_FRM_COBS the frame is delimited by zeros
+ *              and encoded with Consistent Overhead Byte Stuffing, so a frame of N bytes is never bigger than
+ *              N + 2 + ( N / EFSP_COBS_MAXBLOCK ) + 1 bytes. With EFSP_FRM_TRSP only the header is escaped, and
+ *              the payload follows it as it is, so the overhead is the sync sequence and the escaped bytes of the
+ *              header. The payload is copied in the same place with every engine.
+ *              Call this function before eFSP_MSGE_NewMessage, a message already started is not sent again.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ * @param[in]   p_uFrm          - EFSP_FRM_ESC, EFSP_FRM_COBS or EFSP_FRM_TRSP
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_SetFraming(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uFrm);
+
+/**
+ * @brief       Enable the whitening of the next messages. With EFSP_HDR_WHT the encoder XOR the payload with the mask,
+ *              from a small set, that leave the lowest number of bytes that the framing engine must escape, and store
+ *              the mask in a byte of the header after the length. Payloads full of SOF, EOF and ESC bytes are sent
+ *              with EFSP_FRM_ESC without expansion at the cost of one byte of header. EFSP_FRM_COBS and EFSP_FRM_TRSP
+ *              do not expand any byte of the payload, so the mask is always zero. The decoder must use the same
+ *              setting.
+ *              The payload is whitened in the memory area, so it must be copied again before every new message, and
+ *              this function must be called before copying it, the position of the payload depends on the header.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ * @param[in]   p_uWhtL         - EFSP_HDR_WHTNONE or EFSP_HDR_WHT
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function, or if the
+ *                                               buffer can not contain the header and some payload
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_SetWhitening(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uWhtL);
+
+/**
+ * @brief       Enable the compression of the next messages. With EFSP_HDR_CMP the encoder compress the payload in
+ *              place with LZSS, using a window of EFSP_LZSS_WINDOW bytes and no memory other than the stack, and
+ *              store in a byte of the header after the mask if the payload is compressed. The payload is sent as it is
+ *              when the compression does not make it shorter. The length in the header is the one of the sent
+ *              payload, the CRC is calculated on it and the whitening is applied on it. The decoder must use the same
+ *              setting.
+ *              The payload is compressed in the memory area, so it must be copied again before every new message, and
+ *              this function must be called before copying it, the position of the payload depends on the header.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ * @param[in]   p_uCmpL         - EFSP_HDR_CMPNONE or EFSP_HDR_CMP
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function, or if the
+ *                                               buffer can not contain the header and some payload
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_SetCompression(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uCmpL);
+
+/**
+ * @brief       Enable the delta frames for the next messages. A key frame, sent as it is, is copied in p_puBase when
+ *              it fits, and the next messages of the same length are sent as the difference from it, encoded in place
+ *              with eFSP_DLT, when it is shorter. After p_uKeyN differences, or when the difference is not shorter, a
+ *              new key frame is sent. Two bytes of the header after the compression flag store the kind of frame and
+ *              the sequence number of the key frame, so the decoder can discard a difference from a key frame that
+ *              it lost. The difference is compressed, when enabled, and the length, the CRC and the whitening refer to
+ *              the sent payload. The decoder must enable the delta frames too.
+ *              The payload is encoded in the memory area, so it must be copied again before every new message, and
+ *              this function must be called before copying it, the position of the payload depends on the header.
+ *              The base and the sequence are updated only after the CRC of the message, so a message that fails on
+ *              the CRC does not change them. The delta frames can be disabled only initializing again the context.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ * @param[in]   p_puBase        - Pointer to a memory area where the last key frame will be kept
+ * @param[in]   p_uBaseL        - Dimension in byte of p_puBase, bigger messages are always key frames
+ * @param[in]   p_uKeyN         - Maximum number of differences sent after a key frame
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function, or if the
+ *                                               buffer can not contain the header and some payload
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_SetDelta(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL,
+                                   const uint32_t p_uKeyN);
+
+/**
+ * @brief       Send the next message as a key frame, for example when the receiver reported that it lost the last
+ *              one. Nothing is done when the delta frames are not enabled.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_ResetDelta(t_eFSP_MSGE_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Select the forward error correction of the next messages. The whole message, header included, is split
+ *              in blocks of EFSP_FEC_BLOCKL bytes and p_uFecL Reed-Solomon parity bytes for every block are appended
+ *              to it, after the whitening, so the decoder can correct up to p_uFecL / 2 wrong bytes for every block
+ *              before checking the CRC. The blocks are interleaved, so a burst of errors is spread on all of them.
+ *              The bytes added by the framing engine are not protected. The parity is placed in the same buffer, so
+ *              the maximum payload returned by eFSP_MSGE_GetWherePutData get smaller. The decoder must use the same
+ *              setting.
+ *
+ * @param[in]   p_ptCtx         - Message Encoder context
+ * @param[in]   p_uFecL         - EFSP_FEC_NONE, EFSP_FEC_RS4, EFSP_FEC_RS8 or EFSP_FEC_RS16
+ *
+ * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function, or if the
+ *                                               buffer can not contain the header, some payload and the parity
+ *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGE_RES eFSP_MSGE_SetFec(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uFecL);
+
 /**
  * @brief       Retrive the pointer of the buffer that the user can use to insert data payload that need to be encoded
  *
@@ -114,10 +285,15 @@ e_eFSP_MSGE_RES eFSP_MSGE_GetWherePutData(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_
  *                             raw data )
  *
  * @return      e_eFSP_MSGE_RES_BADPOINTER     - In case of bad pointer passed to the function
- *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGE_RES_BADPARAM       - In case of an invalid parameter passed to the function, or if the
+ *                                               length does not fit the length field of the header profile
  *		        e_eFSP_MSGE_RES_NOINITLIB      - Need to init the data encoder context before taking some action
  *		        e_eFSP_MSGE_RES_CORRUPTCTX     - In case of an corrupted context
- *				e_eFSP_MSGE_RES_CRCCLBKERROR   - The crc callback function returned an error
+ *		        e_eFSP_MSGE_RES_NOINITMESSAGE  - The payload was compressed by a message that failed on the CRC, it
+ *                                               must be copied again after calling eFSP_MSGE_GetWherePutData
+ *				e_eFSP_MSGE_RES_CRCCLBKERROR   - The crc callback function returned an error. If the payload was
+ *                                               already compressed in place it is lost, and the message can not be
+ *                                               started until the payload is copied again
  *              e_eFSP_MSGE_RES_OK             - Operation ended correctly
  */
 e_eFSP_MSGE_RES eFSP_MSGE_NewMessage(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uMsgLen);
@@ -0,0 +1,315 @@
+/**
+ * @file       eFSP_TRSP.h
+ *
+ * @brief      Length delimited transparent framing, only the header is escaped
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_TRSP_H
+#define EFSP_TRSP_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Every frame starts with the sync sequence. EFSP_TRSP_SYNC1 never appear inside an encoded header, but it can appear
+ * in the raw part of the frame */
+#define EFSP_TRSP_SYNC1                                                 ( ( uint8_t ) 0xC3u )
+#define EFSP_TRSP_SYNC2                                                 ( ( uint8_t ) 0x5Au )
+#define EFSP_TRSP_SYNCL                                                 ( 2u )
+
+/* EFSP_TRSP_SYNC1 and EFSP_TRSP_ESC inside the header are sent as EFSP_TRSP_ESC and the byte xor EFSP_TRSP_ESCXOR */
+#define EFSP_TRSP_ESC                                                   ( ( uint8_t ) 0xB4u )
+#define EFSP_TRSP_ESCXOR                                                ( ( uint8_t ) 0x20u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_TRSP_RES_OK = 0,
+    e_eFSP_TRSP_RES_BADPARAM,
+    e_eFSP_TRSP_RES_BADPOINTER,
+	e_eFSP_TRSP_RES_CORRUPTCTX,
+    e_eFSP_TRSP_RES_OUTOFMEM,
+    e_eFSP_TRSP_RES_BADFRAME,
+    e_eFSP_TRSP_RES_FRAMEENDED,
+    e_eFSP_TRSP_RES_FRAMERESTART,
+    e_eFSP_TRSP_RES_NEEDLEN,
+    e_eFSP_TRSP_RES_NOINITLIB,
+    e_eFSP_TRSP_RES_NOINITFRAME
+}e_eFSP_TRSP_RES;
+
+typedef enum
+{
+    e_eFSP_TRSP_ENCSM_NOFRAME = 0,
+    e_eFSP_TRSP_ENCSM_SYNC1,
+    e_eFSP_TRSP_ENCSM_SYNC2,
+    e_eFSP_TRSP_ENCSM_HDR,
+    e_eFSP_TRSP_ENCSM_RAW,
+    e_eFSP_TRSP_ENCSM_ENDED
+}e_eFSP_TRSP_ENCSM;
+
+typedef enum
+{
+    e_eFSP_TRSP_DECSM_WAITSYNC1 = 0,
+    e_eFSP_TRSP_DECSM_WAITSYNC2,
+    e_eFSP_TRSP_DECSM_HDR,
+    e_eFSP_TRSP_DECSM_NEEDLEN,
+    e_eFSP_TRSP_DECSM_RAW,
+    e_eFSP_TRSP_DECSM_ENDED,
+    e_eFSP_TRSP_DECSM_BAD
+}e_eFSP_TRSP_DECSM;
+
+typedef struct
+{
+    bool_t            bIsInit;
+	uint8_t*          puBuff;
+	uint32_t          uBuffL;
+    uint32_t          uFrameL;
+    uint32_t          uHdrL;
+    uint32_t          uFrameEncL;
+    uint32_t          uCntr;
+    uint32_t          uSentL;
+    bool_t            bEsc;
+    e_eFSP_TRSP_ENCSM eSt;
+}t_eFSP_TRSP_EncCtx;
+
+typedef struct
+{
+    bool_t            bIsInit;
+	uint8_t*          puBuff;
+	uint32_t          uBuffL;
+    uint32_t          uCntr;
+    uint32_t          uHdrL;
+    uint32_t          uRawL;
+    bool_t            bEsc;
+    e_eFSP_TRSP_DECSM eSt;
+}t_eFSP_TRSP_DecCtx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the encoder context. The frame to encode is placed by the user in p_puBuff. Only the header
+ *              of the frame is escaped, the rest is copied as it is, so the overhead is the sync sequence plus the
+ *              escaped bytes of the header.
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[in]   p_puBuff        - Pointer to the memory area that contains the frame to encode
+ * @param[in]   p_uBuffL        - Dimension in byte of p_puBuff
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_InitEncCtx(t_eFSP_TRSP_EncCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL);
+
+/**
+ * @brief       Start the encoding of a frame of p_uFrameL bytes placed at the start of the memory area, the first
+ *              p_uHdrL bytes are the header
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[in]   p_uFrameL       - Size of the frame, not zero and not bigger than the memory area
+ * @param[in]   p_uHdrL         - Size of the header, not bigger than the frame
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_NewEncFrame(t_eFSP_TRSP_EncCtx* const p_ptCtx, const uint32_t p_uFrameL,
+                                      const uint32_t p_uHdrL);
+
+/**
+ * @brief       Restart the encoding of the current frame from the sync sequence
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_TRSP_RES_NOINITFRAME    - No frame to restart
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_RestartEncFrame(t_eFSP_TRSP_EncCtx* const p_ptCtx);
+
+/**
+ * @brief       Retrive the number of encoded bytes still to get, sync sequence included
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[out]  p_puRemL        - Pointer to a uint32_t variable where the number of bytes will be placed
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_TRSP_RES_NOINITFRAME    - No frame started
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_GetEncRemL(t_eFSP_TRSP_EncCtx* const p_ptCtx, uint32_t* const p_puRemL);
+
+/**
+ * @brief       Retrive the next chunk of the encoded frame, the raw part is copied with a single memcpy
+ *
+ * @param[in]   p_ptCtx         - Encoder context
+ * @param[out]  p_puEncBuff     - Pointer to the buffer where the encoded chunk will be placed
+ * @param[in]   p_uMaxBufL      - Size of p_puEncBuff
+ * @param[out]  p_puGettedL     - Pointer to a uint32_t variable where the size of the chunk will be placed
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_TRSP_RES_NOINITFRAME    - No frame started
+ *		        e_eFSP_TRSP_RES_FRAMEENDED     - The last byte of the frame has been retrived
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly, more bytes to retrive
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_GetEncChunk(t_eFSP_TRSP_EncCtx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                      const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL);
+
+/**
+ * @brief       Initialize the decoder context. The decoded frame is stored in p_puBuff.
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[in]   p_puBuff        - Pointer to the memory area where the decoded frame will be placed
+ * @param[in]   p_uBuffL        - Dimension in byte of p_puBuff
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_InitDecCtx(t_eFSP_TRSP_DecCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL);
+
+/**
+ * @brief       Discard the current frame and wait the sync sequence of a new one. The data in the memory area is
+ *              not modified, so it can be inserted again in order to search a sync sequence inside it.
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_NewDecFrame(t_eFSP_TRSP_DecCtx* const p_ptCtx);
+
+/**
+ * @brief       Retrive the bytes decoded till now
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the location of the decoded bytes will be placed
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the number of decoded bytes will be placed
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_GetDecData(t_eFSP_TRSP_DecCtx* const p_ptCtx, uint8_t** p_ppuData,
+                                     uint32_t* const p_puDataL);
+
+/**
+ * @brief       Retrive the state of the decoder
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[out]  p_pbWaitSync    - Filled with true if the decoder is still waiting the sync sequence
+ * @param[out]  p_pbEnded       - Filled with true if a full frame is decoded
+ * @param[out]  p_pbBad         - Filled with true if the frame is bad
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_GetDecState(t_eFSP_TRSP_DecCtx* const p_ptCtx, bool_t* const p_pbWaitSync,
+                                      bool_t* const p_pbEnded, bool_t* const p_pbBad);
+
+/**
+ * @brief       Continue the decoding of a header longer than the part received, call this function after
+ *              eFSP_TRSP_InsEncChunk returned e_eFSP_TRSP_RES_NEEDLEN
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[in]   p_uHdrL         - Size of the header, bigger than the bytes decoded till now
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - Not waiting the length, or p_uHdrL is already decoded
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_TRSP_RES_OUTOFMEM       - The memory area can not contain the header, the frame is bad
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_SetDecHdrL(t_eFSP_TRSP_DecCtx* const p_ptCtx, const uint32_t p_uHdrL);
+
+/**
+ * @brief       The header is complete, set the number of raw bytes that follow it. Call this function after
+ *              eFSP_TRSP_InsEncChunk returned e_eFSP_TRSP_RES_NEEDLEN
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[in]   p_uRawL         - Number of raw bytes after the header
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - Not waiting the length
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_TRSP_RES_OUTOFMEM       - The memory area can not contain the frame, the frame is bad
+ *		        e_eFSP_TRSP_RES_FRAMEENDED     - No raw bytes, the frame is ended
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_SetDecRawL(t_eFSP_TRSP_DecCtx* const p_ptCtx, const uint32_t p_uRawL);
+
+/**
+ * @brief       Decode a chunk of an encoded frame. Bytes before the sync sequence are discarded, and a sync
+ *              inside the header discard the data received and start a new frame. Bytes of the raw part are copied
+ *              with a single memmove, so p_puEncBuff can be the memory area of the decoder itself, placed after the
+ *              decoded bytes.
+ *
+ * @param[in]   p_ptCtx         - Decoder context
+ * @param[in]   p_puEncBuff     - Pointer to the encoded chunk
+ * @param[in]   p_uEncL         - Size of the encoded chunk
+ * @param[out]  p_puUsedL       - Pointer to a uint32_t variable where the number of used bytes will be placed
+ *
+ * @return      e_eFSP_TRSP_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TRSP_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_TRSP_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TRSP_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_TRSP_RES_BADFRAME       - Bad frame, call eFSP_TRSP_NewDecFrame
+ *		        e_eFSP_TRSP_RES_NEEDLEN        - The header is decoded, call eFSP_TRSP_SetDecHdrL or
+ *                                               eFSP_TRSP_SetDecRawL before inserting the remaining bytes
+ *		        e_eFSP_TRSP_RES_FRAMERESTART   - A new frame started, the previous one was not complete
+ *		        e_eFSP_TRSP_RES_FRAMEENDED     - Frame ended, the bytes after it are not used
+ *              e_eFSP_TRSP_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TRSP_RES eFSP_TRSP_InsEncChunk(t_eFSP_TRSP_DecCtx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                      const uint32_t p_uEncL, uint32_t* const p_puUsedL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_TRSP_H */
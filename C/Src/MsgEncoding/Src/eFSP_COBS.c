@@ -0,0 +1,692 @@
+/**
+ * @file       eFSP_COBS.c
+ *
+ * @brief      Consistent Overhead Byte Stuffing encoder and decoder
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_COBS.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_COBS_IsEncStillCoherent(const t_eFSP_COBS_EncCtx* p_ptCtx);
+static e_eFSP_COBS_RES eFSP_COBS_CheckEncCtx(const t_eFSP_COBS_EncCtx* p_ptCtx);
+static bool_t eFSP_COBS_IsDecStillCoherent(const t_eFSP_COBS_DecCtx* p_ptCtx);
+static e_eFSP_COBS_RES eFSP_COBS_CheckDecCtx(const t_eFSP_COBS_DecCtx* p_ptCtx);
+static uint32_t eFSP_COBS_GetBlkL(const uint8_t* p_puData, const uint32_t p_uStart, const uint32_t p_uEnd);
+static uint32_t eFSP_COBS_GetEncL(const uint8_t* p_puData, const uint32_t p_uDataL);
+static void eFSP_COBS_EndEncBlk(t_eFSP_COBS_EncCtx* const p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_COBS_RES eFSP_COBS_InitEncCtx(t_eFSP_COBS_EncCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uBuffL < 1u )
+        {
+            l_eRes = e_eFSP_COBS_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uFrameL = 0u;
+            p_ptCtx->uFrameEncL = 0u;
+            p_ptCtx->uCntr = 0u;
+            p_ptCtx->uBlkL = 0u;
+            p_ptCtx->uSentL = 0u;
+            p_ptCtx->bZero = false;
+            p_ptCtx->eSt = e_eFSP_COBS_ENCSM_NOFRAME;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_COBS_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_NewEncFrame(t_eFSP_COBS_EncCtx* const p_ptCtx, const uint32_t p_uFrameL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            if( ( p_uFrameL < 1u ) || ( p_uFrameL > p_ptCtx->uBuffL ) )
+            {
+                l_eRes = e_eFSP_COBS_RES_BADPARAM;
+            }
+            else
+            {
+                /* The size of the encoded frame is known now, so the remaining bytes are a simple difference */
+                p_ptCtx->uFrameL = p_uFrameL;
+                p_ptCtx->uFrameEncL = eFSP_COBS_GetEncL(p_ptCtx->puBuff, p_uFrameL);
+                p_ptCtx->uCntr = 0u;
+                p_ptCtx->uBlkL = 0u;
+                p_ptCtx->uSentL = 0u;
+                p_ptCtx->bZero = false;
+                p_ptCtx->eSt = e_eFSP_COBS_ENCSM_SOF;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_RestartEncFrame(t_eFSP_COBS_EncCtx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            if( e_eFSP_COBS_ENCSM_NOFRAME == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_COBS_RES_NOINITFRAME;
+            }
+            else
+            {
+                p_ptCtx->uCntr = 0u;
+                p_ptCtx->uBlkL = 0u;
+                p_ptCtx->uSentL = 0u;
+                p_ptCtx->bZero = false;
+                p_ptCtx->eSt = e_eFSP_COBS_ENCSM_SOF;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_GetEncRemL(t_eFSP_COBS_EncCtx* const p_ptCtx, uint32_t* const p_puRemL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRemL ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            if( e_eFSP_COBS_ENCSM_NOFRAME == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_COBS_RES_NOINITFRAME;
+            }
+            else
+            {
+                *p_puRemL = p_ptCtx->uFrameEncL - p_ptCtx->uSentL;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_GetEncChunk(t_eFSP_COBS_EncCtx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                      const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+    uint32_t l_uFilledL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puEncBuff ) || ( NULL == p_puGettedL ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            if( p_uMaxBufL < 1u )
+            {
+                l_eRes = e_eFSP_COBS_RES_BADPARAM;
+            }
+            else if( e_eFSP_COBS_ENCSM_NOFRAME == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_COBS_RES_NOINITFRAME;
+            }
+            else
+            {
+                l_uFilledL = 0u;
+
+                while( ( l_uFilledL < p_uMaxBufL ) && ( e_eFSP_COBS_ENCSM_ENDED != p_ptCtx->eSt ) )
+                {
+                    switch( p_ptCtx->eSt )
+                    {
+                        case e_eFSP_COBS_ENCSM_SOF:
+                        {
+                            p_puEncBuff[l_uFilledL] = EFSP_COBS_DELIM;
+                            p_ptCtx->eSt = e_eFSP_COBS_ENCSM_CODE;
+                            break;
+                        }
+
+                        case e_eFSP_COBS_ENCSM_CODE:
+                        {
+                            /* A block shorter than the maximum one is followed by a zero, unless the frame ends */
+                            p_ptCtx->uBlkL = eFSP_COBS_GetBlkL(p_ptCtx->puBuff, p_ptCtx->uCntr, p_ptCtx->uFrameL);
+                            p_ptCtx->bZero = ( ( p_ptCtx->uBlkL < EFSP_COBS_MAXBLOCK ) &&
+                                               ( ( p_ptCtx->uCntr + p_ptCtx->uBlkL ) < p_ptCtx->uFrameL ) );
+                            p_puEncBuff[l_uFilledL] = (uint8_t)( p_ptCtx->uBlkL + 1u );
+
+                            if( 0u == p_ptCtx->uBlkL )
+                            {
+                                eFSP_COBS_EndEncBlk(p_ptCtx);
+                            }
+                            else
+                            {
+                                p_ptCtx->eSt = e_eFSP_COBS_ENCSM_DATA;
+                            }
+                            break;
+                        }
+
+                        case e_eFSP_COBS_ENCSM_DATA:
+                        {
+                            p_puEncBuff[l_uFilledL] = p_ptCtx->puBuff[p_ptCtx->uCntr];
+                            p_ptCtx->uCntr++;
+                            p_ptCtx->uBlkL--;
+
+                            if( 0u == p_ptCtx->uBlkL )
+                            {
+                                eFSP_COBS_EndEncBlk(p_ptCtx);
+                            }
+                            break;
+                        }
+
+                        default:
+                        {
+                            /* Only the end delimiter is left */
+                            p_puEncBuff[l_uFilledL] = EFSP_COBS_DELIM;
+                            p_ptCtx->eSt = e_eFSP_COBS_ENCSM_ENDED;
+                            break;
+                        }
+                    }
+
+                    l_uFilledL++;
+                }
+
+                p_ptCtx->uSentL += l_uFilledL;
+                *p_puGettedL = l_uFilledL;
+
+                if( e_eFSP_COBS_ENCSM_ENDED == p_ptCtx->eSt )
+                {
+                    l_eRes = e_eFSP_COBS_RES_FRAMEENDED;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_InitDecCtx(t_eFSP_COBS_DecCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uBuffL < 1u )
+        {
+            l_eRes = e_eFSP_COBS_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uCntr = 0u;
+            p_ptCtx->uBlkL = 0u;
+            p_ptCtx->bZero = false;
+            p_ptCtx->bCode = false;
+            p_ptCtx->eSt = e_eFSP_COBS_DECSM_WAITSOF;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_COBS_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_NewDecFrame(t_eFSP_COBS_DecCtx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            p_ptCtx->uCntr = 0u;
+            p_ptCtx->uBlkL = 0u;
+            p_ptCtx->bZero = false;
+            p_ptCtx->bCode = false;
+            p_ptCtx->eSt = e_eFSP_COBS_DECSM_WAITSOF;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_GetDecData(t_eFSP_COBS_DecCtx* const p_ptCtx, uint8_t** p_ppuData,
+                                     uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            *p_ppuData = p_ptCtx->puBuff;
+            *p_puDataL = p_ptCtx->uCntr;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_GetDecState(t_eFSP_COBS_DecCtx* const p_ptCtx, bool_t* const p_pbWaitSof,
+                                      bool_t* const p_pbEnded, bool_t* const p_pbBad)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbWaitSof ) || ( NULL == p_pbEnded ) || ( NULL == p_pbBad ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            *p_pbWaitSof = ( e_eFSP_COBS_DECSM_WAITSOF == p_ptCtx->eSt );
+            *p_pbEnded = ( e_eFSP_COBS_DECSM_ENDED == p_ptCtx->eSt );
+            *p_pbBad = ( e_eFSP_COBS_DECSM_BAD == p_ptCtx->eSt );
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_COBS_RES eFSP_COBS_InsEncChunk(t_eFSP_COBS_DecCtx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                      const uint32_t p_uEncL, uint32_t* const p_puUsedL)
+{
+	/* Local variable */
+	e_eFSP_COBS_RES l_eRes;
+    uint32_t l_uUsedL;
+    uint8_t l_uByte;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puEncBuff ) || ( NULL == p_puUsedL ) )
+	{
+		l_eRes = e_eFSP_COBS_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_COBS_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_COBS_RES_OK == l_eRes )
+        {
+            *p_puUsedL = 0u;
+
+            if( p_uEncL < 1u )
+            {
+                l_eRes = e_eFSP_COBS_RES_BADPARAM;
+            }
+            else if( e_eFSP_COBS_DECSM_ENDED == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_COBS_RES_FRAMEENDED;
+            }
+            else if( e_eFSP_COBS_DECSM_BAD == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_COBS_RES_BADFRAME;
+            }
+            else
+            {
+                l_uUsedL = 0u;
+
+                while( ( l_uUsedL < p_uEncL ) && ( e_eFSP_COBS_RES_OK == l_eRes ) )
+                {
+                    l_uByte = p_puEncBuff[l_uUsedL];
+
+                    if( e_eFSP_COBS_DECSM_WAITSOF == p_ptCtx->eSt )
+                    {
+                        /* Discard everything till the first delimiter */
+                        l_uUsedL++;
+
+                        if( EFSP_COBS_DELIM == l_uByte )
+                        {
+                            p_ptCtx->eSt = e_eFSP_COBS_DECSM_CODE;
+                        }
+                    }
+                    else if( e_eFSP_COBS_DECSM_DATA == p_ptCtx->eSt )
+                    {
+                        if( EFSP_COBS_DELIM == l_uByte )
+                        {
+                            /* Truncated block, the delimiter is the start of a new frame */
+                            l_uUsedL++;
+                            p_ptCtx->uCntr = 0u;
+                            p_ptCtx->uBlkL = 0u;
+                            p_ptCtx->bZero = false;
+                            p_ptCtx->bCode = false;
+                            p_ptCtx->eSt = e_eFSP_COBS_DECSM_CODE;
+                            l_eRes = e_eFSP_COBS_RES_FRAMERESTART;
+                        }
+                        else if( p_ptCtx->uCntr >= p_ptCtx->uBuffL )
+                        {
+                            l_eRes = e_eFSP_COBS_RES_OUTOFMEM;
+                        }
+                        else
+                        {
+                            l_uUsedL++;
+                            p_ptCtx->puBuff[p_ptCtx->uCntr] = l_uByte;
+                            p_ptCtx->uCntr++;
+                            p_ptCtx->uBlkL--;
+
+                            if( 0u == p_ptCtx->uBlkL )
+                            {
+                                p_ptCtx->eSt = e_eFSP_COBS_DECSM_CODE;
+                            }
+                        }
+                    }
+                    else if( EFSP_COBS_DELIM == l_uByte )
+                    {
+                        /* Delimiter in place of a code byte */
+                        l_uUsedL++;
+
+                        if( true == p_ptCtx->bCode )
+                        {
+                            if( 0u == p_ptCtx->uCntr )
+                            {
+                                p_ptCtx->eSt = e_eFSP_COBS_DECSM_BAD;
+                                l_eRes = e_eFSP_COBS_RES_BADFRAME;
+                            }
+                            else
+                            {
+                                /* The zero after the last block is not part of the frame */
+                                p_ptCtx->eSt = e_eFSP_COBS_DECSM_ENDED;
+                                l_eRes = e_eFSP_COBS_RES_FRAMEENDED;
+                            }
+                        }
+                    }
+                    else if( ( true == p_ptCtx->bZero ) && ( p_ptCtx->uCntr >= p_ptCtx->uBuffL ) )
+                    {
+                        l_eRes = e_eFSP_COBS_RES_OUTOFMEM;
+                    }
+                    else
+                    {
+                        /* New code byte, the previous block was followed by a zero if it was not a maximum one */
+                        l_uUsedL++;
+
+                        if( true == p_ptCtx->bZero )
+                        {
+                            p_ptCtx->puBuff[p_ptCtx->uCntr] = 0u;
+                            p_ptCtx->uCntr++;
+                        }
+
+                        p_ptCtx->bCode = true;
+                        p_ptCtx->uBlkL = (uint32_t)l_uByte - 1u;
+                        p_ptCtx->bZero = ( p_ptCtx->uBlkL < EFSP_COBS_MAXBLOCK );
+
+                        if( p_ptCtx->uBlkL > 0u )
+                        {
+                            p_ptCtx->eSt = e_eFSP_COBS_DECSM_DATA;
+                        }
+                    }
+                }
+
+                *p_puUsedL = l_uUsedL;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_COBS_IsEncStillCoherent(const t_eFSP_COBS_EncCtx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puBuff )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check index validity */
+        if( ( p_ptCtx->uFrameL > p_ptCtx->uBuffL ) || ( p_ptCtx->uCntr > p_ptCtx->uFrameL ) ||
+            ( p_ptCtx->uSentL > p_ptCtx->uFrameEncL ) || ( p_ptCtx->uBlkL > EFSP_COBS_MAXBLOCK ) ||
+            ( p_ptCtx->eSt > e_eFSP_COBS_ENCSM_ENDED ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_COBS_RES eFSP_COBS_CheckEncCtx(const t_eFSP_COBS_EncCtx* p_ptCtx)
+{
+    e_eFSP_COBS_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_COBS_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_COBS_IsEncStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_COBS_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_COBS_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_COBS_IsDecStillCoherent(const t_eFSP_COBS_DecCtx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puBuff )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check index validity */
+        if( ( p_ptCtx->uCntr > p_ptCtx->uBuffL ) || ( p_ptCtx->uBlkL > EFSP_COBS_MAXBLOCK ) ||
+            ( p_ptCtx->eSt > e_eFSP_COBS_DECSM_BAD ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_COBS_RES eFSP_COBS_CheckDecCtx(const t_eFSP_COBS_DecCtx* p_ptCtx)
+{
+    e_eFSP_COBS_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_COBS_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_COBS_IsDecStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_COBS_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_COBS_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eFSP_COBS_GetBlkL(const uint8_t* p_puData, const uint32_t p_uStart, const uint32_t p_uEnd)
+{
+    uint32_t l_uBlkL;
+
+    /* Count the non zero bytes, till the end of the frame or the biggest block */
+    l_uBlkL = 0u;
+
+    while( ( ( p_uStart + l_uBlkL ) < p_uEnd ) && ( l_uBlkL < EFSP_COBS_MAXBLOCK ) &&
+           ( 0u != p_puData[p_uStart + l_uBlkL] ) )
+    {
+        l_uBlkL++;
+    }
+
+    return l_uBlkL;
+}
+
+static uint32_t eFSP_COBS_GetEncL(const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    uint32_t l_uEncL;
+    uint32_t l_uIdx;
+    uint32_t l_uBlkL;
+    bool_t l_bMore;
+
+    /* Two delimiters, and a code byte for every block */
+    l_uEncL = 2u;
+    l_uIdx = 0u;
+    l_bMore = true;
+
+    while( true == l_bMore )
+    {
+        l_uBlkL = eFSP_COBS_GetBlkL(p_puData, l_uIdx, p_uDataL);
+        l_uEncL += l_uBlkL + 1u;
+        l_uIdx += l_uBlkL;
+
+        if( ( l_uBlkL < EFSP_COBS_MAXBLOCK ) && ( l_uIdx < p_uDataL ) )
+        {
+            /* Skip the zero, another block follows even if it is the last byte */
+            l_uIdx++;
+        }
+        else
+        {
+            l_bMore = ( l_uIdx < p_uDataL );
+        }
+    }
+
+    return l_uEncL;
+}
+
+static void eFSP_COBS_EndEncBlk(t_eFSP_COBS_EncCtx* const p_ptCtx)
+{
+    if( true == p_ptCtx->bZero )
+    {
+        /* The zero is encoded by the code byte of the next block */
+        p_ptCtx->uCntr++;
+        p_ptCtx->eSt = e_eFSP_COBS_ENCSM_CODE;
+    }
+    else if( p_ptCtx->uCntr < p_ptCtx->uFrameL )
+    {
+        p_ptCtx->eSt = e_eFSP_COBS_ENCSM_CODE;
+    }
+    else
+    {
+        p_ptCtx->eSt = e_eFSP_COBS_ENCSM_EOF;
+    }
+}
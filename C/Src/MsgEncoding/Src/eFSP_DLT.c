@@ -0,0 +1,253 @@
+/**
+ * @file       eFSP_DLT.c
+ *
+ * @brief      In place delta encoder and decoder of the message payload against a base payload
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_DLT.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_DLT_Pass(uint8_t* p_puData, const uint8_t* p_puBase, const uint32_t p_uDataL, const bool_t p_bWrite,
+                            uint32_t* const p_puOut);
+static bool_t eFSP_DLT_CheckStream(const uint8_t* p_puArea, const uint32_t p_uBaseL, const uint32_t p_uDltL);
+static void eFSP_DLT_Expand(uint8_t* p_puArea, const uint8_t* p_puBase, const uint32_t p_uBaseL,
+                            const uint32_t p_uDltL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_DLT_RES eFSP_DLT_Encode(uint8_t* p_puData, const uint8_t* p_puBase, const uint32_t p_uDataL,
+                               uint32_t* const p_puDltL)
+{
+	/* Local variable */
+	e_eFSP_DLT_RES l_eRes;
+	uint32_t l_uDltL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puData ) || ( NULL == p_puBase ) || ( NULL == p_puDltL ) )
+	{
+		l_eRes = e_eFSP_DLT_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uDataL < 1u )
+        {
+            l_eRes = e_eFSP_DLT_RES_BADPARAM;
+        }
+        else
+        {
+            /* A dry pass find out if the stream fit in place and is shorter than the data, the second pass take the
+             * same decision and write the stream */
+            if( false == eFSP_DLT_Pass(p_puData, p_puBase, p_uDataL, false, &l_uDltL) )
+            {
+                l_eRes = e_eFSP_DLT_RES_NOGAIN;
+            }
+            else
+            {
+                (void)eFSP_DLT_Pass(p_puData, p_puBase, p_uDataL, true, &l_uDltL);
+                *p_puDltL = l_uDltL;
+                l_eRes = e_eFSP_DLT_RES_OK;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_DLT_RES eFSP_DLT_Decode(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint8_t* p_puBase,
+                               const uint32_t p_uBaseL, const uint32_t p_uDltL)
+{
+	/* Local variable */
+	e_eFSP_DLT_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puArea ) || ( NULL == p_puBase ) )
+	{
+		l_eRes = e_eFSP_DLT_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_uDltL < 1u ) || ( p_uDltL > p_uAreaL ) || ( p_uBaseL < 1u ) )
+        {
+            l_eRes = e_eFSP_DLT_RES_BADPARAM;
+        }
+        else if( p_uBaseL > p_uAreaL )
+        {
+            l_eRes = e_eFSP_DLT_RES_OUTOFMEM;
+        }
+        else
+        {
+            /* Nothing is written till the whole stream is known to be valid */
+            if( false == eFSP_DLT_CheckStream(p_puArea, p_uBaseL, p_uDltL) )
+            {
+                l_eRes = e_eFSP_DLT_RES_BADFRAME;
+            }
+            else
+            {
+                eFSP_DLT_Expand(p_puArea, p_puBase, p_uBaseL, p_uDltL);
+                l_eRes = e_eFSP_DLT_RES_OK;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_DLT_Pass(uint8_t* p_puData, const uint8_t* p_puBase, const uint32_t p_uDataL, const bool_t p_bWrite,
+                            uint32_t* const p_puOut)
+{
+    uint32_t l_uIn;
+    uint32_t l_uOut;
+    uint32_t l_uLitL;
+    uint32_t l_uSameL;
+    bool_t l_bFit;
+
+    /* The stream is written from the start of the data, every token must end before the bytes still to encode. The
+     * control byte can be over the bytes equal to the base, that are not needed anymore */
+    l_uIn = 0u;
+    l_uOut = 0u;
+    l_bFit = true;
+
+    while( ( true == l_bFit ) && ( l_uIn < p_uDataL ) )
+    {
+        l_uLitL = 0u;
+
+        while( ( l_uLitL < EFSP_DLT_MAXLIT ) && ( ( l_uIn + l_uLitL ) < p_uDataL ) &&
+               ( p_puData[l_uIn + l_uLitL] != p_puBase[l_uIn + l_uLitL] ) )
+        {
+            if( true == p_bWrite )
+            {
+                /* Never after the byte just read */
+                p_puData[l_uOut + l_uLitL] = (uint8_t)( p_puData[l_uIn + l_uLitL] ^ p_puBase[l_uIn + l_uLitL] );
+            }
+
+            l_uLitL++;
+        }
+
+        l_uSameL = 0u;
+
+        while( ( l_uSameL < EFSP_DLT_MAXSAME ) && ( ( l_uIn + l_uLitL + l_uSameL ) < p_uDataL ) &&
+               ( p_puData[l_uIn + l_uLitL + l_uSameL] == p_puBase[l_uIn + l_uLitL + l_uSameL] ) )
+        {
+            l_uSameL++;
+        }
+
+        if( ( l_uOut + l_uLitL + 1u ) <= ( l_uIn + l_uLitL + l_uSameL ) )
+        {
+            if( true == p_bWrite )
+            {
+                p_puData[l_uOut + l_uLitL] = (uint8_t) ( ( l_uLitL << EFSP_DLT_LITSHIFT ) | l_uSameL );
+            }
+
+            l_uOut += l_uLitL + 1u;
+            l_uIn += l_uLitL + l_uSameL;
+        }
+        else
+        {
+            l_bFit = false;
+        }
+    }
+
+    if( ( true == l_bFit ) && ( l_uOut >= p_uDataL ) )
+    {
+        /* No gain */
+        l_bFit = false;
+    }
+
+    *p_puOut = l_uOut;
+
+    return l_bFit;
+}
+
+static bool_t eFSP_DLT_CheckStream(const uint8_t* p_puArea, const uint32_t p_uBaseL, const uint32_t p_uDltL)
+{
+    bool_t l_bRes;
+    uint32_t l_uRd;
+    uint32_t l_uWr;
+    uint32_t l_uLitL;
+    uint32_t l_uSameL;
+
+    /* The tokens are decoded from the last one, the data must never reach the tokens still to decode */
+    l_bRes = true;
+    l_uRd = p_uDltL;
+    l_uWr = p_uBaseL;
+
+    while( ( true == l_bRes ) && ( l_uRd > 0u ) )
+    {
+        l_uLitL = ( (uint32_t) p_puArea[l_uRd - 1u] ) >> EFSP_DLT_LITSHIFT;
+        l_uSameL = ( (uint32_t) p_puArea[l_uRd - 1u] ) & EFSP_DLT_MAXSAME;
+        l_uRd--;
+
+        if( ( l_uRd < l_uLitL ) || ( l_uWr < ( l_uLitL + l_uSameL ) ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_uRd -= l_uLitL;
+            l_uWr -= ( l_uLitL + l_uSameL );
+
+            if( l_uWr < l_uRd )
+            {
+                l_bRes = false;
+            }
+        }
+    }
+
+    if( ( true == l_bRes ) && ( 0u != l_uWr ) )
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static void eFSP_DLT_Expand(uint8_t* p_puArea, const uint8_t* p_puBase, const uint32_t p_uBaseL,
+                            const uint32_t p_uDltL)
+{
+    uint32_t l_uRd;
+    uint32_t l_uWr;
+    uint32_t l_uLitL;
+    uint32_t l_uSameL;
+    uint32_t l_uIdx;
+
+    /* Stream already checked */
+    l_uRd = p_uDltL;
+    l_uWr = p_uBaseL;
+
+    while( l_uRd > 0u )
+    {
+        l_uLitL = ( (uint32_t) p_puArea[l_uRd - 1u] ) >> EFSP_DLT_LITSHIFT;
+        l_uSameL = ( (uint32_t) p_puArea[l_uRd - 1u] ) & EFSP_DLT_MAXSAME;
+        l_uRd -= ( l_uLitL + 1u );
+        l_uWr -= ( l_uLitL + l_uSameL );
+
+        /* The bytes equal to the base can be over the control byte, already read */
+        (void)memcpy(&p_puArea[l_uWr + l_uLitL], &p_puBase[l_uWr + l_uLitL], l_uSameL);
+
+        /* From the last byte, the data is never before the stream */
+        for( l_uIdx = l_uLitL; l_uIdx > 0u; l_uIdx-- )
+        {
+            p_puArea[l_uWr + l_uIdx - 1u] = (uint8_t)( p_puArea[l_uRd + l_uIdx - 1u] ^ p_puBase[l_uWr + l_uIdx - 1u] );
+        }
+    }
+}
\ No newline at end of file
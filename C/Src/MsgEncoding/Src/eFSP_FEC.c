@@ -0,0 +1,489 @@
+/**
+ * @file       eFSP_FEC.c
+ *
+ * @brief      In place Reed-Solomon forward error correction of interleaved blocks of an encoded frame
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_FEC.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE VARIABLE DECLARATION
+ **********************************************************************************************************************/
+/* Powers of alpha, and their logarithm. The logarithm of zero is never used */
+static const uint8_t m_auFecExp[EFSP_FEC_GFN] =
+{
+    0x01u, 0x02u, 0x04u, 0x08u, 0x10u, 0x20u, 0x40u, 0x80u, 0x1Du, 0x3Au, 0x74u, 0xE8u, 0xCDu, 0x87u, 0x13u, 0x26u,
+    0x4Cu, 0x98u, 0x2Du, 0x5Au, 0xB4u, 0x75u, 0xEAu, 0xC9u, 0x8Fu, 0x03u, 0x06u, 0x0Cu, 0x18u, 0x30u, 0x60u, 0xC0u,
+    0x9Du, 0x27u, 0x4Eu, 0x9Cu, 0x25u, 0x4Au, 0x94u, 0x35u, 0x6Au, 0xD4u, 0xB5u, 0x77u, 0xEEu, 0xC1u, 0x9Fu, 0x23u,
+    0x46u, 0x8Cu, 0x05u, 0x0Au, 0x14u, 0x28u, 0x50u, 0xA0u, 0x5Du, 0xBAu, 0x69u, 0xD2u, 0xB9u, 0x6Fu, 0xDEu, 0xA1u,
+    0x5Fu, 0xBEu, 0x61u, 0xC2u, 0x99u, 0x2Fu, 0x5Eu, 0xBCu, 0x65u, 0xCAu, 0x89u, 0x0Fu, 0x1Eu, 0x3Cu, 0x78u, 0xF0u,
+    0xFDu, 0xE7u, 0xD3u, 0xBBu, 0x6Bu, 0xD6u, 0xB1u, 0x7Fu, 0xFEu, 0xE1u, 0xDFu, 0xA3u, 0x5Bu, 0xB6u, 0x71u, 0xE2u,
+    0xD9u, 0xAFu, 0x43u, 0x86u, 0x11u, 0x22u, 0x44u, 0x88u, 0x0Du, 0x1Au, 0x34u, 0x68u, 0xD0u, 0xBDu, 0x67u, 0xCEu,
+    0x81u, 0x1Fu, 0x3Eu, 0x7Cu, 0xF8u, 0xEDu, 0xC7u, 0x93u, 0x3Bu, 0x76u, 0xECu, 0xC5u, 0x97u, 0x33u, 0x66u, 0xCCu,
+    0x85u, 0x17u, 0x2Eu, 0x5Cu, 0xB8u, 0x6Du, 0xDAu, 0xA9u, 0x4Fu, 0x9Eu, 0x21u, 0x42u, 0x84u, 0x15u, 0x2Au, 0x54u,
+    0xA8u, 0x4Du, 0x9Au, 0x29u, 0x52u, 0xA4u, 0x55u, 0xAAu, 0x49u, 0x92u, 0x39u, 0x72u, 0xE4u, 0xD5u, 0xB7u, 0x73u,
+    0xE6u, 0xD1u, 0xBFu, 0x63u, 0xC6u, 0x91u, 0x3Fu, 0x7Eu, 0xFCu, 0xE5u, 0xD7u, 0xB3u, 0x7Bu, 0xF6u, 0xF1u, 0xFFu,
+    0xE3u, 0xDBu, 0xABu, 0x4Bu, 0x96u, 0x31u, 0x62u, 0xC4u, 0x95u, 0x37u, 0x6Eu, 0xDCu, 0xA5u, 0x57u, 0xAEu, 0x41u,
+    0x82u, 0x19u, 0x32u, 0x64u, 0xC8u, 0x8Du, 0x07u, 0x0Eu, 0x1Cu, 0x38u, 0x70u, 0xE0u, 0xDDu, 0xA7u, 0x53u, 0xA6u,
+    0x51u, 0xA2u, 0x59u, 0xB2u, 0x79u, 0xF2u, 0xF9u, 0xEFu, 0xC3u, 0x9Bu, 0x2Bu, 0x56u, 0xACu, 0x45u, 0x8Au, 0x09u,
+    0x12u, 0x24u, 0x48u, 0x90u, 0x3Du, 0x7Au, 0xF4u, 0xF5u, 0xF7u, 0xF3u, 0xFBu, 0xEBu, 0xCBu, 0x8Bu, 0x0Bu, 0x16u,
+    0x2Cu, 0x58u, 0xB0u, 0x7Du, 0xFAu, 0xE9u, 0xCFu, 0x83u, 0x1Bu, 0x36u, 0x6Cu, 0xD8u, 0xADu, 0x47u, 0x8Eu
+};
+
+static const uint8_t m_auFecLog[EFSP_FEC_GFN + 1u] =
+{
+    0x00u, 0x00u, 0x01u, 0x19u, 0x02u, 0x32u, 0x1Au, 0xC6u, 0x03u, 0xDFu, 0x33u, 0xEEu, 0x1Bu, 0x68u, 0xC7u, 0x4Bu,
+    0x04u, 0x64u, 0xE0u, 0x0Eu, 0x34u, 0x8Du, 0xEFu, 0x81u, 0x1Cu, 0xC1u, 0x69u, 0xF8u, 0xC8u, 0x08u, 0x4Cu, 0x71u,
+    0x05u, 0x8Au, 0x65u, 0x2Fu, 0xE1u, 0x24u, 0x0Fu, 0x21u, 0x35u, 0x93u, 0x8Eu, 0xDAu, 0xF0u, 0x12u, 0x82u, 0x45u,
+    0x1Du, 0xB5u, 0xC2u, 0x7Du, 0x6Au, 0x27u, 0xF9u, 0xB9u, 0xC9u, 0x9Au, 0x09u, 0x78u, 0x4Du, 0xE4u, 0x72u, 0xA6u,
+    0x06u, 0xBFu, 0x8Bu, 0x62u, 0x66u, 0xDDu, 0x30u, 0xFDu, 0xE2u, 0x98u, 0x25u, 0xB3u, 0x10u, 0x91u, 0x22u, 0x88u,
+    0x36u, 0xD0u, 0x94u, 0xCEu, 0x8Fu, 0x96u, 0xDBu, 0xBDu, 0xF1u, 0xD2u, 0x13u, 0x5Cu, 0x83u, 0x38u, 0x46u, 0x40u,
+    0x1Eu, 0x42u, 0xB6u, 0xA3u, 0xC3u, 0x48u, 0x7Eu, 0x6Eu, 0x6Bu, 0x3Au, 0x28u, 0x54u, 0xFAu, 0x85u, 0xBAu, 0x3Du,
+    0xCAu, 0x5Eu, 0x9Bu, 0x9Fu, 0x0Au, 0x15u, 0x79u, 0x2Bu, 0x4Eu, 0xD4u, 0xE5u, 0xACu, 0x73u, 0xF3u, 0xA7u, 0x57u,
+    0x07u, 0x70u, 0xC0u, 0xF7u, 0x8Cu, 0x80u, 0x63u, 0x0Du, 0x67u, 0x4Au, 0xDEu, 0xEDu, 0x31u, 0xC5u, 0xFEu, 0x18u,
+    0xE3u, 0xA5u, 0x99u, 0x77u, 0x26u, 0xB8u, 0xB4u, 0x7Cu, 0x11u, 0x44u, 0x92u, 0xD9u, 0x23u, 0x20u, 0x89u, 0x2Eu,
+    0x37u, 0x3Fu, 0xD1u, 0x5Bu, 0x95u, 0xBCu, 0xCFu, 0xCDu, 0x90u, 0x87u, 0x97u, 0xB2u, 0xDCu, 0xFCu, 0xBEu, 0x61u,
+    0xF2u, 0x56u, 0xD3u, 0xABu, 0x14u, 0x2Au, 0x5Du, 0x9Eu, 0x84u, 0x3Cu, 0x39u, 0x53u, 0x47u, 0x6Du, 0x41u, 0xA2u,
+    0x1Fu, 0x2Du, 0x43u, 0xD8u, 0xB7u, 0x7Bu, 0xA4u, 0x76u, 0xC4u, 0x17u, 0x49u, 0xECu, 0x7Fu, 0x0Cu, 0x6Fu, 0xF6u,
+    0x6Cu, 0xA1u, 0x3Bu, 0x52u, 0x29u, 0x9Du, 0x55u, 0xAAu, 0xFBu, 0x60u, 0x86u, 0xB1u, 0xBBu, 0xCCu, 0x3Eu, 0x5Au,
+    0xCBu, 0x59u, 0x5Fu, 0xB0u, 0x9Cu, 0xA9u, 0xA0u, 0x51u, 0x0Bu, 0xF5u, 0x16u, 0xEBu, 0x7Au, 0x75u, 0x2Cu, 0xD7u,
+    0x4Fu, 0xAEu, 0xD5u, 0xE9u, 0xE6u, 0xE7u, 0xADu, 0xE8u, 0x74u, 0xD6u, 0xF4u, 0xEAu, 0xA8u, 0x50u, 0x58u, 0xAFu
+};
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static uint8_t eFSP_FEC_Mul(const uint8_t p_uA, const uint8_t p_uB);
+static uint8_t eFSP_FEC_Div(const uint8_t p_uA, const uint8_t p_uB);
+static uint32_t eFSP_FEC_GetIdx(const uint32_t p_uCwN, const uint32_t p_uCw, const uint32_t p_uPos);
+static void eFSP_FEC_GetGen(uint8_t* p_puGen, const uint32_t p_uParL);
+static void eFSP_FEC_EncodeCw(uint8_t* p_puArea, const uint32_t p_uDataL, const uint32_t p_uCwN, const uint32_t p_uCw,
+                              const uint8_t* p_puGen, const uint32_t p_uParL);
+static bool_t eFSP_FEC_DecodeCw(uint8_t* p_puFrame, const uint32_t p_uDataL, const uint32_t p_uCwN,
+                                const uint32_t p_uCw, const uint32_t p_uParL, uint32_t* const p_puFixN);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+uint32_t eFSP_FEC_GetParL(const uint32_t p_uDataL, const uint32_t p_uParL)
+{
+    uint32_t l_uCwN;
+
+    /* One codeword every EFSP_FEC_BLOCKL bytes, the last one can be shorter */
+    l_uCwN = p_uDataL / EFSP_FEC_BLOCKL;
+
+    if( 0u != ( p_uDataL % EFSP_FEC_BLOCKL ) )
+    {
+        l_uCwN++;
+    }
+
+    return l_uCwN * p_uParL;
+}
+
+uint32_t eFSP_FEC_GetDataL(const uint32_t p_uFrameL, const uint32_t p_uParL)
+{
+    uint32_t l_uDataL;
+    uint32_t l_uRem;
+
+    /* Every full codeword carry EFSP_FEC_BLOCKL bytes of data, the last one what remains after its parity */
+    l_uDataL = ( p_uFrameL / ( EFSP_FEC_BLOCKL + p_uParL ) ) * EFSP_FEC_BLOCKL;
+    l_uRem = p_uFrameL % ( EFSP_FEC_BLOCKL + p_uParL );
+
+    if( l_uRem > p_uParL )
+    {
+        l_uDataL += l_uRem - p_uParL;
+    }
+
+    return l_uDataL;
+}
+
+e_eFSP_FEC_RES eFSP_FEC_Encode(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uDataL,
+                               const uint32_t p_uParL, uint32_t* const p_puFrameL)
+{
+	/* Local variable */
+	e_eFSP_FEC_RES l_eRes;
+    uint8_t l_auGen[EFSP_FEC_MAXPAR + 1u];
+	uint32_t l_uCwN;
+	uint32_t l_uCw;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puArea ) || ( NULL == p_puFrameL ) )
+	{
+		l_eRes = e_eFSP_FEC_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_uDataL < 1u ) || ( p_uParL < 2u ) || ( p_uParL > EFSP_FEC_MAXPAR ) )
+        {
+            l_eRes = e_eFSP_FEC_RES_BADPARAM;
+        }
+        else if( ( p_uDataL > p_uAreaL ) || ( eFSP_FEC_GetParL(p_uDataL, p_uParL) > ( p_uAreaL - p_uDataL ) ) )
+        {
+            l_eRes = e_eFSP_FEC_RES_OUTOFMEM;
+        }
+        else
+        {
+            /* Every codeword has a byte of data every l_uCwN */
+            eFSP_FEC_GetGen(l_auGen, p_uParL);
+            l_uCwN = eFSP_FEC_GetParL(p_uDataL, 1u);
+
+            for( l_uCw = 0u; l_uCw < l_uCwN; l_uCw++ )
+            {
+                eFSP_FEC_EncodeCw(p_puArea, p_uDataL, l_uCwN, l_uCw, l_auGen, p_uParL);
+            }
+
+            *p_puFrameL = p_uDataL + ( l_uCwN * p_uParL );
+            l_eRes = e_eFSP_FEC_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FEC_RES eFSP_FEC_Decode(uint8_t* p_puFrame, const uint32_t p_uFrameL, const uint32_t p_uParL,
+                               uint32_t* const p_puDataL, uint32_t* const p_puFixN)
+{
+	/* Local variable */
+	e_eFSP_FEC_RES l_eRes;
+	uint32_t l_uDataL;
+	uint32_t l_uCwN;
+	uint32_t l_uCw;
+	uint32_t l_uFixN;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puFrame ) || ( NULL == p_puDataL ) || ( NULL == p_puFixN ) )
+	{
+		l_eRes = e_eFSP_FEC_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_uParL < 2u ) || ( p_uParL > EFSP_FEC_MAXPAR ) )
+        {
+            l_eRes = e_eFSP_FEC_RES_BADPARAM;
+        }
+        else
+        {
+            /* Only one size of data give this size of frame */
+            l_uDataL = eFSP_FEC_GetDataL(p_uFrameL, p_uParL);
+
+            if( ( l_uDataL < 1u ) || ( ( l_uDataL + eFSP_FEC_GetParL(l_uDataL, p_uParL) ) != p_uFrameL ) )
+            {
+                l_eRes = e_eFSP_FEC_RES_BADFRAME;
+            }
+            else
+            {
+                l_uCwN = eFSP_FEC_GetParL(l_uDataL, 1u);
+                l_uFixN = 0u;
+                l_eRes = e_eFSP_FEC_RES_OK;
+
+                for( l_uCw = 0u; l_uCw < l_uCwN; l_uCw++ )
+                {
+                    if( false == eFSP_FEC_DecodeCw(p_puFrame, l_uDataL, l_uCwN, l_uCw, p_uParL, &l_uFixN) )
+                    {
+                        l_eRes = e_eFSP_FEC_RES_BADFRAME;
+                    }
+                }
+
+                *p_puDataL = l_uDataL;
+                *p_puFixN = l_uFixN;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static uint8_t eFSP_FEC_Mul(const uint8_t p_uA, const uint8_t p_uB)
+{
+    uint8_t l_uRes;
+
+    if( ( 0u == p_uA ) || ( 0u == p_uB ) )
+    {
+        l_uRes = 0u;
+    }
+    else
+    {
+        l_uRes = m_auFecExp[( (uint32_t)m_auFecLog[p_uA] + (uint32_t)m_auFecLog[p_uB] ) % EFSP_FEC_GFN];
+    }
+
+    return l_uRes;
+}
+
+static uint8_t eFSP_FEC_Div(const uint8_t p_uA, const uint8_t p_uB)
+{
+    uint8_t l_uRes;
+
+    /* The divisor is never zero */
+    if( 0u == p_uA )
+    {
+        l_uRes = 0u;
+    }
+    else
+    {
+        l_uRes = m_auFecExp[( ( (uint32_t)m_auFecLog[p_uA] + EFSP_FEC_GFN ) - (uint32_t)m_auFecLog[p_uB] ) %
+                            EFSP_FEC_GFN];
+    }
+
+    return l_uRes;
+}
+
+static uint32_t eFSP_FEC_GetIdx(const uint32_t p_uCwN, const uint32_t p_uCw, const uint32_t p_uPos)
+{
+    /* The codeword p_uCw is made of the bytes of the frame at p_uCw, p_uCw + p_uCwN and so on. The data of every
+     * codeword is followed by exactly its parity, as every p_uCwN bytes contain one byte of every codeword */
+    return p_uCw + ( p_uPos * p_uCwN );
+}
+
+static void eFSP_FEC_GetGen(uint8_t* p_puGen, const uint32_t p_uParL)
+{
+    uint32_t l_uRoot;
+    uint32_t l_uIdx;
+
+    /* Product of ( x - alpha^i ), the coefficient of x^i in p_puGen[i] */
+    (void)memset(p_puGen, 0, p_uParL + 1u);
+    p_puGen[0u] = 1u;
+
+    for( l_uRoot = 0u; l_uRoot < p_uParL; l_uRoot++ )
+    {
+        for( l_uIdx = l_uRoot + 1u; l_uIdx > 0u; l_uIdx-- )
+        {
+            p_puGen[l_uIdx] = (uint8_t)( p_puGen[l_uIdx - 1u] ^ eFSP_FEC_Mul(p_puGen[l_uIdx], m_auFecExp[l_uRoot]) );
+        }
+
+        p_puGen[0u] = eFSP_FEC_Mul(p_puGen[0u], m_auFecExp[l_uRoot]);
+    }
+}
+
+static void eFSP_FEC_EncodeCw(uint8_t* p_puArea, const uint32_t p_uDataL, const uint32_t p_uCwN, const uint32_t p_uCw,
+                              const uint8_t* p_puGen, const uint32_t p_uParL)
+{
+    uint8_t l_auRem[EFSP_FEC_MAXPAR];
+    uint32_t l_uCwDataL;
+    uint32_t l_uPos;
+    uint32_t l_uIdx;
+    uint8_t l_uFb;
+
+    /* Remainder of the division of the data, shifted by the parity, by the generator. The first byte is the
+     * coefficient of the highest power */
+    l_uCwDataL = ( ( p_uDataL - p_uCw ) + ( p_uCwN - 1u ) ) / p_uCwN;
+    (void)memset(l_auRem, 0, p_uParL);
+
+    for( l_uPos = 0u; l_uPos < l_uCwDataL; l_uPos++ )
+    {
+        l_uFb = (uint8_t)( p_puArea[eFSP_FEC_GetIdx(p_uCwN, p_uCw, l_uPos)] ^
+                           l_auRem[p_uParL - 1u] );
+
+        for( l_uIdx = p_uParL - 1u; l_uIdx > 0u; l_uIdx-- )
+        {
+            l_auRem[l_uIdx] = (uint8_t)( l_auRem[l_uIdx - 1u] ^ eFSP_FEC_Mul(l_uFb, p_puGen[l_uIdx]) );
+        }
+
+        l_auRem[0u] = eFSP_FEC_Mul(l_uFb, p_puGen[0u]);
+    }
+
+    for( l_uPos = 0u; l_uPos < p_uParL; l_uPos++ )
+    {
+        p_puArea[eFSP_FEC_GetIdx(p_uCwN, p_uCw, l_uCwDataL + l_uPos)] =
+            l_auRem[p_uParL - 1u - l_uPos];
+    }
+}
+
+static bool_t eFSP_FEC_DecodeCw(uint8_t* p_puFrame, const uint32_t p_uDataL, const uint32_t p_uCwN,
+                                const uint32_t p_uCw, const uint32_t p_uParL, uint32_t* const p_puFixN)
+{
+    uint8_t l_auSyn[EFSP_FEC_MAXPAR];
+    uint8_t l_auLoc[EFSP_FEC_MAXPAR + 1u];
+    uint8_t l_auPrv[EFSP_FEC_MAXPAR + 1u];
+    uint8_t l_auTmp[EFSP_FEC_MAXPAR + 1u];
+    uint8_t l_auEvl[EFSP_FEC_MAXPAR];
+    uint32_t l_auErr[EFSP_FEC_MAXPAR / 2u];
+    uint32_t l_uCwDataL;
+    uint32_t l_uCwL;
+    uint32_t l_uLocL;
+    uint32_t l_uGap;
+    uint32_t l_uErrN;
+    uint32_t l_uPos;
+    uint32_t l_uIdx;
+    uint32_t l_uJdx;
+    uint8_t l_uSynAll;
+    uint8_t l_uPrvD;
+    uint8_t l_uD;
+    uint8_t l_uX;
+    uint8_t l_uXInv;
+    uint8_t l_uNum;
+    uint8_t l_uDen;
+    uint8_t l_uPow;
+    bool_t l_bRes;
+
+    l_uCwDataL = ( ( p_uDataL - p_uCw ) + ( p_uCwN - 1u ) ) / p_uCwN;
+    l_uCwL = l_uCwDataL + p_uParL;
+
+    /* Syndromes, the codeword evaluated in the roots of the generator */
+    l_uSynAll = 0u;
+
+    for( l_uIdx = 0u; l_uIdx < p_uParL; l_uIdx++ )
+    {
+        l_auSyn[l_uIdx] = 0u;
+
+        for( l_uPos = 0u; l_uPos < l_uCwL; l_uPos++ )
+        {
+            l_auSyn[l_uIdx] = (uint8_t)( eFSP_FEC_Mul(l_auSyn[l_uIdx], m_auFecExp[l_uIdx]) ^
+                                         p_puFrame[eFSP_FEC_GetIdx(p_uCwN, p_uCw, l_uPos)] );
+        }
+
+        l_uSynAll |= l_auSyn[l_uIdx];
+    }
+
+    if( 0u == l_uSynAll )
+    {
+        /* No errors */
+        l_bRes = true;
+    }
+    else
+    {
+        /* Error locator with Berlekamp-Massey */
+        (void)memset(l_auLoc, 0, sizeof(l_auLoc));
+        (void)memset(l_auPrv, 0, sizeof(l_auPrv));
+        l_auLoc[0u] = 1u;
+        l_auPrv[0u] = 1u;
+        l_uLocL = 0u;
+        l_uGap = 1u;
+        l_uPrvD = 1u;
+
+        for( l_uIdx = 0u; l_uIdx < p_uParL; l_uIdx++ )
+        {
+            l_uD = l_auSyn[l_uIdx];
+
+            for( l_uJdx = 1u; l_uJdx <= l_uLocL; l_uJdx++ )
+            {
+                l_uD ^= eFSP_FEC_Mul(l_auLoc[l_uJdx], l_auSyn[l_uIdx - l_uJdx]);
+            }
+
+            if( 0u == l_uD )
+            {
+                l_uGap++;
+            }
+            else
+            {
+                (void)memcpy(l_auTmp, l_auLoc, sizeof(l_auTmp));
+
+                for( l_uJdx = 0u; ( l_uJdx + l_uGap ) <= p_uParL; l_uJdx++ )
+                {
+                    l_auLoc[l_uJdx + l_uGap] ^= eFSP_FEC_Mul(eFSP_FEC_Div(l_uD, l_uPrvD), l_auPrv[l_uJdx]);
+                }
+
+                if( ( 2u * l_uLocL ) <= l_uIdx )
+                {
+                    l_uLocL = l_uIdx + 1u - l_uLocL;
+                    (void)memcpy(l_auPrv, l_auTmp, sizeof(l_auPrv));
+                    l_uPrvD = l_uD;
+                    l_uGap = 1u;
+                }
+                else
+                {
+                    l_uGap++;
+                }
+            }
+        }
+
+        /* Chien search of the positions inside the codeword, the byte at l_uPos is the coefficient of the power
+         * l_uCwL - 1 - l_uPos */
+        l_uErrN = 0u;
+
+        if( ( 2u * l_uLocL ) <= p_uParL )
+        {
+            for( l_uPos = 0u; ( l_uPos < l_uCwL ) && ( l_uErrN < l_uLocL ); l_uPos++ )
+            {
+                l_uXInv = m_auFecExp[( EFSP_FEC_GFN - ( l_uCwL - 1u - l_uPos ) ) % EFSP_FEC_GFN];
+                l_uD = 0u;
+
+                for( l_uJdx = l_uLocL + 1u; l_uJdx > 0u; l_uJdx-- )
+                {
+                    l_uD = (uint8_t)( eFSP_FEC_Mul(l_uD, l_uXInv) ^ l_auLoc[l_uJdx - 1u] );
+                }
+
+                if( 0u == l_uD )
+                {
+                    l_auErr[l_uErrN] = l_uPos;
+                    l_uErrN++;
+                }
+            }
+        }
+
+        if( ( 0u == l_uErrN ) || ( l_uErrN != l_uLocL ) )
+        {
+            /* Too many errors */
+            l_bRes = false;
+        }
+        else
+        {
+            /* Error evaluator, syndromes times locator truncated at the parity size */
+            for( l_uIdx = 0u; l_uIdx < p_uParL; l_uIdx++ )
+            {
+                l_auEvl[l_uIdx] = 0u;
+
+                for( l_uJdx = 0u; ( l_uJdx <= l_uIdx ) && ( l_uJdx <= l_uLocL ); l_uJdx++ )
+                {
+                    l_auEvl[l_uIdx] ^= eFSP_FEC_Mul(l_auLoc[l_uJdx], l_auSyn[l_uIdx - l_uJdx]);
+                }
+            }
+
+            /* Forney, the error is X * Evl(X^-1) / Loc'(X^-1) */
+            l_bRes = true;
+
+            for( l_uIdx = 0u; l_uIdx < l_uErrN; l_uIdx++ )
+            {
+                l_uX = m_auFecExp[l_uCwL - 1u - l_auErr[l_uIdx]];
+                l_uXInv = eFSP_FEC_Div(1u, l_uX);
+                l_uNum = 0u;
+
+                for( l_uJdx = p_uParL; l_uJdx > 0u; l_uJdx-- )
+                {
+                    l_uNum = (uint8_t)( eFSP_FEC_Mul(l_uNum, l_uXInv) ^ l_auEvl[l_uJdx - 1u] );
+                }
+
+                /* Only the odd powers remain in the derivative */
+                l_uDen = 0u;
+                l_uPow = 1u;
+
+                for( l_uJdx = 1u; l_uJdx <= l_uLocL; l_uJdx += 2u )
+                {
+                    l_uDen ^= eFSP_FEC_Mul(l_auLoc[l_uJdx], l_uPow);
+                    l_uPow = eFSP_FEC_Mul(l_uPow, eFSP_FEC_Mul(l_uXInv, l_uXInv));
+                }
+
+                if( 0u == l_uDen )
+                {
+                    l_bRes = false;
+                }
+                else
+                {
+                    l_uPos = eFSP_FEC_GetIdx(p_uCwN, p_uCw, l_auErr[l_uIdx]);
+                    p_puFrame[l_uPos] ^= eFSP_FEC_Mul(l_uX, eFSP_FEC_Div(l_uNum, l_uDen));
+                    (*p_puFixN)++;
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
\ No newline at end of file
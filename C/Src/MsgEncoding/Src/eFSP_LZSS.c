@@ -0,0 +1,490 @@
+/**
+ * @file       eFSP_LZSS.c
+ *
+ * @brief      In place LZSS compressor and decompressor of the message payload
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_LZSS.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static uint32_t eFSP_LZSS_GetVarL(const uint32_t p_uVal);
+static uint32_t eFSP_LZSS_FindMatch(const uint8_t* p_puData, const uint32_t p_uDataL, const uint32_t p_uLow,
+                                    const uint32_t p_uIn, uint32_t* const p_puDist);
+static uint32_t eFSP_LZSS_PutLit(uint8_t* p_puData, const uint32_t p_uOut, const uint32_t p_uLitS,
+                                 const uint32_t p_uLitL, const bool_t p_bWrite);
+static bool_t eFSP_LZSS_Pass(uint8_t* p_puData, const uint32_t p_uDataL, const bool_t p_bWrite,
+                             uint32_t* const p_puOut);
+static bool_t eFSP_LZSS_GetVar(const uint8_t* p_puStream, const uint32_t p_uStreamL, uint32_t* const p_puVal,
+                               uint32_t* const p_puVarL);
+static e_eFSP_LZSS_RES eFSP_LZSS_CheckStream(const uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uCmpL,
+                                             const uint32_t p_uVarL, const uint32_t p_uDecL);
+static void eFSP_LZSS_Expand(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uCmpL,
+                             const uint32_t p_uVarL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_LZSS_RES eFSP_LZSS_Compress(uint8_t* p_puData, const uint32_t p_uDataL, uint32_t* const p_puCmpL)
+{
+	/* Local variable */
+	e_eFSP_LZSS_RES l_eRes;
+	uint32_t l_uCmpL;
+	uint32_t l_uVarL;
+	uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puData ) || ( NULL == p_puCmpL ) )
+	{
+		l_eRes = e_eFSP_LZSS_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uDataL < 1u )
+        {
+            l_eRes = e_eFSP_LZSS_RES_BADPARAM;
+        }
+        else
+        {
+            /* A dry pass find out if the stream fit in place and is shorter than the data, the second pass take the
+             * same decision and write the stream */
+            if( false == eFSP_LZSS_Pass(p_puData, p_uDataL, false, &l_uCmpL) )
+            {
+                l_eRes = e_eFSP_LZSS_RES_NOGAIN;
+            }
+            else
+            {
+                (void)eFSP_LZSS_Pass(p_puData, p_uDataL, true, &l_uCmpL);
+
+                /* The space of the length was left free by the passes */
+                l_uVarL = eFSP_LZSS_GetVarL(p_uDataL);
+
+                for( l_uIdx = 0u; l_uIdx < l_uVarL; l_uIdx++ )
+                {
+                    p_puData[l_uIdx] = (uint8_t) ( ( p_uDataL >> ( 7u * l_uIdx ) ) & 0x0000007Fu );
+
+                    if( ( l_uIdx + 1u ) < l_uVarL )
+                    {
+                        /* Another byte follows */
+                        p_puData[l_uIdx] |= 0x80u;
+                    }
+                }
+
+                *p_puCmpL = l_uCmpL;
+                l_eRes = e_eFSP_LZSS_RES_OK;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_LZSS_RES eFSP_LZSS_Decompress(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uCmpL,
+                                     uint32_t* const p_puDecL)
+{
+	/* Local variable */
+	e_eFSP_LZSS_RES l_eRes;
+	uint32_t l_uDecL;
+	uint32_t l_uVarL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_puArea ) || ( NULL == p_puDecL ) )
+	{
+		l_eRes = e_eFSP_LZSS_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_uCmpL < 1u ) || ( p_uCmpL > p_uAreaL ) )
+        {
+            l_eRes = e_eFSP_LZSS_RES_BADPARAM;
+        }
+        else
+        {
+            if( false == eFSP_LZSS_GetVar(p_puArea, p_uCmpL, &l_uDecL, &l_uVarL) )
+            {
+                l_eRes = e_eFSP_LZSS_RES_BADFRAME;
+            }
+            else if( l_uDecL > p_uAreaL )
+            {
+                l_eRes = e_eFSP_LZSS_RES_OUTOFMEM;
+            }
+            else
+            {
+                /* Nothing is written till the whole stream is known to be valid */
+                l_eRes = eFSP_LZSS_CheckStream(p_puArea, p_uAreaL, p_uCmpL, l_uVarL, l_uDecL);
+
+                if( e_eFSP_LZSS_RES_OK == l_eRes )
+                {
+                    eFSP_LZSS_Expand(p_puArea, p_uAreaL, p_uCmpL, l_uVarL);
+                    *p_puDecL = l_uDecL;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static uint32_t eFSP_LZSS_GetVarL(const uint32_t p_uVal)
+{
+    uint32_t l_uVarL;
+    uint32_t l_uRem;
+
+    l_uVarL = 1u;
+    l_uRem = p_uVal >> 7u;
+
+    while( l_uRem > 0u )
+    {
+        l_uVarL++;
+        l_uRem = l_uRem >> 7u;
+    }
+
+    return l_uVarL;
+}
+
+static uint32_t eFSP_LZSS_FindMatch(const uint8_t* p_puData, const uint32_t p_uDataL, const uint32_t p_uLow,
+                                    const uint32_t p_uIn, uint32_t* const p_puDist)
+{
+    uint32_t l_uBestL;
+    uint32_t l_uMaxL;
+    uint32_t l_uCand;
+    uint32_t l_uLen;
+
+    l_uBestL = 0u;
+    l_uMaxL = p_uDataL - p_uIn;
+
+    if( l_uMaxL > EFSP_LZSS_MAXMATCH )
+    {
+        l_uMaxL = EFSP_LZSS_MAXMATCH;
+    }
+
+    /* Search from the nearest byte, the match can overlap the bytes still to compress */
+    l_uCand = p_uIn;
+
+    while( ( l_uCand > p_uLow ) && ( l_uBestL < l_uMaxL ) )
+    {
+        l_uCand--;
+        l_uLen = 0u;
+
+        while( ( l_uLen < l_uMaxL ) && ( p_puData[l_uCand + l_uLen] == p_puData[p_uIn + l_uLen] ) )
+        {
+            l_uLen++;
+        }
+
+        if( l_uLen > l_uBestL )
+        {
+            l_uBestL = l_uLen;
+            *p_puDist = p_uIn - l_uCand;
+        }
+    }
+
+    return l_uBestL;
+}
+
+static uint32_t eFSP_LZSS_PutLit(uint8_t* p_puData, const uint32_t p_uOut, const uint32_t p_uLitS,
+                                 const uint32_t p_uLitL, const bool_t p_bWrite)
+{
+    if( true == p_bWrite )
+    {
+        /* Move the literals before writing the control byte, that can be over the first of them */
+        (void)memmove(&p_puData[p_uOut + 1u], &p_puData[p_uLitS], p_uLitL);
+        p_puData[p_uOut] = (uint8_t) ( p_uLitL - 1u );
+    }
+
+    return p_uOut + 1u + p_uLitL;
+}
+
+static bool_t eFSP_LZSS_Pass(uint8_t* p_puData, const uint32_t p_uDataL, const bool_t p_bWrite,
+                             uint32_t* const p_puOut)
+{
+    uint32_t l_uIn;
+    uint32_t l_uOut;
+    uint32_t l_uLitS;
+    uint32_t l_uLitL;
+    uint32_t l_uLow;
+    uint32_t l_uTokL;
+    uint32_t l_uMatchL;
+    uint32_t l_uDist;
+    bool_t l_bFit;
+
+    /* The stream is written from the start of the data, after the space reserved to the length. Every token must end
+     * before the bytes still to compress, so only the bytes not yet overwritten are used as window */
+    l_uIn = 0u;
+    l_uOut = eFSP_LZSS_GetVarL(p_uDataL);
+    l_uLitS = 0u;
+    l_uDist = 0u;
+    l_bFit = true;
+
+    while( ( true == l_bFit ) && ( l_uIn < p_uDataL ) )
+    {
+        if( l_uIn > EFSP_LZSS_WINDOW )
+        {
+            l_uLow = l_uIn - EFSP_LZSS_WINDOW;
+        }
+        else
+        {
+            l_uLow = 0u;
+        }
+
+        if( l_uLow < l_uOut )
+        {
+            l_uLow = l_uOut;
+        }
+
+        if( l_uLow < l_uIn )
+        {
+            l_uMatchL = eFSP_LZSS_FindMatch(p_puData, p_uDataL, l_uLow, l_uIn, &l_uDist);
+        }
+        else
+        {
+            l_uMatchL = 0u;
+        }
+
+        /* Pending literals are flushed together with the match */
+        l_uLitL = l_uIn - l_uLitS;
+
+        if( l_uLitL > 0u )
+        {
+            l_uTokL = l_uLitL + 3u;
+        }
+        else
+        {
+            l_uTokL = 2u;
+        }
+
+        if( ( l_uMatchL >= EFSP_LZSS_MINMATCH ) && ( ( l_uOut + l_uTokL ) <= ( l_uIn + l_uMatchL ) ) )
+        {
+            if( l_uLitL > 0u )
+            {
+                l_uOut = eFSP_LZSS_PutLit(p_puData, l_uOut, l_uLitS, l_uLitL, p_bWrite);
+            }
+
+            if( true == p_bWrite )
+            {
+                p_puData[l_uOut] = EFSP_LZSS_MATCHFLAG | (uint8_t) ( l_uMatchL - EFSP_LZSS_MINMATCH );
+                p_puData[l_uOut + 1u] = (uint8_t) ( l_uDist - 1u );
+            }
+
+            l_uOut += 2u;
+            l_uIn += l_uMatchL;
+            l_uLitS = l_uIn;
+        }
+        else if( l_uLitL < EFSP_LZSS_MAXLIT )
+        {
+            l_uIn++;
+        }
+        else
+        {
+            /* The run of literals is full and must be flushed alone */
+            if( ( l_uOut + 1u + l_uLitL ) <= l_uIn )
+            {
+                l_uOut = eFSP_LZSS_PutLit(p_puData, l_uOut, l_uLitS, l_uLitL, p_bWrite);
+                l_uLitS = l_uIn;
+            }
+            else
+            {
+                l_bFit = false;
+            }
+        }
+    }
+
+    if( true == l_bFit )
+    {
+        l_uLitL = p_uDataL - l_uLitS;
+
+        if( l_uLitL > 0u )
+        {
+            if( ( l_uOut + 1u + l_uLitL ) <= p_uDataL )
+            {
+                l_uOut = eFSP_LZSS_PutLit(p_puData, l_uOut, l_uLitS, l_uLitL, p_bWrite);
+            }
+            else
+            {
+                l_bFit = false;
+            }
+        }
+
+        if( l_uOut >= p_uDataL )
+        {
+            /* No gain */
+            l_bFit = false;
+        }
+    }
+
+    *p_puOut = l_uOut;
+
+    return l_bFit;
+}
+
+static bool_t eFSP_LZSS_GetVar(const uint8_t* p_puStream, const uint32_t p_uStreamL, uint32_t* const p_puVal,
+                               uint32_t* const p_puVarL)
+{
+    bool_t l_bRes;
+    bool_t l_bMore;
+    uint32_t l_uIdx;
+    uint32_t l_uVal;
+
+    l_bRes = true;
+    l_bMore = true;
+    l_uIdx = 0u;
+    l_uVal = 0u;
+
+    while( ( true == l_bRes ) && ( true == l_bMore ) )
+    {
+        if( ( l_uIdx >= p_uStreamL ) || ( l_uIdx >= EFSP_HDR_LENVARMAX ) )
+        {
+            l_bRes = false;
+        }
+        else if( ( ( EFSP_HDR_LENVARMAX - 1u ) == l_uIdx ) && ( p_puStream[l_uIdx] > 0x0Fu ) )
+        {
+            /* Bigger than an uint32_t */
+            l_bRes = false;
+        }
+        else
+        {
+            l_uVal |= ( (uint32_t) ( p_puStream[l_uIdx] & 0x7Fu ) ) << ( 7u * l_uIdx );
+
+            if( 0u == ( p_puStream[l_uIdx] & 0x80u ) )
+            {
+                l_bMore = false;
+            }
+
+            l_uIdx++;
+        }
+    }
+
+    if( ( true == l_bRes ) && ( l_uVal < 1u ) )
+    {
+        l_bRes = false;
+    }
+
+    *p_puVal = l_uVal;
+    *p_puVarL = l_uIdx;
+
+    return l_bRes;
+}
+
+static e_eFSP_LZSS_RES eFSP_LZSS_CheckStream(const uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uCmpL,
+                                             const uint32_t p_uVarL, const uint32_t p_uDecL)
+{
+    e_eFSP_LZSS_RES l_eRes;
+    uint32_t l_uBase;
+    uint32_t l_uRd;
+    uint32_t l_uWr;
+    uint32_t l_uTokL;
+    uint32_t l_uOutL;
+
+    /* The tokens will be moved at the end of the area, the data must never reach the tokens still to decode */
+    l_eRes = e_eFSP_LZSS_RES_OK;
+    l_uBase = p_uAreaL - p_uCmpL;
+    l_uRd = p_uVarL;
+    l_uWr = 0u;
+
+    while( ( e_eFSP_LZSS_RES_OK == l_eRes ) && ( l_uRd < p_uCmpL ) )
+    {
+        if( p_puArea[l_uRd] < EFSP_LZSS_MATCHFLAG )
+        {
+            l_uOutL = ( (uint32_t) p_puArea[l_uRd] ) + 1u;
+            l_uTokL = l_uOutL + 1u;
+        }
+        else if( ( l_uRd + 1u ) >= p_uCmpL )
+        {
+            l_uOutL = 0u;
+            l_uTokL = 0u;
+            l_eRes = e_eFSP_LZSS_RES_BADFRAME;
+        }
+        else
+        {
+            l_uOutL = ( (uint32_t) ( p_puArea[l_uRd] & 0x7Fu ) ) + EFSP_LZSS_MINMATCH;
+            l_uTokL = 2u;
+
+            if( ( ( (uint32_t) p_puArea[l_uRd + 1u] ) + 1u ) > l_uWr )
+            {
+                /* Match before the start of the data */
+                l_eRes = e_eFSP_LZSS_RES_BADFRAME;
+            }
+        }
+
+        if( e_eFSP_LZSS_RES_OK == l_eRes )
+        {
+            if( ( ( p_uCmpL - l_uRd ) < l_uTokL ) || ( ( p_uDecL - l_uWr ) < l_uOutL ) )
+            {
+                l_eRes = e_eFSP_LZSS_RES_BADFRAME;
+            }
+            else
+            {
+                l_uRd += l_uTokL;
+                l_uWr += l_uOutL;
+
+                if( l_uWr > ( l_uBase + l_uRd ) )
+                {
+                    l_eRes = e_eFSP_LZSS_RES_OUTOFMEM;
+                }
+            }
+        }
+    }
+
+    if( ( e_eFSP_LZSS_RES_OK == l_eRes ) && ( l_uWr != p_uDecL ) )
+    {
+        l_eRes = e_eFSP_LZSS_RES_BADFRAME;
+    }
+
+    return l_eRes;
+}
+
+static void eFSP_LZSS_Expand(uint8_t* p_puArea, const uint32_t p_uAreaL, const uint32_t p_uCmpL,
+                             const uint32_t p_uVarL)
+{
+    uint32_t l_uRd;
+    uint32_t l_uWr;
+    uint32_t l_uLen;
+    uint32_t l_uDist;
+    uint32_t l_uIdx;
+
+    /* Stream already checked, move the tokens at the end of the area */
+    (void)memmove(&p_puArea[p_uAreaL - p_uCmpL], p_puArea, p_uCmpL);
+    l_uRd = p_uAreaL - p_uCmpL + p_uVarL;
+    l_uWr = 0u;
+
+    while( l_uRd < p_uAreaL )
+    {
+        if( p_puArea[l_uRd] < EFSP_LZSS_MATCHFLAG )
+        {
+            l_uLen = ( (uint32_t) p_puArea[l_uRd] ) + 1u;
+            (void)memmove(&p_puArea[l_uWr], &p_puArea[l_uRd + 1u], l_uLen);
+            l_uRd += l_uLen + 1u;
+        }
+        else
+        {
+            l_uLen = ( (uint32_t) ( p_puArea[l_uRd] & 0x7Fu ) ) + EFSP_LZSS_MINMATCH;
+            l_uDist = ( (uint32_t) p_puArea[l_uRd + 1u] ) + 1u;
+            l_uRd += 2u;
+
+            /* Byte by byte, the match can overlap the data it is building */
+            for( l_uIdx = 0u; l_uIdx < l_uLen; l_uIdx++ )
+            {
+                p_puArea[l_uWr + l_uIdx] = p_puArea[l_uWr + l_uIdx - l_uDist];
+            }
+        }
+
+        l_uWr += l_uLen;
+    }
+}
\ No newline at end of file
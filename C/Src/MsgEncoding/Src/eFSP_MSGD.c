@@ -21,12 +21,42 @@
  **********************************************************************************************************************/
 static bool_t eFSP_MSGD_isStatusStillCoherent(const t_eFSP_MSGD_Ctx* p_ptCtx);
 static e_eFSP_MSGD_RES eFSP_MSGD_convertReturnFromBstf(e_eCU_BUNSTF_RES p_eRetEvent);
+static e_eCU_BUNSTF_RES eFSP_MSGD_convertReturnFromCobs(e_eFSP_COBS_RES p_eRetEvent);
+static e_eCU_BUNSTF_RES eFSP_MSGD_convertReturnFromTrsp(e_eFSP_TRSP_RES p_eRetEvent);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmCheck(t_eFSP_MSGD_Ctx* const p_ptCtx);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmNew(t_eFSP_MSGD_Ctx* const p_ptCtx);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmGetData(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                             uint32_t* const p_puDataL);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmIsWaitSof(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsWaitSof);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmIsEnded(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsEnded);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmIsBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsBad);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmInsChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                              const uint32_t p_uEncL, uint32_t* const p_puUsedL);
+static e_eCU_BUNSTF_RES eFSP_MSGD_TrspInsChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                               const uint32_t p_uEncL, uint32_t* const p_puUsedL);
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmResync(t_eFSP_MSGD_Ctx* const p_ptCtx);
 static e_eFSP_MSGD_RES eFSP_MSGD_IsFullMsgDec(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsMsgDec);
 static e_eFSP_MSGD_RES eFSP_MSGD_IsFrmBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsFrameBad);
-static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_pbIsCor, f_eFSP_MSGD_CrcCb p_fCrc,
-                                           t_eFSP_MSGD_CrcCtx* p_ptCrcCtx);
-static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_pbIsCoh);
-static uint32_t eFSP_MSGD_CreateU32LE(uint8_t p_uV1, uint8_t p_uV2, uint8_t p_uV3, uint8_t p_uV4);
+static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* p_pbIsCor);
+static e_eFSP_MSGD_RES eFSP_MSGD_FecFix(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsFix);
+static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* p_pbIsCoh);
+static bool_t eFSP_MSGD_IsHdrValid(const uint32_t p_uCrcL, const uint32_t p_uLenL);
+static bool_t eFSP_MSGD_IsFrmValid(const uint32_t p_uFrm);
+static bool_t eFSP_MSGD_IsWhtValid(const uint32_t p_uWhtL);
+static bool_t eFSP_MSGD_IsCmpValid(const uint32_t p_uCmpL);
+static bool_t eFSP_MSGD_IsDltValid(const t_eFSP_MSGD_Ctx* p_ptCtx);
+static bool_t eFSP_MSGD_IsFecValid(const uint32_t p_uFecL);
+static uint32_t eFSP_MSGD_GetRawL(const t_eFSP_MSGD_Ctx* p_ptCtx, const uint32_t p_uHdrL, const uint32_t p_uDeclL);
+static uint32_t eFSP_MSGD_GetFieldMax(const uint32_t p_uFieldL);
+static uint32_t eFSP_MSGD_CreateUxLE(const uint8_t* p_puV, const uint32_t p_uFieldL);
+static bool_t eFSP_MSGD_ParseHdr(const t_eFSP_MSGD_Ctx* p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL,
+                                 uint32_t* const p_puHdrL, uint32_t* const p_puDeclL);
+static e_eFSP_MSGD_RES eFSP_MSGD_GetWhtMask(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* const p_puMask);
+static e_eFSP_MSGD_RES eFSP_MSGD_WhtXor(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t p_uMask);
+static bool_t eFSP_MSGD_Expand(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uHdrL,
+                               const uint32_t p_uDataL);
+static bool_t eFSP_MSGD_ApplyDelta(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uHdrL,
+                                   const uint32_t p_uPayL);
 
 
 
@@ -57,10 +87,37 @@ e_eFSP_MSGD_RES eFSP_MSGD_InitCtx(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puB
             /* Initialize internal status clbck */
             p_ptCtx->fCrc = p_fCrc;
             p_ptCtx->ptCrcCtx = p_ptFctx;
-
-			/* initialize internal bytestuffer */
+            p_ptCtx->uCrcL = EFSP_HDR_CRC32;
+            p_ptCtx->uLenL = EFSP_HDR_LEN32;
+            p_ptCtx->uFrm = EFSP_FRM_ESC;
+            p_ptCtx->uWhtL = EFSP_HDR_WHTNONE;
+            p_ptCtx->uCmpL = EFSP_HDR_CMPNONE;
+            p_ptCtx->uDecL = 0u;
+            p_ptCtx->uDltL = EFSP_HDR_DLTNONE;
+            p_ptCtx->puDltBase = NULL;
+            p_ptCtx->uDltBaseL = 0u;
+            p_ptCtx->uDltUseL = 0u;
+            p_ptCtx->uDltSeq = 0u;
+            p_ptCtx->uFecL = EFSP_FEC_NONE;
+            p_ptCtx->uFecCutL = 0u;
+
+			/* initialize internal bytestuffer, every engine decode in the same memory area */
 			l_eResBSTF =  eCU_BUNSTF_InitCtx(&p_ptCtx->tBUNSTFCtx, &p_puBuff[0u], p_uBuffL);
 			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                l_eResBSTF = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_InitDecCtx(&p_ptCtx->tCOBSCtx, &p_puBuff[0u],
+                                                                                  p_uBuffL));
+                l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+            }
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                l_eResBSTF = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_InitDecCtx(&p_ptCtx->tTRSPCtx, &p_puBuff[0u],
+                                                                                  p_uBuffL));
+                l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+            }
         }
 	}
 
@@ -87,11 +144,12 @@ e_eFSP_MSGD_RES eFSP_MSGD_IsInit(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* p_pbIsI
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_NewMsg(t_eFSP_MSGD_Ctx* const p_ptCtx)
+e_eFSP_MSGD_RES eFSP_MSGD_SetHeader(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
 	e_eCU_BUNSTF_RES l_eResBSTF;
+    bool_t l_bIsInit;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -107,26 +165,42 @@ e_eFSP_MSGD_RES eFSP_MSGD_NewMsg(t_eFSP_MSGD_Ctx* const p_ptCtx)
 		}
 		else
 		{
-			/* Update index */
-			l_eResBSTF = eCU_BUNSTF_NewFrame(&p_ptCtx->tBUNSTFCtx);
-			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBSTF = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGD_IsHdrValid(p_uCrcL, p_uLenL) )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uCrcL = p_uCrcL;
+                    p_ptCtx->uLenL = p_uLenL;
+                }
+            }
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedData(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t** p_ppuDat, uint32_t* const p_puGetL)
+e_eFSP_MSGD_RES eFSP_MSGD_SetFraming(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uFrm)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
 	e_eCU_BUNSTF_RES l_eResBSTF;
-	uint8_t*  l_puData;
-    uint8_t** l_ppuData;
-	uint32_t  l_uDataL;
+    bool_t l_bIsInit;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuDat ) || ( NULL == p_puGetL ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -139,47 +213,44 @@ e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedData(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t
 		}
 		else
 		{
-			/* Get memory reference of CRC+LEN+DATA, so we can calculate reference of only data payload */
-            l_uDataL = 0u;
-            l_puData = NULL;
-            l_ppuData = &l_puData;
-			l_eResBSTF = eCU_BUNSTF_GetUnstufData(&p_ptCtx->tBUNSTFCtx, l_ppuData, &l_uDataL);
-			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
-
-			if( e_eFSP_MSGD_RES_OK == l_eRes )
-			{
-                /* Starting point is always the same */
-                *p_ppuDat = &(*l_ppuData)[EFSP_MSGDE_HEADERSIZE];
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBSTF = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
-				/* Removed HADER from data ( CRC + DATA LEN ) */
-                if( l_uDataL < EFSP_MIN_MSGDE_BUFFLEN )
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
                 {
-					/* No memory free */
-                    *p_puGetL = 0u;
+                    l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGD_IsFrmValid(p_uFrm) )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_BADPARAM;
                 }
                 else
                 {
-                    /* Return reference of only the raw payload */
-                    *p_puGetL = l_uDataL - EFSP_MSGDE_HEADERSIZE;
+                    /* The data received with the previous engine can not be used */
+                    p_ptCtx->uFrm = p_uFrm;
+                    l_eResBSTF = eFSP_MSGD_FrmNew(p_ptCtx);
+                    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
                 }
-
-				l_eRes = e_eFSP_MSGD_RES_OK;
-			}
+            }
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint32_t* const p_puRetrivedL)
+e_eFSP_MSGD_RES eFSP_MSGD_SetWhitening(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uWhtL)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
 	e_eCU_BUNSTF_RES l_eResBSTF;
-	uint32_t l_uDataL;
+    bool_t l_bIsInit;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puRetrivedL ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -192,41 +263,41 @@ e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint32_t
 		}
 		else
 		{
-			/* Get memory reference of CRC+LEN+DATA, so we can calculate reference of only data payload */
-            l_uDataL = 0u;
-			l_eResBSTF = eCU_BUNSTF_GetUnstufLen(&p_ptCtx->tBUNSTFCtx, &l_uDataL);
-			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBSTF = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
-			if( e_eFSP_MSGD_RES_OK == l_eRes )
-			{
-				/* Removed HADER from data ( CRC + DATA LEN ) */
-                if( l_uDataL < EFSP_MIN_MSGDE_BUFFLEN )
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
                 {
-					/* No memory free */
-                    *p_puRetrivedL = 0u;
+                    l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGD_IsWhtValid(p_uWhtL) )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_BADPARAM;
                 }
                 else
                 {
-                    /* Return reference of only the raw payload */
-                    *p_puRetrivedL = l_uDataL - EFSP_MSGDE_HEADERSIZE;
+                    p_ptCtx->uWhtL = p_uWhtL;
                 }
-
-				l_eRes = e_eFSP_MSGD_RES_OK;
-			}
+            }
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_IsWaitingSof(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsWaitingSof)
+e_eFSP_MSGD_RES eFSP_MSGD_SetCompression(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uCmpL)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
 	e_eCU_BUNSTF_RES l_eResBSTF;
+    bool_t l_bIsInit;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsWaitingSof ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -239,21 +310,41 @@ e_eFSP_MSGD_RES eFSP_MSGD_IsWaitingSof(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* c
 		}
 		else
 		{
-			l_eResBSTF = eCU_BUNSTF_IsWaitingSof(&p_ptCtx->tBUNSTFCtx, p_pbIsWaitingSof);
-			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBSTF = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGD_IsCmpValid(p_uCmpL) )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uCmpL = p_uCmpL;
+                }
+            }
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_IsAFullMsgDecoded(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsMsgDec)
+e_eFSP_MSGD_RES eFSP_MSGD_SetDelta(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+    bool_t l_bIsInit;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsMsgDec ) )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBase ) )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -266,20 +357,45 @@ e_eFSP_MSGD_RES eFSP_MSGD_IsAFullMsgDecoded(t_eFSP_MSGD_Ctx* const p_ptCtx, bool
 		}
 		else
 		{
-            l_eRes = eFSP_MSGD_IsFullMsgDec(p_ptCtx, p_pbIsMsgDec);
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBSTF = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+                }
+                else if( p_uBaseL < 1u )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Differences are discarded till a key frame is received */
+                    p_ptCtx->uDltL = EFSP_HDR_DLT;
+                    p_ptCtx->puDltBase = p_puBase;
+                    p_ptCtx->uDltBaseL = p_uBaseL;
+                    p_ptCtx->uDltUseL = 0u;
+                }
+            }
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_IsFrameBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsFrameBad)
+e_eFSP_MSGD_RES eFSP_MSGD_SetFec(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint32_t p_uFecL)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+    bool_t l_bIsInit;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsFrameBad ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -292,29 +408,40 @@ e_eFSP_MSGD_RES eFSP_MSGD_IsFrameBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* con
 		}
 		else
 		{
-            l_eRes = eFSP_MSGD_IsFrmBad(p_ptCtx, p_pbIsFrameBad);
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBSTF = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGD_IsFecValid(p_uFecL) )
+                {
+                    l_eRes = e_eFSP_MSGD_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uFecL = p_uFecL;
+                }
+            }
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_GetMostEffDatLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint32_t* const p_puMostEffPayL)
+e_eFSP_MSGD_RES eFSP_MSGD_NewMsg(t_eFSP_MSGD_Ctx* const p_ptCtx)
 {
 	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
 	e_eCU_BUNSTF_RES l_eResBSTF;
-    bool_t l_bIsFullUNSTF;
-    bool_t l_bIsWaitingSof;
-    bool_t l_bIsFrameBad;
-    uint32_t l_uDataLRemaings;
-	uint32_t l_uDPayRx;
-    uint32_t l_uDataLRaw;
-	uint8_t* l_puData;
-    uint32_t l_uDPayTRx;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puMostEffPayL ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -327,133 +454,29 @@ e_eFSP_MSGD_RES eFSP_MSGD_GetMostEffDatLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint3
 		}
 		else
 		{
-            /* Check if the frame is already ended */
-            l_bIsFullUNSTF = false;
-            l_eResBSTF = eCU_BUNSTF_IsAFullFrameUnstuff(&p_ptCtx->tBUNSTFCtx, &l_bIsFullUNSTF);
-            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
-
-            if( e_eFSP_MSGD_RES_OK == l_eRes )
-            {
-                if( true == l_bIsFullUNSTF )
-                {
-                    /* Full unstuffed frame, could be wrong or rigth but no more data is needed */
-                    *p_puMostEffPayL = 0u;
-                }
-                else
-                {
-                    /* Check for error */
-                    l_bIsFrameBad = true;
-                    l_eResBSTF = eCU_BUNSTF_IsFrameBad(&p_ptCtx->tBUNSTFCtx, &l_bIsFrameBad);
-                    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
-
-                    if( e_eFSP_MSGD_RES_OK == l_eRes )
-                    {
-                        if( true == l_bIsFrameBad )
-                        {
-                            /* Bad frame only for unstuffer level, dont request more data */
-                            *p_puMostEffPayL = 0u;
-                        }
-                        else
-                        {
-                            /* How many byte do we have decoded? */
-                            l_uDataLRaw = 0u;
-                            l_puData = NULL;
-                            l_eResBSTF = eCU_BUNSTF_GetUnstufData(&p_ptCtx->tBUNSTFCtx, &l_puData, &l_uDataLRaw);
-                            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
-
-                            if( e_eFSP_MSGD_RES_OK == l_eRes )
-                            {
-                                /* Do we have enough data?  */
-                                if( 0u == l_uDataLRaw )
-                                {
-                                    /* No data, are we still waiting SOF? */
-                                    l_bIsWaitingSof = false;
-                                    l_eResBSTF = eCU_BUNSTF_IsWaitingSof(&p_ptCtx->tBUNSTFCtx, &l_bIsWaitingSof);
-                                    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
-
-                                    if( e_eFSP_MSGD_RES_OK == l_eRes )
-                                    {
-                                        if( true == l_bIsWaitingSof )
-                                        {
-                                            /* Header + SOF */
-                                            *p_puMostEffPayL = EFSP_MSGDE_HEADERSIZE + 1u;
-                                        }
-                                        else
-                                        {
-                                            /* Header only */
-                                            *p_puMostEffPayL = EFSP_MSGDE_HEADERSIZE;
-                                        }
-                                    }
-                                }
-                                else if( l_uDataLRaw < EFSP_MSGDE_HEADERSIZE )
-                                {
-                                    /* Need to receive all the header before estimating data size */
-                                    *p_puMostEffPayL = EFSP_MSGDE_HEADERSIZE - l_uDataLRaw;
-                                }
-                                else
-                                {
-                                    /* Enough data! Start remaining data estimation */
-                                    l_uDPayTRx = eFSP_MSGD_CreateU32LE(l_puData[0x04u], l_puData[0x05u],
-                                                                        l_puData[0x06u], l_puData[0x07u]);
-
-                                    /* How much payload do we have */
-                                    l_uDPayRx = l_uDataLRaw - EFSP_MSGDE_HEADERSIZE;
-
-                                    /* A correct frame payload must have less lenght than the size reported in frame
-                                     * header */
-                                    if( l_uDPayRx <= l_uDPayTRx )
-                                    {
-                                        l_uDataLRemaings = l_uDPayTRx - l_uDPayRx;
-
-                                        /* Wait remaining data + EOF */
-                                        if( l_uDataLRemaings < MAX_UINT32VAL )
-                                        {
-                                            /* l_uDataLRemaings != 0 -> need data + EOF
-                                             * l_uDataLRemaings == 0 -> need EOF . Infact we are sure the frame is not
-                                             * ended because we already have called the function
-                                             * BUNSTF_IsAFullFrameUnstuff */
-                                            *p_puMostEffPayL = l_uDataLRemaings + 1u;
-                                        }
-                                        else
-                                        {
-                                            *p_puMostEffPayL = l_uDataLRemaings;
-                                        }
-                                    }
-                                    else
-                                    {
-                                        /* We have more data than expected -> bad frame -> no need to receive data */
-                                        *p_puMostEffPayL = 0u;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+			/* Update index */
+			l_eResBSTF = eFSP_MSGD_FrmNew(p_ptCtx);
+			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 		}
 	}
 
 	return l_eRes;
 }
 
-e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puEncArea, const uint32_t p_uEncL,
-                                      uint32_t* const p_puUsedEncB)
+e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedData(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t** p_ppuDat, uint32_t* const p_puGetL)
 {
-	/* Local return  */
+	/* Local variable */
 	e_eFSP_MSGD_RES l_eRes;
-    e_eFSP_MSGD_RES l_eResMsgCor;
-    e_eFSP_MSGD_RES l_eResMsgCoh;
 	e_eCU_BUNSTF_RES l_eResBSTF;
-
-    /* Local coherence */
-    bool_t l_bIsMCor;
-    bool_t l_bIsMCoh;
-
-    /* Redo loop var */
-    e_eFSP_MSGDPRV_SM l_eInsEncState;
+	uint8_t*  l_puData;
+    uint8_t** l_ppuData;
+	uint32_t  l_uDataL;
+    uint32_t  l_uHdrL;
+    uint32_t  l_uDeclL;
+    bool_t    l_bHdrOk;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puEncArea ) || ( NULL == p_puUsedEncB ) )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuDat ) || ( NULL == p_puGetL ) )
 	{
 		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
 	}
@@ -466,21 +489,475 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
 		}
 		else
 		{
-            /* Init data */
-            *p_puUsedEncB = 0u;
-
-            /* Elaborate */
-            l_eInsEncState = e_eFSP_MSGDPRV_SM_PRECHECK;
-            l_eRes = e_eFSP_MSGD_RES_OK;
+			/* Get memory reference of CRC+LEN+DATA, so we can calculate reference of only data payload */
+            l_uDataL = 0u;
+            l_puData = NULL;
+            l_ppuData = &l_puData;
+			l_eResBSTF = eFSP_MSGD_FrmGetData(p_ptCtx, l_ppuData, &l_uDataL);
+			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
-            while( l_eInsEncState != e_eFSP_MSGDPRV_SM_ELABDONE )
+            if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
             {
-                switch( l_eInsEncState )
-                {
+                l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+            }
+
+			if( e_eFSP_MSGD_RES_OK == l_eRes )
+			{
+                /* Starting point is after the header, that can have a variable size */
+                l_bHdrOk = eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDeclL);
+                *p_ppuDat = &(*l_ppuData)[l_uHdrL];
+
+				/* Removed HADER from data ( CRC + DATA LEN ) */
+                if( ( false == l_bHdrOk ) || ( l_uDataL < ( l_uHdrL + EFSP_MIN_MSGDE_PAYLOAD ) ) )
+                {
+					/* No memory free */
+                    *p_puGetL = 0u;
+                }
+                else if( 0u != p_ptCtx->uDecL )
+                {
+                    /* Payload decompressed in place */
+                    *p_puGetL = p_ptCtx->uDecL;
+                }
+                else
+                {
+                    /* Return reference of only the raw payload */
+                    *p_puGetL = l_uDataL - l_uHdrL;
+                }
+
+				l_eRes = e_eFSP_MSGD_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_GetDecodedLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint32_t* const p_puRetrivedL)
+{
+	/* Local variable */
+	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+	uint32_t l_uDataL;
+    uint32_t l_uHdrL;
+    uint32_t l_uDeclL;
+	uint8_t* l_puData;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRetrivedL ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+			/* Get memory reference of CRC+LEN+DATA, so we can calculate reference of only data payload */
+            l_uDataL = 0u;
+            l_puData = NULL;
+			l_eResBSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataL);
+			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+            {
+                l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+            }
+
+			if( e_eFSP_MSGD_RES_OK == l_eRes )
+			{
+				/* Removed HADER from data ( CRC + DATA LEN ) */
+                if( ( false == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDeclL) ) ||
+                    ( l_uDataL < ( l_uHdrL + EFSP_MIN_MSGDE_PAYLOAD ) ) )
+                {
+					/* No memory free */
+                    *p_puRetrivedL = 0u;
+                }
+                else if( 0u != p_ptCtx->uDecL )
+                {
+                    /* Payload decompressed in place */
+                    *p_puRetrivedL = p_ptCtx->uDecL;
+                }
+                else
+                {
+                    /* Return reference of only the raw payload */
+                    *p_puRetrivedL = l_uDataL - l_uHdrL;
+                }
+
+				l_eRes = e_eFSP_MSGD_RES_OK;
+			}
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_GetDeclaredLen(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsKnown,
+                                         uint32_t* const p_puDeclaredL)
+{
+	/* Local variable */
+	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+    uint32_t l_uDataLRaw;
+	uint8_t* l_puData;
+    uint32_t l_uHdrL;
+    uint32_t l_uDeclL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsKnown ) || ( NULL == p_puDeclaredL ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* How many byte do we have decoded? */
+            l_uDataLRaw = 0u;
+            l_puData = NULL;
+            l_eResBSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataLRaw);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+            {
+                l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+            }
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                /* CRC + LEN, the len is after the CRC */
+                if( ( false == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataLRaw, &l_uHdrL, &l_uDeclL) ) ||
+                    ( l_uDataLRaw < l_uHdrL ) )
+                {
+                    /* Header not received yet, or a malformed one */
+                    *p_pbIsKnown = false;
+                    *p_puDeclaredL = 0u;
+                }
+                else
+                {
+                    *p_pbIsKnown = true;
+                    *p_puDeclaredL = l_uDeclL;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_IsWaitingSof(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsWaitingSof)
+{
+	/* Local variable */
+	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsWaitingSof ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+			l_eResBSTF = eFSP_MSGD_FrmIsWaitSof(p_ptCtx, p_pbIsWaitingSof);
+			l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_IsAFullMsgDecoded(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsMsgDec)
+{
+	/* Local variable */
+	e_eFSP_MSGD_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsMsgDec ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+            l_eRes = eFSP_MSGD_IsFullMsgDec(p_ptCtx, p_pbIsMsgDec);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_IsFrameBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsFrameBad)
+{
+	/* Local variable */
+	e_eFSP_MSGD_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsFrameBad ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+            l_eRes = eFSP_MSGD_IsFrmBad(p_ptCtx, p_pbIsFrameBad);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_GetMostEffDatLen(t_eFSP_MSGD_Ctx* const p_ptCtx, uint32_t* const p_puMostEffPayL)
+{
+	/* Local variable */
+	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+    bool_t l_bIsFullUNSTF;
+    bool_t l_bIsWaitingSof;
+    bool_t l_bIsFrameBad;
+    uint32_t l_uDataLRemaings;
+	uint32_t l_uDPayRx;
+    uint32_t l_uDataLRaw;
+	uint8_t* l_puData;
+    uint32_t l_uDPayTRx;
+    uint32_t l_uHdrL;
+    uint32_t l_uSofL;
+    uint32_t l_uEofL;
+    bool_t l_bHdrOk;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puMostEffPayL ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if the frame is already ended */
+            l_bIsFullUNSTF = false;
+            l_eResBSTF = eFSP_MSGD_FrmIsEnded(p_ptCtx, &l_bIsFullUNSTF);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+            if( e_eFSP_MSGD_RES_OK == l_eRes )
+            {
+                if( true == l_bIsFullUNSTF )
+                {
+                    /* Full unstuffed frame, could be wrong or rigth but no more data is needed */
+                    *p_puMostEffPayL = 0u;
+                }
+                else
+                {
+                    /* Check for error */
+                    l_bIsFrameBad = true;
+                    l_eResBSTF = eFSP_MSGD_FrmIsBad(p_ptCtx, &l_bIsFrameBad);
+                    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+                    if( e_eFSP_MSGD_RES_OK == l_eRes )
+                    {
+                        if( true == l_bIsFrameBad )
+                        {
+                            /* Bad frame only for unstuffer level, dont request more data */
+                            *p_puMostEffPayL = 0u;
+                        }
+                        else
+                        {
+                            /* How many byte do we have decoded? */
+                            l_uDataLRaw = 0u;
+                            l_puData = NULL;
+                            l_eResBSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataLRaw);
+                            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+                            if( ( e_eFSP_MSGD_RES_OK == l_eRes ) &&
+                                ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+                            {
+                                l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+                            }
+
+                            if( e_eFSP_MSGD_RES_OK == l_eRes )
+                            {
+                                /* The transparent engine start with a sync sequence and has no end of frame */
+                                if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+                                {
+                                    l_uSofL = EFSP_TRSP_SYNCL;
+                                    l_uEofL = 0u;
+                                }
+                                else
+                                {
+                                    l_uSofL = 1u;
+                                    l_uEofL = 1u;
+                                }
+
+                                /* Size of the header received till now, or of the smallest one when the length is
+                                 * not complete */
+                                l_uDPayTRx = 0u;
+                                l_uHdrL = 0u;
+                                l_bHdrOk = eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataLRaw, &l_uHdrL, &l_uDPayTRx);
+
+                                /* Do we have enough data?  */
+                                if( ( false == l_bHdrOk ) && ( EFSP_FEC_NONE != p_ptCtx->uFecL ) )
+                                {
+                                    /* The header could be corrected at the end of the frame, wait for it */
+                                    *p_puMostEffPayL = 1u;
+                                }
+                                else if( false == l_bHdrOk )
+                                {
+                                    /* Malformed length -> bad frame -> no need to receive data */
+                                    *p_puMostEffPayL = 0u;
+                                }
+                                else if( 0u == l_uDataLRaw )
+                                {
+                                    /* No data, are we still waiting SOF? */
+                                    l_bIsWaitingSof = false;
+                                    l_eResBSTF = eFSP_MSGD_FrmIsWaitSof(p_ptCtx, &l_bIsWaitingSof);
+                                    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+                                    if( e_eFSP_MSGD_RES_OK == l_eRes )
+                                    {
+                                        if( true == l_bIsWaitingSof )
+                                        {
+                                            /* Header + SOF */
+                                            *p_puMostEffPayL = l_uHdrL + l_uSofL;
+                                        }
+                                        else
+                                        {
+                                            /* Header only */
+                                            *p_puMostEffPayL = l_uHdrL;
+                                        }
+                                    }
+                                }
+                                else if( l_uDataLRaw < l_uHdrL )
+                                {
+                                    /* Need to receive all the header before estimating data size */
+                                    *p_puMostEffPayL = l_uHdrL - l_uDataLRaw;
+                                }
+                                else
+                                {
+                                    /* Enough data! Start remaining data estimation */
+                                    /* How much payload do we have, the parity follow the payload */
+                                    l_uDPayRx = l_uDataLRaw - l_uHdrL;
+                                    l_uDPayTRx = eFSP_MSGD_GetRawL(p_ptCtx, l_uHdrL, l_uDPayTRx);
+
+                                    /* A correct frame payload must have less lenght than the size reported in frame
+                                     * header */
+                                    if( l_uDPayRx <= l_uDPayTRx )
+                                    {
+                                        l_uDataLRemaings = l_uDPayTRx - l_uDPayRx;
+
+                                        /* Wait remaining data + EOF */
+                                        if( l_uDataLRemaings <= ( MAX_UINT32VAL - l_uEofL ) )
+                                        {
+                                            /* l_uDataLRemaings != 0 -> need data + EOF
+                                             * l_uDataLRemaings == 0 -> need EOF . Infact we are sure the frame is not
+                                             * ended because we already have called the function
+                                             * BUNSTF_IsAFullFrameUnstuff */
+                                            *p_puMostEffPayL = l_uDataLRemaings + l_uEofL;
+                                        }
+                                        else
+                                        {
+                                            *p_puMostEffPayL = l_uDataLRemaings;
+                                        }
+                                    }
+                                    else if( EFSP_FEC_NONE != p_ptCtx->uFecL )
+                                    {
+                                        /* The length could be wrong till the end of the frame, wait for it */
+                                        *p_puMostEffPayL = 1u;
+                                    }
+                                    else
+                                    {
+                                        /* We have more data than expected -> bad frame -> no need to receive data */
+                                        *p_puMostEffPayL = 0u;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t* p_puEncArea,
+                                      const uint32_t p_uEncL, uint32_t* const p_puUsedEncB)
+{
+	/* Local return  */
+	e_eFSP_MSGD_RES l_eRes;
+    e_eFSP_MSGD_RES l_eResMsgCor;
+    e_eFSP_MSGD_RES l_eResMsgCoh;
+	e_eCU_BUNSTF_RES l_eResBSTF;
+
+    /* Local coherence */
+    bool_t l_bIsMCor;
+    bool_t l_bIsMCoh;
+    bool_t l_bIsFix;
+    uint8_t l_uMask;
+
+    /* Redo loop var */
+    e_eFSP_MSGDPRV_SM l_eInsEncState;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puEncArea ) || ( NULL == p_puUsedEncB ) )
+	{
+		l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGD_isStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Init data */
+            *p_puUsedEncB = 0u;
+
+            /* Elaborate */
+            l_eInsEncState = e_eFSP_MSGDPRV_SM_PRECHECK;
+            l_eRes = e_eFSP_MSGD_RES_OK;
+
+            while( l_eInsEncState != e_eFSP_MSGDPRV_SM_ELABDONE )
+            {
+                switch( l_eInsEncState )
+                {
                     case e_eFSP_MSGDPRV_SM_PRECHECK:
                     {
                         /* Before inserting data check if the current message is coherent */
-                        l_eResMsgCoh = eFSP_MSGD_isMsgCohe(&p_ptCtx->tBUNSTFCtx, &l_bIsMCoh);
+                        l_eResMsgCoh = eFSP_MSGD_isMsgCohe(p_ptCtx, &l_bIsMCoh);
 
                         if( e_eFSP_MSGD_RES_OK == l_eResMsgCoh )
                         {
@@ -510,7 +987,7 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
                     case e_eFSP_MSGDPRV_SM_INSERTCHUNK:
                     {
                         /* Insert data */
-                        l_eResBSTF = eCU_BUNSTF_InsStufChunk(&p_ptCtx->tBUNSTFCtx, p_puEncArea, p_uEncL, p_puUsedEncB);
+                        l_eResBSTF = eFSP_MSGD_FrmInsChunk(p_ptCtx, p_puEncArea, p_uEncL, p_puUsedEncB);
                         l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
                         if( e_eFSP_MSGD_RES_MESSAGEENDED == l_eRes )
@@ -523,6 +1000,11 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
                             /* Check if okied correclty */
                             l_eInsEncState = e_eFSP_MSGDPRV_SM_OKCHECK;
                         }
+                        else if( ( e_eFSP_MSGD_RES_BADFRAME == l_eRes ) && ( EFSP_FRM_TRSP == p_ptCtx->uFrm ) )
+                        {
+                            /* The transparent engine search the next frame by itself */
+                            l_eInsEncState = e_eFSP_MSGDPRV_SM_RESYNC;
+                        }
                         else if( e_eFSP_MSGD_RES_BADFRAME == l_eRes )
                         {
                             /* bad frame, return till somehome will restart elaboration */
@@ -544,14 +1026,47 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
 
                     case e_eFSP_MSGDPRV_SM_ENDCHECK:
                     {
-                        /* Verify message integrity */
-                        l_eResMsgCor = eFSP_MSGD_isMsgCorr(&p_ptCtx->tBUNSTFCtx, &l_bIsMCor, p_ptCtx->fCrc, 
-                                                           p_ptCtx->ptCrcCtx);
+                        /* Correct the errors, the parity was calculated on the whitened message */
+                        l_uMask = 0u;
+                        l_bIsMCor = false;
+                        l_eResMsgCor = eFSP_MSGD_FecFix(p_ptCtx, &l_bIsFix);
+
+                        if( ( e_eFSP_MSGD_RES_OK == l_eResMsgCor ) && ( true == l_bIsFix ) )
+                        {
+                            /* Remove the whitening, the CRC was calculated on the original payload */
+                            l_eResMsgCor = eFSP_MSGD_GetWhtMask(p_ptCtx, &l_uMask);
+
+                            if( e_eFSP_MSGD_RES_OK == l_eResMsgCor )
+                            {
+                                l_eResMsgCor = eFSP_MSGD_WhtXor(p_ptCtx, l_uMask);
+                            }
+
+                            /* Verify message integrity */
+                            if( e_eFSP_MSGD_RES_OK == l_eResMsgCor )
+                            {
+                                l_eResMsgCor = eFSP_MSGD_isMsgCorr(p_ptCtx, &l_bIsMCor);
+                            }
+                        }
 
                         if( e_eFSP_MSGD_RES_OK == l_eResMsgCor )
                         {
                             /* no strange error found, check message correctness */
-                            if( true != l_bIsMCor )
+                            if( ( true != l_bIsMCor ) && ( EFSP_FRM_TRSP == p_ptCtx->uFrm ) )
+                            {
+                                /* The sync found could be inside the payload of another frame, search again in the
+                                 * data as it was received */
+                                l_eRes = eFSP_MSGD_WhtXor(p_ptCtx, l_uMask);
+
+                                if( e_eFSP_MSGD_RES_OK == l_eRes )
+                                {
+                                    l_eInsEncState = e_eFSP_MSGDPRV_SM_RESYNC;
+                                }
+                                else
+                                {
+                                    l_eInsEncState = e_eFSP_MSGDPRV_SM_ELABDONE;
+                                }
+                            }
+                            else if( true != l_bIsMCor )
                             {
                                 /* Message ended but something about CRC or length is not rigth, restart a frame */
                                 l_eInsEncState = e_eFSP_MSGDPRV_SM_ELABDONE;
@@ -576,12 +1091,16 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
                     case e_eFSP_MSGDPRV_SM_OKCHECK:
                     {
                         /* Still parsing but we can check if data len is coherent */
-                        l_eResMsgCoh = eFSP_MSGD_isMsgCohe(&p_ptCtx->tBUNSTFCtx, &l_bIsMCoh);
+                        l_eResMsgCoh = eFSP_MSGD_isMsgCohe(p_ptCtx, &l_bIsMCoh);
 
                         if( e_eFSP_MSGD_RES_OK == l_eResMsgCoh )
                         {
                             /* no strange error found, check message correctness */
-                            if( true != l_bIsMCoh )
+                            if( ( true != l_bIsMCoh ) && ( EFSP_FRM_TRSP == p_ptCtx->uFrm ) )
+                            {
+                                l_eInsEncState = e_eFSP_MSGDPRV_SM_RESYNC;
+                            }
+                            else if( true != l_bIsMCoh )
                             {
                                 l_eInsEncState = e_eFSP_MSGDPRV_SM_ELABDONE;
                                 l_eRes = e_eFSP_MSGD_RES_BADFRAME;
@@ -601,6 +1120,31 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
                         break;
                     }
 
+                    case e_eFSP_MSGDPRV_SM_RESYNC:
+                    {
+                        /* Search a sync sequence in the data of the bad frame */
+                        l_eResBSTF = eFSP_MSGD_FrmResync(p_ptCtx);
+                        l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
+
+                        if( e_eFSP_MSGD_RES_MESSAGEENDED == l_eRes )
+                        {
+                            /* A whole frame was hidden in the bad one */
+                            l_eInsEncState = e_eFSP_MSGDPRV_SM_ENDCHECK;
+                        }
+                        else if( e_eFSP_MSGD_RES_OK == l_eRes )
+                        {
+                            /* The bad frame is discarded, the decoding continue from the sync found, if any */
+                            l_eInsEncState = e_eFSP_MSGDPRV_SM_ELABDONE;
+                            l_eRes = e_eFSP_MSGD_RES_FRAMERESTART;
+                        }
+                        else
+                        {
+                            /* Some error */
+                            l_eInsEncState = e_eFSP_MSGDPRV_SM_ELABDONE;
+                        }
+                        break;
+                    }
+
                     default:
                     {
                         /* Impossible end here */
@@ -611,97 +1155,230 @@ e_eFSP_MSGD_RES eFSP_MSGD_InsEncChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p
                 }
             }
 		}
-	}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_MSGD_isStatusStillCoherent(const t_eFSP_MSGD_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check context validity */
+	if( ( NULL == p_ptCtx->fCrc ) || ( NULL == p_ptCtx->ptCrcCtx ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+		l_eRes = true;
+	}
+
+    return l_eRes;
+}
+
+static e_eFSP_MSGD_RES eFSP_MSGD_convertReturnFromBstf(e_eCU_BUNSTF_RES p_eRetEvent)
+{
+	e_eFSP_MSGD_RES l_eRes;
+
+	switch( p_eRetEvent )
+	{
+		case e_eCU_BUNSTF_RES_OK:
+		{
+			l_eRes = e_eFSP_MSGD_RES_OK;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_BADPARAM:
+		{
+			l_eRes = e_eFSP_MSGD_RES_BADPARAM;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_BADPOINTER:
+		{
+			l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_CORRUPTCTX:
+		{
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_OUTOFMEM:
+		{
+			l_eRes = e_eFSP_MSGD_RES_OUTOFMEM;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_BADFRAME:
+		{
+			l_eRes = e_eFSP_MSGD_RES_BADFRAME;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_FRAMEENDED:
+		{
+			l_eRes = e_eFSP_MSGD_RES_MESSAGEENDED;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_FRAMERESTART:
+		{
+			l_eRes = e_eFSP_MSGD_RES_FRAMERESTART;
+            break;
+		}
+
+		case e_eCU_BUNSTF_RES_NOINITLIB:
+		{
+			l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+            break;
+		}
+
+		default:
+		{
+            /* Impossible end here */
+			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+            break;
+		}
+	}
+
+	return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_convertReturnFromCobs(e_eFSP_COBS_RES p_eRetEvent)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+
+    /* The COBS engine return the same errors of the byte unstuffer */
+	switch( p_eRetEvent )
+	{
+		case e_eFSP_COBS_RES_OK:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_OK;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_BADPARAM:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
+            break;
+		}
 
-	return l_eRes;
-}
+		case e_eFSP_COBS_RES_BADPOINTER:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
+            break;
+		}
 
+		case e_eFSP_COBS_RES_OUTOFMEM:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
+            break;
+		}
 
+		case e_eFSP_COBS_RES_BADFRAME:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
+            break;
+		}
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSP_MSGD_isStatusStillCoherent(const t_eFSP_MSGD_Ctx* p_ptCtx)
-{
-    bool_t l_eRes;
+		case e_eFSP_COBS_RES_FRAMEENDED:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_FRAMEENDED;
+            break;
+		}
 
-	/* Check context validity */
-	if( ( NULL == p_ptCtx->fCrc ) || ( NULL == p_ptCtx->ptCrcCtx ) )
-	{
-		l_eRes = false;
-	}
-	else
-	{
-		l_eRes = true;
+		case e_eFSP_COBS_RES_FRAMERESTART:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_FRAMERESTART;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_NOINITLIB:
+		{
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+            break;
+		}
+
+		default:
+		{
+            /* Impossible end here */
+			l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            break;
+		}
 	}
 
-    return l_eRes;
+	return l_eRes;
 }
 
-static e_eFSP_MSGD_RES eFSP_MSGD_convertReturnFromBstf(e_eCU_BUNSTF_RES p_eRetEvent)
+static e_eCU_BUNSTF_RES eFSP_MSGD_convertReturnFromTrsp(e_eFSP_TRSP_RES p_eRetEvent)
 {
-	e_eFSP_MSGD_RES l_eRes;
+	e_eCU_BUNSTF_RES l_eRes;
 
+    /* The decoder side of the transparent engine return the same errors of the byte unstuffer, the request of the
+     * header length is always handled here */
 	switch( p_eRetEvent )
 	{
-		case e_eCU_BUNSTF_RES_OK:
-		{
-			l_eRes = e_eFSP_MSGD_RES_OK;
-            break;
-		}
-
-		case e_eCU_BUNSTF_RES_BADPARAM:
+		case e_eFSP_TRSP_RES_OK:
 		{
-			l_eRes = e_eFSP_MSGD_RES_BADPARAM;
+			l_eRes = e_eCU_BUNSTF_RES_OK;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_BADPOINTER:
+		case e_eFSP_TRSP_RES_BADPARAM:
 		{
-			l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
+			l_eRes = e_eCU_BUNSTF_RES_BADPARAM;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_CORRUPTCTX:
+		case e_eFSP_TRSP_RES_BADPOINTER:
 		{
-			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+			l_eRes = e_eCU_BUNSTF_RES_BADPOINTER;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_OUTOFMEM:
+		case e_eFSP_TRSP_RES_OUTOFMEM:
 		{
-			l_eRes = e_eFSP_MSGD_RES_OUTOFMEM;
+			l_eRes = e_eCU_BUNSTF_RES_OUTOFMEM;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_BADFRAME:
+		case e_eFSP_TRSP_RES_BADFRAME:
 		{
-			l_eRes = e_eFSP_MSGD_RES_BADFRAME;
+			l_eRes = e_eCU_BUNSTF_RES_BADFRAME;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_FRAMEENDED:
+		case e_eFSP_TRSP_RES_FRAMEENDED:
 		{
-			l_eRes = e_eFSP_MSGD_RES_MESSAGEENDED;
+			l_eRes = e_eCU_BUNSTF_RES_FRAMEENDED;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_FRAMERESTART:
+		case e_eFSP_TRSP_RES_FRAMERESTART:
 		{
-			l_eRes = e_eFSP_MSGD_RES_FRAMERESTART;
+			l_eRes = e_eCU_BUNSTF_RES_FRAMERESTART;
             break;
 		}
 
-		case e_eCU_BUNSTF_RES_NOINITLIB:
+		case e_eFSP_TRSP_RES_NOINITLIB:
 		{
-			l_eRes = e_eFSP_MSGD_RES_NOINITLIB;
+			l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
             break;
 		}
 
 		default:
 		{
             /* Impossible end here */
-			l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+			l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
             break;
 		}
 	}
@@ -709,6 +1386,349 @@ static e_eFSP_MSGD_RES eFSP_MSGD_convertReturnFromBstf(e_eCU_BUNSTF_RES p_eRetEv
 	return l_eRes;
 }
 
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmCheck(t_eFSP_MSGD_Ctx* const p_ptCtx)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+    bool_t l_bIsInit;
+
+    /* A not initialized context is reported before an invalid engine */
+    l_bIsInit = false;
+    l_eRes = eCU_BUNSTF_IsInit(&p_ptCtx->tBUNSTFCtx, &l_bIsInit);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( true != l_bIsInit )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_NOINITLIB;
+        }
+        else if( ( false == eFSP_MSGD_IsFrmValid(p_ptCtx->uFrm) ) ||
+                 ( false == eFSP_MSGD_IsWhtValid(p_ptCtx->uWhtL) ) ||
+                 ( false == eFSP_MSGD_IsCmpValid(p_ptCtx->uCmpL) ) ||
+                 ( false == eFSP_MSGD_IsDltValid(p_ptCtx) ) ||
+                 ( false == eFSP_MSGD_IsFecValid(p_ptCtx->uFecL) ) )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eCU_BUNSTF_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmNew(t_eFSP_MSGD_Ctx* const p_ptCtx)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGD_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        /* The payload of the new frame is not decompressed or corrected yet */
+        p_ptCtx->uDecL = 0u;
+        p_ptCtx->uFecCutL = 0u;
+
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_NewDecFrame(&p_ptCtx->tCOBSCtx));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_NewDecFrame(&p_ptCtx->tTRSPCtx));
+        }
+        else
+        {
+            l_eRes = eCU_BUNSTF_NewFrame(&p_ptCtx->tBUNSTFCtx);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmGetData(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                             uint32_t* const p_puDataL)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGD_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_GetDecData(&p_ptCtx->tCOBSCtx, p_ppuData, p_puDataL));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_GetDecData(&p_ptCtx->tTRSPCtx, p_ppuData, p_puDataL));
+        }
+        else
+        {
+            l_eRes = eCU_BUNSTF_GetUnstufData(&p_ptCtx->tBUNSTFCtx, p_ppuData, p_puDataL);
+        }
+
+        if( ( e_eCU_BUNSTF_RES_OK == l_eRes ) && ( 0u != p_ptCtx->uFecCutL ) )
+        {
+            /* The parity of a corrected frame is not part of the message */
+            if( p_ptCtx->uFecCutL > *p_puDataL )
+            {
+                l_eRes = e_eCU_BUNSTF_RES_CORRUPTCTX;
+            }
+            else
+            {
+                *p_puDataL -= p_ptCtx->uFecCutL;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmIsWaitSof(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsWaitSof)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+    bool_t l_bIsEnded;
+    bool_t l_bIsBad;
+
+    l_eRes = eFSP_MSGD_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_GetDecState(&p_ptCtx->tCOBSCtx, p_pbIsWaitSof,
+                                                                           &l_bIsEnded, &l_bIsBad));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            /* The sync sequence take the place of the SOF */
+            l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_GetDecState(&p_ptCtx->tTRSPCtx, p_pbIsWaitSof,
+                                                                           &l_bIsEnded, &l_bIsBad));
+        }
+        else
+        {
+            l_eRes = eCU_BUNSTF_IsWaitingSof(&p_ptCtx->tBUNSTFCtx, p_pbIsWaitSof);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmIsEnded(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsEnded)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+    bool_t l_bIsWaitSof;
+    bool_t l_bIsBad;
+
+    l_eRes = eFSP_MSGD_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_GetDecState(&p_ptCtx->tCOBSCtx, &l_bIsWaitSof,
+                                                                           p_pbIsEnded, &l_bIsBad));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_GetDecState(&p_ptCtx->tTRSPCtx, &l_bIsWaitSof,
+                                                                           p_pbIsEnded, &l_bIsBad));
+        }
+        else
+        {
+            l_eRes = eCU_BUNSTF_IsAFullFrameUnstuff(&p_ptCtx->tBUNSTFCtx, p_pbIsEnded);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmIsBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsBad)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+    bool_t l_bIsWaitSof;
+    bool_t l_bIsEnded;
+
+    l_eRes = eFSP_MSGD_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_GetDecState(&p_ptCtx->tCOBSCtx, &l_bIsWaitSof,
+                                                                           &l_bIsEnded, p_pbIsBad));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_GetDecState(&p_ptCtx->tTRSPCtx, &l_bIsWaitSof,
+                                                                           &l_bIsEnded, p_pbIsBad));
+        }
+        else
+        {
+            l_eRes = eCU_BUNSTF_IsFrameBad(&p_ptCtx->tBUNSTFCtx, p_pbIsBad);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmInsChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                              const uint32_t p_uEncL, uint32_t* const p_puUsedL)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGD_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_convertReturnFromCobs(eFSP_COBS_InsEncChunk(&p_ptCtx->tCOBSCtx, p_puEncBuff, p_uEncL,
+                                                                           p_puUsedL));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGD_TrspInsChunk(p_ptCtx, p_puEncBuff, p_uEncL, p_puUsedL);
+        }
+        else
+        {
+            l_eRes = eCU_BUNSTF_InsStufChunk(&p_ptCtx->tBUNSTFCtx, p_puEncBuff, p_uEncL, p_puUsedL);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_TrspInsChunk(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                               const uint32_t p_uEncL, uint32_t* const p_puUsedL)
+{
+    e_eFSP_TRSP_RES l_eRes;
+    uint32_t l_uUsedL;
+    uint32_t l_uChunkUsedL;
+    uint32_t l_uDataL;
+    uint32_t l_uHdrL;
+    uint32_t l_uDeclL;
+    uint8_t* l_puData;
+
+    l_uChunkUsedL = 0u;
+    l_eRes = eFSP_TRSP_InsEncChunk(&p_ptCtx->tTRSPCtx, p_puEncBuff, p_uEncL, &l_uChunkUsedL);
+    l_uUsedL = l_uChunkUsedL;
+
+    /* Only the header profile knows how long the header is and where the length of the payload is placed */
+    while( e_eFSP_TRSP_RES_NEEDLEN == l_eRes )
+    {
+        l_uDataL = 0u;
+        l_puData = NULL;
+        l_eRes = eFSP_TRSP_GetDecData(&p_ptCtx->tTRSPCtx, &l_puData, &l_uDataL);
+
+        if( ( e_eFSP_TRSP_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+        {
+            l_eRes = e_eFSP_TRSP_RES_CORRUPTCTX;
+        }
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            l_uHdrL = 0u;
+            l_uDeclL = 0u;
+
+            if( false == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDeclL) )
+            {
+                /* Malformed length */
+                l_eRes = e_eFSP_TRSP_RES_BADFRAME;
+            }
+            else if( l_uDataL < l_uHdrL )
+            {
+                /* Receive the rest of the header */
+                l_eRes = eFSP_TRSP_SetDecHdrL(&p_ptCtx->tTRSPCtx, l_uHdrL);
+            }
+            else
+            {
+                /* Header complete, receive the raw payload and its parity */
+                l_eRes = eFSP_TRSP_SetDecRawL(&p_ptCtx->tTRSPCtx, eFSP_MSGD_GetRawL(p_ptCtx, l_uHdrL, l_uDeclL));
+            }
+
+            if( e_eFSP_TRSP_RES_OUTOFMEM == l_eRes )
+            {
+                /* The declared length can not be stored, same as a too long frame */
+                l_eRes = e_eFSP_TRSP_RES_BADFRAME;
+            }
+        }
+
+        if( ( e_eFSP_TRSP_RES_OK == l_eRes ) && ( l_uUsedL < p_uEncL ) )
+        {
+            l_uChunkUsedL = 0u;
+            l_eRes = eFSP_TRSP_InsEncChunk(&p_ptCtx->tTRSPCtx, &p_puEncBuff[l_uUsedL], p_uEncL - l_uUsedL,
+                                           &l_uChunkUsedL);
+            l_uUsedL += l_uChunkUsedL;
+        }
+    }
+
+    *p_puUsedL = l_uUsedL;
+
+    return eFSP_MSGD_convertReturnFromTrsp(l_eRes);
+}
+
+static e_eCU_BUNSTF_RES eFSP_MSGD_FrmResync(t_eFSP_MSGD_Ctx* const p_ptCtx)
+{
+	e_eCU_BUNSTF_RES l_eRes;
+    uint32_t l_uDataL;
+    uint32_t l_uIdx;
+    uint32_t l_uUsedL;
+    uint32_t l_uDecL;
+    uint8_t* l_puData;
+    uint8_t* l_puDec;
+
+    /* The raw payload of a bad frame can contain the sync sequence of the next one, search it in the data already
+     * received. The decoder write every byte before the one it's reading, so the data can be decoded in place */
+    l_uDataL = 0u;
+    l_puData = NULL;
+    l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_GetDecData(&p_ptCtx->tTRSPCtx, &l_puData, &l_uDataL));
+    p_ptCtx->uFecCutL = 0u;
+
+    if( e_eCU_BUNSTF_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_NewDecFrame(&p_ptCtx->tTRSPCtx));
+    }
+
+    l_uIdx = 0u;
+
+    while( ( e_eCU_BUNSTF_RES_OK == l_eRes ) && ( l_uIdx < l_uDataL ) )
+    {
+        l_uUsedL = 0u;
+        l_eRes = eFSP_MSGD_TrspInsChunk(p_ptCtx, &l_puData[l_uIdx], l_uDataL - l_uIdx, &l_uUsedL);
+        l_uIdx += l_uUsedL;
+
+        if( e_eCU_BUNSTF_RES_FRAMERESTART == l_eRes )
+        {
+            l_eRes = e_eCU_BUNSTF_RES_OK;
+        }
+        else if( e_eCU_BUNSTF_RES_BADFRAME == l_eRes )
+        {
+            /* Bad again, search in the data of this frame followed by the bytes not scanned yet. At least the sync
+             * sequence is dropped every time, so the loop ends */
+            l_uDecL = 0u;
+            l_puDec = NULL;
+            l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_GetDecData(&p_ptCtx->tTRSPCtx, &l_puDec, &l_uDecL));
+
+            if( e_eCU_BUNSTF_RES_OK == l_eRes )
+            {
+                (void)memmove(&l_puData[l_uDecL], &l_puData[l_uIdx], l_uDataL - l_uIdx);
+                l_uDataL = l_uDecL + ( l_uDataL - l_uIdx );
+                l_uIdx = 0u;
+                l_eRes = eFSP_MSGD_convertReturnFromTrsp(eFSP_TRSP_NewDecFrame(&p_ptCtx->tTRSPCtx));
+            }
+        }
+        else
+        {
+            /* Frame ended or still receiving. When a frame ended the bytes after it are dropped */
+        }
+    }
+
+    return l_eRes;
+}
+
 static e_eFSP_MSGD_RES eFSP_MSGD_IsFullMsgDec(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsMsgDec)
 {
 	/* Local variable */
@@ -717,7 +1737,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFullMsgDec(t_eFSP_MSGD_Ctx* const p_ptCtx, bo
     bool_t l_bIsFullUNSTF;
 
     l_bIsFullUNSTF = false;
-    l_eResBSTF = eCU_BUNSTF_IsAFullFrameUnstuff(&p_ptCtx->tBUNSTFCtx, &l_bIsFullUNSTF);
+    l_eResBSTF = eFSP_MSGD_FrmIsEnded(p_ptCtx, &l_bIsFullUNSTF);
     l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
     if( e_eFSP_MSGD_RES_OK == l_eRes )
@@ -731,7 +1751,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFullMsgDec(t_eFSP_MSGD_Ctx* const p_ptCtx, bo
         else
         {
             /* Full frame received at unstuffer level, check if it is valid message at this level */
-            l_eRes = eFSP_MSGD_isMsgCorr(&p_ptCtx->tBUNSTFCtx, p_pbIsMsgDec, p_ptCtx->fCrc, p_ptCtx->ptCrcCtx);
+            l_eRes = eFSP_MSGD_isMsgCorr(p_ptCtx, p_pbIsMsgDec);
         }
     }
 
@@ -748,7 +1768,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFrmBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t
     bool_t l_bIsFrmBadloc;
 
     l_bIsFrmBadloc = true;
-    l_eResBSTF = eCU_BUNSTF_IsFrameBad(&p_ptCtx->tBUNSTFCtx, &l_bIsFrmBadloc);
+    l_eResBSTF = eFSP_MSGD_FrmIsBad(p_ptCtx, &l_bIsFrmBadloc);
     l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
     if( e_eFSP_MSGD_RES_OK == l_eRes )
@@ -763,7 +1783,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFrmBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t
             /* Frame seems ok, no error found. It could be ended on in receiving state. If ended check CRC,
              * if still in receiving state check coherence with datalen */
             l_bIsFullUNSTF = false;
-            l_eResBSTF = eCU_BUNSTF_IsAFullFrameUnstuff(&p_ptCtx->tBUNSTFCtx, &l_bIsFullUNSTF);
+            l_eResBSTF = eFSP_MSGD_FrmIsEnded(p_ptCtx, &l_bIsFullUNSTF);
             l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBSTF);
 
             if( e_eFSP_MSGD_RES_OK == l_eRes )
@@ -771,7 +1791,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFrmBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t
                 if( false == l_bIsFullUNSTF )
                 {
                     /* Check ongoing coherence */
-                    l_eRes = eFSP_MSGD_isMsgCohe(&p_ptCtx->tBUNSTFCtx, &l_bIsCor);
+                    l_eRes = eFSP_MSGD_isMsgCohe(p_ptCtx, &l_bIsCor);
 
                     if( e_eFSP_MSGD_RES_OK == l_eRes )
                     {
@@ -791,7 +1811,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFrmBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t
                 else
                 {
                     /* Check complete frame coherence */
-                    l_eRes = eFSP_MSGD_isMsgCorr(&p_ptCtx->tBUNSTFCtx, &l_bIsCor, p_ptCtx->fCrc, p_ptCtx->ptCrcCtx);
+                    l_eRes = eFSP_MSGD_isMsgCorr(p_ptCtx, &l_bIsCor);
 
                     if( e_eFSP_MSGD_RES_OK == l_eRes )
                     {
@@ -815,8 +1835,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_IsFrmBad(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t
 	return l_eRes;
 }
 
-static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_pbIsCor, f_eFSP_MSGD_CrcCb p_fCrc,
-                                           t_eFSP_MSGD_CrcCtx* p_ptCrcCtx)
+static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* p_pbIsCor)
 {
     e_eFSP_MSGD_RES l_eRes;
     e_eCU_BUNSTF_RES l_eResBUNSTF;
@@ -824,55 +1843,93 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
 	uint32_t l_uCMsg;
 	uint32_t l_uCExp;
 	uint32_t l_uDataL;
+    uint32_t l_uHdrL;
     bool_t l_bResCrc;
+    bool_t l_bIsFix;
 	uint8_t* l_puData;
 
     /* Check NULL */
-    if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsCor) || ( NULL == p_fCrc) || ( NULL == p_ptCrcCtx ) )
+    if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsCor) || ( NULL == p_ptCtx->fCrc) || ( NULL == p_ptCtx->ptCrcCtx ) )
     {
         l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
     }
+    else if( 0u != p_ptCtx->uDecL )
+    {
+        /* Already verified before decompressing the payload in place */
+        *p_pbIsCor = true;
+        l_eRes = e_eFSP_MSGD_RES_OK;
+    }
     else
     {
-        /* Ok the frame is complete, need to check if we have data size, data crc, crc rigth value */
+        /* Ok the frame is complete, correct it and check if we have data size, data crc, crc rigth value */
+        l_bIsFix = false;
+        l_eRes = eFSP_MSGD_FecFix(p_ptCtx, &l_bIsFix);
+
         /* Init value */
         l_uDataL = 0u;
         l_puData = NULL;
 
         /* Get unstuffed data */
-        l_eResBUNSTF = eCU_BUNSTF_GetUnstufData(p_ptCtx, &l_puData, &l_uDataL);
-        l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBUNSTF);
+        if( e_eFSP_MSGD_RES_OK == l_eRes )
+        {
+            l_eResBUNSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataL);
+            l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBUNSTF);
+        }
+
+        if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+        {
+            l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+        }
 
         if( e_eFSP_MSGD_RES_OK == l_eRes )
         {
             /* Do we have enough data?  */
-            if( l_uDataL < EFSP_MIN_MSGDE_BUFFLEN )
+            l_uHdrL = 0u;
+            l_uDPayTRx = 0u;
+
+            if( false == l_bIsFix )
+            {
+                /* Too many errors, discharge */
+                *p_pbIsCor = false;
+            }
+            else if( ( false == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDPayTRx) ) ||
+                     ( l_uDataL < ( l_uHdrL + EFSP_MIN_MSGDE_PAYLOAD ) ) )
             {
-                /* Too small frame, discharge */
+                /* Too small frame or malformed length, discharge */
                 *p_pbIsCor = false;
             }
             else
             {
                 /* Enough data! Is data len in frame coherent?  */
-                l_uDPayTRx = eFSP_MSGD_CreateU32LE(l_puData[0x04u], l_puData[0x05u], l_puData[0x06u], l_puData[0x07u]);
-
-                if( ( l_uDataL - EFSP_MSGDE_HEADERSIZE ) == l_uDPayTRx )
+                if( ( l_uDataL - l_uHdrL ) != l_uDPayTRx )
+                {
+                    /* Data len is wrong, discharge */
+                    *p_pbIsCor = false;
+                }
+                else if( EFSP_HDR_CRCNONE == p_ptCtx->uCrcL )
+                {
+                    /* Data len is coherent and the link is already protected */
+                    *p_pbIsCor = eFSP_MSGD_Expand(p_ptCtx, l_puData, l_uHdrL, l_uDataL);
+                }
+                else
                 {
                     /* Data len is coherent! Is crc rigth? */
                     l_uCExp = 0u;
 
                     /* Estrapolate CRC in Little Endian */
-                    l_uCMsg = eFSP_MSGD_CreateU32LE(l_puData[0x00u], l_puData[0x01u], l_puData[0x02u], l_puData[0x03u]);
+                    l_uCMsg = eFSP_MSGD_CreateUxLE(&l_puData[0u], p_ptCtx->uCrcL);
 
                     /* Calculate CRC */
-                    l_bResCrc = (*(p_fCrc))( p_ptCrcCtx, eCU_CRC_BASE_SEED, &l_puData[4u], l_uDPayTRx + 4u,  &l_uCExp );
+                    l_bResCrc = (*(p_ptCtx->fCrc))( p_ptCtx->ptCrcCtx, eCU_CRC_BASE_SEED, &l_puData[p_ptCtx->uCrcL],
+                                                    l_uDataL - p_ptCtx->uCrcL,  &l_uCExp );
 
                     if( true == l_bResCrc )
                     {
-                        if( l_uCMsg == l_uCExp )
+                        /* Only the lower bytes of the CRC are in the frame */
+                        if( l_uCMsg == ( l_uCExp & eFSP_MSGD_GetFieldMax(p_ptCtx->uCrcL) ) )
                         {
-                            /* All ok */
-                            *p_pbIsCor = true;
+                            /* All ok, a malformed compressed payload is a bad frame too */
+                            *p_pbIsCor = eFSP_MSGD_Expand(p_ptCtx, l_puData, l_uHdrL, l_uDataL);
                         }
                         else
                         {
@@ -885,11 +1942,6 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
                         l_eRes = e_eFSP_MSGD_RES_CRCCLBKERROR;
                     }
                 }
-                else
-                {
-                    /* Data len is wrong, discharge */
-                    *p_pbIsCor = false;
-                }
             }
         }
     }
@@ -897,7 +1949,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCorr(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
     return l_eRes;
 }
 
-static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_pbIsCoh)
+static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* p_pbIsCoh)
 {
     /* Need to check coherence of the message during message receiving, how? Check if data len reported by payload
      * is lower than data payload received, if greater something is wrong  */
@@ -905,6 +1957,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
     e_eCU_BUNSTF_RES l_eResBUNSTF;
     uint32_t l_uDPayTRx;
 	uint32_t l_uDataL;
+    uint32_t l_uHdrL;
 	uint8_t* l_puData;
 
     /* Check NULL */
@@ -912,6 +1965,12 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
     {
         l_eRes = e_eFSP_MSGD_RES_BADPOINTER;
     }
+    else if( EFSP_FEC_NONE != p_ptCtx->uFecL )
+    {
+        /* The header could be wrong till the frame is corrected, at the end of it */
+        *p_pbIsCoh = true;
+        l_eRes = e_eFSP_MSGD_RES_OK;
+    }
     else
     {
         /* Check how much payload is received */
@@ -920,13 +1979,26 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
         l_puData = NULL;
 
         /* Get unstuffed data */
-        l_eResBUNSTF = eCU_BUNSTF_GetUnstufData(p_ptCtx, &l_puData, &l_uDataL);
+        l_eResBUNSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataL);
         l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBUNSTF);
 
+        if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+        {
+            l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+        }
+
         if( e_eFSP_MSGD_RES_OK == l_eRes )
         {
             /* Do we have enough data?  */
-            if( l_uDataL < EFSP_MSGDE_HEADERSIZE )
+            l_uHdrL = 0u;
+            l_uDPayTRx = 0u;
+
+            if( false == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDPayTRx) )
+            {
+                /* Malformed length, discharge */
+                *p_pbIsCoh = false;
+            }
+            else if( l_uDataL < l_uHdrL )
             {
                 /* Not enoght data to make a check */
                 *p_pbIsCoh = true;
@@ -934,9 +2006,7 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
             else
             {
                 /* Enough data! Is data len in frame coherent?  */
-                l_uDPayTRx = eFSP_MSGD_CreateU32LE(l_puData[0x04u], l_puData[0x05u], l_puData[0x06u], l_puData[0x07u]);
-
-                if( ( l_uDataL - EFSP_MSGDE_HEADERSIZE ) <= l_uDPayTRx )
+                if( ( l_uDataL - l_uHdrL ) <= l_uDPayTRx )
                 {
                     /* Data len is coherent! */
                     *p_pbIsCoh = true;
@@ -953,23 +2023,444 @@ static e_eFSP_MSGD_RES eFSP_MSGD_isMsgCohe(t_eCU_BUNSTF_Ctx* p_ptCtx, bool_t* p_
     return l_eRes;
 }
 
-static uint32_t eFSP_MSGD_CreateU32LE(uint8_t p_uV1, uint8_t p_uV2, uint8_t p_uV3, uint8_t p_uV4)
+static e_eFSP_MSGD_RES eFSP_MSGD_FecFix(t_eFSP_MSGD_Ctx* const p_ptCtx, bool_t* const p_pbIsFix)
+{
+    e_eFSP_MSGD_RES l_eRes;
+    e_eCU_BUNSTF_RES l_eResBUNSTF;
+    uint32_t l_uDataL;
+    uint32_t l_uMsgL;
+    uint32_t l_uFixN;
+	uint8_t* l_puData;
+
+    if( ( EFSP_FEC_NONE == p_ptCtx->uFecL ) || ( 0u != p_ptCtx->uFecCutL ) )
+    {
+        /* Nothing to correct, or already corrected */
+        *p_pbIsFix = true;
+        l_eRes = e_eFSP_MSGD_RES_OK;
+    }
+    else
+    {
+        /* Init value */
+        l_uDataL = 0u;
+        l_puData = NULL;
+
+        l_eResBUNSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataL);
+        l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBUNSTF);
+
+        if( e_eFSP_MSGD_RES_OK == l_eRes )
+        {
+            l_uMsgL = 0u;
+            l_uFixN = 0u;
+
+            if( e_eFSP_FEC_RES_OK == eFSP_FEC_Decode(l_puData, l_uDataL, p_ptCtx->uFecL, &l_uMsgL, &l_uFixN) )
+            {
+                /* From now on the parity is hidden */
+                p_ptCtx->uFecCutL = l_uDataL - l_uMsgL;
+                *p_pbIsFix = true;
+            }
+            else
+            {
+                *p_pbIsFix = false;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_MSGD_IsHdrValid(const uint32_t p_uCrcL, const uint32_t p_uLenL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_CRCNONE != p_uCrcL ) && ( EFSP_HDR_CRC16 != p_uCrcL ) && ( EFSP_HDR_CRC32 != p_uCrcL ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( EFSP_HDR_LEN8 != p_uLenL ) && ( EFSP_HDR_LEN16 != p_uLenL ) && ( EFSP_HDR_LEN32 != p_uLenL ) &&
+             ( EFSP_HDR_LENVAR != p_uLenL ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGD_IsFrmValid(const uint32_t p_uFrm)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_FRM_ESC == p_uFrm ) || ( EFSP_FRM_COBS == p_uFrm ) || ( EFSP_FRM_TRSP == p_uFrm ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGD_IsWhtValid(const uint32_t p_uWhtL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_WHTNONE == p_uWhtL ) || ( EFSP_HDR_WHT == p_uWhtL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGD_IsCmpValid(const uint32_t p_uCmpL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_CMPNONE == p_uCmpL ) || ( EFSP_HDR_CMP == p_uCmpL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGD_IsDltValid(const t_eFSP_MSGD_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+    if( EFSP_HDR_DLTNONE == p_ptCtx->uDltL )
+    {
+        l_bRes = true;
+    }
+    else if( ( EFSP_HDR_DLT == p_ptCtx->uDltL ) && ( NULL != p_ptCtx->puDltBase ) && ( p_ptCtx->uDltBaseL > 0u ) &&
+             ( p_ptCtx->uDltUseL <= p_ptCtx->uDltBaseL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGD_IsFecValid(const uint32_t p_uFecL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_FEC_NONE == p_uFecL ) || ( EFSP_FEC_RS4 == p_uFecL ) || ( EFSP_FEC_RS8 == p_uFecL ) ||
+        ( EFSP_FEC_RS16 == p_uFecL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static uint32_t eFSP_MSGD_GetRawL(const t_eFSP_MSGD_Ctx* p_ptCtx, const uint32_t p_uHdrL, const uint32_t p_uDeclL)
+{
+    uint32_t l_uRes;
+
+    /* Bytes after the header: the payload and the parity of the whole message. A length too big to be stored in any
+     * memory area is left as the biggest one */
+    if( EFSP_FEC_NONE == p_ptCtx->uFecL )
+    {
+        l_uRes = p_uDeclL;
+    }
+    else if( p_uDeclL > ( ( MAX_UINT32VAL / 2u ) - p_uHdrL ) )
+    {
+        l_uRes = MAX_UINT32VAL;
+    }
+    else
+    {
+        l_uRes = p_uDeclL + eFSP_FEC_GetParL(p_uHdrL + p_uDeclL, p_ptCtx->uFecL);
+    }
+
+    return l_uRes;
+}
+
+static uint32_t eFSP_MSGD_GetFieldMax(const uint32_t p_uFieldL)
+{
+    uint32_t l_uRes;
+
+    /* Biggest value that can be stored in a header field */
+    if( p_uFieldL >= 4u )
+    {
+        l_uRes = MAX_UINT32VAL;
+    }
+    else
+    {
+        l_uRes = ( ( (uint32_t) 1u ) << ( 8u * p_uFieldL ) ) - 1u;
+    }
+
+    return l_uRes;
+}
+
+static uint32_t eFSP_MSGD_CreateUxLE(const uint8_t* p_puV, const uint32_t p_uFieldL)
 {
-    uint32_t l_uTemp;
+    uint32_t l_uIdx;
     uint32_t l_uRes;
 
     /* Init var */
     l_uRes = 0u;
 
     /* Calculate */
-    l_uTemp =                 (uint32_t) p_uV1;
-    l_uRes |= ( l_uTemp & 0x000000FFu );
-    l_uTemp =  (uint32_t) ( ( (uint32_t) p_uV2 ) << 8u  );
-    l_uRes |= ( l_uTemp & 0x0000FF00u );
-    l_uTemp =  (uint32_t) ( ( (uint32_t) p_uV3 ) << 16u  );
-    l_uRes |= ( l_uTemp & 0x00FF0000u );
-    l_uTemp =  (uint32_t) ( ( (uint32_t) p_uV4 ) << 24u  );
-    l_uRes |= ( l_uTemp & 0xFF000000u );
+    for( l_uIdx = 0u; l_uIdx < p_uFieldL; l_uIdx++ )
+    {
+        l_uRes |= ( ( (uint32_t) p_puV[l_uIdx] ) << ( 8u * l_uIdx ) );
+    }
 
     return l_uRes;
+}
+
+static bool_t eFSP_MSGD_ParseHdr(const t_eFSP_MSGD_Ctx* p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL,
+                                 uint32_t* const p_puHdrL, uint32_t* const p_puDeclL)
+{
+    bool_t l_bRes;
+    bool_t l_bEnd;
+    uint32_t l_uIdx;
+    uint32_t l_uByte;
+
+    /* Init var */
+    l_bRes = true;
+    *p_puDeclL = 0u;
+
+    if( EFSP_HDR_LENVAR != p_ptCtx->uLenL )
+    {
+        /* Fixed size header */
+        *p_puHdrL = p_ptCtx->uCrcL + p_ptCtx->uLenL + p_ptCtx->uWhtL + p_ptCtx->uCmpL + p_ptCtx->uDltL;
+
+        if( p_uDataL >= *p_puHdrL )
+        {
+            *p_puDeclL = eFSP_MSGD_CreateUxLE(&p_puData[p_ptCtx->uCrcL], p_ptCtx->uLenL);
+        }
+    }
+    else
+    {
+        /* Varint length, 7 bit for every byte and the MSB set when another byte follows */
+        l_bEnd = false;
+        l_uIdx = 0u;
+
+        while( ( false == l_bEnd ) && ( true == l_bRes ) && ( ( p_ptCtx->uCrcL + l_uIdx ) < p_uDataL ) )
+        {
+            l_uByte = (uint32_t) p_puData[p_ptCtx->uCrcL + l_uIdx];
+
+            if( ( ( EFSP_HDR_LENVARMAX - 1u ) == l_uIdx ) && ( l_uByte > 0x0Fu ) )
+            {
+                /* The last byte can contain only the upper 4 bit of the length */
+                l_bRes = false;
+            }
+            else
+            {
+                *p_puDeclL |= ( ( l_uByte & 0x7Fu ) << ( 7u * l_uIdx ) );
+                l_bEnd = ( 0u == ( l_uByte & 0x80u ) );
+                l_uIdx++;
+            }
+        }
+
+        if( true == l_bEnd )
+        {
+            *p_puHdrL = p_ptCtx->uCrcL + l_uIdx + p_ptCtx->uWhtL + p_ptCtx->uCmpL + p_ptCtx->uDltL;
+        }
+        else
+        {
+            /* At least another byte of the header is needed */
+            *p_puHdrL = p_ptCtx->uCrcL + l_uIdx + 1u + p_ptCtx->uWhtL + p_ptCtx->uCmpL + p_ptCtx->uDltL;
+            *p_puDeclL = 0u;
+        }
+    }
+
+    return l_bRes;
+}
+
+static e_eFSP_MSGD_RES eFSP_MSGD_GetWhtMask(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* const p_puMask)
+{
+    e_eFSP_MSGD_RES l_eRes;
+    e_eCU_BUNSTF_RES l_eResBUNSTF;
+    uint32_t l_uDataL;
+    uint32_t l_uHdrL;
+    uint32_t l_uDeclL;
+	uint8_t* l_puData;
+
+    /* Init value */
+    l_uDataL = 0u;
+    l_puData = NULL;
+    *p_puMask = 0u;
+
+    l_eResBUNSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataL);
+    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBUNSTF);
+
+    if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( false == eFSP_MSGD_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) )
+    {
+        l_eRes = e_eFSP_MSGD_RES_CORRUPTCTX;
+    }
+
+    if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( EFSP_HDR_WHT == p_ptCtx->uWhtL ) )
+    {
+        /* The mask is after the length, a frame without a whole header has nothing to restore */
+        l_uHdrL = 0u;
+        l_uDeclL = 0u;
+
+        if( ( true == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDeclL) ) &&
+            ( l_uDataL >= l_uHdrL ) )
+        {
+            *p_puMask = l_puData[l_uHdrL - 1u - p_ptCtx->uCmpL - p_ptCtx->uDltL];
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MSGD_RES eFSP_MSGD_WhtXor(t_eFSP_MSGD_Ctx* const p_ptCtx, const uint8_t p_uMask)
+{
+    e_eFSP_MSGD_RES l_eRes;
+    e_eCU_BUNSTF_RES l_eResBUNSTF;
+    uint32_t l_uDataL;
+    uint32_t l_uHdrL;
+    uint32_t l_uDeclL;
+    uint32_t l_uIdx;
+    uint32_t l_uMaskI;
+	uint8_t* l_puData;
+
+    /* Init value */
+    l_uDataL = 0u;
+    l_puData = NULL;
+
+    l_eResBUNSTF = eFSP_MSGD_FrmGetData(p_ptCtx, &l_puData, &l_uDataL);
+    l_eRes = eFSP_MSGD_convertReturnFromBstf(l_eResBUNSTF);
+
+    if( ( e_eFSP_MSGD_RES_OK == l_eRes ) && ( 0u != p_uMask ) )
+    {
+        /* The mask and the payload are XORed, so calling it again with the same mask restore the received data. The
+         * compression flag and the delta fields are not whitened */
+        l_uHdrL = 0u;
+        l_uDeclL = 0u;
+
+        if( ( true == eFSP_MSGD_ParseHdr(p_ptCtx, l_puData, l_uDataL, &l_uHdrL, &l_uDeclL) ) &&
+            ( l_uDataL >= l_uHdrL ) )
+        {
+            l_uMaskI = l_uHdrL - 1u - p_ptCtx->uCmpL - p_ptCtx->uDltL;
+            l_puData[l_uMaskI] = (uint8_t)( l_puData[l_uMaskI] ^ p_uMask );
+
+            for( l_uIdx = l_uHdrL; l_uIdx < l_uDataL; l_uIdx++ )
+            {
+                l_puData[l_uIdx] = (uint8_t)( l_puData[l_uIdx] ^ p_uMask );
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_MSGD_Expand(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uHdrL,
+                               const uint32_t p_uDataL)
+{
+    bool_t l_bRes;
+    bool_t l_bIsCmp;
+    uint32_t l_uDecL;
+    uint8_t l_uCmpF;
+
+    /* The compression flag is before the delta fields */
+    l_uDecL = p_uDataL - p_uHdrL;
+    l_uCmpF = p_puData[p_uHdrL - 1u - p_ptCtx->uDltL];
+    l_bIsCmp = false;
+
+    if( ( EFSP_HDR_CMPNONE == p_ptCtx->uCmpL ) || ( EFSP_HDR_CMPRAW == l_uCmpF ) )
+    {
+        /* Sent as it is */
+        l_bRes = true;
+    }
+    else if( EFSP_HDR_CMPLZSS == l_uCmpF )
+    {
+        /* Every engine decode in the same memory area, the payload can grow till the end of it. The stream is left
+         * untouched when it can not be decompressed */
+        l_bRes = ( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Decompress(&p_puData[p_uHdrL],
+                                                               p_ptCtx->tCOBSCtx.uBuffL - p_uHdrL,
+                                                               p_uDataL - p_uHdrL, &l_uDecL) );
+        l_bIsCmp = l_bRes;
+    }
+    else
+    {
+        /* Unknown compression */
+        l_bRes = false;
+    }
+
+    if( ( true == l_bRes ) && ( EFSP_HDR_DLT == p_ptCtx->uDltL ) )
+    {
+        /* A rebuilt difference set the decoded length by itself */
+        l_bRes = eFSP_MSGD_ApplyDelta(p_ptCtx, p_puData, p_uHdrL, l_uDecL);
+    }
+
+    if( ( true == l_bRes ) && ( true == l_bIsCmp ) && ( 0u == p_ptCtx->uDecL ) )
+    {
+        p_ptCtx->uDecL = l_uDecL;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGD_ApplyDelta(t_eFSP_MSGD_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uHdrL,
+                                   const uint32_t p_uPayL)
+{
+    bool_t l_bRes;
+
+    if( EFSP_HDR_DLTKEY == p_puData[p_uHdrL - 2u] )
+    {
+        /* Keep the key frame as base of the next differences, when it fits */
+        if( p_uPayL <= p_ptCtx->uDltBaseL )
+        {
+            (void)memcpy(p_ptCtx->puDltBase, &p_puData[p_uHdrL], p_uPayL);
+            p_ptCtx->uDltUseL = p_uPayL;
+            p_ptCtx->uDltSeq = p_puData[p_uHdrL - 1u];
+        }
+        else
+        {
+            p_ptCtx->uDltUseL = 0u;
+        }
+
+        l_bRes = true;
+    }
+    else if( EFSP_HDR_DLTDIFF == p_puData[p_uHdrL - 2u] )
+    {
+        /* A difference from a key frame that was lost can not be rebuilt */
+        if( ( 0u == p_ptCtx->uDltUseL ) || ( p_ptCtx->uDltSeq != p_puData[p_uHdrL - 1u] ) )
+        {
+            l_bRes = false;
+        }
+        else if( e_eFSP_DLT_RES_OK == eFSP_DLT_Decode(&p_puData[p_uHdrL], p_ptCtx->tCOBSCtx.uBuffL - p_uHdrL,
+                                                      p_ptCtx->puDltBase, p_ptCtx->uDltUseL, p_uPayL) )
+        {
+            p_ptCtx->uDecL = p_ptCtx->uDltUseL;
+            l_bRes = true;
+        }
+        else
+        {
+            l_bRes = false;
+        }
+    }
+    else
+    {
+        /* Unknown kind of frame */
+        l_bRes = false;
+    }
+
+    return l_bRes;
 }
\ No newline at end of file
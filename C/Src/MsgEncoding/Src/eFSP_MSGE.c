@@ -20,6 +20,32 @@
  **********************************************************************************************************************/
 static bool_t eFSP_MSGE_IsStatusStillCoherent(const t_eFSP_MSGE_Ctx* p_ptCtx);
 static e_eFSP_MSGE_RES eFSP_MSGE_ConvertRetFromBstf(const e_eCU_BSTF_RES p_eRetEvent);
+static e_eCU_BSTF_RES eFSP_MSGE_ConvertRetFromCobs(const e_eFSP_COBS_RES p_eRetEvent);
+static e_eCU_BSTF_RES eFSP_MSGE_ConvertRetFromTrsp(const e_eFSP_TRSP_RES p_eRetEvent);
+static e_eCU_BSTF_RES eFSP_MSGE_FrmCheck(t_eFSP_MSGE_Ctx* const p_ptCtx);
+static e_eCU_BSTF_RES eFSP_MSGE_FrmNew(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uFrameL,
+                                       const uint32_t p_uHdrL);
+static e_eCU_BSTF_RES eFSP_MSGE_FrmRestart(t_eFSP_MSGE_Ctx* const p_ptCtx);
+static e_eCU_BSTF_RES eFSP_MSGE_FrmGetRemL(t_eFSP_MSGE_Ctx* const p_ptCtx, uint32_t* const p_puRemL);
+static e_eCU_BSTF_RES eFSP_MSGE_FrmGetChunk(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                            const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL);
+static bool_t eFSP_MSGE_IsHdrValid(const uint32_t p_uCrcL, const uint32_t p_uLenL);
+static bool_t eFSP_MSGE_IsFrmValid(const uint32_t p_uFrm);
+static bool_t eFSP_MSGE_IsWhtValid(const uint32_t p_uWhtL);
+static bool_t eFSP_MSGE_IsCmpValid(const uint32_t p_uCmpL);
+static bool_t eFSP_MSGE_IsDltValid(const t_eFSP_MSGE_Ctx* p_ptCtx);
+static bool_t eFSP_MSGE_IsFecValid(const uint32_t p_uFecL);
+static uint32_t eFSP_MSGE_GetFieldMax(const uint32_t p_uFieldL);
+static uint32_t eFSP_MSGE_GetRsvL(const uint32_t p_uCrcL, const uint32_t p_uLenL, const uint32_t p_uWhtL,
+                                  const uint32_t p_uCmpL, const uint32_t p_uDltL);
+static uint32_t eFSP_MSGE_GetLenFieldL(const uint32_t p_uLenL, const uint32_t p_uMsgLen);
+static void eFSP_MSGE_InsUxLE(uint8_t* p_puDest, const uint32_t p_uVal, const uint32_t p_uFieldL);
+static void eFSP_MSGE_InsVarLE(uint8_t* p_puDest, const uint32_t p_uVal, const uint32_t p_uFieldL);
+static bool_t eFSP_MSGE_IsEscByte(const uint32_t p_uFrm, const uint8_t p_uByte);
+static uint8_t eFSP_MSGE_GetWhtMask(const uint32_t p_uFrm, const uint8_t* p_puDat, const uint32_t p_uDataL);
+static void eFSP_MSGE_Whiten(uint8_t* p_puDat, const uint32_t p_uDataL, const uint8_t p_uMask);
+static void eFSP_MSGE_DltAccept(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint8_t p_uDltF, const uint8_t p_uCmpF,
+                                const uint8_t* p_puPay, const uint32_t p_uPayL, const uint32_t p_uMsgLen);
 
 
 
@@ -50,10 +76,38 @@ e_eFSP_MSGE_RES eFSP_MSGE_InitCtx(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p_puB
             /* Initialize internal status clbck */
             p_ptCtx->fCrc = p_fCrc;
             p_ptCtx->ptCrcCtx = p_ptFctx;
+            p_ptCtx->uCrcL = EFSP_HDR_CRC32;
+            p_ptCtx->uLenL = EFSP_HDR_LEN32;
+            p_ptCtx->uFrm = EFSP_FRM_ESC;
+            p_ptCtx->uWhtL = EFSP_HDR_WHTNONE;
+            p_ptCtx->uCmpL = EFSP_HDR_CMPNONE;
+            p_ptCtx->uDltL = EFSP_HDR_DLTNONE;
+            p_ptCtx->puDltBase = NULL;
+            p_ptCtx->uDltBaseL = 0u;
+            p_ptCtx->uDltUseL = 0u;
+            p_ptCtx->uDltKeyN = 0u;
+            p_ptCtx->uDltN = 0u;
+            p_ptCtx->uDltSeq = 0u;
+            p_ptCtx->uFecL = EFSP_FEC_NONE;
+            p_ptCtx->bPayLost = false;
 
-			/* initialize internal bytestuffer */
+			/* initialize internal bytestuffer, every engine encode the frame from the same memory area */
 			l_eResBTSTUFF =  eCU_BSTF_InitCtx(&p_ptCtx->tBSTFCtx, p_puBuff, p_uBuffL);
 			l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                l_eResBTSTUFF = eFSP_MSGE_ConvertRetFromCobs(eFSP_COBS_InitEncCtx(&p_ptCtx->tCOBSCtx, p_puBuff,
+                                                                                  p_uBuffL));
+                l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+            }
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                l_eResBTSTUFF = eFSP_MSGE_ConvertRetFromTrsp(eFSP_TRSP_InitEncCtx(&p_ptCtx->tTRSPCtx, p_puBuff,
+                                                                                  p_uBuffL));
+                l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+            }
         }
 	}
 
@@ -80,6 +134,460 @@ e_eFSP_MSGE_RES eFSP_MSGE_IsInit(t_eFSP_MSGE_Ctx* const p_ptCtx, bool_t* p_pbIsI
 	return l_eRes;
 }
 
+e_eFSP_MSGE_RES eFSP_MSGE_SetHeader(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+	uint8_t* l_puData;
+	uint32_t l_uMaxDataL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGE_IsHdrValid(p_uCrcL, p_uLenL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                }
+                else
+                {
+                    /* The buffer must contain the biggest header of the profile and some payload */
+                    l_uMaxDataL = 0u;
+                    l_puData = NULL;
+                    l_eResBTSTUFF = eCU_BSTF_GetWherePutData(&p_ptCtx->tBSTFCtx, &l_puData, &l_uMaxDataL);
+                    l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+                    if( e_eFSP_MSGE_RES_OK == l_eRes )
+                    {
+                        if( ( eFSP_MSGE_GetRsvL(p_uCrcL, p_uLenL, p_ptCtx->uWhtL, p_ptCtx->uCmpL,
+                                                p_ptCtx->uDltL) +
+                              EFSP_MIN_MSGEN_PAYLOAD ) > eFSP_FEC_GetDataL(l_uMaxDataL, p_ptCtx->uFecL) )
+                        {
+                            l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            p_ptCtx->uCrcL = p_uCrcL;
+                            p_ptCtx->uLenL = p_uLenL;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGE_RES eFSP_MSGE_SetFraming(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uFrm)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGE_IsFrmValid(p_uFrm) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uFrm = p_uFrm;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGE_RES eFSP_MSGE_SetWhitening(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uWhtL)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+	uint8_t* l_puData;
+	uint32_t l_uMaxDataL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGE_IsWhtValid(p_uWhtL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                }
+                else if( false == eFSP_MSGE_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The buffer must contain the biggest header with the mask and some payload */
+                    l_uMaxDataL = 0u;
+                    l_puData = NULL;
+                    l_eResBTSTUFF = eCU_BSTF_GetWherePutData(&p_ptCtx->tBSTFCtx, &l_puData, &l_uMaxDataL);
+                    l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+                    if( e_eFSP_MSGE_RES_OK == l_eRes )
+                    {
+                        if( ( eFSP_MSGE_GetRsvL(p_ptCtx->uCrcL, p_ptCtx->uLenL, p_uWhtL, p_ptCtx->uCmpL,
+                                                p_ptCtx->uDltL) +
+                              EFSP_MIN_MSGEN_PAYLOAD ) > eFSP_FEC_GetDataL(l_uMaxDataL, p_ptCtx->uFecL) )
+                        {
+                            l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            p_ptCtx->uWhtL = p_uWhtL;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGE_RES eFSP_MSGE_SetCompression(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uCmpL)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+	uint8_t* l_puData;
+	uint32_t l_uMaxDataL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGE_IsCmpValid(p_uCmpL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                }
+                else if( false == eFSP_MSGE_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The buffer must contain the biggest header with the flag and some payload */
+                    l_uMaxDataL = 0u;
+                    l_puData = NULL;
+                    l_eResBTSTUFF = eCU_BSTF_GetWherePutData(&p_ptCtx->tBSTFCtx, &l_puData, &l_uMaxDataL);
+                    l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+                    if( e_eFSP_MSGE_RES_OK == l_eRes )
+                    {
+                        if( ( eFSP_MSGE_GetRsvL(p_ptCtx->uCrcL, p_ptCtx->uLenL, p_ptCtx->uWhtL, p_uCmpL,
+                                                p_ptCtx->uDltL) +
+                              EFSP_MIN_MSGEN_PAYLOAD ) > eFSP_FEC_GetDataL(l_uMaxDataL, p_ptCtx->uFecL) )
+                        {
+                            l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            p_ptCtx->uCmpL = p_uCmpL;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGE_RES eFSP_MSGE_SetDelta(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL,
+                                   const uint32_t p_uKeyN)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+	uint8_t* l_puData;
+	uint32_t l_uMaxDataL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBase ) )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( ( p_uBaseL < 1u ) || ( p_uKeyN < 1u ) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                }
+                else if( false == eFSP_MSGE_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The buffer must contain the biggest header with the delta fields and some payload */
+                    l_uMaxDataL = 0u;
+                    l_puData = NULL;
+                    l_eResBTSTUFF = eCU_BSTF_GetWherePutData(&p_ptCtx->tBSTFCtx, &l_puData, &l_uMaxDataL);
+                    l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+                    if( e_eFSP_MSGE_RES_OK == l_eRes )
+                    {
+                        if( ( eFSP_MSGE_GetRsvL(p_ptCtx->uCrcL, p_ptCtx->uLenL, p_ptCtx->uWhtL, p_ptCtx->uCmpL,
+                                                EFSP_HDR_DLT) + EFSP_MIN_MSGEN_PAYLOAD ) >
+                            eFSP_FEC_GetDataL(l_uMaxDataL, p_ptCtx->uFecL) )
+                        {
+                            l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            /* The next message is a key frame */
+                            p_ptCtx->uDltL = EFSP_HDR_DLT;
+                            p_ptCtx->puDltBase = p_puBase;
+                            p_ptCtx->uDltBaseL = p_uBaseL;
+                            p_ptCtx->uDltUseL = 0u;
+                            p_ptCtx->uDltKeyN = p_uKeyN;
+                            p_ptCtx->uDltN = 0u;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGE_RES eFSP_MSGE_ResetDelta(t_eFSP_MSGE_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGE_IsDltValid(p_ptCtx) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Forget the base, the next message is a key frame */
+                    p_ptCtx->uDltUseL = 0u;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGE_RES eFSP_MSGE_SetFec(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uFecL)
+{
+	/* Local variable */
+	e_eFSP_MSGE_RES l_eRes;
+	e_eCU_BSTF_RES l_eResBTSTUFF;
+    bool_t l_bIsInit;
+	uint8_t* l_puData;
+	uint32_t l_uMaxDataL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGE_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGE_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResBTSTUFF = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+            if( e_eFSP_MSGE_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_NOINITLIB;
+                }
+                else if( false == eFSP_MSGE_IsFecValid(p_uFecL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                }
+                else if( false == eFSP_MSGE_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) )
+                {
+                    l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The buffer must contain the biggest header, some payload and the parity of both */
+                    l_uMaxDataL = 0u;
+                    l_puData = NULL;
+                    l_eResBTSTUFF = eCU_BSTF_GetWherePutData(&p_ptCtx->tBSTFCtx, &l_puData, &l_uMaxDataL);
+                    l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+
+                    if( e_eFSP_MSGE_RES_OK == l_eRes )
+                    {
+                        if( ( eFSP_MSGE_GetRsvL(p_ptCtx->uCrcL, p_ptCtx->uLenL, p_ptCtx->uWhtL, p_ptCtx->uCmpL,
+                                                p_ptCtx->uDltL) +
+                              EFSP_MIN_MSGEN_PAYLOAD ) > eFSP_FEC_GetDataL(l_uMaxDataL, p_uFecL) )
+                        {
+                            l_eRes = e_eFSP_MSGE_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            p_ptCtx->uFecL = p_uFecL;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
 e_eFSP_MSGE_RES eFSP_MSGE_GetWherePutData(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t** p_ppuDat, uint32_t* const p_puMaxL)
 {
 	/* Local variable */
@@ -88,6 +596,7 @@ e_eFSP_MSGE_RES eFSP_MSGE_GetWherePutData(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_
 	uint8_t* l_puData;
     uint8_t** l_ppuData;
 	uint32_t l_uMaxDataL;
+    uint32_t l_uHdrL;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuDat ) || ( NULL == p_puMaxL ) )
@@ -112,15 +621,35 @@ e_eFSP_MSGE_RES eFSP_MSGE_GetWherePutData(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_
 
 			if( e_eFSP_MSGE_RES_OK == l_eRes )
 			{
-                if( l_uMaxDataL < EFSP_MIN_MSGEN_BUFFLEN )
+                if( ( l_uMaxDataL < EFSP_MIN_MSGEN_BUFFLEN ) ||
+                    ( false == eFSP_MSGE_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) ||
+                    ( false == eFSP_MSGE_IsWhtValid(p_ptCtx->uWhtL) ) ||
+                    ( false == eFSP_MSGE_IsCmpValid(p_ptCtx->uCmpL) ) ||
+                    ( false == eFSP_MSGE_IsDltValid(p_ptCtx) ) ||
+                    ( false == eFSP_MSGE_IsFecValid(p_ptCtx->uFecL) ) )
                 {
                     l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
                 }
                 else
                 {
-                    /* Return reference of only the raw payload */
-                    *p_ppuDat = &(*l_ppuData)[EFSP_MSGEN_HEADERSIZE];
-                    *p_puMaxL = l_uMaxDataL - EFSP_MSGEN_HEADERSIZE;
+                    /* Return reference of only the raw payload, after the biggest header of the profile, leaving
+                     * space for the parity */
+                    l_uMaxDataL = eFSP_FEC_GetDataL(l_uMaxDataL, p_ptCtx->uFecL);
+                    l_uHdrL = eFSP_MSGE_GetRsvL(p_ptCtx->uCrcL, p_ptCtx->uLenL, p_ptCtx->uWhtL, p_ptCtx->uCmpL,
+                                                p_ptCtx->uDltL);
+
+                    if( l_uMaxDataL < ( l_uHdrL + EFSP_MIN_MSGEN_PAYLOAD ) )
+                    {
+                        l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                    }
+                    else
+                    {
+                        *p_ppuDat = &(*l_ppuData)[l_uHdrL];
+                        *p_puMaxL = l_uMaxDataL - l_uHdrL;
+
+                        /* The caller is going to copy the payload again */
+                        p_ptCtx->bPayLost = false;
+                    }
                 }
 			}
 		}
@@ -140,6 +669,15 @@ e_eFSP_MSGE_RES eFSP_MSGE_NewMessage(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint3
     bool_t l_bResC;
     uint32_t l_uNBToSf;
 	uint32_t l_uNBToC;
+    uint32_t l_uHdrL;
+    uint32_t l_uRsvL;
+    uint32_t l_uRoomL;
+    uint32_t l_uLenL;
+    uint32_t l_uWireL;
+    uint8_t l_uMask;
+    uint8_t l_uCmpF;
+    uint8_t l_uDltF;
+    uint32_t l_uPayL;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -156,10 +694,15 @@ e_eFSP_MSGE_RES eFSP_MSGE_NewMessage(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint3
 		else
 		{
             /* Check param validity, need at least 1 byte of paylaod */
-            if( ( p_uMsgLen <= 0u ) || ( p_uMsgLen > ( MAX_UINT32VAL - EFSP_MSGEN_HEADERSIZE ) ) )
+            if( p_uMsgLen <= 0u )
             {
                 l_eRes = e_eFSP_MSGE_RES_BADPARAM;
             }
+            else if( true == p_ptCtx->bPayLost )
+            {
+                /* The payload was transformed by a message that was not started, it must be copied again */
+                l_eRes = e_eFSP_MSGE_RES_NOINITMESSAGE;
+            }
             else
             {
                 /* Data where already loaded in internal buffer */
@@ -171,47 +714,183 @@ e_eFSP_MSGE_RES eFSP_MSGE_NewMessage(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint3
 
 				if( e_eFSP_MSGE_RES_OK == l_eRes )
 				{
-                    if( l_uMaxDataL < EFSP_MIN_MSGEN_BUFFLEN )
+                    if( ( l_uMaxDataL < EFSP_MIN_MSGEN_BUFFLEN ) ||
+                        ( false == eFSP_MSGE_IsHdrValid(p_ptCtx->uCrcL, p_ptCtx->uLenL) ) ||
+                        ( false == eFSP_MSGE_IsFrmValid(p_ptCtx->uFrm) ) ||
+                        ( false == eFSP_MSGE_IsWhtValid(p_ptCtx->uWhtL) ) ||
+                        ( false == eFSP_MSGE_IsCmpValid(p_ptCtx->uCmpL) ) ||
+                        ( false == eFSP_MSGE_IsDltValid(p_ptCtx) ) ||
+                        ( false == eFSP_MSGE_IsFecValid(p_ptCtx->uFecL) ) )
                     {
                         l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
                     }
                     else
                     {
-						if( ( p_uMsgLen + EFSP_MSGEN_HEADERSIZE ) > l_uMaxDataL )
+                        /* The payload was copied after the biggest header of the profile */
+                        l_uRsvL = eFSP_MSGE_GetRsvL(p_ptCtx->uCrcL, p_ptCtx->uLenL, p_ptCtx->uWhtL, p_ptCtx->uCmpL,
+                                                    p_ptCtx->uDltL);
+
+                        l_uRoomL = eFSP_FEC_GetDataL(l_uMaxDataL, p_ptCtx->uFecL);
+
+						if( ( l_uRsvL > l_uRoomL ) || ( p_uMsgLen > ( l_uRoomL - l_uRsvL ) ) ||
+                            ( ( EFSP_HDR_LENVAR != p_ptCtx->uLenL ) &&
+                              ( p_uMsgLen > eFSP_MSGE_GetFieldMax(p_ptCtx->uLenL) ) ) )
 						{
-							/* Data payload can not be greater that max payload size */
+							/* Data payload can not be greater that max payload size or the size of the len field */
 							l_eRes = e_eFSP_MSGE_RES_BADPARAM;
 						}
 						else
 						{
+                            /* Send the difference from the last key frame, a new key frame is sent when there is
+                             * none, when too many differences were sent or when the difference is not shorter */
+                            l_uWireL = p_uMsgLen;
+                            l_uDltF = EFSP_HDR_DLTKEY;
+
+                            if( EFSP_HDR_DLT == p_ptCtx->uDltL )
+                            {
+                                l_uPayL = 0u;
+
+                                /* The state of the differences is updated only when the CRC is done */
+                                if( ( p_uMsgLen == p_ptCtx->uDltUseL ) && ( p_ptCtx->uDltN < p_ptCtx->uDltKeyN ) &&
+                                    ( e_eFSP_DLT_RES_OK == eFSP_DLT_Encode(&l_puData[l_uRsvL], p_ptCtx->puDltBase,
+                                                                           p_uMsgLen, &l_uPayL) ) )
+                                {
+                                    l_uWireL = l_uPayL;
+                                    l_uDltF = EFSP_HDR_DLTDIFF;
+                                }
+                            }
+
+                            /* Compress in place, the payload is sent as it is when it does not get shorter */
+                            l_uCmpF = EFSP_HDR_CMPRAW;
+
+                            if( EFSP_HDR_CMP == p_ptCtx->uCmpL )
+                            {
+                                l_uPayL = 0u;
+
+                                if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Compress(&l_puData[l_uRsvL], l_uWireL, &l_uPayL) )
+                                {
+                                    l_uWireL = l_uPayL;
+                                    l_uCmpF = EFSP_HDR_CMPLZSS;
+                                }
+                            }
+
+                            l_uLenL = eFSP_MSGE_GetLenFieldL(p_ptCtx->uLenL, l_uWireL);
+                            l_uHdrL = p_ptCtx->uCrcL + l_uLenL + p_ptCtx->uWhtL + p_ptCtx->uCmpL + p_ptCtx->uDltL;
+
 							/* we have now the memory reference  */
+                            if( l_uRsvL != l_uHdrL )
+                            {
+                                /* A varint length shorter than the reserved one, move the payload near the header */
+                                (void)memmove(&l_puData[l_uHdrL], &l_puData[l_uRsvL], l_uWireL);
+                            }
+
 							/* Insert in the buffer the updated message size, in Little Endian */
-							l_puData[0x04u] = (uint8_t) ( ( p_uMsgLen        ) & 0x000000FFu );
-							l_puData[0x05u] = (uint8_t) ( ( p_uMsgLen >> 8u  ) & 0x000000FFu );
-							l_puData[0x06u] = (uint8_t) ( ( p_uMsgLen >> 16u ) & 0x000000FFu );
-							l_puData[0x07u] = (uint8_t) ( ( p_uMsgLen >> 24u ) & 0x000000FFu );
+                            if( EFSP_HDR_LENVAR == p_ptCtx->uLenL )
+                            {
+                                eFSP_MSGE_InsVarLE(&l_puData[p_ptCtx->uCrcL], l_uWireL, l_uLenL);
+                            }
+                            else
+                            {
+                                eFSP_MSGE_InsUxLE(&l_puData[p_ptCtx->uCrcL], l_uWireL, l_uLenL);
+                            }
+
+                            /* The CRC is calculated with a zero mask, as the decoder see the message after removing
+                             * the whitening */
+                            if( EFSP_HDR_WHT == p_ptCtx->uWhtL )
+                            {
+                                l_puData[p_ptCtx->uCrcL + l_uLenL] = 0u;
+                            }
+
+                            if( EFSP_HDR_CMP == p_ptCtx->uCmpL )
+                            {
+                                l_puData[p_ptCtx->uCrcL + l_uLenL + p_ptCtx->uWhtL] = l_uCmpF;
+                            }
+
+                            if( EFSP_HDR_DLT == p_ptCtx->uDltL )
+                            {
+                                /* A key frame start the next sequence */
+                                l_puData[l_uHdrL - 2u] = l_uDltF;
+
+                                if( EFSP_HDR_DLTKEY == l_uDltF )
+                                {
+                                    l_puData[l_uHdrL - 1u] = (uint8_t)( p_ptCtx->uDltSeq + 1u );
+                                }
+                                else
+                                {
+                                    l_puData[l_uHdrL - 1u] = p_ptCtx->uDltSeq;
+                                }
+                            }
 
 							/* Calculate the CRC of data payload and p_uMsgLen */
-							l_uNBToC = p_uMsgLen + 4u;
-							l_bResC = (*(p_ptCtx->fCrc))( p_ptCtx->ptCrcCtx, eCU_CRC_BASE_SEED, &l_puData[4u], l_uNBToC,
-                                                          &l_uC32 );
+                            if( EFSP_HDR_CRCNONE == p_ptCtx->uCrcL )
+                            {
+                                /* The link is already protected */
+                                l_uC32 = 0u;
+                                l_bResC = true;
+                            }
+                            else
+                            {
+                                l_uNBToC = l_uHdrL - p_ptCtx->uCrcL + l_uWireL;
+                                l_bResC = (*(p_ptCtx->fCrc))( p_ptCtx->ptCrcCtx, eCU_CRC_BASE_SEED,
+                                                              &l_puData[p_ptCtx->uCrcL], l_uNBToC, &l_uC32 );
+                            }
 
 							if( true == l_bResC )
 							{
-								/* Insert in the buffer the CRC32, in Little Endian */
-								l_puData[0x00u] = (uint8_t) ( ( l_uC32        ) & 0x000000FFu );
-								l_puData[0x01u] = (uint8_t) ( ( l_uC32 >> 8u  ) & 0x000000FFu );
-								l_puData[0x02u] = (uint8_t) ( ( l_uC32 >> 16u ) & 0x000000FFu );
-								l_puData[0x03u] = (uint8_t) ( ( l_uC32 >> 24u ) & 0x000000FFu );
+								/* Insert in the buffer the CRC, in Little Endian */
+								eFSP_MSGE_InsUxLE(&l_puData[0u], l_uC32, p_ptCtx->uCrcL);
+
+                                if( EFSP_HDR_DLT == p_ptCtx->uDltL )
+                                {
+                                    /* The frame is going to be sent, the payload is not whitened yet */
+                                    eFSP_MSGE_DltAccept(p_ptCtx, l_uDltF, l_uCmpF, &l_puData[l_uHdrL], l_uWireL,
+                                                        p_uMsgLen);
+                                }
+
+                                if( EFSP_HDR_WHT == p_ptCtx->uWhtL )
+                                {
+                                    /* Whiten the payload with the mask that leave less bytes to escape */
+                                    l_uMask = eFSP_MSGE_GetWhtMask(p_ptCtx->uFrm, &l_puData[l_uHdrL], l_uWireL);
+                                    eFSP_MSGE_Whiten(&l_puData[l_uHdrL], l_uWireL, l_uMask);
+                                    l_puData[p_ptCtx->uCrcL + l_uLenL] = l_uMask;
+                                }
 
 								/* the message frame is ready, need to start the bytestuffer with size of crc + size
 								* of len + real number of data */
-								l_uNBToSf = ( EFSP_MSGEN_HEADERSIZE + p_uMsgLen );
-								l_eResBTSTUFF = eCU_BSTF_NewFrame(&p_ptCtx->tBSTFCtx, l_uNBToSf);
-								l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+								l_uNBToSf = ( l_uHdrL + l_uWireL );
+
+                                if( EFSP_FEC_NONE != p_ptCtx->uFecL )
+                                {
+                                    /* Append the parity of the whole message, the framing engine send it as payload */
+                                    if( e_eFSP_FEC_RES_OK != eFSP_FEC_Encode(l_puData, l_uMaxDataL, l_uNBToSf,
+                                                                             p_ptCtx->uFecL, &l_uNBToSf) )
+                                    {
+                                        l_eRes = e_eFSP_MSGE_RES_CORRUPTCTX;
+                                    }
+                                }
+
+                                if( e_eFSP_MSGE_RES_OK == l_eRes )
+                                {
+                                    l_eResBTSTUFF = eFSP_MSGE_FrmNew(p_ptCtx, l_uNBToSf, l_uHdrL);
+                                    l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
+                                }
 							}
 							else
 							{
+                                if( l_uRsvL != l_uHdrL )
+                                {
+                                    /* Leave the payload where it was copied, so a payload that was not
+                                     * transformed can be started again */
+                                    (void)memmove(&l_puData[l_uRsvL], &l_puData[l_uHdrL], l_uWireL);
+                                }
+
+                                /* A compressed payload or a difference can not be restored in place, the state of the
+                                 * differences is left untouched */
+                                if( ( EFSP_HDR_CMPLZSS == l_uCmpF ) || ( EFSP_HDR_DLTDIFF == l_uDltF ) )
+                                {
+                                    p_ptCtx->bPayLost = true;
+                                }
+
 								l_eRes = e_eFSP_MSGE_RES_CRCCLBKERROR;
 							}
 						}
@@ -245,7 +924,7 @@ e_eFSP_MSGE_RES eFSP_MSGE_RestartMessage(t_eFSP_MSGE_Ctx* const p_ptCtx)
 		else
 		{
 			/* Restart only the byte stuffer */
-			l_eResBTSTUFF = eCU_BSTF_RestartFrame(&p_ptCtx->tBSTFCtx);
+			l_eResBTSTUFF = eFSP_MSGE_FrmRestart(p_ptCtx);
 			l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
 		}
 	}
@@ -274,7 +953,7 @@ e_eFSP_MSGE_RES eFSP_MSGE_GetRemByteToGet(t_eFSP_MSGE_Ctx* const p_ptCtx, uint32
 		else
 		{
 			/* Get memory reference */
-			l_eResBTSTUFF = eCU_BSTF_GetRemByteToGet(&p_ptCtx->tBSTFCtx, p_puRetrivedLen);
+			l_eResBTSTUFF = eFSP_MSGE_FrmGetRemL(p_ptCtx, p_puRetrivedLen);
 			l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
 		}
 	}
@@ -304,7 +983,7 @@ e_eFSP_MSGE_RES eFSP_MSGE_GetEncChunk(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p
 		else
 		{
 			/* Get memory reference */
-			l_eResBTSTUFF = eCU_BSTF_GetStufChunk(&p_ptCtx->tBSTFCtx, p_puEncBuff, p_uMaxBufL, p_puGettedL);
+			l_eResBTSTUFF = eFSP_MSGE_FrmGetChunk(p_ptCtx, p_puEncBuff, p_uMaxBufL, p_puGettedL);
 			l_eRes = eFSP_MSGE_ConvertRetFromBstf(l_eResBTSTUFF);
 		}
 	}
@@ -391,4 +1070,546 @@ static e_eFSP_MSGE_RES eFSP_MSGE_ConvertRetFromBstf(const e_eCU_BSTF_RES p_eRetE
 	}
 
 	return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_ConvertRetFromCobs(const e_eFSP_COBS_RES p_eRetEvent)
+{
+	e_eCU_BSTF_RES l_eRes;
+
+    /* The COBS engine return the same errors of the byte stuffer */
+	switch( p_eRetEvent )
+	{
+		case e_eFSP_COBS_RES_OK:
+		{
+			l_eRes = e_eCU_BSTF_RES_OK;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_BADPARAM:
+		{
+			l_eRes = e_eCU_BSTF_RES_BADPARAM;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_BADPOINTER:
+		{
+			l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_FRAMEENDED:
+		{
+			l_eRes = e_eCU_BSTF_RES_FRAMEENDED;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_NOINITLIB:
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+            break;
+		}
+
+		case e_eFSP_COBS_RES_NOINITFRAME :
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITFRAME;
+            break;
+		}
+
+		default:
+		{
+            /* Impossible end here */
+			l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            break;
+		}
+	}
+
+	return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_ConvertRetFromTrsp(const e_eFSP_TRSP_RES p_eRetEvent)
+{
+	e_eCU_BSTF_RES l_eRes;
+
+    /* The encoder side of the transparent engine return the same errors of the byte stuffer */
+	switch( p_eRetEvent )
+	{
+		case e_eFSP_TRSP_RES_OK:
+		{
+			l_eRes = e_eCU_BSTF_RES_OK;
+            break;
+		}
+
+		case e_eFSP_TRSP_RES_BADPARAM:
+		{
+			l_eRes = e_eCU_BSTF_RES_BADPARAM;
+            break;
+		}
+
+		case e_eFSP_TRSP_RES_BADPOINTER:
+		{
+			l_eRes = e_eCU_BSTF_RES_BADPOINTER;
+            break;
+		}
+
+		case e_eFSP_TRSP_RES_FRAMEENDED:
+		{
+			l_eRes = e_eCU_BSTF_RES_FRAMEENDED;
+            break;
+		}
+
+		case e_eFSP_TRSP_RES_NOINITLIB:
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+            break;
+		}
+
+		case e_eFSP_TRSP_RES_NOINITFRAME :
+		{
+			l_eRes = e_eCU_BSTF_RES_NOINITFRAME;
+            break;
+		}
+
+		default:
+		{
+            /* Impossible end here */
+			l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+            break;
+		}
+	}
+
+	return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_FrmCheck(t_eFSP_MSGE_Ctx* const p_ptCtx)
+{
+	e_eCU_BSTF_RES l_eRes;
+    bool_t l_bIsInit;
+
+    /* A not initialized context is reported before an invalid engine */
+    l_bIsInit = false;
+    l_eRes = eCU_BSTF_IsInit(&p_ptCtx->tBSTFCtx, &l_bIsInit);
+
+    if( e_eCU_BSTF_RES_OK == l_eRes )
+    {
+        if( true != l_bIsInit )
+        {
+            l_eRes = e_eCU_BSTF_RES_NOINITLIB;
+        }
+        else if( false == eFSP_MSGE_IsFrmValid(p_ptCtx->uFrm) )
+        {
+            l_eRes = e_eCU_BSTF_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eCU_BSTF_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_FrmNew(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint32_t p_uFrameL,
+                                       const uint32_t p_uHdrL)
+{
+	e_eCU_BSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGE_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromCobs(eFSP_COBS_NewEncFrame(&p_ptCtx->tCOBSCtx, p_uFrameL));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            /* Only the header is escaped */
+            l_eRes = eFSP_MSGE_ConvertRetFromTrsp(eFSP_TRSP_NewEncFrame(&p_ptCtx->tTRSPCtx, p_uFrameL, p_uHdrL));
+        }
+        else
+        {
+            l_eRes = eCU_BSTF_NewFrame(&p_ptCtx->tBSTFCtx, p_uFrameL);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_FrmRestart(t_eFSP_MSGE_Ctx* const p_ptCtx)
+{
+	e_eCU_BSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGE_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromCobs(eFSP_COBS_RestartEncFrame(&p_ptCtx->tCOBSCtx));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromTrsp(eFSP_TRSP_RestartEncFrame(&p_ptCtx->tTRSPCtx));
+        }
+        else
+        {
+            l_eRes = eCU_BSTF_RestartFrame(&p_ptCtx->tBSTFCtx);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_FrmGetRemL(t_eFSP_MSGE_Ctx* const p_ptCtx, uint32_t* const p_puRemL)
+{
+	e_eCU_BSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGE_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromCobs(eFSP_COBS_GetEncRemL(&p_ptCtx->tCOBSCtx, p_puRemL));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromTrsp(eFSP_TRSP_GetEncRemL(&p_ptCtx->tTRSPCtx, p_puRemL));
+        }
+        else
+        {
+            l_eRes = eCU_BSTF_GetRemByteToGet(&p_ptCtx->tBSTFCtx, p_puRemL);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eCU_BSTF_RES eFSP_MSGE_FrmGetChunk(t_eFSP_MSGE_Ctx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                            const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL)
+{
+	e_eCU_BSTF_RES l_eRes;
+
+    l_eRes = eFSP_MSGE_FrmCheck(p_ptCtx);
+
+    if( e_eCU_BSTF_RES_OK == l_eRes )
+    {
+        if( EFSP_FRM_COBS == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromCobs(eFSP_COBS_GetEncChunk(&p_ptCtx->tCOBSCtx, p_puEncBuff, p_uMaxBufL,
+                                                                        p_puGettedL));
+        }
+        else if( EFSP_FRM_TRSP == p_ptCtx->uFrm )
+        {
+            l_eRes = eFSP_MSGE_ConvertRetFromTrsp(eFSP_TRSP_GetEncChunk(&p_ptCtx->tTRSPCtx, p_puEncBuff, p_uMaxBufL,
+                                                                        p_puGettedL));
+        }
+        else
+        {
+            l_eRes = eCU_BSTF_GetStufChunk(&p_ptCtx->tBSTFCtx, p_puEncBuff, p_uMaxBufL, p_puGettedL);
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_MSGE_IsHdrValid(const uint32_t p_uCrcL, const uint32_t p_uLenL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_CRCNONE != p_uCrcL ) && ( EFSP_HDR_CRC16 != p_uCrcL ) && ( EFSP_HDR_CRC32 != p_uCrcL ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( EFSP_HDR_LEN8 != p_uLenL ) && ( EFSP_HDR_LEN16 != p_uLenL ) && ( EFSP_HDR_LEN32 != p_uLenL ) &&
+             ( EFSP_HDR_LENVAR != p_uLenL ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGE_IsFrmValid(const uint32_t p_uFrm)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_FRM_ESC == p_uFrm ) || ( EFSP_FRM_COBS == p_uFrm ) || ( EFSP_FRM_TRSP == p_uFrm ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGE_IsWhtValid(const uint32_t p_uWhtL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_WHTNONE == p_uWhtL ) || ( EFSP_HDR_WHT == p_uWhtL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGE_IsCmpValid(const uint32_t p_uCmpL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_CMPNONE == p_uCmpL ) || ( EFSP_HDR_CMP == p_uCmpL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGE_IsDltValid(const t_eFSP_MSGE_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+    if( EFSP_HDR_DLTNONE == p_ptCtx->uDltL )
+    {
+        l_bRes = true;
+    }
+    else if( ( EFSP_HDR_DLT == p_ptCtx->uDltL ) && ( NULL != p_ptCtx->puDltBase ) && ( p_ptCtx->uDltBaseL > 0u ) &&
+             ( p_ptCtx->uDltUseL <= p_ptCtx->uDltBaseL ) && ( p_ptCtx->uDltKeyN > 0u ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGE_IsFecValid(const uint32_t p_uFecL)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_FEC_NONE == p_uFecL ) || ( EFSP_FEC_RS4 == p_uFecL ) || ( EFSP_FEC_RS8 == p_uFecL ) ||
+        ( EFSP_FEC_RS16 == p_uFecL ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static uint32_t eFSP_MSGE_GetFieldMax(const uint32_t p_uFieldL)
+{
+    uint32_t l_uRes;
+
+    /* Biggest value that can be stored in a header field */
+    if( p_uFieldL >= 4u )
+    {
+        l_uRes = MAX_UINT32VAL;
+    }
+    else
+    {
+        l_uRes = ( ( (uint32_t) 1u ) << ( 8u * p_uFieldL ) ) - 1u;
+    }
+
+    return l_uRes;
+}
+
+static uint32_t eFSP_MSGE_GetRsvL(const uint32_t p_uCrcL, const uint32_t p_uLenL, const uint32_t p_uWhtL,
+                                  const uint32_t p_uCmpL, const uint32_t p_uDltL)
+{
+    uint32_t l_uRes;
+
+    /* Space before the payload, the varint length can use up to EFSP_HDR_LENVARMAX bytes */
+    if( EFSP_HDR_LENVAR == p_uLenL )
+    {
+        l_uRes = p_uCrcL + EFSP_HDR_LENVARMAX + p_uWhtL + p_uCmpL + p_uDltL;
+    }
+    else
+    {
+        l_uRes = p_uCrcL + p_uLenL + p_uWhtL + p_uCmpL + p_uDltL;
+    }
+
+    return l_uRes;
+}
+
+static uint32_t eFSP_MSGE_GetLenFieldL(const uint32_t p_uLenL, const uint32_t p_uMsgLen)
+{
+    uint32_t l_uRes;
+    uint32_t l_uRem;
+
+    if( EFSP_HDR_LENVAR == p_uLenL )
+    {
+        /* One byte every 7 bit of the length */
+        l_uRes = 1u;
+        l_uRem = p_uMsgLen >> 7u;
+
+        while( 0u != l_uRem )
+        {
+            l_uRes++;
+            l_uRem = l_uRem >> 7u;
+        }
+    }
+    else
+    {
+        l_uRes = p_uLenL;
+    }
+
+    return l_uRes;
+}
+
+static void eFSP_MSGE_InsUxLE(uint8_t* p_puDest, const uint32_t p_uVal, const uint32_t p_uFieldL)
+{
+    uint32_t l_uIdx;
+
+    for( l_uIdx = 0u; l_uIdx < p_uFieldL; l_uIdx++ )
+    {
+        p_puDest[l_uIdx] = (uint8_t) ( ( p_uVal >> ( 8u * l_uIdx ) ) & 0x000000FFu );
+    }
+}
+
+static void eFSP_MSGE_InsVarLE(uint8_t* p_puDest, const uint32_t p_uVal, const uint32_t p_uFieldL)
+{
+    uint32_t l_uIdx;
+
+    for( l_uIdx = 0u; l_uIdx < p_uFieldL; l_uIdx++ )
+    {
+        p_puDest[l_uIdx] = (uint8_t) ( ( p_uVal >> ( 7u * l_uIdx ) ) & 0x0000007Fu );
+
+        if( ( l_uIdx + 1u ) < p_uFieldL )
+        {
+            /* Another byte follows */
+            p_puDest[l_uIdx] |= 0x80u;
+        }
+    }
+}
+
+static bool_t eFSP_MSGE_IsEscByte(const uint32_t p_uFrm, const uint8_t p_uByte)
+{
+    bool_t l_bRes;
+
+    /* Bytes of the payload that take two bytes on the wire. COBS replace every zero with a single code byte, and the
+     * transparent engine send the payload as it is, so only the escape engine expand some bytes */
+    if( ( EFSP_FRM_ESC == p_uFrm ) &&
+        ( ( ECU_SOF == p_uByte ) || ( ECU_EOF == p_uByte ) || ( ECU_ESC == p_uByte ) ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+static uint8_t eFSP_MSGE_GetWhtMask(const uint32_t p_uFrm, const uint8_t* p_puDat, const uint32_t p_uDataL)
+{
+    /* Candidate masks, the first is no whitening at all */
+    const uint8_t l_auMask[] = { 0x00u, 0xFFu, 0x55u, 0xAAu, 0x0Fu, 0xF0u, 0x33u, 0xCCu };
+    uint32_t l_uM;
+    uint32_t l_uIdx;
+    uint32_t l_uEscN;
+    uint32_t l_uBestN;
+    uint8_t l_uBest;
+
+    /* Init var */
+    l_uBest = l_auMask[0u];
+    l_uBestN = MAX_UINT32VAL;
+
+    for( l_uM = 0u; ( l_uM < sizeof(l_auMask) ) && ( 0u != l_uBestN ); l_uM++ )
+    {
+        /* Count the bytes to escape, a mask already worse than the best one is dropped */
+        l_uEscN = 0u;
+
+        for( l_uIdx = 0u; ( l_uIdx < p_uDataL ) && ( l_uEscN < l_uBestN ); l_uIdx++ )
+        {
+            if( true == eFSP_MSGE_IsEscByte(p_uFrm, (uint8_t)( p_puDat[l_uIdx] ^ l_auMask[l_uM] )) )
+            {
+                l_uEscN++;
+            }
+        }
+
+        if( l_uEscN < l_uBestN )
+        {
+            l_uBestN = l_uEscN;
+            l_uBest = l_auMask[l_uM];
+        }
+    }
+
+    return l_uBest;
+}
+
+static void eFSP_MSGE_Whiten(uint8_t* p_puDat, const uint32_t p_uDataL, const uint8_t p_uMask)
+{
+    uint32_t l_uIdx;
+
+    if( 0u != p_uMask )
+    {
+        for( l_uIdx = 0u; l_uIdx < p_uDataL; l_uIdx++ )
+        {
+            p_puDat[l_uIdx] = (uint8_t)( p_puDat[l_uIdx] ^ p_uMask );
+        }
+    }
+}
+
+static void eFSP_MSGE_DltAccept(t_eFSP_MSGE_Ctx* const p_ptCtx, const uint8_t p_uDltF, const uint8_t p_uCmpF,
+                                const uint8_t* p_puPay, const uint32_t p_uPayL, const uint32_t p_uMsgLen)
+{
+    uint32_t l_uDecL;
+
+    if( EFSP_HDR_DLTDIFF == p_uDltF )
+    {
+        p_ptCtx->uDltN++;
+    }
+    else
+    {
+        p_ptCtx->uDltSeq++;
+        p_ptCtx->uDltN = 0u;
+        p_ptCtx->uDltUseL = 0u;
+
+        /* A payload too big to be a base, or that can not be rebuilt, make the next message a key frame too */
+        if( p_uMsgLen <= p_ptCtx->uDltBaseL )
+        {
+            if( EFSP_HDR_CMPLZSS == p_uCmpF )
+            {
+                /* The key frame is already compressed, rebuild the base from it */
+                (void)memcpy(p_ptCtx->puDltBase, p_puPay, p_uPayL);
+                l_uDecL = 0u;
+
+                if( ( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Decompress(p_ptCtx->puDltBase, p_ptCtx->uDltBaseL, p_uPayL,
+                                                                 &l_uDecL) ) && ( p_uMsgLen == l_uDecL ) )
+                {
+                    p_ptCtx->uDltUseL = p_uMsgLen;
+                }
+            }
+            else
+            {
+                (void)memcpy(p_ptCtx->puDltBase, p_puPay, p_uMsgLen);
+                p_ptCtx->uDltUseL = p_uMsgLen;
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,772 @@
+/**
+ * @file       eFSP_TRSP.c
+ *
+ * @brief      Length delimited transparent framing, only the header is escaped
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TRSP.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_TRSP_IsEncStillCoherent(const t_eFSP_TRSP_EncCtx* p_ptCtx);
+static e_eFSP_TRSP_RES eFSP_TRSP_CheckEncCtx(const t_eFSP_TRSP_EncCtx* p_ptCtx);
+static bool_t eFSP_TRSP_IsDecStillCoherent(const t_eFSP_TRSP_DecCtx* p_ptCtx);
+static e_eFSP_TRSP_RES eFSP_TRSP_CheckDecCtx(const t_eFSP_TRSP_DecCtx* p_ptCtx);
+static bool_t eFSP_TRSP_IsToEsc(const uint8_t p_uByte);
+static void eFSP_TRSP_EncHdrEnd(t_eFSP_TRSP_EncCtx* const p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_TRSP_RES eFSP_TRSP_InitEncCtx(t_eFSP_TRSP_EncCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uBuffL < 1u )
+        {
+            l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uFrameL = 0u;
+            p_ptCtx->uHdrL = 0u;
+            p_ptCtx->uFrameEncL = 0u;
+            p_ptCtx->uCntr = 0u;
+            p_ptCtx->uSentL = 0u;
+            p_ptCtx->bEsc = false;
+            p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_NOFRAME;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_TRSP_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_NewEncFrame(t_eFSP_TRSP_EncCtx* const p_ptCtx, const uint32_t p_uFrameL,
+                                      const uint32_t p_uHdrL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            if( ( p_uFrameL < 1u ) || ( p_uFrameL > p_ptCtx->uBuffL ) || ( p_uHdrL > p_uFrameL ) )
+            {
+                l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+            }
+            else
+            {
+                /* Sync sequence, frame and a byte for every escaped byte of the header */
+                p_ptCtx->uFrameEncL = EFSP_TRSP_SYNCL + p_uFrameL;
+
+                for( l_uIdx = 0u; l_uIdx < p_uHdrL; l_uIdx++ )
+                {
+                    if( true == eFSP_TRSP_IsToEsc(p_ptCtx->puBuff[l_uIdx]) )
+                    {
+                        p_ptCtx->uFrameEncL++;
+                    }
+                }
+
+                p_ptCtx->uFrameL = p_uFrameL;
+                p_ptCtx->uHdrL = p_uHdrL;
+                p_ptCtx->uCntr = 0u;
+                p_ptCtx->uSentL = 0u;
+                p_ptCtx->bEsc = false;
+                p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_SYNC1;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_RestartEncFrame(t_eFSP_TRSP_EncCtx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            if( e_eFSP_TRSP_ENCSM_NOFRAME == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_NOINITFRAME;
+            }
+            else
+            {
+                p_ptCtx->uCntr = 0u;
+                p_ptCtx->uSentL = 0u;
+                p_ptCtx->bEsc = false;
+                p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_SYNC1;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_GetEncRemL(t_eFSP_TRSP_EncCtx* const p_ptCtx, uint32_t* const p_puRemL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRemL ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            if( e_eFSP_TRSP_ENCSM_NOFRAME == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_NOINITFRAME;
+            }
+            else
+            {
+                *p_puRemL = p_ptCtx->uFrameEncL - p_ptCtx->uSentL;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_GetEncChunk(t_eFSP_TRSP_EncCtx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                      const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+    uint32_t l_uFilledL;
+    uint32_t l_uRawL;
+    uint8_t l_uByte;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puEncBuff ) || ( NULL == p_puGettedL ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckEncCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            if( p_uMaxBufL < 1u )
+            {
+                l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+            }
+            else if( e_eFSP_TRSP_ENCSM_NOFRAME == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_NOINITFRAME;
+            }
+            else
+            {
+                l_uFilledL = 0u;
+
+                while( ( l_uFilledL < p_uMaxBufL ) && ( e_eFSP_TRSP_ENCSM_ENDED != p_ptCtx->eSt ) )
+                {
+                    switch( p_ptCtx->eSt )
+                    {
+                        case e_eFSP_TRSP_ENCSM_SYNC1:
+                        {
+                            p_puEncBuff[l_uFilledL] = EFSP_TRSP_SYNC1;
+                            l_uFilledL++;
+                            p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_SYNC2;
+                            break;
+                        }
+
+                        case e_eFSP_TRSP_ENCSM_SYNC2:
+                        {
+                            p_puEncBuff[l_uFilledL] = EFSP_TRSP_SYNC2;
+                            l_uFilledL++;
+                            eFSP_TRSP_EncHdrEnd(p_ptCtx);
+                            break;
+                        }
+
+                        case e_eFSP_TRSP_ENCSM_HDR:
+                        {
+                            l_uByte = p_ptCtx->puBuff[p_ptCtx->uCntr];
+
+                            if( true == p_ptCtx->bEsc )
+                            {
+                                /* Second byte of an escaped one */
+                                p_puEncBuff[l_uFilledL] = l_uByte ^ EFSP_TRSP_ESCXOR;
+                                p_ptCtx->bEsc = false;
+                                p_ptCtx->uCntr++;
+                            }
+                            else if( true == eFSP_TRSP_IsToEsc(l_uByte) )
+                            {
+                                p_puEncBuff[l_uFilledL] = EFSP_TRSP_ESC;
+                                p_ptCtx->bEsc = true;
+                            }
+                            else
+                            {
+                                p_puEncBuff[l_uFilledL] = l_uByte;
+                                p_ptCtx->uCntr++;
+                            }
+
+                            l_uFilledL++;
+                            eFSP_TRSP_EncHdrEnd(p_ptCtx);
+                            break;
+                        }
+
+                        default:
+                        {
+                            /* The raw part is copied as it is, as much as possible */
+                            l_uRawL = p_ptCtx->uFrameL - p_ptCtx->uCntr;
+                            if( l_uRawL > ( p_uMaxBufL - l_uFilledL ) )
+                            {
+                                l_uRawL = p_uMaxBufL - l_uFilledL;
+                            }
+
+                            (void)memcpy(&p_puEncBuff[l_uFilledL], &p_ptCtx->puBuff[p_ptCtx->uCntr], l_uRawL);
+                            l_uFilledL += l_uRawL;
+                            p_ptCtx->uCntr += l_uRawL;
+
+                            if( p_ptCtx->uCntr >= p_ptCtx->uFrameL )
+                            {
+                                p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_ENDED;
+                            }
+                            break;
+                        }
+                    }
+                }
+
+                p_ptCtx->uSentL += l_uFilledL;
+                *p_puGettedL = l_uFilledL;
+
+                if( e_eFSP_TRSP_ENCSM_ENDED == p_ptCtx->eSt )
+                {
+                    l_eRes = e_eFSP_TRSP_RES_FRAMEENDED;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_InitDecCtx(t_eFSP_TRSP_DecCtx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( p_uBuffL < 1u )
+        {
+            l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uCntr = 0u;
+            p_ptCtx->uHdrL = 0u;
+            p_ptCtx->uRawL = 0u;
+            p_ptCtx->bEsc = false;
+            p_ptCtx->eSt = e_eFSP_TRSP_DECSM_WAITSYNC1;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_TRSP_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_NewDecFrame(t_eFSP_TRSP_DecCtx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            p_ptCtx->uCntr = 0u;
+            p_ptCtx->uHdrL = 0u;
+            p_ptCtx->uRawL = 0u;
+            p_ptCtx->bEsc = false;
+            p_ptCtx->eSt = e_eFSP_TRSP_DECSM_WAITSYNC1;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_GetDecData(t_eFSP_TRSP_DecCtx* const p_ptCtx, uint8_t** p_ppuData,
+                                     uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            *p_ppuData = p_ptCtx->puBuff;
+            *p_puDataL = p_ptCtx->uCntr;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_GetDecState(t_eFSP_TRSP_DecCtx* const p_ptCtx, bool_t* const p_pbWaitSync,
+                                      bool_t* const p_pbEnded, bool_t* const p_pbBad)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbWaitSync ) || ( NULL == p_pbEnded ) || ( NULL == p_pbBad ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            *p_pbWaitSync = ( ( e_eFSP_TRSP_DECSM_WAITSYNC1 == p_ptCtx->eSt ) ||
+                              ( e_eFSP_TRSP_DECSM_WAITSYNC2 == p_ptCtx->eSt ) );
+            *p_pbEnded = ( e_eFSP_TRSP_DECSM_ENDED == p_ptCtx->eSt );
+            *p_pbBad = ( e_eFSP_TRSP_DECSM_BAD == p_ptCtx->eSt );
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_SetDecHdrL(t_eFSP_TRSP_DecCtx* const p_ptCtx, const uint32_t p_uHdrL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            if( ( e_eFSP_TRSP_DECSM_NEEDLEN != p_ptCtx->eSt ) || ( p_uHdrL <= p_ptCtx->uCntr ) )
+            {
+                l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+            }
+            else if( p_uHdrL > p_ptCtx->uBuffL )
+            {
+                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_BAD;
+                l_eRes = e_eFSP_TRSP_RES_OUTOFMEM;
+            }
+            else
+            {
+                p_ptCtx->uHdrL = p_uHdrL;
+                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_HDR;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_SetDecRawL(t_eFSP_TRSP_DecCtx* const p_ptCtx, const uint32_t p_uRawL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            if( e_eFSP_TRSP_DECSM_NEEDLEN != p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+            }
+            else if( p_uRawL > ( p_ptCtx->uBuffL - p_ptCtx->uCntr ) )
+            {
+                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_BAD;
+                l_eRes = e_eFSP_TRSP_RES_OUTOFMEM;
+            }
+            else if( 0u == p_uRawL )
+            {
+                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_ENDED;
+                l_eRes = e_eFSP_TRSP_RES_FRAMEENDED;
+            }
+            else
+            {
+                p_ptCtx->uRawL = p_uRawL;
+                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_RAW;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSP_InsEncChunk(t_eFSP_TRSP_DecCtx* const p_ptCtx, const uint8_t* p_puEncBuff,
+                                      const uint32_t p_uEncL, uint32_t* const p_puUsedL)
+{
+	/* Local variable */
+	e_eFSP_TRSP_RES l_eRes;
+    uint32_t l_uUsedL;
+    uint32_t l_uRawL;
+    uint8_t l_uByte;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puEncBuff ) || ( NULL == p_puUsedL ) )
+	{
+		l_eRes = e_eFSP_TRSP_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TRSP_CheckDecCtx(p_ptCtx);
+
+        if( e_eFSP_TRSP_RES_OK == l_eRes )
+        {
+            *p_puUsedL = 0u;
+
+            if( p_uEncL < 1u )
+            {
+                l_eRes = e_eFSP_TRSP_RES_BADPARAM;
+            }
+            else if( e_eFSP_TRSP_DECSM_ENDED == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_FRAMEENDED;
+            }
+            else if( e_eFSP_TRSP_DECSM_BAD == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_BADFRAME;
+            }
+            else if( e_eFSP_TRSP_DECSM_NEEDLEN == p_ptCtx->eSt )
+            {
+                l_eRes = e_eFSP_TRSP_RES_NEEDLEN;
+            }
+            else
+            {
+                l_uUsedL = 0u;
+
+                while( ( l_uUsedL < p_uEncL ) && ( e_eFSP_TRSP_RES_OK == l_eRes ) )
+                {
+                    switch( p_ptCtx->eSt )
+                    {
+                        case e_eFSP_TRSP_DECSM_WAITSYNC1:
+                        {
+                            /* Discard everything till the sync sequence */
+                            if( EFSP_TRSP_SYNC1 == p_puEncBuff[l_uUsedL] )
+                            {
+                                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_WAITSYNC2;
+                            }
+                            l_uUsedL++;
+                            break;
+                        }
+
+                        case e_eFSP_TRSP_DECSM_WAITSYNC2:
+                        {
+                            l_uByte = p_puEncBuff[l_uUsedL];
+                            l_uUsedL++;
+
+                            if( EFSP_TRSP_SYNC2 == l_uByte )
+                            {
+                                /* The size of the header is not known yet */
+                                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_NEEDLEN;
+                                l_eRes = e_eFSP_TRSP_RES_NEEDLEN;
+                            }
+                            else if( EFSP_TRSP_SYNC1 != l_uByte )
+                            {
+                                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_WAITSYNC1;
+                            }
+                            else
+                            {
+                                /* Still the first byte of the sync */
+                            }
+                            break;
+                        }
+
+                        case e_eFSP_TRSP_DECSM_HDR:
+                        {
+                            l_uByte = p_puEncBuff[l_uUsedL];
+                            l_uUsedL++;
+
+                            if( EFSP_TRSP_SYNC1 == l_uByte )
+                            {
+                                /* Sync inside the header, a new frame is starting */
+                                p_ptCtx->uCntr = 0u;
+                                p_ptCtx->uHdrL = 0u;
+                                p_ptCtx->bEsc = false;
+                                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_WAITSYNC2;
+                                l_eRes = e_eFSP_TRSP_RES_FRAMERESTART;
+                            }
+                            else if( ( false == p_ptCtx->bEsc ) && ( EFSP_TRSP_ESC == l_uByte ) )
+                            {
+                                p_ptCtx->bEsc = true;
+                            }
+                            else
+                            {
+                                if( true == p_ptCtx->bEsc )
+                                {
+                                    l_uByte ^= EFSP_TRSP_ESCXOR;
+                                    p_ptCtx->bEsc = false;
+                                }
+
+                                /* uHdrL is never bigger than the memory area */
+                                p_ptCtx->puBuff[p_ptCtx->uCntr] = l_uByte;
+                                p_ptCtx->uCntr++;
+
+                                if( p_ptCtx->uCntr >= p_ptCtx->uHdrL )
+                                {
+                                    p_ptCtx->eSt = e_eFSP_TRSP_DECSM_NEEDLEN;
+                                    l_eRes = e_eFSP_TRSP_RES_NEEDLEN;
+                                }
+                            }
+                            break;
+                        }
+
+                        case e_eFSP_TRSP_DECSM_RAW:
+                        {
+                            /* No escape in the raw part, the source can overlap the memory area */
+                            l_uRawL = p_uEncL - l_uUsedL;
+                            if( l_uRawL > p_ptCtx->uRawL )
+                            {
+                                l_uRawL = p_ptCtx->uRawL;
+                            }
+
+                            (void)memmove(&p_ptCtx->puBuff[p_ptCtx->uCntr], &p_puEncBuff[l_uUsedL], l_uRawL);
+                            p_ptCtx->uCntr += l_uRawL;
+                            p_ptCtx->uRawL -= l_uRawL;
+                            l_uUsedL += l_uRawL;
+
+                            if( 0u == p_ptCtx->uRawL )
+                            {
+                                p_ptCtx->eSt = e_eFSP_TRSP_DECSM_ENDED;
+                                l_eRes = e_eFSP_TRSP_RES_FRAMEENDED;
+                            }
+                            break;
+                        }
+
+                        default:
+                        {
+                            /* Impossible end here */
+                            l_eRes = e_eFSP_TRSP_RES_CORRUPTCTX;
+                            break;
+                        }
+                    }
+                }
+
+                *p_puUsedL = l_uUsedL;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_TRSP_IsEncStillCoherent(const t_eFSP_TRSP_EncCtx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puBuff )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check index validity */
+        if( ( p_ptCtx->uFrameL > p_ptCtx->uBuffL ) || ( p_ptCtx->uHdrL > p_ptCtx->uFrameL ) ||
+            ( p_ptCtx->uCntr > p_ptCtx->uFrameL ) || ( p_ptCtx->uSentL > p_ptCtx->uFrameEncL ) ||
+            ( p_ptCtx->eSt > e_eFSP_TRSP_ENCSM_ENDED ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_TRSP_RES eFSP_TRSP_CheckEncCtx(const t_eFSP_TRSP_EncCtx* p_ptCtx)
+{
+    e_eFSP_TRSP_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_TRSP_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_TRSP_IsEncStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_TRSP_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_TRSP_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_TRSP_IsDecStillCoherent(const t_eFSP_TRSP_DecCtx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puBuff )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check index validity */
+        if( ( p_ptCtx->uCntr > p_ptCtx->uBuffL ) || ( p_ptCtx->uHdrL > p_ptCtx->uBuffL ) ||
+            ( p_ptCtx->uRawL > ( p_ptCtx->uBuffL - p_ptCtx->uCntr ) ) || ( p_ptCtx->eSt > e_eFSP_TRSP_DECSM_BAD ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_TRSP_RES eFSP_TRSP_CheckDecCtx(const t_eFSP_TRSP_DecCtx* p_ptCtx)
+{
+    e_eFSP_TRSP_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_TRSP_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_TRSP_IsDecStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_TRSP_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_TRSP_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_TRSP_IsToEsc(const uint8_t p_uByte)
+{
+    return ( ( EFSP_TRSP_SYNC1 == p_uByte ) || ( EFSP_TRSP_ESC == p_uByte ) );
+}
+
+static void eFSP_TRSP_EncHdrEnd(t_eFSP_TRSP_EncCtx* const p_ptCtx)
+{
+    if( p_ptCtx->uCntr < p_ptCtx->uHdrL )
+    {
+        p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_HDR;
+    }
+    else if( p_ptCtx->uCntr < p_ptCtx->uFrameL )
+    {
+        p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_RAW;
+    }
+    else
+    {
+        p_ptCtx->eSt = e_eFSP_TRSP_ENCSM_ENDED;
+    }
+}
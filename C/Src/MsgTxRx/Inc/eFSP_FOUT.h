@@ -0,0 +1,266 @@
+/**
+ * @file       eFSP_FOUT.h
+ *
+ * @brief      Encode once fan-out of a message to many message transmitters
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_FOUT_H
+#define EFSP_FOUT_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eFSP_MSGE.h"
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_FOUT_RES_OK = 0,
+    e_eFSP_FOUT_RES_BADPARAM,
+    e_eFSP_FOUT_RES_BADPOINTER,
+	e_eFSP_FOUT_RES_CORRUPTCTX,
+    e_eFSP_FOUT_RES_NOINITLIB,
+    e_eFSP_FOUT_RES_NOINITMESSAGE,
+	e_eFSP_FOUT_RES_CRCCLBKERROR,
+    e_eFSP_FOUT_RES_OUTOFMEM,
+    e_eFSP_FOUT_RES_BUSY
+}e_eFSP_FOUT_RES;
+
+typedef struct
+{
+    t_eFSP_MSGE_Ctx tMsgeCtx;
+    uint8_t*        puFrame;
+    uint32_t        uFrameAreaL;
+    uint32_t        uFrameL;
+    uint32_t        uMsgL;
+    uint32_t        uRefN;
+    uint32_t        uGen;
+}t_eFSP_FOUT_Ctx;
+
+typedef struct
+{
+    uint8_t*            puIMemArea;
+    uint32_t            uIMemAreaL;
+    uint8_t*            puIFrameArea;
+    uint32_t            uIFrameAreaL;
+    f_eFSP_MSGE_CrcCb   fICrc;
+    t_eFSP_MSGE_CrcCtx* ptICbCrcCtx;
+}t_eFSP_FOUT_InitData;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the fan-out context. A message is encoded once, header, CRC and byte stuffing included, in
+ *              the frame area, and every transmitter that send it take a reference to the frame with
+ *              eFSP_MSGTX_NewShared and drain it with its own cursor.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_ptInitData    - Init data. puIMemArea is the payload area of the encoder, puIFrameArea must contain
+ *                                the whole encoded frame of the biggest message
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_InitCtx(t_eFSP_FOUT_Ctx* const p_ptCtx, const t_eFSP_FOUT_InitData* p_ptInitData);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_IsInit(t_eFSP_FOUT_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Set the CRC size and the length field of the header used starting from the next message, see
+ *              eFSP_MSGE_SetHeader. Every receiver of the fan-out must use the same header profile.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_uCrcL         - EFSP_HDR_CRCNONE, EFSP_HDR_CRC16 or EFSP_HDR_CRC32
+ * @param[in]   p_uLenL         - EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32 or EFSP_HDR_LENVAR
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_SetHeader(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL);
+
+/**
+ * @brief       Set the framing engine used starting from the next message, see eFSP_MSGE_SetFraming
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_uFrm          - EFSP_FRM_ESC, EFSP_FRM_COBS or EFSP_FRM_TRSP
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_SetFraming(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uFrm);
+
+/**
+ * @brief       Set the payload whitening used starting from the next message, see eFSP_MSGE_SetWhitening
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_uWhtL         - EFSP_HDR_WHTNONE or EFSP_HDR_WHT
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_SetWhitening(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uWhtL);
+
+/**
+ * @brief       Set the compression stage used starting from the next message, see eFSP_MSGE_SetCompression. The
+ *              payload is compressed only once for all the transmitters.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_uCmpL         - EFSP_HDR_CMPNONE or EFSP_HDR_CMP
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_SetCompression(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uCmpL);
+
+/**
+ * @brief       Set the forward error correction used starting from the next message, see eFSP_MSGE_SetFec. The
+ *              parity is computed only once for all the transmitters.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_uFecL         - EFSP_FEC_NONE, EFSP_FEC_RS4, EFSP_FEC_RS8 or EFSP_FEC_RS16
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_SetFec(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uFecL);
+
+/**
+ * @brief       Retrive the pointer of the buffer that the user can use to insert the payload of the next message.
+ *              The encoded frame is kept in its own area, so the next payload can be prepared while the transmitters
+ *              are still sending the current frame.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the raw data needs to be copied before starting a message
+ * @param[out]  p_puMaxDL       - Pointer to a uint32_t variable where the max number of data that can be copied in
+ *                                p_ppuData will be placed
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_GetWherePutData(t_eFSP_FOUT_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                          uint32_t* const p_puMaxDL);
+
+/**
+ * @brief       Encode the whole frame of a payload already copied in memory. The CRC, the optional stages and the
+ *              byte stuffing are done only here, whatever is the number of transmitters that will send the frame.
+ *              The frame can not be replaced while a transmitter is still referencing it.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[in]   p_uMsgL         - lenght of the raw payload present in the frame that we need to encode ( no header )
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_FOUT_RES_NOINITMESSAGE - The payload was compressed by a message that failed on the CRC, it
+ *                                              must be copied again after calling eFSP_FOUT_GetWherePutData
+ *				e_eFSP_FOUT_RES_CRCCLBKERROR  - The crc callback function returned an error
+ *		        e_eFSP_FOUT_RES_OUTOFMEM      - The frame area can not contain the encoded frame, no frame is
+ *                                              available till the next message
+ *		        e_eFSP_FOUT_RES_BUSY          - Some transmitter is still referencing the current frame, that is left
+ *                                              untouched, retry later
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_NewMessage(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uMsgL);
+
+/**
+ * @brief       Retrive the number of transmitters that are still referencing the current frame
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[out]  p_puRefN        - Pointer to a uint32_t variable where the number of references will be placed
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_GetRefN(t_eFSP_FOUT_Ctx* const p_ptCtx, uint32_t* const p_puRefN);
+
+/**
+ * @brief       Take a reference to the current frame. Used by eFSP_MSGTX_NewShared, the frame must not be written
+ *              and stay valid till eFSP_FOUT_Detach is called.
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ * @param[out]  p_ppuFrame      - Pointer to a Pointer where the location of the encoded frame will be placed
+ * @param[out]  p_puFrameL      - Pointer to a uint32_t variable where the size of the encoded frame will be placed
+ * @param[out]  p_puMsgL        - Pointer to a uint32_t variable where the size of the raw payload will be placed
+ * @param[out]  p_puGen         - Pointer to a uint32_t variable where the generation of the frame will be placed, it
+ *                                change every time a new message is started
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_NOINITMESSAGE - No frame is encoded
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_Attach(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint8_t** p_ppuFrame,
+                                 uint32_t* const p_puFrameL, uint32_t* const p_puMsgL, uint32_t* const p_puGen);
+
+/**
+ * @brief       Release a reference taken with eFSP_FOUT_Attach
+ *
+ * @param[in]   p_ptCtx         - Fan-out context
+ *
+ * @return      e_eFSP_FOUT_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FOUT_RES_BADPARAM      - No reference is taken
+ *		        e_eFSP_FOUT_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FOUT_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FOUT_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FOUT_RES eFSP_FOUT_Detach(t_eFSP_FOUT_Ctx* const p_ptCtx);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_FOUT_H */
@@ -23,6 +23,16 @@ extern "C" {
  **********************************************************************************************************************/
 #include "eFSP_TYPE.h"
 #include "eFSP_MSGD.h"
+#include "eFSP_SPSCR.h"
+#include "eFSP_TIMW.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Biggest credit window, so the limits granted to the transmitter can be compared across a wrap around */
+#define EFSP_MSGRX_MAXCREDIT                                            ( 0x7FFFFFFFu )
 
 
 
@@ -45,6 +55,10 @@ typedef bool_t (*f_eFSP_MSGRX_RxCb) ( t_eFSP_MSGRX_RxCtx* const p_ptCtx, uint8_t
 typedef bool_t (*f_eFSP_MSGRX_TimStart) ( t_eFSP_MSGRX_TimCtx* const p_ptCtx, const uint32_t p_uTimeout );
 typedef bool_t (*f_eFSP_MSGRX_TimGetRemaing) ( t_eFSP_MSGRX_TimCtx* const p_ptCtx, uint32_t* const p_puRemain );
 
+/* Optional call back to a monotonic clock, that return the current time in ms and can wrap around. When used in place
+ * of the timer call backs the timeout is stored as an absolute deadline and compared inline */
+typedef bool_t (*f_eFSP_MSGRX_TimGetNow) ( t_eFSP_MSGRX_TimCtx* const p_ptCtx, uint32_t* const p_puNowMs );
+
 typedef struct
 {
     t_eFSP_MSGRX_TimCtx*        ptTimCtx;
@@ -69,6 +83,16 @@ typedef enum
     e_eFSP_MSGRX_RES_TIMCLBKERROR
 }e_eFSP_MSGRX_RES;
 
+/* Define a generic event func callback context that must be implemented by the user */
+typedef struct t_eFSP_MSGRX_EvtCtxUser t_eFSP_MSGRX_EvtCtx;
+
+/* Call back to a function that will be notified when the current message reach a final state, that can be
+ * e_eFSP_MSGRX_RES_MESSAGERECEIVED, e_eFSP_MSGRX_RES_BADFRAME or e_eFSP_MSGRX_RES_MESSAGETIMEOUT. The callback is
+ * called only once for every message started with eFSP_MSGRX_NewMsg or eFSP_MSGRX_NewMsgNClean.
+ * the p_ptCtx parameter is a custom pointer that can be used by the creator of this EVT callback, and will not be used
+ * by the MSG RECEIVER module */
+typedef void (*f_eFSP_MSGRX_EvtCb) ( t_eFSP_MSGRX_EvtCtx* const p_ptCtx, const e_eFSP_MSGRX_RES p_eEvt );
+
 typedef struct
 {
     t_eFSP_MSGD_Ctx      tMsgdCtx;
@@ -82,6 +106,31 @@ typedef struct
     uint32_t             uTimeoutMs;
     uint32_t             uTimePerRecMs;
     bool_t               bWaitFrmStart;
+    f_eFSP_MSGRX_EvtCb   fEvt;
+    t_eFSP_MSGRX_EvtCtx* ptEvtCtx;
+    bool_t               bEvtPend;
+    t_eFSP_SPSCR_Ctx*    ptRing;
+    f_eFSP_MSGRX_TimGetNow fTimNow;
+    uint32_t             uNowMs;
+    uint32_t             uDeadlineMs;
+    uint32_t             uArmedMs;
+    t_eFSP_TIMW_Ctx*     ptTimW;
+    t_eFSP_TIMW_Node     tTimNode;
+    uint32_t             uLineRate;
+    uint32_t             uLineMarginMs;
+    bool_t               bFrmTimSized;
+    uint8_t*             puDmaArea;
+    uint32_t             uDmaBuffL;
+    uint32_t             uDmaBuffN;
+    volatile uint32_t    uDmaDoneCnt;
+    volatile uint32_t    uDmaPartL;
+    volatile bool_t      bDmaOvr;
+    uint32_t             uDmaConsCnt;
+    uint32_t             uDmaConsOff;
+    uint32_t             uCredWinFrames;
+    uint32_t             uCredWinBytes;
+    uint32_t             uRelFrames;
+    uint32_t             uRelBytes;
 }t_eFSP_MSGRX_Ctx;
 
 typedef struct
@@ -132,7 +181,8 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_IsInit(t_eFSP_MSGRX_Ctx* const p_ptCtx, bool_t* p_pb
  * @brief       Start receiving a new message, loosing the previous stored decoded msg frame, but not the data in rx
  *              buffer, retrived toghether with the current discharged frame. If bINeedWaitFrameStart is true the
  *              timeout will start counting after the first byte of the frame is received, otherwise it will start
- *              couting just after this function is called.
+ *              couting just after this function is called. A fully received frame that is discharged give
+ *              back its credit to the transmitter, see eFSP_MSGRX_GetCreditLimit.
  *
  * @param[in]   p_ptCtx         - Msg receiver context
  *
@@ -147,7 +197,8 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_NewMsg(t_eFSP_MSGRX_Ctx* const p_ptCtx);
 /**
  * @brief       Start receiving a new message, loosing the previous stored decoded msg frame, and cleaning rx buffer.
  *              If bINeedWaitFrameStart is true the timeout will start counting after the first byte of the frame
- *              is received, otherwise it will start couting just after this function is called.
+ *              is received, otherwise it will start couting just after this function is called. A fully
+ *              received frame that is discharged give back its credit to the transmitter.
  *
  * @param[in]   p_ptCtx         - Msg receiver context
  *
@@ -226,6 +277,399 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_GetDecodedData(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint
  */
 e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx);
 
+/**
+ * @brief       Set the optional event callback that will be called when the current message is received, when a bad
+ *              frame is found or when the message timeout is elapsed. The callback is called from
+ *              eFSP_MSGRX_ReceiveChunk, eFSP_MSGRX_NotifyRecv and eFSP_MSGRX_CheckTimeout. Pass NULL as p_fEvt and
+ *              p_ptEvtCtx in order to disable the notification.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_fEvt          - Pointer to the event callback function, or NULL
+ * @param[in]   p_ptEvtCtx      - Custom context passed to the event callback function, or NULL
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB    	- Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetEvtCb(t_eFSP_MSGRX_Ctx* const p_ptCtx, f_eFSP_MSGRX_EvtCb p_fEvt,
+                                     t_eFSP_MSGRX_EvtCtx* const p_ptEvtCtx);
+
+/**
+ * @brief       Event driven alternative to eFSP_MSGRX_ReceiveChunk. Retrive the location of the free part of the
+ *              internal RX buffer where the driver (ISR, DMA, RTOS task) can write the received data. This function
+ *              dosent call the f_eFSP_MSGRX_RxCb callback, the driver must call eFSP_MSGRX_NotifyRecv when some data
+ *              is written. If the RX buffer contains only data not parsed yet p_puMaxDataL could be zero, in this case
+ *              call eFSP_MSGRX_NotifyRecv with zero received data in order to parse it.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the location of the free RX buffer will be placed
+ * @param[out]  p_puMaxDataL    - Pointer to a uint32_t variable where the size of the free RX buffer will be placed
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_GetWhereRxData(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                           uint32_t* const p_puMaxDataL);
+
+/**
+ * @brief       Notify the receiver that the driver has written p_uRecvL bytes in the location retrived with
+ *              eFSP_MSGRX_GetWhereRxData. All the data present in the RX buffer is decoded immediately, and when the
+ *              message reach a final state the event callback is called, if configured. A frame restart is handled
+ *              internally and the decoding continue with the remaining data.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_uRecvL        - Number of bytes written by the driver, can be zero
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	  - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM     	  - p_uRecvL is greater than the free space of the RX buffer
+ *		        e_eFSP_MSGRX_RES_NOINITLIB    	  - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	  - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OUTOFMEM     	  - Can not decode data, initial mem pointer was too small
+ *		        e_eFSP_MSGRX_RES_MESSAGERECEIVED  - Frame ended, restart context in order to parse a new frame
+ *              e_eFSP_MSGRX_RES_MESSAGETIMEOUT   - The message is not received before "uITimeoutMs"
+ *              e_eFSP_MSGRX_RES_BADFRAME         - Found an error while parsing, the frame passed is invalid
+ *		        e_eFSP_MSGRX_RES_CRCCLBKERROR     - The crc callback returned an error when the decoder where verifing CRC
+ *              e_eFSP_MSGRX_RES_TIMCLBKERROR     - The timer function returned an error
+ *              e_eFSP_MSGRX_RES_OK           	  - Operation ended correctly, the frame is not finished yet
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_NotifyRecv(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uRecvL);
+
+/**
+ * @brief       Check the frame timeout without receiving any data. Useful when the reception is event driven and
+ *              the driver is not notifying any received data. The event callback is called if the timeout is elapsed.
+ *              If bINeedWaitFrameStart is true and the start of frame is not received yet the timer is restarted.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	  - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB    	  - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	  - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_MESSAGETIMEOUT   - The message is not received before "uITimeoutMs"
+ *              e_eFSP_MSGRX_RES_TIMCLBKERROR     - The timer function returned an error
+ *              e_eFSP_MSGRX_RES_OK           	  - Timeout is not elapsed
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_CheckTimeout(t_eFSP_MSGRX_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Set an optional lock free ring buffer as RX source. When a ring is configured eFSP_MSGRX_ReceiveChunk
+ *              dosent call the f_eFSP_MSGRX_RxCb callback anymore, but decode in place the contiguous data published
+ *              in the ring by the producer (UART ISR, DMA), that can keep writing while the decoder is working.
+ *              Data already present in the internal RX buffer is decoded before the ring one. Pass NULL in order to
+ *              use the f_eFSP_MSGRX_RxCb callback again.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_ptRing        - Pointer to an initialized ring buffer context, or NULL
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM     	- The ring buffer passed is not initialized or a DMA source is
+ *                                                already configured
+ *		        e_eFSP_MSGRX_RES_NOINITLIB    	- Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetRingSrc(t_eFSP_MSGRX_Ctx* const p_ptCtx, t_eFSP_SPSCR_Ctx* const p_ptRing);
+
+/**
+ * @brief       Push mode receive. Decode the encoded data pushed by the caller (UART ISR, DMA half/full transfer
+ *              event, epoll readiness handler) directly from the caller memory, without any copy in the internal RX
+ *              buffer and without calling the f_eFSP_MSGRX_RxCb callback. The elaboration stops as soon as a message
+ *              is received or a bad frame is found, and p_puUsedL report how many bytes were consumed. The remaining
+ *              data can be pushed again after eFSP_MSGRX_NewMsg. A frame restart is handled internally.
+ *              The event callback is called, if configured.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_puData        - Pointer to the encoded data pushed by the caller
+ * @param[in]   p_uDataL        - Size of the encoded data pushed by the caller
+ * @param[out]  p_puUsedL       - Pointer to a uint32_t variable where the number of consumed bytes will be placed
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	  - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM     	  - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB    	  - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	  - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OUTOFMEM     	  - Can not decode data, initial mem pointer was too small
+ *		        e_eFSP_MSGRX_RES_MESSAGERECEIVED  - Frame ended, restart context in order to parse a new frame
+ *              e_eFSP_MSGRX_RES_MESSAGETIMEOUT   - The message is not received before "uITimeoutMs"
+ *              e_eFSP_MSGRX_RES_BADFRAME         - Found an error while parsing, the frame passed is invalid
+ *		        e_eFSP_MSGRX_RES_CRCCLBKERROR     - The crc callback returned an error when the decoder where verifing CRC
+ *              e_eFSP_MSGRX_RES_TIMCLBKERROR     - The timer function returned an error
+ *              e_eFSP_MSGRX_RES_OK           	  - Operation ended correctly, all the data is consumed but the frame is
+ *                                                  not finished yet
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_InsChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                     const uint32_t p_uDataL, uint32_t* const p_puUsedL);
+
+/**
+ * @brief       Set an optional group of DMA receive buffers as RX source. p_puArea is made of p_uBuffN buffers of
+ *              p_uBuffL bytes placed one after the other, that the DMA fill in order, e.g. a circular DMA with half and
+ *              full transfer interrupt is a group of two buffers. The DMA must be armed on the first buffer. When the
+ *              DMA source is configured eFSP_MSGRX_ReceiveChunk dosent call the f_eFSP_MSGRX_RxCb callback anymore,
+ *              but decode in place the buffers already filled while the DMA keep writing the next one.
+ *              Data already present in the internal RX buffer is decoded before the DMA one. Pass NULL in order to
+ *              use the f_eFSP_MSGRX_RxCb callback again. Can not be used together with a ring source.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_puArea        - Pointer to the DMA memory area of p_uBuffN * p_uBuffL bytes, or NULL
+ * @param[in]   p_uBuffL        - Size of a single DMA buffer
+ * @param[in]   p_uBuffN        - Number of DMA buffers, at least two
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM     	- In case of an invalid parameter passed to the function or if a ring
+ *                                                source is already configured
+ *		        e_eFSP_MSGRX_RES_NOINITLIB    	- Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetDmaSrc(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t* p_puArea, const uint32_t p_uBuffL,
+                                     const uint32_t p_uBuffN);
+
+/**
+ * @brief       Must be called from the half transfer and full transfer interrupt, every time the DMA has completely
+ *              filled a buffer. The buffer is then visible to eFSP_MSGRX_ReceiveChunk. If the DMA has started to write
+ *              a buffer that the decoder has not consumed yet the function return e_eFSP_MSGRX_RES_OUTOFMEM: the
+ *              pending data is discarded by the decoder and the current frame will be reported as bad or timed out,
+ *              more or bigger buffers are needed.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[out]  p_ppuNextBuff   - Pointer to a Pointer where the buffer that the DMA is filling now will be placed,
+ *                                useful in order to re-arm a non circular DMA
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM     	- The DMA source is not configured
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OUTOFMEM     	- The decoder was too slow, the DMA is overwriting pending data
+ *              e_eFSP_MSGRX_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_DmaBuffDone(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t** p_ppuNextBuff);
+
+/**
+ * @brief       Optional, can be called from the UART idle line interrupt in order to let the decoder elaborate the
+ *              part of the buffer already written by the DMA, without waiting the buffer to be full.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_uWrittenL     - Number of bytes written by the DMA in the buffer that is filling now
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER   	- In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM     	- The DMA source is not configured or p_uWrittenL is too big
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX   	- In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK           	- Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_DmaBuffPart(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uWrittenL);
+
+/**
+ * @brief       Use a monotonic clock in place of the fTimStart and fTimGetRemain timer call backs. The frame timeout
+ *              is kept as an absolute deadline in the context, so the time is sampled with a single call and compared
+ *              inline, and every restart of the timer is just a sum. An ongoing timeout is moved from the timer to the
+ *              clock and vice versa. Pass NULL in order to use the timer call backs again.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_fNow          - Pointer to the clock function, or NULL. Will be called with the timer context
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_TIMCLBKERROR   - The timer or the clock function returned an error
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetClock(t_eFSP_MSGRX_Ctx* const p_ptCtx, f_eFSP_MSGRX_TimGetNow p_fNow);
+
+/**
+ * @brief       Register the frame timeout in a timer wheel shared with many other contexts, in place of the timer
+ *              call backs or of the clock. Starting and stopping the timeout is O(1), and the wheel is moved with a
+ *              single eFSP_TIMW_Advance for all the contexts. When the timeout of this context fire
+ *              eFSP_TIMW_PopFired return p_uId, and the poller must call eFSP_MSGRX_CheckTimeout only for this context.
+ *              The timeout is removed from the wheel as soon as the message reach a final state. The resolution of the
+ *              timeout is the one of the eFSP_TIMW_Advance calls, and the tick of the wheel must be in ms. An ongoing
+ *              timeout is moved to the new time source. Pass NULL in order to use the previous time source again.
+ *              The wheel does not move during a call, so eFSP_MSGRX_ReceiveChunk return when nothing is received.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_ptTimW        - Pointer to an initialized timer wheel context, or NULL
+ * @param[in]   p_uId           - Identifier of this context returned by eFSP_TIMW_PopFired
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - The timer wheel passed is not initialized
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_TIMCLBKERROR   - The previous or the new time source returned an error
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetTimerWheel(t_eFSP_MSGRX_Ctx* const p_ptCtx, t_eFSP_TIMW_Ctx* const p_ptTimW,
+                                           const uint32_t p_uId);
+
+/**
+ * @brief       Compute the timeout of every frame from its length and from the line rate, so a lost small frame is
+ *              detected without waiting the timeout of the largest message. On the receiver side the line time is
+ *              computed as soon as the header of the frame is in, from the declared length and with the worst case
+ *              overhead of the framing engine, and the frame timeout is shortened accordingly.
+ *              The frame timeout is the line time plus p_uMarginMs, and it's never longer than the timeout passed
+ *              during initialization. The new values are used starting from the next frame.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_uLineRate     - Bytes per second of the line (e.g. baud / 10 for an 8N1 UART), zero in order to use
+ *                                the constant timeout passed during initialization
+ * @param[in]   p_uMarginMs     - Time added to the line time, must cover latency and jitter of the link
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - The line rate is too high to be used in the calculation
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetLineRate(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uLineRate,
+                                         const uint32_t p_uMarginMs);
+
+/**
+ * @brief       Change the frame timeout passed during initialization, e.g. with the value computed by eFSP_RTTE for the
+ *              link. The running timer is not changed, the new value is used when the timer is started again. When a
+ *              line rate is set the value is still the upper bound of the computed frame timeout.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_uTimeoutMs    - New frame timeout, can not be lower than the time per receive
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - The timeout is zero or lower than the time per receive
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetTimeout(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uTimeoutMs);
+
+/**
+ * @brief       Set how many frames and payload bytes the application can hold before discharging them with
+ *              eFSP_MSGRX_NewMsg or eFSP_MSGRX_NewMsgNClean. The default is one frame and EFSP_MSGRX_MAXCREDIT bytes,
+ *              so the transmitter never start a frame before the previous one is discharged. A smaller window is
+ *              seen by the transmitter only when the credit already granted is used.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[in]   p_uFrames       - Number of frames that can be received and not yet discharged
+ * @param[in]   p_uBytes        - Number of payload bytes that can be received and not yet discharged
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - A window is bigger than EFSP_MSGRX_MAXCREDIT
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetCreditWindow(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uFrames,
+                                            const uint32_t p_uBytes);
+
+/**
+ * @brief       Retrive the credit limits that must be advertised to the transmitter of the peer, that pass them to
+ *              eFSP_MSGTX_SetCreditLimit. The limits are the total number of frames and of payload bytes that can be
+ *              received since the initialization, i.e. the discharged ones plus the window, and wrap around. The
+ *              limits are never sent on the link by this library, the application must carry them to the peer in
+ *              its own messages: a lost limit only delay the transmitter until a newer one arrive. A frame the
+ *              transmitter abandon without a complete reception is never given back, so use this flow control on a
+ *              reliable link or with retransmission.
+ *
+ * @param[in]   p_ptCtx         - Msg receiver context
+ * @param[out]  p_puFrameLim    - Pointer to a uint32_t variable where the frame limit will be placed
+ * @param[out]  p_puByteLim     - Pointer to a uint32_t variable where the payload byte limit will be placed
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_GetCreditLimit(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint32_t* const p_puFrameLim,
+                                           uint32_t* const p_puByteLim);
+
+/**
+ * @brief       Select the header profile of the received messages, see eFSP_MSGD_SetHeader. Call this function
+ *              before starting a new message. The transmitter must use the same profile.
+ *
+ * @param[in]   p_ptCtx         - Message Receiver context
+ * @param[in]   p_uCrcL         - EFSP_HDR_CRCNONE, EFSP_HDR_CRC16 or EFSP_HDR_CRC32
+ * @param[in]   p_uLenL         - EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32 or EFSP_HDR_LENVAR
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetHeader(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL);
+
+/**
+ * @brief       Select the framing engine of the received messages, see eFSP_MSGD_SetFraming. Call this function
+ *              before starting a new message. The transmitter must use the same engine.
+ *
+ * @param[in]   p_ptCtx         - Message Receiver context
+ * @param[in]   p_uFrm          - EFSP_FRM_ESC, EFSP_FRM_COBS or EFSP_FRM_TRSP
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetFraming(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uFrm);
+
+/**
+ * @brief       Select the whitening of the received messages, see eFSP_MSGD_SetWhitening. Call this function
+ *              before starting a new message. The transmitter must use the same setting.
+ *
+ * @param[in]   p_ptCtx         - Message Receiver context
+ * @param[in]   p_uWhtL         - EFSP_HDR_WHTNONE or EFSP_HDR_WHT
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetWhitening(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uWhtL);
+
+/**
+ * @brief       Select the compression of the received messages, see eFSP_MSGD_SetCompression. Call this function
+ *              before starting a new message. The transmitter must use the same setting.
+ *
+ * @param[in]   p_ptCtx         - Message Receiver context
+ * @param[in]   p_uCmpL         - EFSP_HDR_CMPNONE or EFSP_HDR_CMP
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetCompression(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uCmpL);
+
+/**
+ * @brief       Enable the delta frames of the received messages, see eFSP_MSGD_SetDelta. A difference from a key frame
+ *              that was not received is reported as a bad frame. Call this function before starting a new message.
+ *              The transmitter must enable them too.
+ *
+ * @param[in]   p_ptCtx         - Message Receiver context
+ * @param[in]   p_puBase        - Pointer to a memory area where the last key frame will be kept
+ * @param[in]   p_uBaseL        - Dimension in byte of p_puBase
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetDelta(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL);
+
+/**
+ * @brief       Select the forward error correction of the received messages, see eFSP_MSGD_SetFec. A frame with too
+ *              many errors is reported as a bad frame. Call this function before starting a new message. The
+ *              transmitter must use the same setting.
+ *
+ * @param[in]   p_ptCtx         - Message Receiver context
+ * @param[in]   p_uFecL         - EFSP_FEC_NONE, EFSP_FEC_RS4, EFSP_FEC_RS8 or EFSP_FEC_RS16
+ *
+ * @return      e_eFSP_MSGRX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGRX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGRX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGRX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGRX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetFec(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uFecL);
+
 
 
 #ifdef __cplusplus
@@ -38,6 +38,8 @@ typedef enum
     e_eFSP_MSGRXPRV_SM_INSERTCHUNK,
     e_eFSP_MSGRXPRV_SM_CHECKTIMEOUTAFTERRX,
     e_eFSP_MSGRXPRV_SM_RECEIVEBUFF,
+    e_eFSP_MSGRXPRV_SM_RECEIVERING,
+    e_eFSP_MSGRXPRV_SM_RECEIVEDMA,
     e_eFSP_MSGRXPRV_SM_ELABDONE
 }e_eFSP_MSGRXPRV_SM;
 
@@ -23,6 +23,17 @@ extern "C" {
  **********************************************************************************************************************/
 #include "eFSP_TYPE.h"
 #include "eFSP_MSGE.h"
+#include "eFSP_FOUT.h"
+#include "eFSP_SPSCR.h"
+#include "eFSP_TIMW.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Biggest credit that can be outstanding, so the limits granted by the receiver can be compared across a wrap around */
+#define EFSP_MSGTX_MAXCREDIT                                            ( 0x7FFFFFFFu )
 
 
 
@@ -45,6 +56,10 @@ typedef bool_t (*f_eFSP_MSGTX_TxCb) ( t_eFSP_MSGTX_TxCtx* const p_ptCtx, const u
 typedef bool_t (*f_eFSP_MSGTX_TimStart) ( t_eFSP_MSGTX_TimCtx* const p_ptCtx, const uint32_t p_uTimeout );
 typedef bool_t (*f_eFSP_MSGTX_TimGetRemaing) ( t_eFSP_MSGTX_TimCtx* const p_ptCtx, uint32_t* const p_puRemain );
 
+/* Optional call back to a monotonic clock, that return the current time in ms and can wrap around. When used in place
+ * of the timer call backs the timeout is stored as an absolute deadline and compared inline */
+typedef bool_t (*f_eFSP_MSGTX_TimGetNow) ( t_eFSP_MSGTX_TimCtx* const p_ptCtx, uint32_t* const p_puNowMs );
+
 typedef struct
 {
     t_eFSP_MSGTX_TimCtx*                       ptTimCtx;
@@ -64,9 +79,20 @@ typedef enum
     e_eFSP_MSGTX_RES_NOINITMESSAGE,
 	e_eFSP_MSGTX_RES_CRCCLBKERROR,
     e_eFSP_MSGTX_RES_TXCLBKERROR,
-    e_eFSP_MSGTX_RES_TIMCLBKERROR
+    e_eFSP_MSGTX_RES_TIMCLBKERROR,
+    e_eFSP_MSGTX_RES_NOCREDIT
 }e_eFSP_MSGTX_RES;
 
+/* Define a generic event func callback context that must be implemented by the user */
+typedef struct t_eFSP_MSGTX_EvtCtxUser t_eFSP_MSGTX_EvtCtx;
+
+/* Call back to a function that will be notified when the current message reach a final state, that can be
+ * e_eFSP_MSGTX_RES_MESSAGESENDED or e_eFSP_MSGTX_RES_MESSAGETIMEOUT. The callback is called only once for every
+ * message started with eFSP_MSGTX_NewMessage, eFSP_MSGTX_NewShared or eFSP_MSGTX_RestartMessage.
+ * the p_ptCtx parameter is a custom pointer that can be used by the creator of this EVT callback, and will not be used
+ * by the MSG TRANSMITTER module */
+typedef void (*f_eFSP_MSGTX_EvtCb) ( t_eFSP_MSGTX_EvtCtx* const p_ptCtx, const e_eFSP_MSGTX_RES p_eEvt );
+
 typedef struct
 {
     t_eFSP_MSGE_Ctx      tMsgeCtx;
@@ -79,6 +105,34 @@ typedef struct
     t_eFSP_MSGTX_Timer   tTxTim;
     uint32_t             uTimeoutMs;
     uint32_t             uTimePerSendMs;
+    f_eFSP_MSGTX_EvtCb   fEvt;
+    t_eFSP_MSGTX_EvtCtx* ptEvtCtx;
+    bool_t               bEvtPend;
+    t_eFSP_SPSCR_Ctx*    ptRing;
+    f_eFSP_MSGTX_TimGetNow fTimNow;
+    uint32_t             uNowMs;
+    uint32_t             uDeadlineMs;
+    uint32_t             uArmedMs;
+    t_eFSP_TIMW_Ctx*     ptTimW;
+    t_eFSP_TIMW_Node     tTimNode;
+    uint32_t             uLineRate;
+    uint32_t             uLineMarginMs;
+    bool_t               bCreditOn;
+    uint32_t             uCredFrameLim;
+    uint32_t             uCredByteLim;
+    uint32_t             uSentFrames;
+    uint32_t             uSentBytes;
+    uint32_t             uPaceRate;
+    uint32_t             uPaceBurst;
+    uint32_t             uPaceTokens;
+    uint32_t             uPaceFrac;
+    uint32_t             uPaceLastMs;
+    t_eFSP_FOUT_Ctx*     ptFout;
+    const uint8_t*       puShFrame;
+    uint32_t             uShFrameL;
+    uint32_t             uShCntr;
+    uint32_t             uShGen;
+    bool_t               bShHeld;
 }t_eFSP_MSGTX_Ctx;
 
 typedef struct
@@ -152,20 +206,51 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_GetWherePutData(t_eFSP_MSGTX_Ctx* const p_ptCtx, uin
  *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
  *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
  *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_MSGTX_RES_NOINITMESSAGE  - The payload was compressed by a message that failed on the CRC, it
+ *                                                must be copied again after calling eFSP_MSGTX_GetWherePutData
  *				e_eFSP_MSGTX_RES_CRCCLBKERROR   - The crc callback function returned an error
  *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The timer function returned an error
+ *              e_eFSP_MSGTX_RES_NOCREDIT       - Credit flow control is enabled and the receiver has not granted
+ *                                                a frame or p_uMsgL bytes, nothing is started, retry later
  *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
  */
 e_eFSP_MSGTX_RES eFSP_MSGTX_NewMessage(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uMsgL);
 
 /**
- * @brief       Restart to encode and send the already passed payload/the current frame
+ * @brief       Start to send a frame already encoded by a fan-out context, in place of a message encoded by this
+ *              transmitter. No CRC or byte stuffing is done here: a reference to the shared frame is taken and the
+ *              frame is drained with a cursor of this context by eFSP_MSGTX_SendChunk, eFSP_MSGTX_GetChunkToSend or
+ *              the ring destination, with the timers, the credit and the pacing of this link. The reference is
+ *              released when the frame is sended, when its timeout is elapsed or when another message is started, so
+ *              eFSP_FOUT_NewMessage can encode the next frame only after every link reached one of these states.
+ *              eFSP_MSGTX_RestartMessage take the reference again only if the fan-out still have the same frame.
+ *
+ * @param[in]   p_ptCtx    - Message Transmitter context
+ * @param[in]   p_ptFout   - Fan-out context that contains the encoded frame
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The fan-out context is not initialized or is corrupted
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGTX_RES_NOINITMESSAGE  - The fan-out context has no encoded frame
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The timer function returned an error
+ *              e_eFSP_MSGTX_RES_NOCREDIT       - Credit flow control is enabled and the receiver has not granted
+ *                                                a frame or the payload bytes, nothing is started, retry later
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_NewShared(t_eFSP_MSGTX_Ctx* const p_ptCtx, t_eFSP_FOUT_Ctx* const p_ptFout);
+
+/**
+ * @brief       Restart to encode and send the already passed payload/the current frame. The frame is already
+ *              counted in the credit, so a restart is never stopped by the credit flow control. A frame started
+ *              with eFSP_MSGTX_NewShared is sent again from the start of the shared frame.
  *
  * @param[in]   p_ptCtx         - Message Transmitter context
  *
  * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
  *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
- *		        e_eFSP_MSGTX_RES_NOINITMESSAGE  - Need to start a message before restarting it
+ *		        e_eFSP_MSGTX_RES_NOINITMESSAGE  - Need to start a message before restarting it, or the shared
+ *                                                frame was replaced in the fan-out context
  *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
  *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The timer function returned an error
  *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
@@ -179,6 +264,7 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_RestartMessage(t_eFSP_MSGTX_Ctx* const p_ptCtx);
  *              try to send all the data that can be send in "uITimePerSendMs". The whole frame instead can be sended
  *              in "uITimeoutMs" milliseconds. This function can return different status, but if we keep call
  *              this function even after uITimeoutMs it will start returning only e_eFSP_MSGTX_RES_MESSAGETIMEOUT.
+ *              When the pacing is enabled the data sent is also limited by the tokens of the bucket.
  *
  * @param[in]   p_ptCtx         - Message Transmitter context
  *
@@ -200,6 +286,348 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_RestartMessage(t_eFSP_MSGTX_Ctx* const p_ptCtx);
  */
 e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx);
 
+/**
+ * @brief       Set the optional event callback that will be called when the current message is sended or when the
+ *              message timeout is elapsed. The callback is called from eFSP_MSGTX_SendChunk, eFSP_MSGTX_NotifySent and
+ *              eFSP_MSGTX_CheckTimeout. Pass NULL as p_fEvt and p_ptEvtCtx in order to disable the notification.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_fEvt          - Pointer to the event callback function, or NULL
+ * @param[in]   p_ptEvtCtx      - Custom context passed to the event callback function, or NULL
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetEvtCb(t_eFSP_MSGTX_Ctx* const p_ptCtx, f_eFSP_MSGTX_EvtCb p_fEvt,
+                                     t_eFSP_MSGTX_EvtCtx* const p_ptEvtCtx);
+
+/**
+ * @brief       Event driven alternative to eFSP_MSGTX_SendChunk. Retrive the pointer and the size of the encoded data
+ *              that the driver must write on the line. The data is taken from the internal TX buffer, and the TX
+ *              buffer is filled again with the encoder output only when all the previous data was notified as sended.
+ *              This function dosent call the f_eFSP_MSGTX_TxCb callback, the driver (ISR, DMA, RTOS task) must call
+ *              eFSP_MSGTX_NotifySent when the data is written.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the location of the data to send will be placed
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the number of data to send will be placed
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGTX_RES_NOINITMESSAGE  - Need to start a message before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_MESSAGESENDED  - No more data to send, p_puDataL is reported as zero
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly, p_puDataL is greater than zero
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_GetChunkToSend(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint8_t** p_ppuData,
+                                           uint32_t* const p_puDataL);
+
+/**
+ * @brief       Notify the transmitter that the driver has written p_uSentL bytes of the data retrived with
+ *              eFSP_MSGTX_GetChunkToSend. When the whole message is sended or when the frame timeout is elapsed the
+ *              event callback is called, if configured.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uSentL        - Number of bytes written by the driver
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - p_uSentL is greater than the data retrived with GetChunkToSend
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGTX_RES_NOINITMESSAGE  - Need to start a message before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_MESSAGESENDED  - The whole message is sended
+ *              e_eFSP_MSGTX_RES_MESSAGETIMEOUT - The message is not sended before "uITimeoutMs". Restart to continue.
+ *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The timer function returned an error
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly, message is not fully sended.
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_NotifySent(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uSentL);
+
+/**
+ * @brief       Check the frame timeout without sending any data. Useful when the transmission is event driven and
+ *              the driver is not notifying any written data. The event callback is called if the timeout is elapsed.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_MESSAGETIMEOUT - The message is not sended before "uITimeoutMs". Restart to continue.
+ *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The timer function returned an error
+ *              e_eFSP_MSGTX_RES_OK             - Timeout is not elapsed
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_CheckTimeout(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Set an optional lock free ring buffer as TX destination. When a ring is configured
+ *              eFSP_MSGTX_SendChunk dosent call the f_eFSP_MSGTX_TxCb callback anymore, but encode the message directly
+ *              in the free area of the ring, that is drained by the consumer (UART TX empty ISR, DMA). Every call of
+ *              eFSP_MSGTX_SendChunk top up the ring and return immediately when the ring is full, without waiting the
+ *              line. e_eFSP_MSGTX_RES_MESSAGESENDED is returned when the whole frame is inserted in the ring, the
+ *              consumer could still be sending the last part of it. Pass NULL in order to use the f_eFSP_MSGTX_TxCb
+ *              callback again.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_ptRing        - Pointer to an initialized ring buffer context, or NULL
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The ring buffer passed is not initialized
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init the data encoder context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetRingDst(t_eFSP_MSGTX_Ctx* const p_ptCtx, t_eFSP_SPSCR_Ctx* const p_ptRing);
+
+/**
+ * @brief       Use a monotonic clock in place of the fTimStart and fTimGetRemain timer call backs. The frame timeout
+ *              is kept as an absolute deadline in the context, so the time is sampled with a single call and compared
+ *              inline, and every restart of the timer is just a sum. An ongoing timeout is moved from the timer to the
+ *              clock and vice versa. Pass NULL in order to use the timer call backs again, this also disable the
+ *              pacing set with eFSP_MSGTX_SetPacing.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_fNow          - Pointer to the clock function, or NULL. Will be called with the timer context
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The timer or the clock function returned an error
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetClock(t_eFSP_MSGTX_Ctx* const p_ptCtx, f_eFSP_MSGTX_TimGetNow p_fNow);
+
+/**
+ * @brief       Register the frame timeout in a timer wheel shared with many other contexts, in place of the timer
+ *              call backs or of the clock. Starting and stopping the timeout is O(1), and the wheel is moved with a
+ *              single eFSP_TIMW_Advance for all the contexts. When the timeout of this context fire
+ *              eFSP_TIMW_PopFired return p_uId, and the poller must call eFSP_MSGTX_CheckTimeout only for this context.
+ *              The timeout is removed from the wheel as soon as the message reach a final state. The resolution of the
+ *              timeout is the one of the eFSP_TIMW_Advance calls, and the tick of the wheel must be in ms. An ongoing
+ *              timeout is moved to the new time source. Pass NULL in order to use the previous time source again.
+ *              The wheel does not move during a call, so eFSP_MSGTX_SendChunk return when nothing is sent.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_ptTimW        - Pointer to an initialized timer wheel context, or NULL
+ * @param[in]   p_uId           - Identifier of this context returned by eFSP_TIMW_PopFired
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The timer wheel passed is not initialized
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The previous or the new time source returned an error
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetTimerWheel(t_eFSP_MSGTX_Ctx* const p_ptCtx, t_eFSP_TIMW_Ctx* const p_ptTimW,
+                                           const uint32_t p_uId);
+
+/**
+ * @brief       Compute the timeout of every frame from its length and from the line rate, so a lost small frame is
+ *              detected without waiting the timeout of the largest message. On the transmitter side the line time
+ *              is computed from the length of the encoded frame when the message is started or restarted.
+ *              The frame timeout is the line time plus p_uMarginMs, and it's never longer than the timeout passed
+ *              during initialization. The new values are used starting from the next frame.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uLineRate     - Bytes per second of the line (e.g. baud / 10 for an 8N1 UART), zero in order to use
+ *                                the constant timeout passed during initialization
+ * @param[in]   p_uMarginMs     - Time added to the line time, must cover latency and jitter of the link
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The line rate is too high to be used in the calculation
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetLineRate(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uLineRate,
+                                         const uint32_t p_uMarginMs);
+
+/**
+ * @brief       Change the frame timeout passed during initialization, e.g. with the value computed by eFSP_RTTE for the
+ *              link. The running timer is not changed, the new value is used when the timer is started again. When a
+ *              line rate is set the value is still the upper bound of the computed frame timeout.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uTimeoutMs    - New frame timeout, can not be lower than the time per send
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The timeout is zero or lower than the time per send
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetTimeout(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uTimeoutMs);
+
+/**
+ * @brief       Enable the credit flow control, or update the credit, with the limits granted by the receiver (see
+ *              eFSP_MSGRX_GetCreditLimit). The limits are the total number of frames and of payload bytes the receiver
+ *              can accept since its initialization, and can wrap around. A limit older than the current one is
+ *              ignored, so grants can be lost, duplicated or reordered by the upper layer that carry them. From now on
+ *              eFSP_MSGTX_NewMessage and eFSP_MSGTX_NewShared start a message only when both the limits are not
+ *              reached. The limits are never sent on the link by this library: the application must carry them
+ *              from the receiver of the peer, for example inside its own messages, and pass them here.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uFrameLim     - Total number of frames granted by the receiver
+ * @param[in]   p_uByteLim      - Total number of payload bytes granted by the receiver
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The limits grant more than EFSP_MSGTX_MAXCREDIT or are behind what
+ *                                                is already sent
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetCreditLimit(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uFrameLim,
+                                           const uint32_t p_uByteLim);
+
+/**
+ * @brief       Retrive the credit still available, in frames and in payload bytes. When the credit flow control is
+ *              not enabled both the values are EFSP_MSGTX_MAXCREDIT.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[out]  p_puFrames      - Pointer to a uint32_t variable where the number of frames that can be started will
+ *                                be placed
+ * @param[out]  p_puBytes       - Pointer to a uint32_t variable where the number of payload bytes that can be sent
+ *                                will be placed
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_GetCredit(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint32_t* const p_puFrames,
+                                      uint32_t* const p_puBytes);
+
+/**
+ * @brief       Pace the data passed to the send call back with a token bucket, for peers that lose bytes when the
+ *              line is used at full rate. The bucket is filled with p_uRate tokens per second up to p_uBurst, and
+ *              every byte sent use a token: eFSP_MSGTX_SendChunk send only the bytes it has tokens for and return
+ *              e_eFSP_MSGTX_RES_OK when the bucket is empty. The bucket start full. The clock set with
+ *              eFSP_MSGTX_SetClock is needed. A ring destination is not paced, its consumer already run at the
+ *              line rate. Remember to size the frame timeout, e.g. with eFSP_MSGTX_SetLineRate, for the paced rate.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uRate         - Bytes per second, zero in order to disable the pacing
+ * @param[in]   p_uBurst        - Bytes that can be sent back to back, at least one
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - The rate is too high to be used in the calculation, the burst is
+ *                                                zero or the clock is not set
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_TIMCLBKERROR   - The clock function returned an error
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetPacing(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uRate,
+                                      const uint32_t p_uBurst);
+
+/**
+ * @brief       Select the header profile of the next messages, see eFSP_MSGE_SetHeader. Call this function before
+ *              retriving where to put the payload of the next message. The receiver must use the same profile.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uCrcL         - EFSP_HDR_CRCNONE, EFSP_HDR_CRC16 or EFSP_HDR_CRC32
+ * @param[in]   p_uLenL         - EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32 or EFSP_HDR_LENVAR
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetHeader(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL);
+
+/**
+ * @brief       Select the framing engine of the next messages, see eFSP_MSGE_SetFraming. Call this function before
+ *              retriving where to put the payload of the next message. The receiver must use the same engine.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uFrm          - EFSP_FRM_ESC, EFSP_FRM_COBS or EFSP_FRM_TRSP
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetFraming(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uFrm);
+
+/**
+ * @brief       Select the whitening of the next messages, see eFSP_MSGE_SetWhitening. Call this function before
+ *              retriving where to put the payload of the next message. The receiver must use the same setting.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uWhtL         - EFSP_HDR_WHTNONE or EFSP_HDR_WHT
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetWhitening(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uWhtL);
+
+/**
+ * @brief       Select the compression of the next messages, see eFSP_MSGE_SetCompression. Call this function before
+ *              retriving where to put the payload of the next message. The receiver must use the same setting.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uCmpL         - EFSP_HDR_CMPNONE or EFSP_HDR_CMP
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetCompression(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uCmpL);
+
+/**
+ * @brief       Enable the delta frames for the next messages, see eFSP_MSGE_SetDelta. Call this function before
+ *              retriving where to put the payload of the next message. The receiver must enable them too.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_puBase        - Pointer to a memory area where the last key frame will be kept
+ * @param[in]   p_uBaseL        - Dimension in byte of p_puBase
+ * @param[in]   p_uKeyN         - Maximum number of differences sent after a key frame
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetDelta(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL,
+                                     const uint32_t p_uKeyN);
+
+/**
+ * @brief       Send the next message as a key frame, see eFSP_MSGE_ResetDelta
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_ResetDelta(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Select the forward error correction of the next messages, see eFSP_MSGE_SetFec. Call this function
+ *              before retriving where to put the payload of the next message. The receiver must use the same setting.
+ *
+ * @param[in]   p_ptCtx         - Message Transmitter context
+ * @param[in]   p_uFecL         - EFSP_FEC_NONE, EFSP_FEC_RS4, EFSP_FEC_RS8 or EFSP_FEC_RS16
+ *
+ * @return      e_eFSP_MSGTX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MSGTX_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *		        e_eFSP_MSGTX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MSGTX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MSGTX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetFec(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uFecL);
+
 
 
 #ifdef __cplusplus
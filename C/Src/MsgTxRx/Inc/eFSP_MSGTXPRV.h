@@ -37,6 +37,7 @@ typedef enum
     e_eFSP_MSGTXPRV_SM_RETRIVECHUNK,
     e_eFSP_MSGTXPRV_SM_SENDBUFF,
     e_eFSP_MSGTXPRV_SM_CHECKTIMEOUTAFTERTX,
+    e_eFSP_MSGTXPRV_SM_FILLRING,
     e_eFSP_MSGTXPRV_SM_ELABDONE
 }e_eFSP_MSGTXPRV_SM;
 
@@ -0,0 +1,535 @@
+/**
+ * @file       eFSP_FOUT.c
+ *
+ * @brief      Encode once fan-out of a message to many message transmitters
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_FOUT.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_FOUT_IsStatusStillCoherent(const t_eFSP_FOUT_Ctx* p_ptCtx);
+static e_eFSP_FOUT_RES eFSP_FOUT_CheckCtx(t_eFSP_FOUT_Ctx* const p_ptCtx);
+static e_eFSP_FOUT_RES eFSP_FOUT_ConvertRetFromMSGE(e_eFSP_MSGE_RES p_eRetEvent);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_FOUT_RES eFSP_FOUT_InitCtx(t_eFSP_FOUT_Ctx* const p_ptCtx, const t_eFSP_FOUT_InitData* p_ptInitData)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptInitData ) )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check pointer validity */
+        if( ( NULL == p_ptInitData->puIMemArea ) || ( NULL == p_ptInitData->puIFrameArea ) ||
+            ( NULL == p_ptInitData->fICrc ) || ( NULL == p_ptInitData->ptICbCrcCtx ) )
+        {
+            l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+        }
+        else
+        {
+            /* Check data validity, we need some len to store the frame */
+            if( p_ptInitData->uIFrameAreaL < 1u )
+            {
+                l_eRes = e_eFSP_FOUT_RES_BADPARAM;
+            }
+            else
+            {
+                /* Initialize internal status variable */
+                p_ptCtx->puFrame = p_ptInitData->puIFrameArea;
+                p_ptCtx->uFrameAreaL = p_ptInitData->uIFrameAreaL;
+                p_ptCtx->uFrameL = 0u;
+                p_ptCtx->uMsgL = 0u;
+                p_ptCtx->uRefN = 0u;
+                p_ptCtx->uGen = 0u;
+
+                /* initialize internal message encoder */
+                l_eResMsgE = eFSP_MSGE_InitCtx(&p_ptCtx->tMsgeCtx, p_ptInitData->puIMemArea, p_ptInitData->uIMemAreaL,
+                                               p_ptInitData->fICrc, p_ptInitData->ptICbCrcCtx);
+                l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_IsInit(t_eFSP_FOUT_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, p_pbIsInit);
+        l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_SetHeader(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            /* The frame already encoded is not touched, the profile is used by the next message */
+            l_eResMsgE = eFSP_MSGE_SetHeader(&p_ptCtx->tMsgeCtx, p_uCrcL, p_uLenL);
+            l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_SetFraming(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uFrm)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            l_eResMsgE = eFSP_MSGE_SetFraming(&p_ptCtx->tMsgeCtx, p_uFrm);
+            l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_SetWhitening(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uWhtL)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            l_eResMsgE = eFSP_MSGE_SetWhitening(&p_ptCtx->tMsgeCtx, p_uWhtL);
+            l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_SetCompression(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uCmpL)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            l_eResMsgE = eFSP_MSGE_SetCompression(&p_ptCtx->tMsgeCtx, p_uCmpL);
+            l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_SetFec(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uFecL)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            l_eResMsgE = eFSP_MSGE_SetFec(&p_ptCtx->tMsgeCtx, p_uFecL);
+            l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_GetWherePutData(t_eFSP_FOUT_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                          uint32_t* const p_puMaxDL)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puMaxDL ) )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            /* The payload area is not the frame area, so it can be written even with transmitters attached */
+            l_eResMsgE = eFSP_MSGE_GetWherePutData(&p_ptCtx->tMsgeCtx, p_ppuData, p_puMaxDL);
+            l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_NewMessage(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint32_t p_uMsgL)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    uint32_t l_uFrameL;
+    uint32_t l_uRemL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            /* Check param validity, need at least 1 byte of paylaod */
+            if( p_uMsgL <= 0u )
+            {
+                l_eRes = e_eFSP_FOUT_RES_BADPARAM;
+            }
+            else if( p_ptCtx->uRefN > 0u )
+            {
+                /* Some transmitter is still sending the current frame */
+                l_eRes = e_eFSP_FOUT_RES_BUSY;
+            }
+            else
+            {
+                /* The current frame is dropped, transmitters that try to restart it must see a new generation */
+                p_ptCtx->uFrameL = 0u;
+                p_ptCtx->uMsgL = 0u;
+                p_ptCtx->uGen++;
+
+                /* CRC and optional stages are done here, only once */
+                l_eResMsgE = eFSP_MSGE_NewMessage(&p_ptCtx->tMsgeCtx, p_uMsgL);
+                l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+
+                if( e_eFSP_FOUT_RES_OK == l_eRes )
+                {
+                    /* Byte stuffing of the whole frame in a single pass */
+                    l_uFrameL = 0u;
+                    l_eResMsgE = eFSP_MSGE_GetEncChunk(&p_ptCtx->tMsgeCtx, p_ptCtx->puFrame, p_ptCtx->uFrameAreaL,
+                                                       &l_uFrameL);
+
+                    if( e_eFSP_MSGE_RES_OK == l_eResMsgE )
+                    {
+                        /* The area is full, the frame is complete only if nothing is left in the encoder */
+                        l_uRemL = 0u;
+                        l_eResMsgE = eFSP_MSGE_GetRemByteToGet(&p_ptCtx->tMsgeCtx, &l_uRemL);
+                        l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+
+                        if( ( e_eFSP_FOUT_RES_OK == l_eRes ) && ( l_uRemL > 0u ) )
+                        {
+                            l_eRes = e_eFSP_FOUT_RES_OUTOFMEM;
+                        }
+                    }
+                    else if( e_eFSP_MSGE_RES_MESSAGEENDED == l_eResMsgE )
+                    {
+                        l_eRes = e_eFSP_FOUT_RES_OK;
+                    }
+                    else
+                    {
+                        l_eRes = eFSP_FOUT_ConvertRetFromMSGE(l_eResMsgE);
+                    }
+
+                    if( e_eFSP_FOUT_RES_OK == l_eRes )
+                    {
+                        p_ptCtx->uFrameL = l_uFrameL;
+                        p_ptCtx->uMsgL = p_uMsgL;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_GetRefN(t_eFSP_FOUT_Ctx* const p_ptCtx, uint32_t* const p_puRefN)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRefN ) )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            *p_puRefN = p_ptCtx->uRefN;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_Attach(t_eFSP_FOUT_Ctx* const p_ptCtx, const uint8_t** p_ppuFrame,
+                                 uint32_t* const p_puFrameL, uint32_t* const p_puMsgL, uint32_t* const p_puGen)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuFrame ) || ( NULL == p_puFrameL ) || ( NULL == p_puMsgL ) ||
+        ( NULL == p_puGen ) )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            if( 0u == p_ptCtx->uFrameL )
+            {
+                /* Nothing encoded, or the last message did not fit the frame area */
+                l_eRes = e_eFSP_FOUT_RES_NOINITMESSAGE;
+            }
+            else
+            {
+                p_ptCtx->uRefN++;
+                *p_ppuFrame = p_ptCtx->puFrame;
+                *p_puFrameL = p_ptCtx->uFrameL;
+                *p_puMsgL = p_ptCtx->uMsgL;
+                *p_puGen = p_ptCtx->uGen;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FOUT_RES eFSP_FOUT_Detach(t_eFSP_FOUT_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_FOUT_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FOUT_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_FOUT_RES_OK == l_eRes )
+        {
+            if( 0u == p_ptCtx->uRefN )
+            {
+                l_eRes = e_eFSP_FOUT_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->uRefN--;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_FOUT_IsStatusStillCoherent(const t_eFSP_FOUT_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puFrame )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check frame area validity */
+        if( ( p_ptCtx->uFrameAreaL < 1u ) || ( p_ptCtx->uFrameL > p_ptCtx->uFrameAreaL ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* A frame can be referenced only when it's encoded */
+            if( ( p_ptCtx->uRefN > 0u ) && ( 0u == p_ptCtx->uFrameL ) )
+            {
+                l_bRes = false;
+            }
+            else
+            {
+                l_bRes = true;
+            }
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_FOUT_RES eFSP_FOUT_CheckCtx(t_eFSP_FOUT_Ctx* const p_ptCtx)
+{
+    e_eFSP_FOUT_RES l_eRes;
+    bool_t l_bIsInit;
+
+    l_bIsInit = false;
+    if( e_eFSP_MSGE_RES_OK != eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit) )
+    {
+        l_eRes = e_eFSP_FOUT_RES_CORRUPTCTX;
+    }
+    else if( false == l_bIsInit )
+    {
+        l_eRes = e_eFSP_FOUT_RES_NOINITLIB;
+    }
+    else if( false == eFSP_FOUT_IsStatusStillCoherent(p_ptCtx) )
+    {
+        l_eRes = e_eFSP_FOUT_RES_CORRUPTCTX;
+    }
+    else
+    {
+        l_eRes = e_eFSP_FOUT_RES_OK;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_FOUT_RES eFSP_FOUT_ConvertRetFromMSGE(e_eFSP_MSGE_RES p_eRetEvent)
+{
+	e_eFSP_FOUT_RES l_eRes;
+
+	switch( p_eRetEvent )
+	{
+		case e_eFSP_MSGE_RES_OK:
+		{
+			l_eRes = e_eFSP_FOUT_RES_OK;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_BADPARAM:
+		{
+			l_eRes = e_eFSP_FOUT_RES_BADPARAM;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_BADPOINTER:
+		{
+			l_eRes = e_eFSP_FOUT_RES_BADPOINTER;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_NOINITLIB:
+		{
+			l_eRes = e_eFSP_FOUT_RES_NOINITLIB;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_NOINITMESSAGE :
+		{
+			l_eRes = e_eFSP_FOUT_RES_NOINITMESSAGE;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_CRCCLBKERROR :
+		{
+			l_eRes = e_eFSP_FOUT_RES_CRCCLBKERROR;
+            break;
+		}
+
+		default:
+		{
+            /* A message can not end before it's encoded, or the encoder is corrupted */
+			l_eRes = e_eFSP_FOUT_RES_CORRUPTCTX;
+            break;
+		}
+	}
+
+	return l_eRes;
+}
@@ -20,6 +20,17 @@
  **********************************************************************************************************************/
 static bool_t eFSP_MSGRX_IsStatusStillCoherent(const t_eFSP_MSGRX_Ctx* p_ptCtx);
 static e_eFSP_MSGRX_RES eFSP_MSGRX_ConvertRetFromMSGD(e_eFSP_MSGD_RES p_eRetEvent);
+static e_eFSP_MSGRX_RES eFSP_MSGRX_ChkFrameTim(t_eFSP_MSGRX_Ctx* const p_ptCtx);
+static e_eFSP_MSGRX_RES eFSP_MSGRX_ElabSpan(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                            const uint32_t p_uDataL, uint32_t* const p_puUsedL);
+static void eFSP_MSGRX_NotifyEvt(t_eFSP_MSGRX_Ctx* const p_ptCtx, const e_eFSP_MSGRX_RES p_eRes);
+static bool_t eFSP_MSGRX_TimStart(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uTimeout,
+                                 const bool_t p_bReuseNow);
+static bool_t eFSP_MSGRX_TimGetRemain(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint32_t* const p_puRemain);
+static uint32_t eFSP_MSGRX_CalcLineTim(const t_eFSP_MSGRX_Ctx* p_ptCtx, const uint32_t p_uByteN);
+static e_eFSP_MSGRX_RES eFSP_MSGRX_SizeFrameTim(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint32_t* const p_puRemainT);
+static uint32_t eFSP_MSGRX_DmaGetReady(const t_eFSP_MSGRX_Ctx* p_ptCtx);
+static e_eFSP_MSGRX_RES eFSP_MSGRX_RelCredit(t_eFSP_MSGRX_Ctx* const p_ptCtx);
 
 
 
@@ -76,6 +87,31 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_InitCtx(t_eFSP_MSGRX_Ctx* const p_ptCtx, const t_eFS
                     p_ptCtx->uTimeoutMs = p_ptInitData->uITimeoutMs;
                     p_ptCtx->uTimePerRecMs = p_ptInitData->uITimePerRecMs;
                     p_ptCtx->bWaitFrmStart = p_ptInitData->bINeedWaitFrameStart;
+                    p_ptCtx->fEvt = NULL;
+                    p_ptCtx->ptEvtCtx = NULL;
+                    p_ptCtx->bEvtPend = false;
+                    p_ptCtx->ptRing = NULL;
+                    p_ptCtx->fTimNow = NULL;
+                    p_ptCtx->uNowMs = 0u;
+                    p_ptCtx->uDeadlineMs = 0u;
+                    p_ptCtx->uArmedMs = 0u;
+                    p_ptCtx->ptTimW = NULL;
+                    (void)eFSP_TIMW_InitNode(&p_ptCtx->tTimNode, 0u);
+                    p_ptCtx->uLineRate = 0u;
+                    p_ptCtx->uLineMarginMs = 0u;
+                    p_ptCtx->bFrmTimSized = false;
+                    p_ptCtx->puDmaArea = NULL;
+                    p_ptCtx->uDmaBuffL = 0u;
+                    p_ptCtx->uDmaBuffN = 0u;
+                    p_ptCtx->uDmaDoneCnt = 0u;
+                    p_ptCtx->uDmaPartL = 0u;
+                    p_ptCtx->bDmaOvr = false;
+                    p_ptCtx->uDmaConsCnt = 0u;
+                    p_ptCtx->uDmaConsOff = 0u;
+                    p_ptCtx->uCredWinFrames = 1u;
+                    p_ptCtx->uCredWinBytes = EFSP_MSGRX_MAXCREDIT;
+                    p_ptCtx->uRelFrames = 0u;
+                    p_ptCtx->uRelBytes = 0u;
 
                     /* initialize internal bytestuffer */
                     l_eResMsgD =  eFSP_MSGD_InitCtx(&p_ptCtx->tMsgdCtx, p_ptInitData->puIMemArea,
@@ -130,17 +166,28 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_NewMsg(t_eFSP_MSGRX_Ctx* const p_ptCtx)
         }
         else
         {
-            /* Init message encoder */
-            l_eResMsgD = eFSP_MSGD_NewMsg(&p_ptCtx->tMsgdCtx);
-            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+            /* Give back the credit of the discharged frame */
+            l_eRes = eFSP_MSGRX_RelCredit(p_ptCtx);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                /* Init message encoder */
+                l_eResMsgD = eFSP_MSGD_NewMsg(&p_ptCtx->tMsgdCtx);
+                l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+            }
 
             if( e_eFSP_MSGRX_RES_OK == l_eRes )
             {
                 /* Start timer even if we need to wait SOF, this case is handled in the MSGRX_GetDecodedData */
-                if( true != p_ptCtx->tRxTim.fTimStart( p_ptCtx->tRxTim.ptTimCtx, p_ptCtx->uTimeoutMs ) )
+                if( true != eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, false) )
                 {
                     l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
                 }
+                else
+                {
+                    /* A new message is started, notify it's end only once */
+                    p_ptCtx->bEvtPend = true;
+                }
             }
         }
 	}
@@ -168,21 +215,32 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_NewMsgNClean(t_eFSP_MSGRX_Ctx* const p_ptCtx)
         }
         else
         {
-            /* Reset internal variable */
-            p_ptCtx->uRxBuffCntr = 0u;
-            p_ptCtx->uRxBufFil = 0u;
+            /* Give back the credit of the discharged frame */
+            l_eRes = eFSP_MSGRX_RelCredit(p_ptCtx);
 
-            /* Init message encoder */
-            l_eResMsgD = eFSP_MSGD_NewMsg(&p_ptCtx->tMsgdCtx);
-            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                /* Reset internal variable */
+                p_ptCtx->uRxBuffCntr = 0u;
+                p_ptCtx->uRxBufFil = 0u;
+
+                /* Init message encoder */
+                l_eResMsgD = eFSP_MSGD_NewMsg(&p_ptCtx->tMsgdCtx);
+                l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+            }
 
             if( e_eFSP_MSGRX_RES_OK == l_eRes )
             {
                 /* Start timer even if we need to wait SOF, this case is handled in the MSGRX_GetDecodedData */
-                if( true != p_ptCtx->tRxTim.fTimStart( p_ptCtx->tRxTim.ptTimCtx, p_ptCtx->uTimeoutMs ) )
+                if( true != eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, false) )
                 {
                     l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
                 }
+                else
+                {
+                    /* A new message is started, notify it's end only once */
+                    p_ptCtx->bEvtPend = true;
+                }
             }
         }
 	}
@@ -246,6 +304,8 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
     /* Other local variable */
     uint32_t l_uRxMosEf;
     bool_t l_bIsWaitingSof;
+    e_eFSP_SPSCR_RES l_eResSpscr;
+    uint32_t l_uDmaReady;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -312,7 +372,7 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                     case e_eFSP_MSGRXPRV_SM_CHECKINITTIMEOUT:
                     {
                         /* Check if frame timeout is eplased */
-                        if( true == p_ptCtx->tRxTim.fTimGetRemain(p_ptCtx->tRxTim.ptTimCtx, &l_uSRemRxT) )
+                        if( true == eFSP_MSGRX_TimGetRemain(p_ptCtx, &l_uSRemRxT) )
                         {
                             /* Check also if we are still waiting start of frame to be received */
                             l_eResMsgD =  eFSP_MSGD_IsWaitingSof(&p_ptCtx->tMsgdCtx, &l_bIsWaitingSof);
@@ -326,8 +386,7 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                                     if( true == l_bIsWaitingSof )
                                     {
                                         /* We are waiting start of frame, reset timer */
-                                        if( true == p_ptCtx->tRxTim.fTimStart( p_ptCtx->tRxTim.ptTimCtx,
-                                                                               p_ptCtx->uTimeoutMs ) )
+                                        if( true == eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, true) )
                                         {
                                             /* Ok restarted the timer */
                                             l_uSRemRxT = p_ptCtx->uTimeoutMs;
@@ -428,14 +487,25 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                         {
                             if( l_uRxMosEf > 0u )
                             {
-                                /* Ok we need some data to be retrived */
-                                l_eSM = e_eFSP_MSGRXPRV_SM_CHECKIFBUFFERRX;
+                                /* The header could be just arrived, the frame timeout can follow the frame length */
+                                l_eRes = eFSP_MSGRX_SizeFrameTim(p_ptCtx, &l_uSRemRxT);
 
-                                /* Check compatibility with rx buffer dimension */
-                                if( l_uRxMosEf > p_ptCtx->uRxBuffL )
+                                if( e_eFSP_MSGRX_RES_OK == l_eRes )
+                                {
+                                    /* Ok we need some data to be retrived */
+                                    l_eSM = e_eFSP_MSGRXPRV_SM_CHECKIFBUFFERRX;
+
+                                    /* Check compatibility with rx buffer dimension */
+                                    if( l_uRxMosEf > p_ptCtx->uRxBuffL )
+                                    {
+                                        /* In this way we dont' have any overflow */
+                                        l_uRxMosEf = p_ptCtx->uRxBuffL;
+                                    }
+                                }
+                                else
                                 {
-                                    /* In this way we dont' have any overflow */
-                                    l_uRxMosEf = p_ptCtx->uRxBuffL;
+                                    /* Some error */
+                                    l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
                                 }
                             }
                             else
@@ -489,7 +559,19 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                             /* No data in msg buffer, retrive some other chunk of data */
                             p_ptCtx->uRxBuffCntr = 0u;
                             p_ptCtx->uRxBufFil = 0u;
-                            l_eSM = e_eFSP_MSGRXPRV_SM_RECEIVEBUFF;
+
+                            if( NULL != p_ptCtx->ptRing )
+                            {
+                                l_eSM = e_eFSP_MSGRXPRV_SM_RECEIVERING;
+                            }
+                            else if( NULL != p_ptCtx->puDmaArea )
+                            {
+                                l_eSM = e_eFSP_MSGRXPRV_SM_RECEIVEDMA;
+                            }
+                            else
+                            {
+                                l_eSM = e_eFSP_MSGRXPRV_SM_RECEIVEBUFF;
+                            }
                         }
                         break;
                     }
@@ -525,6 +607,137 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                         break;
                     }
 
+                    case e_eFSP_MSGRXPRV_SM_RECEIVERING:
+                    {
+                        /* Decode in place the contiguous data published by the producer */
+                        l_puCDToRxP = NULL;
+                        l_uCDToRxL = 0u;
+                        l_eResSpscr = eFSP_SPSCR_GetReadSpan(p_ptCtx->ptRing, &l_puCDToRxP, &l_uCDToRxL);
+
+                        if( e_eFSP_SPSCR_RES_OK != l_eResSpscr )
+                        {
+                            /* The ring was checked when configured */
+                            l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+                            l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                        }
+                        else if( l_uCDToRxL > 0u )
+                        {
+                            l_uCDRxd = 0u;
+                            l_eResMsgD = eFSP_MSGD_InsEncChunk(&p_ptCtx->tMsgdCtx, l_puCDToRxP, l_uCDToRxL, &l_uCDRxd );
+                            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+                            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+                            {
+                                /* By design if MSGD_InsEncChunk return OK all the data is consumed */
+                                l_uCDRxd = l_uCDToRxL;
+                            }
+
+                            /* Give back to the producer the consumed data */
+                            if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_Release(p_ptCtx->ptRing, l_uCDRxd) )
+                            {
+                                l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+                                l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                            }
+                            else if( ( e_eFSP_MSGRX_RES_OK == l_eRes ) ||
+                                     ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == l_eRes ) ||
+                                     ( e_eFSP_MSGRX_RES_BADFRAME == l_eRes ) ||
+                                     ( e_eFSP_MSGRX_RES_FRAMERESTART == l_eRes ) )
+                            {
+                                /* Check for timeout */
+                                l_eSM = e_eFSP_MSGRXPRV_SM_CHECKTIMEOUTAFTERRX;
+                            }
+                            else
+                            {
+                                /* Some error, can return */
+                                l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                            }
+                        }
+                        else
+                        {
+                            /* Nothing published yet, never wait the producer. The timeout is checked at the start
+                             * of the next call */
+                            l_eRes = e_eFSP_MSGRX_RES_OK;
+                            l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                        }
+
+                        break;
+                    }
+
+                    case e_eFSP_MSGRXPRV_SM_RECEIVEDMA:
+                    {
+                        if( true == p_ptCtx->bDmaOvr )
+                        {
+                            /* The DMA has overwritten pending data, discard all of it and restart from the buffer
+                             * that the DMA is filling now */
+                            p_ptCtx->bDmaOvr = false;
+                            EFSP_SPSCR_MEMBARRIER();
+                            p_ptCtx->uDmaConsCnt = p_ptCtx->uDmaDoneCnt;
+                            p_ptCtx->uDmaConsOff = 0u;
+                        }
+
+                        /* A filled buffer can be consumed till the end, the one under DMA only till the written part */
+                        l_uDmaReady = eFSP_MSGRX_DmaGetReady(p_ptCtx);
+                        if( l_uDmaReady > 0u )
+                        {
+                            l_uCDToRxL = p_ptCtx->uDmaBuffL;
+                        }
+                        else
+                        {
+                            l_uCDToRxL = p_ptCtx->uDmaPartL;
+                        }
+                        EFSP_SPSCR_MEMBARRIER();
+
+                        if( l_uCDToRxL > p_ptCtx->uDmaConsOff )
+                        {
+                            /* Decode in place the data written by the DMA */
+                            l_puCDToRxP = &p_ptCtx->puDmaArea[ ( ( p_ptCtx->uDmaConsCnt % p_ptCtx->uDmaBuffN ) *
+                                                                 p_ptCtx->uDmaBuffL ) + p_ptCtx->uDmaConsOff ];
+                            l_uCDToRxL -= p_ptCtx->uDmaConsOff;
+                            l_uCDRxd = 0u;
+                            l_eResMsgD = eFSP_MSGD_InsEncChunk(&p_ptCtx->tMsgdCtx, l_puCDToRxP, l_uCDToRxL, &l_uCDRxd );
+                            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+                            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+                            {
+                                /* By design if MSGD_InsEncChunk return OK all the data is consumed */
+                                l_uCDRxd = l_uCDToRxL;
+                            }
+
+                            p_ptCtx->uDmaConsOff += l_uCDRxd;
+
+                            if( ( e_eFSP_MSGRX_RES_OK == l_eRes ) ||
+                                ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == l_eRes ) ||
+                                ( e_eFSP_MSGRX_RES_BADFRAME == l_eRes ) ||
+                                ( e_eFSP_MSGRX_RES_FRAMERESTART == l_eRes ) )
+                            {
+                                /* Check for timeout */
+                                l_eSM = e_eFSP_MSGRXPRV_SM_CHECKTIMEOUTAFTERRX;
+                            }
+                            else
+                            {
+                                /* Some error, can return */
+                                l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                            }
+                        }
+                        else
+                        {
+                            /* Nothing written yet, never wait the DMA. The timeout is checked at the start of the
+                             * next call */
+                            l_eRes = e_eFSP_MSGRX_RES_OK;
+                            l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                        }
+
+                        /* Give back to the DMA a completely consumed buffer */
+                        if( ( l_uDmaReady > 0u ) && ( p_ptCtx->uDmaConsOff >= p_ptCtx->uDmaBuffL ) )
+                        {
+                            p_ptCtx->uDmaConsOff = 0u;
+                            EFSP_SPSCR_MEMBARRIER();
+                            p_ptCtx->uDmaConsCnt = ( p_ptCtx->uDmaConsCnt + 1u ) % ( 2u * p_ptCtx->uDmaBuffN );
+                        }
+
+                        break;
+                    }
+
                     case e_eFSP_MSGRXPRV_SM_INSERTCHUNK:
                     {
                         /* Ok, we have some data in RX buffer */
@@ -582,6 +795,13 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                                 l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
                             }
                         }
+                        else if( NULL != p_ptCtx->ptTimW )
+                        {
+                            /* Didn't receive data, and the wheel time moves only in eFSP_TIMW_Advance, so waiting
+                             * here can never end the session. The timeout is checked at the start of the next call */
+                            l_eRes = e_eFSP_MSGRX_RES_OK;
+                            l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
+                        }
                         else
                         {
                             /* Didn't receive data in the previous e_eFSP_MSGRXPRV_SM_RECEIVEBUFF, check timeout */
@@ -595,7 +815,7 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                     case e_eFSP_MSGRXPRV_SM_CHECKTIMEOUTAFTERRX:
                     {
                         /* Check if frame timeout is eplased */
-                        if( true == p_ptCtx->tRxTim.fTimGetRemain(p_ptCtx->tRxTim.ptTimCtx, &l_uCRemRxT) )
+                        if( true == eFSP_MSGRX_TimGetRemain(p_ptCtx, &l_uCRemRxT) )
                         {
                             /* Check time validity */
                             if( l_uCRemRxT > l_uSRemRxT )
@@ -622,8 +842,7 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                                         l_eSM = e_eFSP_MSGRXPRV_SM_ELABDONE;
 
                                         /* Frame restarted, restart the timer */
-                                        if( true == p_ptCtx->tRxTim.fTimStart( p_ptCtx->tRxTim.ptTimCtx,
-                                                                               p_ptCtx->uTimeoutMs ) )
+                                        if( true == eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, true) )
                                         {
                                             /* Ok restarted the timer */
                                             l_uSRemRxT = p_ptCtx->uTimeoutMs;
@@ -641,8 +860,7 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                                     {
                                         /* In this case total time dosen't need to be decreased, only the session */
                                         /* Frame restarted, restart the timer */
-                                        if( true == p_ptCtx->tRxTim.fTimStart( p_ptCtx->tRxTim.ptTimCtx,
-                                                                               p_ptCtx->uTimeoutMs ) )
+                                        if( true == eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, true) )
                                         {
                                             /* Ok restarted the timer */
                                             l_uSRemRxT = p_ptCtx->uTimeoutMs;
@@ -750,113 +968,1103 @@ e_eFSP_MSGRX_RES eFSP_MSGRX_ReceiveChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx)
                     }
                 }
             }
+
+            /* Notify the end of the message if needed */
+            eFSP_MSGRX_NotifyEvt(p_ptCtx, l_eRes);
 		}
 	}
 
 	return l_eRes;
 }
 
-
-
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSP_MSGRX_IsStatusStillCoherent(const t_eFSP_MSGRX_Ctx* p_ptCtx)
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetEvtCb(t_eFSP_MSGRX_Ctx* const p_ptCtx, f_eFSP_MSGRX_EvtCb p_fEvt,
+                                     t_eFSP_MSGRX_EvtCtx* const p_ptEvtCtx)
 {
-    bool_t l_bRes;
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
 
-	/* Check pointer validity */
-	if( ( NULL == p_ptCtx->puRxBuff ) || ( NULL == p_ptCtx->fRx ) || ( NULL == p_ptCtx->ptRxCtx ) ||
-        ( NULL == p_ptCtx->tRxTim.ptTimCtx ) || ( NULL == p_ptCtx->tRxTim.fTimStart ) ||
-        ( NULL == p_ptCtx->tRxTim.fTimGetRemain ) )
+	/* Check pointer validity, callback and context must be both valid or both NULL */
+	if( ( NULL == p_ptCtx ) || ( ( NULL == p_fEvt ) != ( NULL == p_ptEvtCtx ) ) )
 	{
-		l_bRes = false;
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
 	}
 	else
 	{
-        /* Check send buffer validity */
-        if( ( p_ptCtx->uRxBuffL < 1u ) || ( p_ptCtx->uRxBufFil > p_ptCtx->uRxBuffL )  ||
-            ( p_ptCtx->uRxBuffCntr > p_ptCtx->uRxBufFil ) )
-        {
-            l_bRes =  false;
-        }
-        else
-        {
-            /* Check timings validity */
-            if( ( p_ptCtx->uTimeoutMs < 1u ) || ( p_ptCtx->uTimePerRecMs < 1u ) ||
-                ( p_ptCtx->uTimePerRecMs > p_ptCtx->uTimeoutMs ) )
-            {
-                l_bRes = false;
-            }
-            else
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
             {
-                l_bRes = true;
+                if( true == l_bIsInit )
+                {
+                    p_ptCtx->fEvt = p_fEvt;
+                    p_ptCtx->ptEvtCtx = p_ptEvtCtx;
+                }
+                else
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
             }
-        }
+		}
 	}
 
-    return l_bRes;
+	return l_eRes;
 }
 
-static e_eFSP_MSGRX_RES eFSP_MSGRX_ConvertRetFromMSGD(e_eFSP_MSGD_RES p_eRetEvent)
+e_eFSP_MSGRX_RES eFSP_MSGRX_GetWhereRxData(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                           uint32_t* const p_puMaxDataL)
 {
+	/* Local variable */
 	e_eFSP_MSGRX_RES l_eRes;
 
-	switch( p_eRetEvent )
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puMaxDataL ) )
 	{
-		case e_eFSP_MSGD_RES_OK:
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
 		{
-			l_eRes = e_eFSP_MSGRX_RES_OK;
-            break;
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
 		}
-
-		case e_eFSP_MSGD_RES_BADPARAM:
+		else
 		{
-			l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
-            break;
-		}
+            if( p_ptCtx->uRxBuffCntr >= p_ptCtx->uRxBufFil )
+            {
+                /* All data is already parsed, can use the whole RX buffer */
+                p_ptCtx->uRxBuffCntr = 0u;
+                p_ptCtx->uRxBufFil = 0u;
+            }
 
-		case e_eFSP_MSGD_RES_BADPOINTER:
-		{
-			l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
-            break;
+            *p_ppuData = &p_ptCtx->puRxBuff[p_ptCtx->uRxBufFil];
+            *p_puMaxDataL = p_ptCtx->uRxBuffL - p_ptCtx->uRxBufFil;
+            l_eRes = e_eFSP_MSGRX_RES_OK;
 		}
+	}
 
-		case e_eFSP_MSGD_RES_CORRUPTCTX:
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_NotifyRecv(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uRecvL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+    uint32_t l_uUsedL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
 		{
 			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
-            break;
 		}
+		else
+		{
+            /* The driver can not have received more data than the free space we gave to it */
+            if( p_uRecvL > ( p_ptCtx->uRxBuffL - p_ptCtx->uRxBufFil ) )
+            {
+                l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+            }
+            else
+            {
+                /* Update received counter */
+                p_ptCtx->uRxBufFil += p_uRecvL;
 
-        case e_eFSP_MSGD_RES_OUTOFMEM:
-        {
-			l_eRes = e_eFSP_MSGRX_RES_OUTOFMEM;
-            break;
-        }
+                /* Parse all the data not parsed yet */
+                l_uUsedL = 0u;
+                l_eRes = eFSP_MSGRX_ElabSpan(p_ptCtx, &p_ptCtx->puRxBuff[p_ptCtx->uRxBuffCntr],
+                                             ( p_ptCtx->uRxBufFil - p_ptCtx->uRxBuffCntr ), &l_uUsedL);
+                p_ptCtx->uRxBuffCntr += l_uUsedL;
 
-        case e_eFSP_MSGD_RES_BADFRAME:
-        {
-			l_eRes = e_eFSP_MSGRX_RES_BADFRAME;
-            break;
-        }
+                if( p_ptCtx->uRxBuffCntr >= p_ptCtx->uRxBufFil )
+                {
+                    /* All data parsed, can reuse the whole RX buffer */
+                    p_ptCtx->uRxBuffCntr = 0u;
+                    p_ptCtx->uRxBufFil = 0u;
+                }
 
-		case e_eFSP_MSGD_RES_MESSAGEENDED:
-		{
-			l_eRes = e_eFSP_MSGRX_RES_MESSAGERECEIVED;
-            break;
+                /* Notify the end of the message if needed */
+                eFSP_MSGRX_NotifyEvt(p_ptCtx, l_eRes);
+            }
 		}
+	}
 
-		case e_eFSP_MSGD_RES_FRAMERESTART:
-		{
-			l_eRes = e_eFSP_MSGRX_RES_FRAMERESTART;
-            break;
-		}
+	return l_eRes;
+}
 
-		case e_eFSP_MSGD_RES_NOINITLIB:
-		{
-			l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
-            break;
-		}
+e_eFSP_MSGRX_RES eFSP_MSGRX_CheckTimeout(t_eFSP_MSGRX_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( true == p_ptCtx->bEvtPend )
+                {
+                    /* A message is ongoing, check it's timeout */
+                    l_eRes = eFSP_MSGRX_ChkFrameTim(p_ptCtx);
+
+                    /* Notify the end of the message if needed */
+                    eFSP_MSGRX_NotifyEvt(p_ptCtx, l_eRes);
+                }
+                else
+                {
+                    /* No message ongoing, nothing to check */
+                    l_eRes = e_eFSP_MSGRX_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetRingSrc(t_eFSP_MSGRX_Ctx* const p_ptCtx, t_eFSP_SPSCR_Ctx* const p_ptRing)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+    bool_t l_bIsRingInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( NULL == p_ptRing )
+                {
+                    /* Use the RX callback again */
+                    p_ptCtx->ptRing = NULL;
+                }
+                else if( NULL != p_ptCtx->puDmaArea )
+                {
+                    /* Only one source at time */
+                    l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                }
+                else
+                {
+                    /* The ring must be already initialized */
+                    l_bIsRingInit = false;
+                    if( ( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_IsInit(p_ptRing, &l_bIsRingInit) ) &&
+                        ( true == l_bIsRingInit ) )
+                    {
+                        p_ptCtx->ptRing = p_ptRing;
+                    }
+                    else
+                    {
+                        l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_InsChunk(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                     const uint32_t p_uDataL, uint32_t* const p_puUsedL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) || ( NULL == p_puUsedL ) )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check data validity */
+            if( p_uDataL < 1u )
+            {
+                l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+            }
+            else
+            {
+                /* Decode directly from the caller memory */
+                l_eRes = eFSP_MSGRX_ElabSpan(p_ptCtx, p_puData, p_uDataL, p_puUsedL);
+
+                /* Notify the end of the message if needed */
+                eFSP_MSGRX_NotifyEvt(p_ptCtx, l_eRes);
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetDmaSrc(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t* p_puArea, const uint32_t p_uBuffL,
+                                     const uint32_t p_uBuffN)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( NULL == p_puArea )
+                {
+                    /* Use the RX callback again */
+                    p_ptCtx->puDmaArea = NULL;
+                }
+                else if( ( NULL != p_ptCtx->ptRing ) || ( p_uBuffL < 1u ) || ( p_uBuffN < 2u ) ||
+                         ( p_uBuffN > ( MAX_UINT32VAL / 2u ) ) || ( p_uBuffL > ( MAX_UINT32VAL / p_uBuffN ) ) )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                }
+                else
+                {
+                    /* The DMA start filling the first buffer */
+                    p_ptCtx->puDmaArea = p_puArea;
+                    p_ptCtx->uDmaBuffL = p_uBuffL;
+                    p_ptCtx->uDmaBuffN = p_uBuffN;
+                    p_ptCtx->uDmaDoneCnt = 0u;
+                    p_ptCtx->uDmaPartL = 0u;
+                    p_ptCtx->bDmaOvr = false;
+                    p_ptCtx->uDmaConsCnt = 0u;
+                    p_ptCtx->uDmaConsOff = 0u;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_DmaBuffDone(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t** p_ppuNextBuff)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+    uint32_t l_uDoneCnt;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuNextBuff ) )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            if( NULL == p_ptCtx->puDmaArea )
+            {
+                l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+            }
+            else
+            {
+                /* The DMA is now filling the buffer after the completed one, it must be already consumed */
+                if( eFSP_MSGRX_DmaGetReady(p_ptCtx) >= ( p_ptCtx->uDmaBuffN - 1u ) )
+                {
+                    p_ptCtx->bDmaOvr = true;
+                    l_eRes = e_eFSP_MSGRX_RES_OUTOFMEM;
+                }
+                else
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_OK;
+                }
+
+                /* Publish the completed buffer to the decoder */
+                l_uDoneCnt = ( p_ptCtx->uDmaDoneCnt + 1u ) % ( 2u * p_ptCtx->uDmaBuffN );
+                p_ptCtx->uDmaPartL = 0u;
+                EFSP_SPSCR_MEMBARRIER();
+                p_ptCtx->uDmaDoneCnt = l_uDoneCnt;
+
+                *p_ppuNextBuff = &p_ptCtx->puDmaArea[ ( l_uDoneCnt % p_ptCtx->uDmaBuffN ) * p_ptCtx->uDmaBuffL ];
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_DmaBuffPart(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uWrittenL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            if( ( NULL == p_ptCtx->puDmaArea ) || ( p_uWrittenL > p_ptCtx->uDmaBuffL ) )
+            {
+                l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+            }
+            else
+            {
+                /* Publish the part of the buffer already written */
+                EFSP_SPSCR_MEMBARRIER();
+                p_ptCtx->uDmaPartL = p_uWrittenL;
+                l_eRes = e_eFSP_MSGRX_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetClock(t_eFSP_MSGRX_Ctx* const p_ptCtx, f_eFSP_MSGRX_TimGetNow p_fNow)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+    uint32_t l_uRemain;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else
+                {
+                    /* Move the ongoing timeout to the new time source */
+                    l_uRemain = 0u;
+                    if( true != eFSP_MSGRX_TimGetRemain(p_ptCtx, &l_uRemain) )
+                    {
+                        l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                    }
+                    else if( NULL == p_fNow )
+                    {
+                        p_ptCtx->fTimNow = NULL;
+                        /* With a timer wheel the timer call backs are not used */
+                        if( ( NULL == p_ptCtx->ptTimW ) &&
+                            ( true != p_ptCtx->tRxTim.fTimStart(p_ptCtx->tRxTim.ptTimCtx, l_uRemain) ) )
+                        {
+                            l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                        }
+                    }
+                    else
+                    {
+                        if( true == (*p_fNow)(p_ptCtx->tRxTim.ptTimCtx, &p_ptCtx->uNowMs) )
+                        {
+                            p_ptCtx->fTimNow = p_fNow;
+                            p_ptCtx->uDeadlineMs = p_ptCtx->uNowMs + l_uRemain;
+                            p_ptCtx->uArmedMs = l_uRemain;
+                        }
+                        else
+                        {
+                            l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetTimerWheel(t_eFSP_MSGRX_Ctx* const p_ptCtx, t_eFSP_TIMW_Ctx* const p_ptTimW,
+                                           const uint32_t p_uId)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+    bool_t l_bIsTimWInit;
+    uint32_t l_uRemain;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                /* The wheel must be already initialized */
+                l_bIsTimWInit = false;
+                if( NULL != p_ptTimW )
+                {
+                    (void)eFSP_TIMW_IsInit(p_ptTimW, &l_bIsTimWInit);
+                }
+
+                l_uRemain = 0u;
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( ( NULL != p_ptTimW ) && ( true != l_bIsTimWInit ) )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                }
+                else if( true != eFSP_MSGRX_TimGetRemain(p_ptCtx, &l_uRemain) )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                }
+                else
+                {
+                    /* Leave the previous wheel */
+                    if( NULL != p_ptCtx->ptTimW )
+                    {
+                        (void)eFSP_TIMW_Cancel(p_ptCtx->ptTimW, &p_ptCtx->tTimNode);
+                    }
+
+                    p_ptCtx->ptTimW = p_ptTimW;
+                    if( NULL != p_ptTimW )
+                    {
+                        (void)eFSP_TIMW_InitNode(&p_ptCtx->tTimNode, p_uId);
+                    }
+
+                    /* Move the ongoing timeout to the new time source */
+                    if( true == p_ptCtx->bEvtPend )
+                    {
+                        if( true != eFSP_MSGRX_TimStart(p_ptCtx, l_uRemain, false) )
+                        {
+                            l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetLineRate(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uLineRate,
+                                         const uint32_t p_uMarginMs)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( p_uLineRate > ( MAX_UINT32VAL / 1000u ) )
+                {
+                    /* The remainder of the division by the rate must be convertible in ms */
+                    l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uLineRate = p_uLineRate;
+                    p_ptCtx->uLineMarginMs = p_uMarginMs;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetTimeout(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uTimeoutMs)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( ( p_uTimeoutMs < 1u ) || ( p_uTimeoutMs < p_ptCtx->uTimePerRecMs ) )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                }
+                else
+                {
+                    /* The running deadline is not touched, the new value is used when the timer is started again */
+                    p_ptCtx->uTimeoutMs = p_uTimeoutMs;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetCreditWindow(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uFrames,
+                                            const uint32_t p_uBytes)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else if( ( p_uFrames > EFSP_MSGRX_MAXCREDIT ) || ( p_uBytes > EFSP_MSGRX_MAXCREDIT ) )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uCredWinFrames = p_uFrames;
+                    p_ptCtx->uCredWinBytes = p_uBytes;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_GetCreditLimit(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint32_t* const p_puFrameLim,
+                                           uint32_t* const p_puByteLim)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrameLim ) || ( NULL == p_puByteLim ) )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+                }
+                else
+                {
+                    /* The sum can wrap around, the transmitter compare the limits modulo 2^32 */
+                    *p_puFrameLim = p_ptCtx->uRelFrames + p_ptCtx->uCredWinFrames;
+                    *p_puByteLim = p_ptCtx->uRelBytes + p_ptCtx->uCredWinBytes;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetHeader(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The profile is used by the message decoder */
+            l_eResMsgD = eFSP_MSGD_SetHeader(&p_ptCtx->tMsgdCtx, p_uCrcL, p_uLenL);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetFraming(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uFrm)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The engine is used by the message decoder */
+            l_eResMsgD = eFSP_MSGD_SetFraming(&p_ptCtx->tMsgdCtx, p_uFrm);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetWhitening(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uWhtL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The whitening is removed by the message decoder */
+            l_eResMsgD = eFSP_MSGD_SetWhitening(&p_ptCtx->tMsgdCtx, p_uWhtL);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetCompression(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uCmpL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The decompression is done by the message decoder */
+            l_eResMsgD = eFSP_MSGD_SetCompression(&p_ptCtx->tMsgdCtx, p_uCmpL);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetDelta(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The delta frames are rebuilt by the message decoder */
+            l_eResMsgD = eFSP_MSGD_SetDelta(&p_ptCtx->tMsgdCtx, p_puBase, p_uBaseL);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGRX_RES eFSP_MSGRX_SetFec(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uFecL)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGRX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The errors are corrected by the message decoder */
+            l_eResMsgD = eFSP_MSGD_SetFec(&p_ptCtx->tMsgdCtx, p_uFecL);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+		}
+	}
+
+	return l_eRes;
+}
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_MSGRX_IsStatusStillCoherent(const t_eFSP_MSGRX_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->puRxBuff ) || ( NULL == p_ptCtx->fRx ) || ( NULL == p_ptCtx->ptRxCtx ) ||
+        ( NULL == p_ptCtx->tRxTim.ptTimCtx ) || ( NULL == p_ptCtx->tRxTim.fTimStart ) ||
+        ( NULL == p_ptCtx->tRxTim.fTimGetRemain ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check send buffer validity */
+        if( ( p_ptCtx->uRxBuffL < 1u ) || ( p_ptCtx->uRxBufFil > p_ptCtx->uRxBuffL )  ||
+            ( p_ptCtx->uRxBuffCntr > p_ptCtx->uRxBufFil ) )
+        {
+            l_bRes =  false;
+        }
+        else
+        {
+            /* Check timings validity */
+            if( ( p_ptCtx->uTimeoutMs < 1u ) || ( p_ptCtx->uTimePerRecMs < 1u ) ||
+                ( p_ptCtx->uTimePerRecMs > p_ptCtx->uTimeoutMs ) )
+            {
+                l_bRes = false;
+            }
+            else
+            {
+                /* Event callback is optional, but callback and context must be coherent */
+                if( ( NULL == p_ptCtx->fEvt ) != ( NULL == p_ptCtx->ptEvtCtx ) )
+                {
+                    l_bRes = false;
+                }
+                else if( ( p_ptCtx->uCredWinFrames > EFSP_MSGRX_MAXCREDIT ) ||
+                         ( p_ptCtx->uCredWinBytes > EFSP_MSGRX_MAXCREDIT ) )
+                {
+                    /* Check credit window validity */
+                    l_bRes = false;
+                }
+                else if( NULL != p_ptCtx->puDmaArea )
+                {
+                    /* Check DMA buffers validity */
+                    if( ( NULL != p_ptCtx->ptRing ) || ( p_ptCtx->uDmaBuffL < 1u ) || ( p_ptCtx->uDmaBuffN < 2u ) ||
+                        ( p_ptCtx->uDmaPartL > p_ptCtx->uDmaBuffL ) || ( p_ptCtx->uDmaConsOff > p_ptCtx->uDmaBuffL ) ||
+                        ( p_ptCtx->uDmaDoneCnt >= ( 2u * p_ptCtx->uDmaBuffN ) ) ||
+                        ( p_ptCtx->uDmaConsCnt >= ( 2u * p_ptCtx->uDmaBuffN ) ) )
+                    {
+                        l_bRes = false;
+                    }
+                    else
+                    {
+                        l_bRes = true;
+                    }
+                }
+                else
+                {
+                    l_bRes = true;
+                }
+            }
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_MSGRX_RES eFSP_MSGRX_ConvertRetFromMSGD(e_eFSP_MSGD_RES p_eRetEvent)
+{
+	e_eFSP_MSGRX_RES l_eRes;
+
+	switch( p_eRetEvent )
+	{
+		case e_eFSP_MSGD_RES_OK:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_OK;
+            break;
+		}
+
+		case e_eFSP_MSGD_RES_BADPARAM:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_BADPARAM;
+            break;
+		}
+
+		case e_eFSP_MSGD_RES_BADPOINTER:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_BADPOINTER;
+            break;
+		}
+
+		case e_eFSP_MSGD_RES_CORRUPTCTX:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_CORRUPTCTX;
+            break;
+		}
+
+        case e_eFSP_MSGD_RES_OUTOFMEM:
+        {
+			l_eRes = e_eFSP_MSGRX_RES_OUTOFMEM;
+            break;
+        }
+
+        case e_eFSP_MSGD_RES_BADFRAME:
+        {
+			l_eRes = e_eFSP_MSGRX_RES_BADFRAME;
+            break;
+        }
+
+		case e_eFSP_MSGD_RES_MESSAGEENDED:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_MESSAGERECEIVED;
+            break;
+		}
+
+		case e_eFSP_MSGD_RES_FRAMERESTART:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_FRAMERESTART;
+            break;
+		}
+
+		case e_eFSP_MSGD_RES_NOINITLIB:
+		{
+			l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+            break;
+		}
 
 		case e_eFSP_MSGD_RES_CRCCLBKERROR :
 		{
@@ -873,4 +2081,393 @@ static e_eFSP_MSGRX_RES eFSP_MSGRX_ConvertRetFromMSGD(e_eFSP_MSGD_RES p_eRetEven
 	}
 
 	return l_eRes;
+}
+
+static e_eFSP_MSGRX_RES eFSP_MSGRX_ChkFrameTim(t_eFSP_MSGRX_Ctx* const p_ptCtx)
+{
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    uint32_t l_uRemainRxT;
+    bool_t l_bIsWaitingSof;
+
+    /* Are we waiting SOF? */
+    l_bIsWaitingSof = false;
+    l_eResMsgD = eFSP_MSGD_IsWaitingSof(&p_ptCtx->tMsgdCtx, &l_bIsWaitingSof);
+    l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+    if( e_eFSP_MSGRX_RES_OK == l_eRes )
+    {
+        if( ( true == p_ptCtx->bWaitFrmStart ) && ( true == l_bIsWaitingSof ) )
+        {
+            /* Frame not started yet, timeout dosent occour in this situation, restart the timer */
+            if( true != eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, false) )
+            {
+                l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+            }
+        }
+        else
+        {
+            /* Check if frame timeout is eplased */
+            l_uRemainRxT = 0u;
+            if( true == eFSP_MSGRX_TimGetRemain(p_ptCtx, &l_uRemainRxT) )
+            {
+                if( l_uRemainRxT <= 0u )
+                {
+                    /* Time elapsed */
+                    l_eRes = e_eFSP_MSGRX_RES_MESSAGETIMEOUT;
+                }
+            }
+            else
+            {
+                /* Some error on timer */
+                l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+            }
+        }
+    }
+
+	return l_eRes;
+}
+
+static e_eFSP_MSGRX_RES eFSP_MSGRX_ElabSpan(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                            const uint32_t p_uDataL, uint32_t* const p_puUsedL)
+{
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    uint32_t l_uCDRxd;
+    uint32_t l_uRemainT;
+    bool_t l_bIsInit;
+
+    *p_puUsedL = 0u;
+
+    /* Check if lib is initialized */
+    l_bIsInit = false;
+    l_eResMsgD = eFSP_MSGD_IsInit(&p_ptCtx->tMsgdCtx, &l_bIsInit);
+    l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+    if( e_eFSP_MSGRX_RES_OK == l_eRes )
+    {
+        if( true != l_bIsInit )
+        {
+            l_eRes = e_eFSP_MSGRX_RES_NOINITLIB;
+        }
+        else
+        {
+            /* If the frame is not started yet the timer must start from now */
+            l_eRes = eFSP_MSGRX_ChkFrameTim(p_ptCtx);
+        }
+    }
+
+    /* Decode the whole span, a frame restart dosent stop the elaboration */
+    while( ( e_eFSP_MSGRX_RES_OK == l_eRes ) && ( *p_puUsedL < p_uDataL ) )
+    {
+        l_uCDRxd = 0u;
+        l_eResMsgD = eFSP_MSGD_InsEncChunk(&p_ptCtx->tMsgdCtx, &p_puData[*p_puUsedL], ( p_uDataL - *p_puUsedL ),
+                                           &l_uCDRxd);
+        l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+        if( e_eFSP_MSGRX_RES_OK == l_eRes )
+        {
+            /* By design if MSGD_InsEncChunk return OK all the data is consumed */
+            *p_puUsedL = p_uDataL;
+        }
+        else
+        {
+            *p_puUsedL += l_uCDRxd;
+
+            if( e_eFSP_MSGRX_RES_FRAMERESTART == l_eRes )
+            {
+                /* Frame restarted, if we wait the SOF the timeout must be restarted */
+                if( true == p_ptCtx->bWaitFrmStart )
+                {
+                    if( true == eFSP_MSGRX_TimStart(p_ptCtx, p_ptCtx->uTimeoutMs, false) )
+                    {
+                        l_eRes = e_eFSP_MSGRX_RES_OK;
+                    }
+                    else
+                    {
+                        l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                    }
+                }
+                else
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_OK;
+                }
+            }
+        }
+    }
+
+    /* Data parsed but frame not finished, the header could be just arrived */
+    if( e_eFSP_MSGRX_RES_OK == l_eRes )
+    {
+        l_uRemainT = 0u;
+        l_eRes = eFSP_MSGRX_SizeFrameTim(p_ptCtx, &l_uRemainT);
+    }
+
+    /* Check for timeout */
+    if( e_eFSP_MSGRX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MSGRX_ChkFrameTim(p_ptCtx);
+    }
+
+	return l_eRes;
+}
+
+static void eFSP_MSGRX_NotifyEvt(t_eFSP_MSGRX_Ctx* const p_ptCtx, const e_eFSP_MSGRX_RES p_eRes)
+{
+    /* Only final state of a message are notified, and only once */
+    if( ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == p_eRes ) || ( e_eFSP_MSGRX_RES_BADFRAME == p_eRes ) ||
+        ( e_eFSP_MSGRX_RES_MESSAGETIMEOUT == p_eRes ) )
+    {
+        if( true == p_ptCtx->bEvtPend )
+        {
+            p_ptCtx->bEvtPend = false;
+
+            /* The timeout is not needed anymore, the poller must not be woken up for this context */
+            if( NULL != p_ptCtx->ptTimW )
+            {
+                (void)eFSP_TIMW_Cancel(p_ptCtx->ptTimW, &p_ptCtx->tTimNode);
+            }
+
+            if( NULL != p_ptCtx->fEvt )
+            {
+                (*p_ptCtx->fEvt)(p_ptCtx->ptEvtCtx, p_eRes);
+            }
+        }
+    }
+}
+
+static uint32_t eFSP_MSGRX_DmaGetReady(const t_eFSP_MSGRX_Ctx* p_ptCtx)
+{
+    uint32_t l_uCntL;
+
+    /* Counters run in the range [0, 2N) so a full queue can be distinguished from an empty one */
+    l_uCntL = 2u * p_ptCtx->uDmaBuffN;
+
+    return ( ( p_ptCtx->uDmaDoneCnt + l_uCntL ) - p_ptCtx->uDmaConsCnt ) % l_uCntL;
+}
+
+static bool_t eFSP_MSGRX_TimStart(t_eFSP_MSGRX_Ctx* const p_ptCtx, const uint32_t p_uTimeout,
+                                 const bool_t p_bReuseNow)
+{
+    bool_t l_bRes;
+
+    /* A new deadline, the length of the frame must be checked again */
+    p_ptCtx->bFrmTimSized = false;
+
+    if( NULL != p_ptCtx->ptTimW )
+    {
+        l_bRes = ( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(p_ptCtx->ptTimW, &p_ptCtx->tTimNode, p_uTimeout) );
+    }
+    else if( NULL == p_ptCtx->fTimNow )
+    {
+        l_bRes = p_ptCtx->tRxTim.fTimStart(p_ptCtx->tRxTim.ptTimCtx, p_uTimeout);
+    }
+    else
+    {
+        /* The restart after a check of the remaining time reuse the same sample of the clock */
+        if( true == p_bReuseNow )
+        {
+            l_bRes = true;
+        }
+        else
+        {
+            l_bRes = (*p_ptCtx->fTimNow)(p_ptCtx->tRxTim.ptTimCtx, &p_ptCtx->uNowMs);
+        }
+
+        if( true == l_bRes )
+        {
+            p_ptCtx->uDeadlineMs = p_ptCtx->uNowMs + p_uTimeout;
+            p_ptCtx->uArmedMs = p_uTimeout;
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGRX_TimGetRemain(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint32_t* const p_puRemain)
+{
+    bool_t l_bRes;
+    uint32_t l_uToDeadline;
+
+    if( NULL != p_ptCtx->ptTimW )
+    {
+        l_bRes = ( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(p_ptCtx->ptTimW, &p_ptCtx->tTimNode, p_puRemain) );
+    }
+    else if( NULL == p_ptCtx->fTimNow )
+    {
+        l_bRes = p_ptCtx->tRxTim.fTimGetRemain(p_ptCtx->tRxTim.ptTimCtx, p_puRemain);
+    }
+    else
+    {
+        l_bRes = (*p_ptCtx->fTimNow)(p_ptCtx->tRxTim.ptTimCtx, &p_ptCtx->uNowMs);
+        if( true == l_bRes )
+        {
+            /* The remaining time can never be greater than the armed timeout, so a bigger value means that the clock
+             * has already passed the deadline. This also handle the wrap around of the clock */
+            l_uToDeadline = p_ptCtx->uDeadlineMs - p_ptCtx->uNowMs;
+            if( l_uToDeadline <= p_ptCtx->uArmedMs )
+            {
+                *p_puRemain = l_uToDeadline;
+            }
+            else
+            {
+                *p_puRemain = 0u;
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static uint32_t eFSP_MSGRX_CalcLineTim(const t_eFSP_MSGRX_Ctx* p_ptCtx, const uint32_t p_uByteN)
+{
+    uint32_t l_uTime;
+    uint32_t l_uQuot;
+    uint32_t l_uRem;
+
+    /* Time on the line rounded up, saturated to the constant timeout */
+    l_uQuot = p_uByteN / p_ptCtx->uLineRate;
+    l_uRem = p_uByteN % p_ptCtx->uLineRate;
+
+    if( l_uQuot > ( p_ptCtx->uTimeoutMs / 1000u ) )
+    {
+        l_uTime = p_ptCtx->uTimeoutMs;
+    }
+    else
+    {
+        l_uTime = ( l_uQuot * 1000u ) + ( ( l_uRem * 1000u ) / p_ptCtx->uLineRate );
+        if( 0u != ( ( l_uRem * 1000u ) % p_ptCtx->uLineRate ) )
+        {
+            l_uTime++;
+        }
+
+        if( ( l_uTime >= p_ptCtx->uTimeoutMs ) || ( p_ptCtx->uLineMarginMs >= ( p_ptCtx->uTimeoutMs - l_uTime ) ) )
+        {
+            l_uTime = p_ptCtx->uTimeoutMs;
+        }
+        else
+        {
+            l_uTime += p_ptCtx->uLineMarginMs;
+        }
+    }
+
+    return l_uTime;
+}
+
+static e_eFSP_MSGRX_RES eFSP_MSGRX_SizeFrameTim(t_eFSP_MSGRX_Ctx* const p_ptCtx, uint32_t* const p_puRemainT)
+{
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsKnown;
+    uint32_t l_uDeclaredL;
+    uint32_t l_uMissingL;
+    uint32_t l_uCurRemT;
+    uint32_t l_uFrameT;
+
+    l_eRes = e_eFSP_MSGRX_RES_OK;
+
+    /* Only once per frame, and only if the line rate is known */
+    if( ( 0u != p_ptCtx->uLineRate ) && ( false == p_ptCtx->bFrmTimSized ) )
+    {
+        l_bIsKnown = false;
+        l_uDeclaredL = 0u;
+        l_eResMsgD = eFSP_MSGD_GetDeclaredLen(&p_ptCtx->tMsgdCtx, &l_bIsKnown, &l_uDeclaredL);
+        l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+        if( ( e_eFSP_MSGRX_RES_OK == l_eRes ) && ( true == l_bIsKnown ) )
+        {
+            /* Header is in, how many raw byte are missing? */
+            l_uMissingL = 0u;
+            l_eResMsgD = eFSP_MSGD_GetMostEffDatLen(&p_ptCtx->tMsgdCtx, &l_uMissingL);
+            l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+            if( e_eFSP_MSGRX_RES_OK == l_eRes )
+            {
+                l_uCurRemT = 0u;
+                if( true != eFSP_MSGRX_TimGetRemain(p_ptCtx, &l_uCurRemT) )
+                {
+                    l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                }
+                else
+                {
+                    if( EFSP_FRM_COBS == p_ptCtx->tMsgdCtx.uFrm )
+                    {
+                        /* Worst case a code byte every EFSP_COBS_MAXBLOCK missing byte, plus the last one */
+                        if( l_uMissingL > ( MAX_UINT32VAL - ( l_uMissingL / EFSP_COBS_MAXBLOCK ) - 1u ) )
+                        {
+                            l_uFrameT = eFSP_MSGRX_CalcLineTim(p_ptCtx, MAX_UINT32VAL);
+                        }
+                        else
+                        {
+                            l_uFrameT = eFSP_MSGRX_CalcLineTim(p_ptCtx,
+                                                              ( l_uMissingL + ( l_uMissingL / EFSP_COBS_MAXBLOCK ) + 1u ) );
+                        }
+                    }
+                    else if( EFSP_FRM_TRSP == p_ptCtx->tMsgdCtx.uFrm )
+                    {
+                        /* The header is in and the payload is not escaped */
+                        l_uFrameT = eFSP_MSGRX_CalcLineTim(p_ptCtx, l_uMissingL);
+                    }
+                    else
+                    {
+                        /* Worst case every missing byte is escaped */
+                        if( l_uMissingL > ( MAX_UINT32VAL / 2u ) )
+                        {
+                            l_uFrameT = eFSP_MSGRX_CalcLineTim(p_ptCtx, MAX_UINT32VAL);
+                        }
+                        else
+                        {
+                            l_uFrameT = eFSP_MSGRX_CalcLineTim(p_ptCtx, ( l_uMissingL * 2u ) );
+                        }
+                    }
+
+                    /* The frame timeout can only be shortened */
+                    if( l_uFrameT < l_uCurRemT )
+                    {
+                        if( true == eFSP_MSGRX_TimStart(p_ptCtx, l_uFrameT, true) )
+                        {
+                            *p_puRemainT = l_uFrameT;
+                        }
+                        else
+                        {
+                            l_eRes = e_eFSP_MSGRX_RES_TIMCLBKERROR;
+                        }
+                    }
+
+                    p_ptCtx->bFrmTimSized = true;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MSGRX_RES eFSP_MSGRX_RelCredit(t_eFSP_MSGRX_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_MSGRX_RES l_eRes;
+	e_eFSP_MSGD_RES l_eResMsgD;
+    bool_t l_bIsMsgDec;
+    uint32_t l_uMsgL;
+
+    /* Only a frame received entirely is given back, a restarted frame is counted once by the transmitter */
+    l_bIsMsgDec = false;
+    l_eResMsgD = eFSP_MSGD_IsAFullMsgDecoded(&p_ptCtx->tMsgdCtx, &l_bIsMsgDec);
+    l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+    if( ( e_eFSP_MSGRX_RES_OK == l_eRes ) && ( true == l_bIsMsgDec ) )
+    {
+        l_uMsgL = 0u;
+        l_eResMsgD = eFSP_MSGD_GetDecodedLen(&p_ptCtx->tMsgdCtx, &l_uMsgL);
+        l_eRes = eFSP_MSGRX_ConvertRetFromMSGD(l_eResMsgD);
+
+        if( e_eFSP_MSGRX_RES_OK == l_eRes )
+        {
+            p_ptCtx->uRelFrames++;
+            p_ptCtx->uRelBytes += l_uMsgL;
+        }
+    }
+
+    return l_eRes;
 }
\ No newline at end of file
@@ -20,6 +20,19 @@
  **********************************************************************************************************************/
 static bool_t eFSP_MSGTX_IsStatusStillCoherent(const t_eFSP_MSGTX_Ctx* p_ptCtx);
 static e_eFSP_MSGTX_RES eFSP_MSGTX_ConvertRetFromMSGE(e_eFSP_MSGE_RES p_eRetEvent);
+static e_eFSP_MSGTX_RES eFSP_MSGTX_ChkFrameTim(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+static void eFSP_MSGTX_NotifyEvt(t_eFSP_MSGTX_Ctx* const p_ptCtx, const e_eFSP_MSGTX_RES p_eRes);
+static bool_t eFSP_MSGTX_TimStart(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uTimeout);
+static bool_t eFSP_MSGTX_TimGetRemain(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint32_t* const p_puRemain);
+static uint32_t eFSP_MSGTX_CalcLineTim(const t_eFSP_MSGTX_Ctx* p_ptCtx, const uint32_t p_uByteN);
+static uint32_t eFSP_MSGTX_GetFrameTim(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+static e_eFSP_MSGTX_RES eFSP_MSGTX_FillRing(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+static bool_t eFSP_MSGTX_PaceRefill(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+static e_eFSP_MSGE_RES eFSP_MSGTX_GetEncChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                              const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL);
+static e_eFSP_MSGE_RES eFSP_MSGTX_GetRemByteToGet(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint32_t* const p_puRemL);
+static e_eFSP_MSGTX_RES eFSP_MSGTX_ReattachShared(t_eFSP_MSGTX_Ctx* const p_ptCtx);
+static void eFSP_MSGTX_DetachShared(t_eFSP_MSGTX_Ctx* const p_ptCtx);
 
 
 
@@ -70,6 +83,34 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_InitCtx(t_eFSP_MSGTX_Ctx* const p_ptCtx, const t_eFS
                 p_ptCtx->tTxTim =  p_ptInitData->tITxTim;
                 p_ptCtx->uTimeoutMs = p_ptInitData->uITimeoutMs;
                 p_ptCtx->uTimePerSendMs = p_ptInitData->uITimePerSendMs;
+                p_ptCtx->fEvt = NULL;
+                p_ptCtx->ptEvtCtx = NULL;
+                p_ptCtx->bEvtPend = false;
+                p_ptCtx->ptRing = NULL;
+                p_ptCtx->fTimNow = NULL;
+                p_ptCtx->uNowMs = 0u;
+                p_ptCtx->uDeadlineMs = 0u;
+                p_ptCtx->uArmedMs = 0u;
+                p_ptCtx->ptTimW = NULL;
+                (void)eFSP_TIMW_InitNode(&p_ptCtx->tTimNode, 0u);
+                p_ptCtx->uLineRate = 0u;
+                p_ptCtx->uLineMarginMs = 0u;
+                p_ptCtx->bCreditOn = false;
+                p_ptCtx->uCredFrameLim = 0u;
+                p_ptCtx->uCredByteLim = 0u;
+                p_ptCtx->uSentFrames = 0u;
+                p_ptCtx->uSentBytes = 0u;
+                p_ptCtx->uPaceRate = 0u;
+                p_ptCtx->uPaceBurst = 0u;
+                p_ptCtx->uPaceTokens = 0u;
+                p_ptCtx->uPaceFrac = 0u;
+                p_ptCtx->uPaceLastMs = 0u;
+                p_ptCtx->ptFout = NULL;
+                p_ptCtx->puShFrame = NULL;
+                p_ptCtx->uShFrameL = 0u;
+                p_ptCtx->uShCntr = 0u;
+                p_ptCtx->uShGen = 0u;
+                p_ptCtx->bShHeld = false;
 
                 /* initialize internal message encoder */
                 l_eResMsgE =  eFSP_MSGE_InitCtx(&p_ptCtx->tMsgeCtx, p_ptInitData->puIMemArea, p_ptInitData->uIMemAreaL,
@@ -157,11 +198,20 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_NewMessage(t_eFSP_MSGTX_Ctx* const p_ptCtx, const ui
             {
                 l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
             }
+            else if( ( true == p_ptCtx->bCreditOn ) &&
+                     ( ( p_ptCtx->uCredFrameLim == p_ptCtx->uSentFrames ) ||
+                       ( ( p_ptCtx->uCredByteLim - p_ptCtx->uSentBytes ) < p_uMsgL ) ) )
+            {
+                /* The receiver can not accept this frame now, the current message is left untouched */
+                l_eRes = e_eFSP_MSGTX_RES_NOCREDIT;
+            }
             else
             {
-                /* Reset internal variable */
+                /* Reset internal variable, a shared frame is not sent anymore */
                 p_ptCtx->uTxBuffCntr = 0u;
                 p_ptCtx->uTxBuffFill = 0u;
+                eFSP_MSGTX_DetachShared(p_ptCtx);
+                p_ptCtx->ptFout = NULL;
 
                 /* Init message encoder */
                 l_eResMsgE = eFSP_MSGE_NewMessage(&p_ptCtx->tMsgeCtx, p_uMsgL);
@@ -170,10 +220,114 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_NewMessage(t_eFSP_MSGTX_Ctx* const p_ptCtx, const ui
                 /* Start timer */
                 if( e_eFSP_MSGTX_RES_OK == l_eRes )
                 {
-                    if( true != p_ptCtx->tTxTim.fTimStart( p_ptCtx->tTxTim.ptTimCtx, p_ptCtx->uTimeoutMs ) )
+                    /* The frame is counted even without credit flow control, so it can be enabled at any time */
+                    p_ptCtx->uSentFrames++;
+                    p_ptCtx->uSentBytes += p_uMsgL;
+
+                    if( true != eFSP_MSGTX_TimStart(p_ptCtx, eFSP_MSGTX_GetFrameTim(p_ptCtx)) )
+                    {
+                        l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                    }
+                    else
+                    {
+                        /* A new message is started, notify it's end only once */
+                        p_ptCtx->bEvtPend = true;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_NewShared(t_eFSP_MSGTX_Ctx* const p_ptCtx, t_eFSP_FOUT_Ctx* const p_ptFout)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+	e_eFSP_FOUT_RES l_eResFout;
+    bool_t l_bIsInit;
+    const uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uMsgL;
+    uint32_t l_uGen;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptFout ) )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( true != l_bIsInit ) )
+            {
+                l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+            }
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                /* Take the new reference before releasing the old one, the two frames can be the same */
+                l_puFrame = NULL;
+                l_uFrameL = 0u;
+                l_uMsgL = 0u;
+                l_uGen = 0u;
+                l_eResFout = eFSP_FOUT_Attach(p_ptFout, &l_puFrame, &l_uFrameL, &l_uMsgL, &l_uGen);
+
+                if( e_eFSP_FOUT_RES_NOINITMESSAGE == l_eResFout )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITMESSAGE;
+                }
+                else if( e_eFSP_FOUT_RES_OK != l_eResFout )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                }
+                else if( ( true == p_ptCtx->bCreditOn ) &&
+                         ( ( p_ptCtx->uCredFrameLim == p_ptCtx->uSentFrames ) ||
+                           ( ( p_ptCtx->uCredByteLim - p_ptCtx->uSentBytes ) < l_uMsgL ) ) )
+                {
+                    /* The receiver can not accept this frame now, the current message is left untouched */
+                    (void)eFSP_FOUT_Detach(p_ptFout);
+                    l_eRes = e_eFSP_MSGTX_RES_NOCREDIT;
+                }
+                else
+                {
+                    /* Reset internal variable */
+                    p_ptCtx->uTxBuffCntr = 0u;
+                    p_ptCtx->uTxBuffFill = 0u;
+                    eFSP_MSGTX_DetachShared(p_ptCtx);
+                    p_ptCtx->ptFout = p_ptFout;
+                    p_ptCtx->puShFrame = l_puFrame;
+                    p_ptCtx->uShFrameL = l_uFrameL;
+                    p_ptCtx->uShCntr = 0u;
+                    p_ptCtx->uShGen = l_uGen;
+                    p_ptCtx->bShHeld = true;
+
+                    /* Credit is counted on the payload, as for a message encoded here */
+                    p_ptCtx->uSentFrames++;
+                    p_ptCtx->uSentBytes += l_uMsgL;
+
+                    if( true != eFSP_MSGTX_TimStart(p_ptCtx, eFSP_MSGTX_GetFrameTim(p_ptCtx)) )
                     {
                         l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
                     }
+                    else
+                    {
+                        /* A new message is started, notify it's end only once */
+                        p_ptCtx->bEvtPend = true;
+                    }
                 }
             }
 		}
@@ -206,17 +360,30 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_RestartMessage(t_eFSP_MSGTX_Ctx* const p_ptCtx)
             p_ptCtx->uTxBuffCntr = 0u;
             p_ptCtx->uTxBuffFill = 0u;
 
-			/* Restart only the byte stuffer */
-			l_eResMsgE = eFSP_MSGE_RestartMessage(&p_ptCtx->tMsgeCtx);
-			l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+            if( NULL == p_ptCtx->ptFout )
+            {
+                /* Restart only the byte stuffer */
+                l_eResMsgE = eFSP_MSGE_RestartMessage(&p_ptCtx->tMsgeCtx);
+                l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+            }
+            else
+            {
+                /* The shared frame is already encoded, restart only the cursor */
+                l_eRes = eFSP_MSGTX_ReattachShared(p_ptCtx);
+            }
 
             /* Start timer */
             if( e_eFSP_MSGTX_RES_OK == l_eRes )
             {
-                if( true != p_ptCtx->tTxTim.fTimStart( p_ptCtx->tTxTim.ptTimCtx, p_ptCtx->uTimeoutMs ) )
+                if( true != eFSP_MSGTX_TimStart(p_ptCtx, eFSP_MSGTX_GetFrameTim(p_ptCtx)) )
                 {
                     l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
                 }
+                else
+                {
+                    /* The message is restarted, notify it's end only once */
+                    p_ptCtx->bEvtPend = true;
+                }
             }
 		}
 	}
@@ -303,7 +470,7 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                     case e_eFSP_MSGTXPRV_SM_CHECKINITTIMEOUT:
                     {
                         /* Check if frame timeout is eplased */
-                        if( true == p_ptCtx->tTxTim.fTimGetRemain(p_ptCtx->tTxTim.ptTimCtx, &l_uSRemainTxT) )
+                        if( true == eFSP_MSGTX_TimGetRemain(p_ptCtx, &l_uSRemainTxT) )
                         {
                             if( l_uSRemainTxT <= 0u )
                             {
@@ -325,8 +492,26 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                                     l_uSesRem = l_uSRemainTxT;
                                 }
 
-                                /* check if we have some data to send in TX buffer */
-                                l_eSM = e_eFSP_MSGTXPRV_SM_CHECKIFBUFFERTX;
+                                if( NULL == p_ptCtx->ptRing )
+                                {
+                                    /* Add the tokens earned since the last session */
+                                    if( true == eFSP_MSGTX_PaceRefill(p_ptCtx) )
+                                    {
+                                        /* check if we have some data to send in TX buffer */
+                                        l_eSM = e_eFSP_MSGTXPRV_SM_CHECKIFBUFFERTX;
+                                    }
+                                    else
+                                    {
+                                        /* Some error on clock */
+                                        l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                                        l_eSM = e_eFSP_MSGTXPRV_SM_ELABDONE;
+                                    }
+                                }
+                                else
+                                {
+                                    /* Top up the TX ring */
+                                    l_eSM = e_eFSP_MSGTXPRV_SM_FILLRING;
+                                }
                             }
                         }
                         else
@@ -366,8 +551,8 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                         p_ptCtx->uTxBuffFill = 0u;
 
                         /* Is data present in message encoder buffer? */
-                        l_eResMsgE = eFSP_MSGE_GetEncChunk(&p_ptCtx->tMsgeCtx, p_ptCtx->puRxBuff, p_ptCtx->uTxBuffL,
-                                                        &p_ptCtx->uTxBuffFill);
+                        l_eResMsgE = eFSP_MSGTX_GetEncChunk(p_ptCtx, p_ptCtx->puRxBuff, p_ptCtx->uTxBuffL,
+                                                            &p_ptCtx->uTxBuffFill);
                         l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
 
                         if( e_eFSP_MSGTX_RES_OK == l_eRes )
@@ -407,8 +592,20 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                         l_puCDToTx = &p_ptCtx->puRxBuff[p_ptCtx->uTxBuffCntr];
                         l_uCDToTxL = p_ptCtx->uTxBuffFill - p_ptCtx->uTxBuffCntr;
 
-                        /* Can send data from send buffer */
-                        if( true == (*p_ptCtx->fTx)(p_ptCtx->ptTxCtx, l_puCDToTx, l_uCDToTxL, &l_uCDTxed, l_uSesRem) )
+                        /* Send only the bytes we have tokens for */
+                        if( ( 0u != p_ptCtx->uPaceRate ) && ( l_uCDToTxL > p_ptCtx->uPaceTokens ) )
+                        {
+                            l_uCDToTxL = p_ptCtx->uPaceTokens;
+                        }
+
+                        if( 0u == l_uCDToTxL )
+                        {
+                            /* Bucket empty, retry later */
+                            l_eRes = e_eFSP_MSGTX_RES_OK;
+                            l_eSM = e_eFSP_MSGTXPRV_SM_ELABDONE;
+                        }
+                        else if( true == (*p_ptCtx->fTx)(p_ptCtx->ptTxCtx, l_puCDToTx, l_uCDToTxL, &l_uCDTxed,
+                                                         l_uSesRem) )
                         {
                             /* Check for some strangeness */
                             if( l_uCDTxed > l_uCDToTxL )
@@ -420,9 +617,23 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                             {
                                 /* Update sended counter */
                                 p_ptCtx->uTxBuffCntr += l_uCDTxed;
+                                if( 0u != p_ptCtx->uPaceRate )
+                                {
+                                    p_ptCtx->uPaceTokens -= l_uCDTxed;
+                                }
 
-                                /* Check if time is elapsed */
-                                l_eSM = e_eFSP_MSGTXPRV_SM_CHECKTIMEOUTAFTERTX;
+                                if( ( 0u == l_uCDTxed ) && ( NULL != p_ptCtx->ptTimW ) )
+                                {
+                                    /* Nothing sent, and the wheel time moves only in eFSP_TIMW_Advance, so waiting
+                                     * here can never end the session. The timeout is checked in the next call */
+                                    l_eRes = e_eFSP_MSGTX_RES_OK;
+                                    l_eSM = e_eFSP_MSGTXPRV_SM_ELABDONE;
+                                }
+                                else
+                                {
+                                    /* Check if time is elapsed */
+                                    l_eSM = e_eFSP_MSGTXPRV_SM_CHECKTIMEOUTAFTERTX;
+                                }
                             }
                         }
                         else
@@ -437,7 +648,7 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                     case e_eFSP_MSGTXPRV_SM_CHECKTIMEOUTAFTERTX:
                     {
                         /* Check if frame timeout is eplased */
-                        if( true == p_ptCtx->tTxTim.fTimGetRemain(p_ptCtx->tTxTim.ptTimCtx, &l_uCRemainTxT) )
+                        if( true == eFSP_MSGTX_TimGetRemain(p_ptCtx, &l_uCRemainTxT) )
                         {
                             /* Check time validity */
                             if( l_uCRemainTxT > l_uSRemainTxT )
@@ -499,6 +710,14 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                         break;
                     }
 
+                    case e_eFSP_MSGTXPRV_SM_FILLRING:
+                    {
+                        /* Encode directly in the ring, never wait the consumer */
+                        l_eRes = eFSP_MSGTX_FillRing(p_ptCtx);
+                        l_eSM = e_eFSP_MSGTXPRV_SM_ELABDONE;
+                        break;
+                    }
+
                     default:
                     {
                         /* Impossible end here */
@@ -508,97 +727,1062 @@ e_eFSP_MSGTX_RES eFSP_MSGTX_SendChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx)
                     }
                 }
             }
+
+            /* Notify the end of the message if needed */
+            eFSP_MSGTX_NotifyEvt(p_ptCtx, l_eRes);
         }
 	}
 
 	return l_eRes;
 }
 
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetEvtCb(t_eFSP_MSGTX_Ctx* const p_ptCtx, f_eFSP_MSGTX_EvtCb p_fEvt,
+                                     t_eFSP_MSGTX_EvtCtx* const p_ptEvtCtx)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity, callback and context must be both valid or both NULL */
+	if( ( NULL == p_ptCtx ) || ( ( NULL == p_fEvt ) != ( NULL == p_ptEvtCtx ) ) )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
 
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true == l_bIsInit )
+                {
+                    p_ptCtx->fEvt = p_fEvt;
+                    p_ptCtx->ptEvtCtx = p_ptEvtCtx;
+                }
+                else
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+            }
+		}
+	}
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSP_MSGTX_IsStatusStillCoherent(const t_eFSP_MSGTX_Ctx* p_ptCtx)
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_GetChunkToSend(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint8_t** p_ppuData,
+                                           uint32_t* const p_puDataL)
 {
-    bool_t l_eRes;
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx->puRxBuff ) || ( NULL == p_ptCtx->fTx ) || ( NULL == p_ptCtx->ptTxCtx ) ||
-        ( NULL == p_ptCtx->tTxTim.ptTimCtx ) || ( NULL == p_ptCtx->tTxTim.fTimStart ) ||
-        ( NULL == p_ptCtx->tTxTim.fTimGetRemain ) )
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puDataL ) )
 	{
-		l_eRes = false;
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
 	}
 	else
 	{
-        /* Check send buffer validity */
-        if( p_ptCtx->uTxBuffL < 1u )
-        {
-            l_eRes =  false;
-        }
-        else
-        {
-            /* Check send buffer validity */
-            if( ( p_ptCtx->uTxBuffFill > p_ptCtx->uTxBuffL )  || ( p_ptCtx->uTxBuffCntr > p_ptCtx->uTxBuffFill ) )
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            l_eRes = e_eFSP_MSGTX_RES_OK;
+
+            if( p_ptCtx->uTxBuffFill <= p_ptCtx->uTxBuffCntr )
             {
-                l_eRes =  false;
+                /* The send buffer is empty, need to load remainings data */
+                p_ptCtx->uTxBuffCntr = 0u;
+                p_ptCtx->uTxBuffFill = 0u;
+
+                l_eResMsgE = eFSP_MSGTX_GetEncChunk(p_ptCtx, p_ptCtx->puRxBuff, p_ptCtx->uTxBuffL,
+                                                    &p_ptCtx->uTxBuffFill);
+                l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+                if( ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes ) && ( p_ptCtx->uTxBuffFill > 0u ) )
+                {
+                    /* Retrived the last part of the message, that still need to be sended */
+                    l_eRes = e_eFSP_MSGTX_RES_OK;
+                }
+            }
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                *p_ppuData = &p_ptCtx->puRxBuff[p_ptCtx->uTxBuffCntr];
+                *p_puDataL = p_ptCtx->uTxBuffFill - p_ptCtx->uTxBuffCntr;
             }
             else
             {
-                /* Check timings validity */
-                if( ( p_ptCtx->uTimeoutMs < 1u ) || ( p_ptCtx->uTimePerSendMs < 1u ) )
+                *p_puDataL = 0u;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_NotifySent(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uSentL)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    uint32_t l_uRemToGet;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( true != l_bIsInit ) )
+            {
+                l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+            }
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                /* A message must be started, the encoder report it as for eFSP_MSGTX_GetChunkToSend */
+                l_uRemToGet = 0u;
+                l_eResMsgE = eFSP_MSGTX_GetRemByteToGet(p_ptCtx, &l_uRemToGet);
+                l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+            }
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                /* The driver can not have sended more data than what we gave to it */
+                if( p_uSentL > ( p_ptCtx->uTxBuffFill - p_ptCtx->uTxBuffCntr ) )
                 {
-                    l_eRes = false;
+                    l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
                 }
                 else
                 {
-                    /* Check timings validity */
-                    if( p_ptCtx->uTimePerSendMs > p_ptCtx->uTimeoutMs )
+                    /* Update sended counter */
+                    p_ptCtx->uTxBuffCntr += p_uSentL;
+
+                    /* Is the whole message sended? */
+                    if( ( 0u == l_uRemToGet ) && ( p_ptCtx->uTxBuffCntr >= p_ptCtx->uTxBuffFill ) )
                     {
-                        l_eRes = false;
+                        /* Nothing more to retrive or to send */
+                        l_eRes = e_eFSP_MSGTX_RES_MESSAGESENDED;
                     }
                     else
                     {
-                        l_eRes = true;
+                        /* Still sending, check frame timeout */
+                        l_eRes = eFSP_MSGTX_ChkFrameTim(p_ptCtx);
                     }
+
+                    /* Notify the end of the message if needed */
+                    eFSP_MSGTX_NotifyEvt(p_ptCtx, l_eRes);
                 }
             }
-        }
+		}
 	}
 
-    return l_eRes;
+	return l_eRes;
 }
 
-static e_eFSP_MSGTX_RES eFSP_MSGTX_ConvertRetFromMSGE(e_eFSP_MSGE_RES p_eRetEvent)
+e_eFSP_MSGTX_RES eFSP_MSGTX_CheckTimeout(t_eFSP_MSGTX_Ctx* const p_ptCtx)
 {
+	/* Local variable */
 	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
 
-	switch( p_eRetEvent )
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
 	{
-		case e_eFSP_MSGE_RES_OK:
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
 		{
-			l_eRes = e_eFSP_MSGTX_RES_OK;
-            break;
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
 		}
-
-		case e_eFSP_MSGE_RES_BADPARAM:
+		else
 		{
-			l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
-            break;
-		}
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
 
-		case e_eFSP_MSGE_RES_BADPOINTER:
-		{
-			l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
-            break;
-		}
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( true == p_ptCtx->bEvtPend )
+                {
+                    /* A message is ongoing, check it's timeout */
+                    l_eRes = eFSP_MSGTX_ChkFrameTim(p_ptCtx);
 
-		case e_eFSP_MSGE_RES_CORRUPTCTX:
-		{
-			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
-            break;
-		}
+                    /* Notify the end of the message if needed */
+                    eFSP_MSGTX_NotifyEvt(p_ptCtx, l_eRes);
+                }
+                else
+                {
+                    /* No message ongoing, nothing to check */
+                    l_eRes = e_eFSP_MSGTX_RES_OK;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetRingDst(t_eFSP_MSGTX_Ctx* const p_ptCtx, t_eFSP_SPSCR_Ctx* const p_ptRing)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+    bool_t l_bIsRingInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( NULL == p_ptRing )
+                {
+                    /* Use the TX callback again */
+                    p_ptCtx->ptRing = NULL;
+                }
+                else
+                {
+                    /* The ring must be already initialized */
+                    l_bIsRingInit = false;
+                    if( ( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_IsInit(p_ptRing, &l_bIsRingInit) ) &&
+                        ( true == l_bIsRingInit ) )
+                    {
+                        p_ptCtx->ptRing = p_ptRing;
+                    }
+                    else
+                    {
+                        l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetClock(t_eFSP_MSGTX_Ctx* const p_ptCtx, f_eFSP_MSGTX_TimGetNow p_fNow)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+    uint32_t l_uRemain;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else
+                {
+                    /* Move the ongoing timeout to the new time source */
+                    l_uRemain = 0u;
+                    if( true != eFSP_MSGTX_TimGetRemain(p_ptCtx, &l_uRemain) )
+                    {
+                        l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                    }
+                    else if( NULL == p_fNow )
+                    {
+                        /* Pacing can not work without the clock */
+                        p_ptCtx->fTimNow = NULL;
+                        p_ptCtx->uPaceRate = 0u;
+                        /* With a timer wheel the timer call backs are not used */
+                        if( ( NULL == p_ptCtx->ptTimW ) &&
+                            ( true != p_ptCtx->tTxTim.fTimStart(p_ptCtx->tTxTim.ptTimCtx, l_uRemain) ) )
+                        {
+                            l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                        }
+                    }
+                    else
+                    {
+                        if( true == (*p_fNow)(p_ptCtx->tTxTim.ptTimCtx, &p_ptCtx->uNowMs) )
+                        {
+                            p_ptCtx->fTimNow = p_fNow;
+                            p_ptCtx->uDeadlineMs = p_ptCtx->uNowMs + l_uRemain;
+                            p_ptCtx->uArmedMs = l_uRemain;
+                            p_ptCtx->uPaceLastMs = p_ptCtx->uNowMs;
+                        }
+                        else
+                        {
+                            l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetTimerWheel(t_eFSP_MSGTX_Ctx* const p_ptCtx, t_eFSP_TIMW_Ctx* const p_ptTimW,
+                                           const uint32_t p_uId)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+    bool_t l_bIsTimWInit;
+    uint32_t l_uRemain;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                /* The wheel must be already initialized */
+                l_bIsTimWInit = false;
+                if( NULL != p_ptTimW )
+                {
+                    (void)eFSP_TIMW_IsInit(p_ptTimW, &l_bIsTimWInit);
+                }
+
+                l_uRemain = 0u;
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( ( NULL != p_ptTimW ) && ( true != l_bIsTimWInit ) )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                }
+                else if( true != eFSP_MSGTX_TimGetRemain(p_ptCtx, &l_uRemain) )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                }
+                else
+                {
+                    /* Leave the previous wheel */
+                    if( NULL != p_ptCtx->ptTimW )
+                    {
+                        (void)eFSP_TIMW_Cancel(p_ptCtx->ptTimW, &p_ptCtx->tTimNode);
+                    }
+
+                    p_ptCtx->ptTimW = p_ptTimW;
+                    if( NULL != p_ptTimW )
+                    {
+                        (void)eFSP_TIMW_InitNode(&p_ptCtx->tTimNode, p_uId);
+                    }
+
+                    /* Move the ongoing timeout to the new time source */
+                    if( true == p_ptCtx->bEvtPend )
+                    {
+                        if( true != eFSP_MSGTX_TimStart(p_ptCtx, l_uRemain) )
+                        {
+                            l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetLineRate(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uLineRate,
+                                         const uint32_t p_uMarginMs)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( p_uLineRate > ( MAX_UINT32VAL / 1000u ) )
+                {
+                    /* The remainder of the division by the rate must be convertible in ms */
+                    l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->uLineRate = p_uLineRate;
+                    p_ptCtx->uLineMarginMs = p_uMarginMs;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetTimeout(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uTimeoutMs)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( ( p_uTimeoutMs < 1u ) || ( p_uTimeoutMs < p_ptCtx->uTimePerSendMs ) )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                }
+                else
+                {
+                    /* The running deadline is not touched, the new value is used when the timer is started again */
+                    p_ptCtx->uTimeoutMs = p_uTimeoutMs;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetCreditLimit(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uFrameLim,
+                                           const uint32_t p_uByteLim)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+    uint32_t l_uFrameLim;
+    uint32_t l_uByteLim;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else
+                {
+                    /* Keep the newest limits, an old grant can arrive after a new one */
+                    l_uFrameLim = p_uFrameLim;
+                    l_uByteLim = p_uByteLim;
+
+                    if( true == p_ptCtx->bCreditOn )
+                    {
+                        if( ( l_uFrameLim - p_ptCtx->uCredFrameLim ) > EFSP_MSGTX_MAXCREDIT )
+                        {
+                            l_uFrameLim = p_ptCtx->uCredFrameLim;
+                        }
+
+                        if( ( l_uByteLim - p_ptCtx->uCredByteLim ) > EFSP_MSGTX_MAXCREDIT )
+                        {
+                            l_uByteLim = p_ptCtx->uCredByteLim;
+                        }
+                    }
+
+                    if( ( ( l_uFrameLim - p_ptCtx->uSentFrames ) > EFSP_MSGTX_MAXCREDIT ) ||
+                        ( ( l_uByteLim - p_ptCtx->uSentBytes ) > EFSP_MSGTX_MAXCREDIT ) )
+                    {
+                        l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        p_ptCtx->uCredFrameLim = l_uFrameLim;
+                        p_ptCtx->uCredByteLim = l_uByteLim;
+                        p_ptCtx->bCreditOn = true;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_GetCredit(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint32_t* const p_puFrames,
+                                      uint32_t* const p_puBytes)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrames ) || ( NULL == p_puBytes ) )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( true == p_ptCtx->bCreditOn )
+                {
+                    *p_puFrames = p_ptCtx->uCredFrameLim - p_ptCtx->uSentFrames;
+                    *p_puBytes = p_ptCtx->uCredByteLim - p_ptCtx->uSentBytes;
+                }
+                else
+                {
+                    *p_puFrames = EFSP_MSGTX_MAXCREDIT;
+                    *p_puBytes = EFSP_MSGTX_MAXCREDIT;
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetPacing(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uRate,
+                                      const uint32_t p_uBurst)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* Check if lib is initialized */
+            l_bIsInit = false;
+            l_eResMsgE = eFSP_MSGE_IsInit(&p_ptCtx->tMsgeCtx, &l_bIsInit);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( e_eFSP_MSGTX_RES_OK == l_eRes )
+            {
+                if( true != l_bIsInit )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_NOINITLIB;
+                }
+                else if( 0u == p_uRate )
+                {
+                    p_ptCtx->uPaceRate = 0u;
+                }
+                else if( ( p_uRate > ( MAX_UINT32VAL / 1000u ) ) || ( p_uBurst < 1u ) ||
+                         ( NULL == p_ptCtx->fTimNow ) )
+                {
+                    /* The remainder of a second must be convertible in tokens */
+                    l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Start with a full bucket */
+                    if( true == (*p_ptCtx->fTimNow)(p_ptCtx->tTxTim.ptTimCtx, &p_ptCtx->uPaceLastMs) )
+                    {
+                        p_ptCtx->uPaceRate = p_uRate;
+                        p_ptCtx->uPaceBurst = p_uBurst;
+                        p_ptCtx->uPaceTokens = p_uBurst;
+                        p_ptCtx->uPaceFrac = 0u;
+                    }
+                    else
+                    {
+                        l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetHeader(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uCrcL, const uint32_t p_uLenL)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The profile is used by the message encoder */
+            l_eResMsgE = eFSP_MSGE_SetHeader(&p_ptCtx->tMsgeCtx, p_uCrcL, p_uLenL);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetFraming(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uFrm)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The engine is used by the message encoder */
+            l_eResMsgE = eFSP_MSGE_SetFraming(&p_ptCtx->tMsgeCtx, p_uFrm);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetWhitening(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uWhtL)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The whitening is done by the message encoder */
+            l_eResMsgE = eFSP_MSGE_SetWhitening(&p_ptCtx->tMsgeCtx, p_uWhtL);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetCompression(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uCmpL)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The compression is done by the message encoder */
+            l_eResMsgE = eFSP_MSGE_SetCompression(&p_ptCtx->tMsgeCtx, p_uCmpL);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetDelta(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint8_t* p_puBase, const uint32_t p_uBaseL,
+                                     const uint32_t p_uKeyN)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The delta frames are encoded by the message encoder */
+            l_eResMsgE = eFSP_MSGE_SetDelta(&p_ptCtx->tMsgeCtx, p_puBase, p_uBaseL, p_uKeyN);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_ResetDelta(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The next message encoded is a key frame */
+            l_eResMsgE = eFSP_MSGE_ResetDelta(&p_ptCtx->tMsgeCtx);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_MSGTX_SetFec(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uFecL)
+{
+	/* Local variable */
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check internal status validity */
+		if( false == eFSP_MSGTX_IsStatusStillCoherent(p_ptCtx) )
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+		}
+		else
+		{
+            /* The parity is added by the message encoder */
+            l_eResMsgE = eFSP_MSGE_SetFec(&p_ptCtx->tMsgeCtx, p_uFecL);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_MSGTX_IsStatusStillCoherent(const t_eFSP_MSGTX_Ctx* p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->puRxBuff ) || ( NULL == p_ptCtx->fTx ) || ( NULL == p_ptCtx->ptTxCtx ) ||
+        ( NULL == p_ptCtx->tTxTim.ptTimCtx ) || ( NULL == p_ptCtx->tTxTim.fTimStart ) ||
+        ( NULL == p_ptCtx->tTxTim.fTimGetRemain ) )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Check send buffer validity */
+        if( p_ptCtx->uTxBuffL < 1u )
+        {
+            l_eRes =  false;
+        }
+        else
+        {
+            /* Check send buffer validity */
+            if( ( p_ptCtx->uTxBuffFill > p_ptCtx->uTxBuffL )  || ( p_ptCtx->uTxBuffCntr > p_ptCtx->uTxBuffFill ) )
+            {
+                l_eRes =  false;
+            }
+            else
+            {
+                /* Check timings validity */
+                if( ( p_ptCtx->uTimeoutMs < 1u ) || ( p_ptCtx->uTimePerSendMs < 1u ) )
+                {
+                    l_eRes = false;
+                }
+                else
+                {
+                    /* Check timings validity */
+                    if( p_ptCtx->uTimePerSendMs > p_ptCtx->uTimeoutMs )
+                    {
+                        l_eRes = false;
+                    }
+                    else
+                    {
+                        /* Event callback is optional, but callback and context must be coherent */
+                        if( ( NULL == p_ptCtx->fEvt ) != ( NULL == p_ptCtx->ptEvtCtx ) )
+                        {
+                            l_eRes = false;
+                        }
+                        else if( ( true == p_ptCtx->bCreditOn ) &&
+                                 ( ( ( p_ptCtx->uCredFrameLim - p_ptCtx->uSentFrames ) > EFSP_MSGTX_MAXCREDIT ) ||
+                                   ( ( p_ptCtx->uCredByteLim - p_ptCtx->uSentBytes ) > EFSP_MSGTX_MAXCREDIT ) ) )
+                        {
+                            /* Nothing can be sent beyond the credit */
+                            l_eRes = false;
+                        }
+                        else if( ( 0u != p_ptCtx->uPaceRate ) &&
+                                 ( ( NULL == p_ptCtx->fTimNow ) || ( p_ptCtx->uPaceRate > ( MAX_UINT32VAL / 1000u ) ) ||
+                                   ( p_ptCtx->uPaceBurst < 1u ) || ( p_ptCtx->uPaceTokens > p_ptCtx->uPaceBurst ) ||
+                                   ( p_ptCtx->uPaceFrac >= 1000u ) ) )
+                        {
+                            /* Check token bucket validity */
+                            l_eRes = false;
+                        }
+                        else if( ( ( NULL == p_ptCtx->ptFout ) && ( true == p_ptCtx->bShHeld ) ) ||
+                                 ( ( true == p_ptCtx->bShHeld ) &&
+                                   ( ( NULL == p_ptCtx->puShFrame ) ||
+                                     ( p_ptCtx->uShCntr > p_ptCtx->uShFrameL ) ) ) )
+                        {
+                            /* A shared frame is referenced only from its fan-out, the cursor can not pass its end */
+                            l_eRes = false;
+                        }
+                        else
+                        {
+                            l_eRes = true;
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+    return l_eRes;
+}
+
+static e_eFSP_MSGTX_RES eFSP_MSGTX_ConvertRetFromMSGE(e_eFSP_MSGE_RES p_eRetEvent)
+{
+	e_eFSP_MSGTX_RES l_eRes;
+
+	switch( p_eRetEvent )
+	{
+		case e_eFSP_MSGE_RES_OK:
+		{
+			l_eRes = e_eFSP_MSGTX_RES_OK;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_BADPARAM:
+		{
+			l_eRes = e_eFSP_MSGTX_RES_BADPARAM;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_BADPOINTER:
+		{
+			l_eRes = e_eFSP_MSGTX_RES_BADPOINTER;
+            break;
+		}
+
+		case e_eFSP_MSGE_RES_CORRUPTCTX:
+		{
+			l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+            break;
+		}
 
 		case e_eFSP_MSGE_RES_MESSAGEENDED:
 		{
@@ -633,4 +1817,410 @@ static e_eFSP_MSGTX_RES eFSP_MSGTX_ConvertRetFromMSGE(e_eFSP_MSGE_RES p_eRetEven
 	}
 
 	return l_eRes;
-}
\ No newline at end of file
+}
+
+static e_eFSP_MSGTX_RES eFSP_MSGTX_ChkFrameTim(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+	e_eFSP_MSGTX_RES l_eRes;
+    uint32_t l_uRemainTxT;
+
+    /* Check if frame timeout is eplased */
+    l_uRemainTxT = 0u;
+    if( true == eFSP_MSGTX_TimGetRemain(p_ptCtx, &l_uRemainTxT) )
+    {
+        if( l_uRemainTxT <= 0u )
+        {
+            /* Time elapsed */
+            l_eRes = e_eFSP_MSGTX_RES_MESSAGETIMEOUT;
+        }
+        else
+        {
+            l_eRes = e_eFSP_MSGTX_RES_OK;
+        }
+    }
+    else
+    {
+        /* Some error on timer */
+        l_eRes = e_eFSP_MSGTX_RES_TIMCLBKERROR;
+    }
+
+	return l_eRes;
+}
+
+static void eFSP_MSGTX_NotifyEvt(t_eFSP_MSGTX_Ctx* const p_ptCtx, const e_eFSP_MSGTX_RES p_eRes)
+{
+    /* Only final state of a message are notified, and only once */
+    if( ( e_eFSP_MSGTX_RES_MESSAGESENDED == p_eRes ) || ( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == p_eRes ) )
+    {
+        /* The fan-out can encode the next frame as soon as every link is done with the current one */
+        eFSP_MSGTX_DetachShared(p_ptCtx);
+
+        if( true == p_ptCtx->bEvtPend )
+        {
+            p_ptCtx->bEvtPend = false;
+
+            /* The timeout is not needed anymore, the poller must not be woken up for this context */
+            if( NULL != p_ptCtx->ptTimW )
+            {
+                (void)eFSP_TIMW_Cancel(p_ptCtx->ptTimW, &p_ptCtx->tTimNode);
+            }
+
+            if( NULL != p_ptCtx->fEvt )
+            {
+                (*p_ptCtx->fEvt)(p_ptCtx->ptEvtCtx, p_eRes);
+            }
+        }
+    }
+}
+
+static e_eFSP_MSGTX_RES eFSP_MSGTX_FillRing(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+	e_eFSP_MSGTX_RES l_eRes;
+	e_eFSP_MSGE_RES l_eResMsgE;
+    uint8_t* l_puSpan;
+    uint32_t l_uSpanL;
+    uint32_t l_uCDTxed;
+
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    l_uSpanL = 1u;
+
+    /* Data already retrived in the TX buffer must be sended before the new one */
+    if( p_ptCtx->uTxBuffFill > p_ptCtx->uTxBuffCntr )
+    {
+        l_uCDTxed = 0u;
+        if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Push(p_ptCtx->ptRing, &p_ptCtx->puRxBuff[p_ptCtx->uTxBuffCntr],
+                                                   ( p_ptCtx->uTxBuffFill - p_ptCtx->uTxBuffCntr ), &l_uCDTxed) )
+        {
+            p_ptCtx->uTxBuffCntr += l_uCDTxed;
+        }
+        else
+        {
+            l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+        }
+    }
+
+    /* Encode in the free area of the ring until it's full or the message is ended */
+    while( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( p_ptCtx->uTxBuffCntr >= p_ptCtx->uTxBuffFill ) &&
+           ( l_uSpanL > 0u ) )
+    {
+        l_puSpan = NULL;
+        l_uSpanL = 0u;
+        if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_GetWriteSpan(p_ptCtx->ptRing, &l_puSpan, &l_uSpanL) )
+        {
+            l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+        }
+        else if( l_uSpanL > 0u )
+        {
+            l_uCDTxed = 0u;
+            l_eResMsgE = eFSP_MSGTX_GetEncChunk(p_ptCtx, l_puSpan, l_uSpanL, &l_uCDTxed);
+            l_eRes = eFSP_MSGTX_ConvertRetFromMSGE(l_eResMsgE);
+
+            if( ( e_eFSP_MSGTX_RES_OK == l_eRes ) || ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes ) )
+            {
+                /* Publish the encoded data to the consumer */
+                if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_CommitWrite(p_ptCtx->ptRing, l_uCDTxed) )
+                {
+                    l_eRes = e_eFSP_MSGTX_RES_CORRUPTCTX;
+                }
+            }
+        }
+        else
+        {
+            /* Ring is full, the consumer will free some space */
+        }
+    }
+
+	return l_eRes;
+}
+
+static bool_t eFSP_MSGTX_TimStart(t_eFSP_MSGTX_Ctx* const p_ptCtx, const uint32_t p_uTimeout)
+{
+    bool_t l_bRes;
+
+    if( NULL != p_ptCtx->ptTimW )
+    {
+        l_bRes = ( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(p_ptCtx->ptTimW, &p_ptCtx->tTimNode, p_uTimeout) );
+    }
+    else if( NULL == p_ptCtx->fTimNow )
+    {
+        l_bRes = p_ptCtx->tTxTim.fTimStart(p_ptCtx->tTxTim.ptTimCtx, p_uTimeout);
+    }
+    else
+    {
+        l_bRes = (*p_ptCtx->fTimNow)(p_ptCtx->tTxTim.ptTimCtx, &p_ptCtx->uNowMs);
+        if( true == l_bRes )
+        {
+            p_ptCtx->uDeadlineMs = p_ptCtx->uNowMs + p_uTimeout;
+            p_ptCtx->uArmedMs = p_uTimeout;
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_MSGTX_TimGetRemain(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint32_t* const p_puRemain)
+{
+    bool_t l_bRes;
+    uint32_t l_uToDeadline;
+
+    if( NULL != p_ptCtx->ptTimW )
+    {
+        l_bRes = ( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(p_ptCtx->ptTimW, &p_ptCtx->tTimNode, p_puRemain) );
+    }
+    else if( NULL == p_ptCtx->fTimNow )
+    {
+        l_bRes = p_ptCtx->tTxTim.fTimGetRemain(p_ptCtx->tTxTim.ptTimCtx, p_puRemain);
+    }
+    else
+    {
+        l_bRes = (*p_ptCtx->fTimNow)(p_ptCtx->tTxTim.ptTimCtx, &p_ptCtx->uNowMs);
+        if( true == l_bRes )
+        {
+            /* The remaining time can never be greater than the armed timeout, so a bigger value means that the clock
+             * has already passed the deadline. This also handle the wrap around of the clock */
+            l_uToDeadline = p_ptCtx->uDeadlineMs - p_ptCtx->uNowMs;
+            if( l_uToDeadline <= p_ptCtx->uArmedMs )
+            {
+                *p_puRemain = l_uToDeadline;
+            }
+            else
+            {
+                *p_puRemain = 0u;
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static uint32_t eFSP_MSGTX_CalcLineTim(const t_eFSP_MSGTX_Ctx* p_ptCtx, const uint32_t p_uByteN)
+{
+    uint32_t l_uTime;
+    uint32_t l_uQuot;
+    uint32_t l_uRem;
+
+    /* Time on the line rounded up, saturated to the constant timeout */
+    l_uQuot = p_uByteN / p_ptCtx->uLineRate;
+    l_uRem = p_uByteN % p_ptCtx->uLineRate;
+
+    if( l_uQuot > ( p_ptCtx->uTimeoutMs / 1000u ) )
+    {
+        l_uTime = p_ptCtx->uTimeoutMs;
+    }
+    else
+    {
+        l_uTime = ( l_uQuot * 1000u ) + ( ( l_uRem * 1000u ) / p_ptCtx->uLineRate );
+        if( 0u != ( ( l_uRem * 1000u ) % p_ptCtx->uLineRate ) )
+        {
+            l_uTime++;
+        }
+
+        if( ( l_uTime >= p_ptCtx->uTimeoutMs ) || ( p_ptCtx->uLineMarginMs >= ( p_ptCtx->uTimeoutMs - l_uTime ) ) )
+        {
+            l_uTime = p_ptCtx->uTimeoutMs;
+        }
+        else
+        {
+            l_uTime += p_ptCtx->uLineMarginMs;
+        }
+    }
+
+    return l_uTime;
+}
+
+static uint32_t eFSP_MSGTX_GetFrameTim(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+    uint32_t l_uTime;
+    uint32_t l_uFrameL;
+
+    l_uTime = p_ptCtx->uTimeoutMs;
+
+    /* The encoder already know the exact number of byte of the frame, escape included */
+    if( 0u != p_ptCtx->uLineRate )
+    {
+        l_uFrameL = 0u;
+        if( e_eFSP_MSGE_RES_OK == eFSP_MSGTX_GetRemByteToGet(p_ptCtx, &l_uFrameL) )
+        {
+            l_uTime = eFSP_MSGTX_CalcLineTim(p_ptCtx, l_uFrameL);
+        }
+    }
+
+    return l_uTime;
+}
+
+static bool_t eFSP_MSGTX_PaceRefill(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+    bool_t l_bRes;
+    uint32_t l_uNow;
+    uint32_t l_uElapMs;
+    uint32_t l_uSec;
+    uint32_t l_uAdd;
+    uint32_t l_uFrac;
+    uint32_t l_uRoom;
+
+    if( 0u == p_ptCtx->uPaceRate )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_uNow = 0u;
+        l_bRes = (*p_ptCtx->fTimNow)(p_ptCtx->tTxTim.ptTimCtx, &l_uNow);
+        if( true == l_bRes )
+        {
+            /* Unsigned difference handle the wrap around of the clock */
+            l_uElapMs = l_uNow - p_ptCtx->uPaceLastMs;
+            p_ptCtx->uPaceLastMs = l_uNow;
+
+            /* Whole seconds first, a full bucket stop the sum before any overflow */
+            l_uSec = l_uElapMs / 1000u;
+            if( l_uSec > ( p_ptCtx->uPaceBurst / p_ptCtx->uPaceRate ) )
+            {
+                p_ptCtx->uPaceTokens = p_ptCtx->uPaceBurst;
+                p_ptCtx->uPaceFrac = 0u;
+            }
+            else
+            {
+                /* The fraction of a token is kept, so slow rates are not lost in the rounding */
+                l_uAdd = l_uSec * p_ptCtx->uPaceRate;
+                l_uFrac = ( ( l_uElapMs % 1000u ) * p_ptCtx->uPaceRate ) + p_ptCtx->uPaceFrac;
+                p_ptCtx->uPaceFrac = l_uFrac % 1000u;
+                l_uFrac = l_uFrac / 1000u;
+                l_uRoom = p_ptCtx->uPaceBurst - p_ptCtx->uPaceTokens;
+
+                if( ( l_uAdd >= l_uRoom ) || ( l_uFrac >= ( l_uRoom - l_uAdd ) ) )
+                {
+                    p_ptCtx->uPaceTokens = p_ptCtx->uPaceBurst;
+                    p_ptCtx->uPaceFrac = 0u;
+                }
+                else
+                {
+                    p_ptCtx->uPaceTokens += ( l_uAdd + l_uFrac );
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static e_eFSP_MSGE_RES eFSP_MSGTX_GetEncChunk(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint8_t* p_puEncBuff,
+                                              const uint32_t p_uMaxBufL, uint32_t* const p_puGettedL)
+{
+    e_eFSP_MSGE_RES l_eResMsgE;
+    uint32_t l_uCopyL;
+
+    if( NULL == p_ptCtx->ptFout )
+    {
+        l_eResMsgE = eFSP_MSGE_GetEncChunk(&p_ptCtx->tMsgeCtx, p_puEncBuff, p_uMaxBufL, p_puGettedL);
+    }
+    else
+    {
+        /* Same contract of the encoder, but the data is only copied from the shared frame. A released frame is
+         * already ended */
+        l_uCopyL = 0u;
+        if( true == p_ptCtx->bShHeld )
+        {
+            l_uCopyL = p_ptCtx->uShFrameL - p_ptCtx->uShCntr;
+            if( l_uCopyL > p_uMaxBufL )
+            {
+                l_uCopyL = p_uMaxBufL;
+            }
+
+            if( l_uCopyL > 0u )
+            {
+                (void)memcpy(p_puEncBuff, &p_ptCtx->puShFrame[p_ptCtx->uShCntr], l_uCopyL);
+                p_ptCtx->uShCntr += l_uCopyL;
+            }
+        }
+
+        *p_puGettedL = l_uCopyL;
+
+        if( ( true == p_ptCtx->bShHeld ) && ( p_ptCtx->uShCntr < p_ptCtx->uShFrameL ) )
+        {
+            l_eResMsgE = e_eFSP_MSGE_RES_OK;
+        }
+        else
+        {
+            l_eResMsgE = e_eFSP_MSGE_RES_MESSAGEENDED;
+        }
+    }
+
+    return l_eResMsgE;
+}
+
+static e_eFSP_MSGE_RES eFSP_MSGTX_GetRemByteToGet(t_eFSP_MSGTX_Ctx* const p_ptCtx, uint32_t* const p_puRemL)
+{
+    e_eFSP_MSGE_RES l_eResMsgE;
+
+    if( NULL == p_ptCtx->ptFout )
+    {
+        l_eResMsgE = eFSP_MSGE_GetRemByteToGet(&p_ptCtx->tMsgeCtx, p_puRemL);
+    }
+    else
+    {
+        if( true == p_ptCtx->bShHeld )
+        {
+            *p_puRemL = p_ptCtx->uShFrameL - p_ptCtx->uShCntr;
+        }
+        else
+        {
+            *p_puRemL = 0u;
+        }
+
+        l_eResMsgE = e_eFSP_MSGE_RES_OK;
+    }
+
+    return l_eResMsgE;
+}
+
+static e_eFSP_MSGTX_RES eFSP_MSGTX_ReattachShared(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+    e_eFSP_MSGTX_RES l_eRes;
+    const uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uMsgL;
+    uint32_t l_uGen;
+
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+
+    if( false == p_ptCtx->bShHeld )
+    {
+        /* The reference was released at the end of the frame, take it again only if the frame is still there */
+        l_puFrame = NULL;
+        l_uFrameL = 0u;
+        l_uMsgL = 0u;
+        l_uGen = 0u;
+        if( e_eFSP_FOUT_RES_OK != eFSP_FOUT_Attach(p_ptCtx->ptFout, &l_puFrame, &l_uFrameL, &l_uMsgL, &l_uGen) )
+        {
+            l_eRes = e_eFSP_MSGTX_RES_NOINITMESSAGE;
+        }
+        else if( l_uGen != p_ptCtx->uShGen )
+        {
+            (void)eFSP_FOUT_Detach(p_ptCtx->ptFout);
+            l_eRes = e_eFSP_MSGTX_RES_NOINITMESSAGE;
+        }
+        else
+        {
+            p_ptCtx->puShFrame = l_puFrame;
+            p_ptCtx->uShFrameL = l_uFrameL;
+            p_ptCtx->bShHeld = true;
+        }
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == l_eRes )
+    {
+        p_ptCtx->uShCntr = 0u;
+    }
+
+    return l_eRes;
+}
+
+static void eFSP_MSGTX_DetachShared(t_eFSP_MSGTX_Ctx* const p_ptCtx)
+{
+    if( true == p_ptCtx->bShHeld )
+    {
+        (void)eFSP_FOUT_Detach(p_ptCtx->ptFout);
+        p_ptCtx->bShHeld = false;
+    }
+}
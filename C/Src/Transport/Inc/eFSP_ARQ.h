@@ -0,0 +1,257 @@
+/**
+ * @file       eFSP_ARQ.h
+ *
+ * @brief      Sliding window ARQ with selective repeat, on top of a message transmitter and a message receiver
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_ARQ_H
+#define EFSP_ARQ_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eFSP_MSGTX.h"
+#include "eFSP_MSGRX.h"
+#include "eFSP_RTTE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Biggest window, limited by the selective acknowledge bitmap. The window must also be a power of two, so the 8 bit
+ * sequence number can be used directly to index the slots */
+#define EFSP_ARQ_MAXWINDOW                                              ( 32u )
+
+/* Every payload is preceded by the frame type and the sequence number */
+#define EFSP_ARQ_HEADERSIZE                                             ( 2u )
+
+/* An acknowledge frame carry the type, the next expected sequence number and the 32 bit selective bitmap */
+#define EFSP_ARQ_ACKSIZE                                                ( 6u )
+
+/* A data frame carrying a pending acknowledge: type, sequence number, next expected sequence number and bitmap */
+#define EFSP_ARQ_PIGGYHEADERSIZE                                        ( EFSP_ARQ_HEADERSIZE + EFSP_ARQ_ACKSIZE - 1u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_ARQ_RES_OK = 0,
+    e_eFSP_ARQ_RES_BADPARAM,
+    e_eFSP_ARQ_RES_BADPOINTER,
+	e_eFSP_ARQ_RES_CORRUPTCTX,
+    e_eFSP_ARQ_RES_WINDOWFULL,
+    e_eFSP_ARQ_RES_NODATA,
+    e_eFSP_ARQ_RES_NOINITLIB,
+    e_eFSP_ARQ_RES_MSGTXERROR,
+    e_eFSP_ARQ_RES_MSGRXERROR
+}e_eFSP_ARQ_RES;
+
+typedef enum
+{
+    e_eFSP_ARQ_SLOT_FREE = 0,
+    e_eFSP_ARQ_SLOT_QUEUED,
+    e_eFSP_ARQ_SLOT_INFLIGHT,
+    e_eFSP_ARQ_SLOT_SACKED
+}e_eFSP_ARQ_SLOT;
+
+typedef struct
+{
+    e_eFSP_ARQ_SLOT eState;
+    uint32_t        uLen;
+    uint32_t        uSentMs;
+    bool_t          bRetx;
+}t_eFSP_ARQ_Slot;
+
+typedef struct
+{
+    bool_t            bIsInit;
+    t_eFSP_MSGTX_Ctx* ptMsgTx;
+    t_eFSP_MSGRX_Ctx* ptMsgRx;
+    t_eFSP_RTTE_Ctx*  ptRtte;
+    uint8_t*          puTxArea;
+    uint8_t*          puRxArea;
+    uint32_t          uSlotL;
+    uint32_t          uWindow;
+    uint32_t          uRtoMs;
+    t_eFSP_ARQ_Slot   atTxSlot[EFSP_ARQ_MAXWINDOW];
+    uint32_t          auRxLen[EFSP_ARQ_MAXWINDOW];
+    uint32_t          uRxMask;
+    uint8_t           uTxBase;
+    uint8_t           uTxNext;
+    uint8_t           uRxNext;
+    bool_t            bAckPend;
+    bool_t            bAckArmed;
+    uint32_t          uAckDelayMs;
+    uint32_t          uAckPendMs;
+    bool_t            bTxBusy;
+    uint32_t          uRetxN;
+}t_eFSP_ARQ_Ctx;
+
+typedef struct
+{
+    t_eFSP_MSGTX_Ctx* ptIMsgTx;
+    t_eFSP_MSGRX_Ctx* ptIMsgRx;
+    uint8_t*          puIMemArea;
+    uint32_t          uIMemAreaL;
+    uint32_t          uISlotL;
+    uint32_t          uIWindow;
+    uint32_t          uIRtoMs;
+}t_eFSP_ARQ_InitData;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the ARQ context. The message transmitter and the message receiver must be already
+ *              initialized, and are used only by this module from now on. The memory area keep a copy of every payload
+ *              until it's acknowledged, and the payloads received out of order until they can be retrived.
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[in]   p_ptInitData    - Init data. uIWindow is the number of frames that can wait an acknowledge, a power of
+ *                                two not bigger than EFSP_ARQ_MAXWINDOW, one for a stop and wait link. uISlotL is the
+ *                                biggest payload, the memory area must be at least 2 * uIWindow * uISlotL and the
+ *                                transmitter must accept uISlotL + EFSP_ARQ_PIGGYHEADERSIZE bytes. uIRtoMs is the
+ *                                retransmission timeout used when no estimator is set.
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_InitCtx(t_eFSP_ARQ_Ctx* const p_ptCtx, const t_eFSP_ARQ_InitData* p_ptInitData);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_IsInit(t_eFSP_ARQ_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Use a round trip time estimator in place of the constant retransmission timeout. Only the frames
+ *              acknowledged at the first attempt are added as samples, and the timeout is doubled every time the oldest
+ *              frame is sent again. Pass NULL in order to use the constant timeout again.
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[in]   p_ptRtte        - Initialized round trip time estimator, owned by this link
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_BADPARAM       - The estimator is not initialized
+ *		        e_eFSP_ARQ_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_ARQ_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_SetRtte(t_eFSP_ARQ_Ctx* const p_ptCtx, t_eFSP_RTTE_Ctx* const p_ptRtte);
+
+/**
+ * @brief       Delay the standalone acknowledge. A pending acknowledge is always carried by the next data frame, and
+ *              is sent alone only when no data frame is started within p_uAckDelayMs, so a bidirectional link use
+ *              nearly no acknowledge frame. The retransmission timeout of the peer must be bigger than the delay.
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[in]   p_uAckDelayMs   - Delay in ms, zero send the acknowledge as soon as the transmitter is free
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_ARQ_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_SetAckDelay(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uAckDelayMs);
+
+/**
+ * @brief       Queue a payload. The payload is copied, and sent by eFSP_ARQ_Process as soon as the transmitter is
+ *              free.
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[in]   p_puData        - Payload to send
+ * @param[in]   p_uDataL        - Size of the payload, not bigger than uISlotL
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_BADPARAM       - The payload is too big
+ *		        e_eFSP_ARQ_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_ARQ_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_ARQ_RES_WINDOWFULL     - uIWindow frames are waiting an acknowledge, retry later
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_Send(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL);
+
+/**
+ * @brief       Retrive the next payload in order. Retriving a payload free a place of the receive window, so the
+ *              acknowledge is sent only for the retrived frames, and the peer can not overrun the receiver.
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[out]  p_puData        - Buffer where the payload will be copied
+ * @param[in]   p_uDataMaxL     - Size of p_puData
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the size of the payload will be placed
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_BADPARAM       - The buffer can not contain the payload, nothing is retrived
+ *		        e_eFSP_ARQ_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_ARQ_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_ARQ_RES_NODATA         - The next payload in order is not received yet
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_Recv(t_eFSP_ARQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataMaxL,
+                             uint32_t* const p_puDataL);
+
+/**
+ * @brief       Run the link: receive a chunk, elaborate a complete frame, and send a chunk. When the transmitter is
+ *              free the frames with an expired timeout have the precedence, then the new frames, and at last the
+ *              delayed standalone acknowledge. Frames discarded by the receiver, for a wrong CRC or a timeout, are
+ *              simply ignored and will be sent again by the peer.
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[in]   p_uNowMs        - Current time in ms, can wrap around
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_ARQ_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_ARQ_RES_MSGTXERROR     - The transmitter returned an unrecoverable error
+ *		        e_eFSP_ARQ_RES_MSGRXERROR     - The receiver returned an unrecoverable error
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_Process(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+
+/**
+ * @brief       Retrive the number of payloads queued or sent and still not acknowledged
+ *
+ * @param[in]   p_ptCtx         - ARQ context
+ * @param[out]  p_puPendingN    - Pointer to a uint32_t variable where the number of pending payloads will be placed
+ *
+ * @return      e_eFSP_ARQ_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_ARQ_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_ARQ_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_ARQ_RES_OK             - Operation ended correctly
+ */
+e_eFSP_ARQ_RES eFSP_ARQ_GetPending(t_eFSP_ARQ_Ctx* const p_ptCtx, uint32_t* const p_puPendingN);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_ARQ_H */
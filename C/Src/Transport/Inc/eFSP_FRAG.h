@@ -0,0 +1,293 @@
+/**
+ * @file       eFSP_FRAG.h
+ *
+ * @brief      Fragmentation and reassembly of messages bigger than the buffers of the link
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_FRAG_H
+#define EFSP_FRAG_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Every fragment start with: message ID, fragment index on two bytes, fragment size on two bytes and message size on
+ * four bytes, all little endian */
+#define EFSP_FRAG_HEADERSIZE                                            ( 9u )
+
+/* Biggest payload of a fragment and biggest number of fragments of a message */
+#define EFSP_FRAG_MAXFRAGL                                              ( 0xFFFFu )
+#define EFSP_FRAG_MAXFRAGN                                              ( 0x10000u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_FRAG_RES_OK = 0,
+    e_eFSP_FRAG_RES_BADPARAM,
+    e_eFSP_FRAG_RES_BADPOINTER,
+	e_eFSP_FRAG_RES_CORRUPTCTX,
+    e_eFSP_FRAG_RES_MESSAGEENDED,
+    e_eFSP_FRAG_RES_MESSAGERECEIVED,
+    e_eFSP_FRAG_RES_BADFRAME,
+    e_eFSP_FRAG_RES_OUTOFMEM,
+    e_eFSP_FRAG_RES_NODATA,
+    e_eFSP_FRAG_RES_NOINITLIB,
+    e_eFSP_FRAG_RES_NOINITMESSAGE,
+    e_eFSP_FRAG_RES_SINKCLBKERROR
+}e_eFSP_FRAG_RES;
+
+/* Define a generic sink func callback context that must be implemented by the user */
+typedef struct t_eFSP_FRAG_SinkCtxUser t_eFSP_FRAG_SinkCtx;
+
+/* Call back to a function that will store a fragment of the message at the passed offset, for example in a flash
+ * memory. Fragments can arrive in any order, but every fragment is passed only once.
+ * the p_ptCtx parameter is a custom pointer that can be used by the creator of this SINK callback, and will not be used
+ * by the FRAG module */
+typedef bool_t (*f_eFSP_FRAG_SinkCb) ( t_eFSP_FRAG_SinkCtx* const p_ptCtx, const uint32_t p_uOffset,
+                                       const uint8_t* p_puData, const uint32_t p_uDataL );
+
+typedef struct
+{
+    bool_t         bIsInit;
+    const uint8_t* puData;
+    uint32_t       uDataL;
+    uint32_t       uFragL;
+    uint32_t       uFragN;
+    uint32_t       uNextIdx;
+    uint8_t        uMsgId;
+    bool_t         bHasMsg;
+}t_eFSP_FRAG_TxCtx;
+
+typedef struct
+{
+    bool_t               bIsInit;
+    uint8_t*             puDataArea;
+    uint32_t             uDataAreaL;
+    f_eFSP_FRAG_SinkCb   fSink;
+    t_eFSP_FRAG_SinkCtx* ptSinkCtx;
+    uint8_t*             puMapArea;
+    uint32_t             uMapAreaL;
+    bool_t               bHasMsg;
+    uint8_t              uMsgId;
+    uint32_t             uDataL;
+    uint32_t             uFragL;
+    uint32_t             uFragN;
+    uint32_t             uRecvN;
+}t_eFSP_FRAG_RxCtx;
+
+typedef struct
+{
+    uint8_t*             puIDataArea;
+    uint32_t             uIDataAreaL;
+    f_eFSP_FRAG_SinkCb   fISink;
+    t_eFSP_FRAG_SinkCtx* ptISinkCtx;
+    uint8_t*             puIMapArea;
+    uint32_t             uIMapAreaL;
+}t_eFSP_FRAG_RxInitData;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the fragmenter context
+ *
+ * @param[in]   p_ptCtx         - Fragmenter context
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_TxInitCtx(t_eFSP_FRAG_TxCtx* const p_ptCtx);
+
+/**
+ * @brief       Check if the fragmenter is initialized
+ *
+ * @param[in]   p_ptCtx         - Fragmenter context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_TxIsInit(t_eFSP_FRAG_TxCtx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Start to fragment a new message. The message is not copied and must stay valid until every fragment is
+ *              retrived, so it can be placed in a read only memory. Every message get a new message ID. The size of
+ *              the fragments should be the size of the decode buffer of the peer less EFSP_FRAG_HEADERSIZE.
+ *
+ * @param[in]   p_ptCtx         - Fragmenter context
+ * @param[in]   p_puData        - Message to fragment
+ * @param[in]   p_uDataL        - Size of the message
+ * @param[in]   p_uFragL        - Size of the payload of every fragment, except the last one that can be smaller
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_BADPARAM      - Empty message, invalid fragment size or more than EFSP_FRAG_MAXFRAGN
+ *                                              fragments
+ *		        e_eFSP_FRAG_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_TxNewMsg(t_eFSP_FRAG_TxCtx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL,
+                                   const uint32_t p_uFragL);
+
+/**
+ * @brief       Retrive the next fragment of the current message, header included
+ *
+ * @param[in]   p_ptCtx         - Fragmenter context
+ * @param[out]  p_puFrag        - Buffer where the fragment will be placed
+ * @param[in]   p_uFragMaxL     - Size of p_puFrag
+ * @param[out]  p_puFragL       - Pointer to a uint32_t variable where the size of the fragment will be placed
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_BADPARAM      - The buffer can not contain the fragment
+ *		        e_eFSP_FRAG_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_FRAG_RES_NOINITMESSAGE - No message started with eFSP_FRAG_TxNewMsg
+ *		        e_eFSP_FRAG_RES_MESSAGEENDED  - Every fragment is already retrived, nothing is placed in p_puFrag
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_TxGetFrag(t_eFSP_FRAG_TxCtx* const p_ptCtx, uint8_t* p_puFrag, const uint32_t p_uFragMaxL,
+                                    uint32_t* const p_puFragL);
+
+/**
+ * @brief       Retrive again a fragment of the current message, for example when the peer report it missing. The
+ *              fragment returned by eFSP_FRAG_TxGetFrag is not changed.
+ *
+ * @param[in]   p_ptCtx         - Fragmenter context
+ * @param[in]   p_uFragIdx      - Index of the fragment
+ * @param[out]  p_puFrag        - Buffer where the fragment will be placed
+ * @param[in]   p_uFragMaxL     - Size of p_puFrag
+ * @param[out]  p_puFragL       - Pointer to a uint32_t variable where the size of the fragment will be placed
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_BADPARAM      - Index out of the message or the buffer can not contain the fragment
+ *		        e_eFSP_FRAG_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_FRAG_RES_NOINITMESSAGE - No message started with eFSP_FRAG_TxNewMsg
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_TxGetFragAt(t_eFSP_FRAG_TxCtx* const p_ptCtx, const uint32_t p_uFragIdx, uint8_t* p_puFrag,
+                                      const uint32_t p_uFragMaxL, uint32_t* const p_puFragL);
+
+/**
+ * @brief       Initialize the reassembler context. The message is placed in puIDataArea, or, when puIDataArea is NULL,
+ *              passed fragment by fragment to fISink, so the size of the message is not limited by the RAM. The map
+ *              area keep a bit for every fragment, so it limit the number of fragments of a message.
+ *
+ * @param[in]   p_ptCtx         - Reassembler context
+ * @param[in]   p_ptInitData    - Init data
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_BADPARAM      - Empty data area or map area
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_RxInitCtx(t_eFSP_FRAG_RxCtx* const p_ptCtx, const t_eFSP_FRAG_RxInitData* p_ptInitData);
+
+/**
+ * @brief       Check if the reassembler is initialized
+ *
+ * @param[in]   p_ptCtx         - Reassembler context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_RxIsInit(t_eFSP_FRAG_RxCtx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Discard the current message, received or not. Must be called after a received message is used, so a
+ *              later message that reuse the same message ID is not taken for a duplicate.
+ *
+ * @param[in]   p_ptCtx         - Reassembler context
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX    - In case of an corrupted context
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_RxNewMsg(t_eFSP_FRAG_RxCtx* const p_ptCtx);
+
+/**
+ * @brief       Insert a received fragment. Fragments can arrive in any order, duplicated fragments are ignored. A
+ *              fragment of a different message discard the current one, received or not, and start the new one.
+ *
+ * @param[in]   p_ptCtx         - Reassembler context
+ * @param[in]   p_puFrag        - Fragment, header included
+ * @param[in]   p_uFragL        - Size of the fragment
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_NOINITLIB       - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX      - In case of an corrupted context
+ *		        e_eFSP_FRAG_RES_BADFRAME        - The header is not valid, the fragment is discarded
+ *		        e_eFSP_FRAG_RES_OUTOFMEM        - The message is bigger than the data area, or has more fragments
+ *                                                than the map area can track. The fragment is discarded.
+ *		        e_eFSP_FRAG_RES_SINKCLBKERROR   - The sink returned an error, the fragment is not marked as received
+ *		        e_eFSP_FRAG_RES_MESSAGERECEIVED - The last missing fragment is received
+ *              e_eFSP_FRAG_RES_OK              - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_RxInsFrag(t_eFSP_FRAG_RxCtx* const p_ptCtx, const uint8_t* p_puFrag,
+                                    const uint32_t p_uFragL);
+
+/**
+ * @brief       Retrive the number of fragments received and expected for the current message
+ *
+ * @param[in]   p_ptCtx         - Reassembler context
+ * @param[out]  p_puRecvN       - Pointer to a uint32_t variable where the number of received fragments will be placed
+ * @param[out]  p_puFragN       - Pointer to a uint32_t variable where the number of fragments will be placed
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_FRAG_RES_NOINITMESSAGE - No fragment received after the last eFSP_FRAG_RxNewMsg
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_RxGetProgress(t_eFSP_FRAG_RxCtx* const p_ptCtx, uint32_t* const p_puRecvN,
+                                        uint32_t* const p_puFragN);
+
+/**
+ * @brief       Retrive the reassembled message, when placed in the data area. With a sink only the size is returned,
+ *              and p_ppuData is set to NULL.
+ *
+ * @param[in]   p_ptCtx         - Reassembler context
+ * @param[out]  p_ppuData       - Pointer to a pointer where the start of the message will be placed
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the size of the message will be placed
+ *
+ * @return      e_eFSP_FRAG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_FRAG_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_FRAG_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_FRAG_RES_NODATA        - The message is not completely received
+ *              e_eFSP_FRAG_RES_OK            - Operation ended correctly
+ */
+e_eFSP_FRAG_RES eFSP_FRAG_RxGetMsg(t_eFSP_FRAG_RxCtx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puDataL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_FRAG_H */
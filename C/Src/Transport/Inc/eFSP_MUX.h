@@ -0,0 +1,223 @@
+/**
+ * @file       eFSP_MUX.h
+ *
+ * @brief      Logical channel multiplexer with deficit round robin scheduling, on top of a message transmitter and a
+ *             message receiver
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_MUX_H
+#define EFSP_MUX_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eFSP_MSGTX.h"
+#include "eFSP_MSGRX.h"
+#include "eFSP_SPSCR.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Number of logical channels, the channel ID is the first byte of every frame */
+#define EFSP_MUX_MAXCHAN                                                ( 8u )
+
+/* Every payload is preceded by the channel ID */
+#define EFSP_MUX_HEADERSIZE                                             ( 1u )
+
+/* Every queued payload is preceded by its size on two bytes */
+#define EFSP_MUX_LENSIZE                                                ( 2u )
+
+/* Biggest quantum of a channel, in bytes */
+#define EFSP_MUX_MAXWEIGHT                                              ( 0xFFFFu )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_MUX_RES_OK = 0,
+    e_eFSP_MUX_RES_BADPARAM,
+    e_eFSP_MUX_RES_BADPOINTER,
+	e_eFSP_MUX_RES_CORRUPTCTX,
+    e_eFSP_MUX_RES_QUEUEFULL,
+    e_eFSP_MUX_RES_NODATA,
+    e_eFSP_MUX_RES_NOINITLIB,
+    e_eFSP_MUX_RES_MSGTXERROR,
+    e_eFSP_MUX_RES_MSGRXERROR
+}e_eFSP_MUX_RES;
+
+typedef struct
+{
+    bool_t           bIsOpen;
+    t_eFSP_SPSCR_Ctx tTxRing;
+    t_eFSP_SPSCR_Ctx tRxRing;
+    uint32_t         uWeight;
+    uint32_t         uDeficit;
+    uint32_t         uTxHeadL;
+    bool_t           bTxHead;
+    uint32_t         uRxHeadL;
+    bool_t           bRxHead;
+    uint32_t         uDropN;
+}t_eFSP_MUX_Chan;
+
+typedef struct
+{
+    bool_t            bIsInit;
+    t_eFSP_MSGTX_Ctx* ptMsgTx;
+    t_eFSP_MSGRX_Ctx* ptMsgRx;
+    uint32_t          uMaxPayL;
+    t_eFSP_MUX_Chan   atChan[EFSP_MUX_MAXCHAN];
+    uint32_t          uCurChan;
+    bool_t            bCharged;
+    bool_t            bTxBusy;
+}t_eFSP_MUX_Ctx;
+
+typedef struct
+{
+    t_eFSP_MSGTX_Ctx* ptIMsgTx;
+    t_eFSP_MSGRX_Ctx* ptIMsgRx;
+}t_eFSP_MUX_InitData;
+
+typedef struct
+{
+    uint8_t*          puITxArea;
+    uint32_t          uITxAreaL;
+    uint8_t*          puIRxArea;
+    uint32_t          uIRxAreaL;
+    uint32_t          uIWeight;
+}t_eFSP_MUX_ChanData;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the multiplexer context. The message transmitter and the message receiver must be already
+ *              initialized, and are used only by this module from now on. Every channel starts closed.
+ *
+ * @param[in]   p_ptCtx         - Multiplexer context
+ * @param[in]   p_ptInitData    - Init data
+ *
+ * @return      e_eFSP_MUX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MUX_RES_BADPARAM       - The transmitter is not initialized or can not contain a payload
+ *              e_eFSP_MUX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MUX_RES eFSP_MUX_InitCtx(t_eFSP_MUX_Ctx* const p_ptCtx, const t_eFSP_MUX_InitData* p_ptInitData);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Multiplexer context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_MUX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_MUX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MUX_RES eFSP_MUX_IsInit(t_eFSP_MUX_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Open a channel, or open it again discarding every queued and received payload. The transmit area is
+ *              the queue of the payloads waiting their turn, the receive area keep the payloads received on this
+ *              channel until they are retrived, so a slow channel never block the other ones. Every queued payload
+ *              use EFSP_MUX_LENSIZE more bytes. The weight is the number of bytes the channel can send in every
+ *              round of the scheduler, use at least the biggest payload of the channel in order to send a frame for
+ *              every round.
+ *
+ * @param[in]   p_ptCtx         - Multiplexer context
+ * @param[in]   p_uChanId       - Channel ID, less than EFSP_MUX_MAXCHAN
+ * @param[in]   p_ptChanData    - Channel data
+ *
+ * @return      e_eFSP_MUX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MUX_RES_BADPARAM       - Invalid channel ID, weight or area too small to contain a payload
+ *		        e_eFSP_MUX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MUX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MUX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MUX_RES eFSP_MUX_OpenChan(t_eFSP_MUX_Ctx* const p_ptCtx, const uint32_t p_uChanId,
+                                 const t_eFSP_MUX_ChanData* p_ptChanData);
+
+/**
+ * @brief       Queue a payload on a channel. The payload is copied, and sent by eFSP_MUX_Process when the scheduler
+ *              select the channel.
+ *
+ * @param[in]   p_ptCtx         - Multiplexer context
+ * @param[in]   p_uChanId       - Channel ID
+ * @param[in]   p_puData        - Payload to send
+ * @param[in]   p_uDataL        - Size of the payload, not zero and not bigger than the transmitter can contain
+ *
+ * @return      e_eFSP_MUX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MUX_RES_BADPARAM       - Channel not open or invalid payload size
+ *		        e_eFSP_MUX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MUX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MUX_RES_QUEUEFULL      - Not enough space in the queue of the channel, retry later
+ *              e_eFSP_MUX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MUX_RES eFSP_MUX_Send(t_eFSP_MUX_Ctx* const p_ptCtx, const uint32_t p_uChanId, const uint8_t* p_puData,
+                             const uint32_t p_uDataL);
+
+/**
+ * @brief       Retrive the oldest payload received on a channel
+ *
+ * @param[in]   p_ptCtx         - Multiplexer context
+ * @param[in]   p_uChanId       - Channel ID
+ * @param[out]  p_puData        - Buffer where the payload will be copied
+ * @param[in]   p_uDataMaxL     - Size of p_puData
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the size of the payload will be placed
+ *
+ * @return      e_eFSP_MUX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MUX_RES_BADPARAM       - Channel not open, or the buffer can not contain the payload and
+ *                                              nothing is retrived
+ *		        e_eFSP_MUX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MUX_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_MUX_RES_NODATA         - No payload received on this channel
+ *              e_eFSP_MUX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MUX_RES eFSP_MUX_Recv(t_eFSP_MUX_Ctx* const p_ptCtx, const uint32_t p_uChanId, uint8_t* p_puData,
+                             const uint32_t p_uDataMaxL, uint32_t* const p_puDataL);
+
+/**
+ * @brief       Run the link: receive a chunk, dispatch a complete frame to the receive area of its channel, and send
+ *              a chunk. When the transmitter is free the next payload is chosen with a deficit round robin between
+ *              the channels with queued payloads. Frames for a closed channel, or for a channel without space in its
+ *              receive area, are discarded and counted in uDropN of the channel. When the credit flow control of the
+ *              transmitter has no credit the payload stay in its queue, and it's sent once the application pass a new
+ *              grant to eFSP_MSGTX_SetCreditLimit.
+ *
+ * @param[in]   p_ptCtx         - Multiplexer context
+ *
+ * @return      e_eFSP_MUX_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_MUX_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_MUX_RES_CORRUPTCTX     - In case of an corrupted context
+ *		        e_eFSP_MUX_RES_MSGTXERROR     - The transmitter returned an unrecoverable error. When it refused a new
+ *                                              frame the payload is kept in the queue and sent in the next call
+ *		        e_eFSP_MUX_RES_MSGRXERROR     - The receiver returned an unrecoverable error
+ *              e_eFSP_MUX_RES_OK             - Operation ended correctly
+ */
+e_eFSP_MUX_RES eFSP_MUX_Process(t_eFSP_MUX_Ctx* const p_ptCtx);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_MUX_H */
@@ -0,0 +1,220 @@
+/**
+ * @file       eFSP_NEGO.h
+ *
+ * @brief      Link capability negotiation at link up, on top of a message transmitter and a message receiver
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_NEGO_H
+#define EFSP_NEGO_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eFSP_MSGTX.h"
+#include "eFSP_MSGRX.h"
+#include "eFSP_ARQ.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Header profiles supported by a node, one bit for every CRC size and for every length field */
+#define EFSP_NEGO_CRCNONE                                               ( 0x01u )
+#define EFSP_NEGO_CRC16                                                 ( 0x02u )
+#define EFSP_NEGO_CRC32                                                 ( 0x04u )
+#define EFSP_NEGO_LEN8                                                  ( 0x01u )
+#define EFSP_NEGO_LEN16                                                 ( 0x02u )
+#define EFSP_NEGO_LEN32                                                 ( 0x04u )
+#define EFSP_NEGO_LENVAR                                                ( 0x08u )
+
+/* Framing engines supported by a node */
+#define EFSP_NEGO_FRMESC                                                ( 0x01u )
+#define EFSP_NEGO_FRMCOBS                                               ( 0x02u )
+#define EFSP_NEGO_FRMTRSP                                               ( 0x04u )
+
+/* Optional stages supported by a node */
+#define EFSP_NEGO_FEATCMP                                               ( 0x01u )
+
+/* A capability frame carry the type, the version, the handshake state, the biggest payload on four bytes little
+ * endian, the CRC, length, framing and feature masks and the window. Longer frames of a newer version are accepted,
+ * the bytes after these are ignored */
+#define EFSP_NEGO_CAPSIZE                                               ( 12u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_NEGO_RES_OK = 0,
+    e_eFSP_NEGO_RES_BADPARAM,
+    e_eFSP_NEGO_RES_BADPOINTER,
+	e_eFSP_NEGO_RES_CORRUPTCTX,
+    e_eFSP_NEGO_RES_LINKUP,
+    e_eFSP_NEGO_RES_LINKDOWN,
+    e_eFSP_NEGO_RES_NOINITLIB,
+    e_eFSP_NEGO_RES_MSGTXERROR,
+    e_eFSP_NEGO_RES_MSGRXERROR
+}e_eFSP_NEGO_RES;
+
+typedef enum
+{
+    e_eFSP_NEGO_ST_HELLO = 0,
+    e_eFSP_NEGO_ST_LINGER,
+    e_eFSP_NEGO_ST_LINKUP
+}e_eFSP_NEGO_ST;
+
+typedef struct
+{
+    uint32_t uMaxPayL;
+    uint32_t uCrcMask;
+    uint32_t uLenMask;
+    uint32_t uFrmMask;
+    uint32_t uFeatMask;
+    uint32_t uWindow;
+}t_eFSP_NEGO_Caps;
+
+typedef struct
+{
+    uint32_t uMaxPayL;
+    uint32_t uCrcL;
+    uint32_t uLenL;
+    uint32_t uFrm;
+    uint32_t uCmpL;
+    uint32_t uWindow;
+}t_eFSP_NEGO_Link;
+
+typedef struct
+{
+    bool_t            bIsInit;
+    t_eFSP_MSGTX_Ctx* ptMsgTx;
+    t_eFSP_MSGRX_Ctx* ptMsgRx;
+    t_eFSP_NEGO_Caps  tLocal;
+    t_eFSP_NEGO_Caps  tPeer;
+    t_eFSP_NEGO_Link  tLink;
+    uint32_t          uBaseCrcL;
+    uint32_t          uBaseLenL;
+    uint32_t          uBaseFrm;
+    uint32_t          uRetryMs;
+    uint32_t          uLingerMs;
+    e_eFSP_NEGO_ST    eState;
+    bool_t            bPeerKnown;
+    bool_t            bSendPend;
+    bool_t            bSentOnce;
+    bool_t            bTxBusy;
+    uint32_t          uLastTxMs;
+}t_eFSP_NEGO_Ctx;
+
+typedef struct
+{
+    t_eFSP_MSGTX_Ctx* ptIMsgTx;
+    t_eFSP_MSGRX_Ctx* ptIMsgRx;
+    t_eFSP_NEGO_Caps  tICaps;
+    uint32_t          uIBaseCrcL;
+    uint32_t          uIBaseLenL;
+    uint32_t          uIBaseFrm;
+    uint32_t          uIRetryMs;
+    uint32_t          uILingerMs;
+}t_eFSP_NEGO_InitData;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the negotiation context and start the handshake. The message transmitter and the message
+ *              receiver must be already initialized, and are used only by this module till the link is up. The base
+ *              profile, the one every peer of the link support, is set on both of them without compression, and the
+ *              receiver start a new message. Call it again to negotiate a new link, for example after a reboot of
+ *              the peer.
+ *
+ * @param[in]   p_ptCtx         - Negotiation context
+ * @param[in]   p_ptInitData    - Init data. tICaps are the capabilities of this node: uMaxPayL is the biggest payload
+ *                                that the transmitter and the receiver can contain with every advertised profile, the
+ *                                masks are made of EFSP_NEGO_CRC*, EFSP_NEGO_LEN*, EFSP_NEGO_FRM* and
+ *                                EFSP_NEGO_FEAT* bits, and uWindow is a power of two not bigger than
+ *                                EFSP_ARQ_MAXWINDOW. uIBaseCrcL, uIBaseLenL and uIBaseFrm are the base profile, the
+ *                                transmitter must accept EFSP_NEGO_CAPSIZE bytes with it. The capabilities are sent
+ *                                every uIRetryMs till the peer answer, and the agreed settings are applied after
+ *                                uILingerMs without requests of the peer, so uILingerMs must be bigger than the
+ *                                retry time of the peer plus a round trip.
+ *
+ * @return      e_eFSP_NEGO_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_NEGO_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *              e_eFSP_NEGO_RES_OK            - Operation ended correctly
+ */
+e_eFSP_NEGO_RES eFSP_NEGO_InitCtx(t_eFSP_NEGO_Ctx* const p_ptCtx, const t_eFSP_NEGO_InitData* p_ptInitData);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Negotiation context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_NEGO_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eFSP_NEGO_RES_OK            - Operation ended correctly
+ */
+e_eFSP_NEGO_RES eFSP_NEGO_IsInit(t_eFSP_NEGO_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Run the handshake: receive a chunk, elaborate a complete capability frame, and send a chunk. Both
+ *              nodes agree on the same settings from the two sets of capabilities: the smallest payload and window,
+ *              the strongest common CRC, the shortest common length field that can contain the payload, the common
+ *              framing engine with the lowest overhead, and the compression if both support it. A category without
+ *              a common option keep the base profile. Once the settings are applied to the transmitter and the
+ *              receiver the link is up, and this function does nothing more. Frames sent by the peer while only one
+ *              of the nodes is using the new settings are lost, so the link must recover them, for example with
+ *              eFSP_ARQ.
+ *
+ * @param[in]   p_ptCtx         - Negotiation context
+ * @param[in]   p_uNowMs        - Current time in ms, can wrap around
+ *
+ * @return      e_eFSP_NEGO_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_NEGO_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_NEGO_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_NEGO_RES_MSGTXERROR    - The transmitter returned an unrecoverable error
+ *		        e_eFSP_NEGO_RES_MSGRXERROR    - The receiver returned an unrecoverable error
+ *		        e_eFSP_NEGO_RES_LINKUP        - The agreed settings are in use
+ *              e_eFSP_NEGO_RES_OK            - Handshake still running
+ */
+e_eFSP_NEGO_RES eFSP_NEGO_Process(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+
+/**
+ * @brief       Retrive the agreed settings. uMaxPayL is the biggest payload of the transmitter, so an eFSP_ARQ on top
+ *              of this link use uWindow and a slot of uMaxPayL - EFSP_ARQ_PIGGYHEADERSIZE bytes.
+ *
+ * @param[in]   p_ptCtx         - Negotiation context
+ * @param[out]  p_ptLink        - Pointer to a t_eFSP_NEGO_Link variable where the settings will be placed
+ *
+ * @return      e_eFSP_NEGO_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSP_NEGO_RES_NOINITLIB     - Need to init context before taking some action
+ *		        e_eFSP_NEGO_RES_CORRUPTCTX    - In case of an corrupted context
+ *		        e_eFSP_NEGO_RES_LINKDOWN      - The handshake is still running
+ *              e_eFSP_NEGO_RES_OK            - Operation ended correctly
+ */
+e_eFSP_NEGO_RES eFSP_NEGO_GetLink(t_eFSP_NEGO_Ctx* const p_ptCtx, t_eFSP_NEGO_Link* const p_ptLink);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_NEGO_H */
@@ -0,0 +1,866 @@
+/**
+ * @file       eFSP_ARQ.c
+ *
+ * @brief      Sliding window ARQ with selective repeat, on top of a message transmitter and a message receiver
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_ARQ.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_ARQ_TYPEDATA                                               ( 0x01u )
+#define EFSP_ARQ_TYPEACK                                                ( 0x02u )
+#define EFSP_ARQ_TYPEDATAACK                                            ( 0x03u )
+#define EFSP_ARQ_SEQSPACE                                               ( 256u )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_ARQ_IsStatusStillCoherent(const t_eFSP_ARQ_Ctx* p_ptCtx);
+static e_eFSP_ARQ_RES eFSP_ARQ_CheckCtx(const t_eFSP_ARQ_Ctx* p_ptCtx);
+static e_eFSP_ARQ_RES eFSP_ARQ_RxStep(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+static e_eFSP_ARQ_RES eFSP_ARQ_ElabFrame(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                         const uint32_t p_uDataL, const uint32_t p_uNowMs);
+static void eFSP_ARQ_ElabData(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t p_uSeq, const uint8_t* p_puData,
+                              const uint32_t p_uDataL);
+static e_eFSP_ARQ_RES eFSP_ARQ_ElabAck(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t p_uCumAck,
+                                       const uint32_t p_uSackMask, const uint32_t p_uNowMs);
+static e_eFSP_ARQ_RES eFSP_ARQ_AddSample(t_eFSP_ARQ_Ctx* const p_ptCtx, const t_eFSP_ARQ_Slot* p_ptSlot,
+                                         const uint32_t p_uNowMs);
+static e_eFSP_ARQ_RES eFSP_ARQ_TxStep(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+static e_eFSP_ARQ_RES eFSP_ARQ_StartNext(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+static void eFSP_ARQ_FillAck(const t_eFSP_ARQ_Ctx* p_ptCtx, uint8_t* p_puAck);
+static e_eFSP_ARQ_RES eFSP_ARQ_StartFrame(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t* p_puHead,
+                                          const uint32_t p_uHeadL, const uint8_t* p_puData, const uint32_t p_uDataL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_ARQ_RES eFSP_ARQ_InitCtx(t_eFSP_ARQ_Ctx* const p_ptCtx, const t_eFSP_ARQ_InitData* p_ptInitData)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+    uint8_t* l_puTxData;
+    uint32_t l_uTxMaxL;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptInitData ) )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check pointer validity */
+        if( ( NULL == p_ptInitData->ptIMsgTx ) || ( NULL == p_ptInitData->ptIMsgRx ) ||
+            ( NULL == p_ptInitData->puIMemArea ) )
+        {
+            l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+        }
+        else
+        {
+            /* Check data validity, the window must be a power of two and the memory must contain the retained
+             * payloads and the reordering buffer */
+            if( ( p_ptInitData->uIWindow < 1u ) || ( p_ptInitData->uIWindow > EFSP_ARQ_MAXWINDOW ) ||
+                ( 0u != ( p_ptInitData->uIWindow & ( p_ptInitData->uIWindow - 1u ) ) ) ||
+                ( p_ptInitData->uISlotL < 1u ) || ( p_ptInitData->uIRtoMs < 1u ) ||
+                ( p_ptInitData->uISlotL > ( MAX_UINT32VAL / ( 2u * EFSP_ARQ_MAXWINDOW ) ) ) ||
+                ( p_ptInitData->uIMemAreaL < ( 2u * p_ptInitData->uIWindow * p_ptInitData->uISlotL ) ) )
+            {
+                l_eRes = e_eFSP_ARQ_RES_BADPARAM;
+            }
+            else
+            {
+                /* The transmitter must be initialized and able to contain a whole frame */
+                if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_GetWherePutData(p_ptInitData->ptIMsgTx, &l_puTxData,
+                                                                      &l_uTxMaxL) )
+                {
+                    l_eRes = e_eFSP_ARQ_RES_BADPARAM;
+                }
+                else if( l_uTxMaxL < ( p_ptInitData->uISlotL + EFSP_ARQ_PIGGYHEADERSIZE ) )
+                {
+                    l_eRes = e_eFSP_ARQ_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Initialize internal status */
+                    p_ptCtx->ptMsgTx = p_ptInitData->ptIMsgTx;
+                    p_ptCtx->ptMsgRx = p_ptInitData->ptIMsgRx;
+                    p_ptCtx->ptRtte = NULL;
+                    p_ptCtx->puTxArea = p_ptInitData->puIMemArea;
+                    p_ptCtx->puRxArea = &p_ptInitData->puIMemArea[p_ptInitData->uIWindow * p_ptInitData->uISlotL];
+                    p_ptCtx->uSlotL = p_ptInitData->uISlotL;
+                    p_ptCtx->uWindow = p_ptInitData->uIWindow;
+                    p_ptCtx->uRtoMs = p_ptInitData->uIRtoMs;
+
+                    for( l_uIdx = 0u; l_uIdx < EFSP_ARQ_MAXWINDOW; l_uIdx++ )
+                    {
+                        p_ptCtx->atTxSlot[l_uIdx].eState = e_eFSP_ARQ_SLOT_FREE;
+                        p_ptCtx->atTxSlot[l_uIdx].uLen = 0u;
+                        p_ptCtx->atTxSlot[l_uIdx].uSentMs = 0u;
+                        p_ptCtx->atTxSlot[l_uIdx].bRetx = false;
+                        p_ptCtx->auRxLen[l_uIdx] = 0u;
+                    }
+
+                    p_ptCtx->uRxMask = 0u;
+                    p_ptCtx->uTxBase = 0u;
+                    p_ptCtx->uTxNext = 0u;
+                    p_ptCtx->uRxNext = 0u;
+                    p_ptCtx->bAckPend = false;
+                    p_ptCtx->bAckArmed = false;
+                    p_ptCtx->uAckDelayMs = 0u;
+                    p_ptCtx->uAckPendMs = 0u;
+                    p_ptCtx->bTxBusy = false;
+                    p_ptCtx->uRetxN = 0u;
+                    p_ptCtx->bIsInit = true;
+
+                    l_eRes = e_eFSP_ARQ_RES_OK;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_IsInit(t_eFSP_ARQ_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_ARQ_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_SetRtte(t_eFSP_ARQ_Ctx* const p_ptCtx, t_eFSP_RTTE_Ctx* const p_ptRtte)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_ARQ_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            if( NULL == p_ptRtte )
+            {
+                p_ptCtx->ptRtte = NULL;
+            }
+            else
+            {
+                l_bIsInit = false;
+                if( ( e_eFSP_RTTE_RES_OK != eFSP_RTTE_IsInit(p_ptRtte, &l_bIsInit) ) || ( true != l_bIsInit ) )
+                {
+                    l_eRes = e_eFSP_ARQ_RES_BADPARAM;
+                }
+                else
+                {
+                    p_ptCtx->ptRtte = p_ptRtte;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_SetAckDelay(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uAckDelayMs)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_ARQ_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            p_ptCtx->uAckDelayMs = p_uAckDelayMs;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_Send(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+    t_eFSP_ARQ_Slot* l_ptSlot;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_ARQ_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            if( p_uDataL > p_ptCtx->uSlotL )
+            {
+                l_eRes = e_eFSP_ARQ_RES_BADPARAM;
+            }
+            else if( (uint8_t)( p_ptCtx->uTxNext - p_ptCtx->uTxBase ) >= p_ptCtx->uWindow )
+            {
+                l_eRes = e_eFSP_ARQ_RES_WINDOWFULL;
+            }
+            else
+            {
+                /* Retain the payload until it's acknowledged */
+                l_uIdx = (uint32_t)p_ptCtx->uTxNext & ( p_ptCtx->uWindow - 1u );
+                l_ptSlot = &p_ptCtx->atTxSlot[l_uIdx];
+                (void)memcpy(&p_ptCtx->puTxArea[l_uIdx * p_ptCtx->uSlotL], p_puData, p_uDataL);
+                l_ptSlot->uLen = p_uDataL;
+                l_ptSlot->bRetx = false;
+                l_ptSlot->eState = e_eFSP_ARQ_SLOT_QUEUED;
+                p_ptCtx->uTxNext++;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_Recv(t_eFSP_ARQ_Ctx* const p_ptCtx, uint8_t* p_puData, const uint32_t p_uDataMaxL,
+                             uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_ARQ_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            l_uIdx = (uint32_t)p_ptCtx->uRxNext & ( p_ptCtx->uWindow - 1u );
+
+            if( 0u == ( p_ptCtx->uRxMask & ( 1u << l_uIdx ) ) )
+            {
+                l_eRes = e_eFSP_ARQ_RES_NODATA;
+            }
+            else if( p_ptCtx->auRxLen[l_uIdx] > p_uDataMaxL )
+            {
+                l_eRes = e_eFSP_ARQ_RES_BADPARAM;
+            }
+            else
+            {
+                (void)memcpy(p_puData, &p_ptCtx->puRxArea[l_uIdx * p_ptCtx->uSlotL], p_ptCtx->auRxLen[l_uIdx]);
+                *p_puDataL = p_ptCtx->auRxLen[l_uIdx];
+                p_ptCtx->uRxMask &= ~( 1u << l_uIdx );
+                p_ptCtx->uRxNext++;
+
+                /* The window is moved, let the peer know it */
+                p_ptCtx->bAckPend = true;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_Process(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_ARQ_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            /* Receive first, so an acknowledge can free the window before choosing what to send */
+            l_eRes = eFSP_ARQ_RxStep(p_ptCtx, p_uNowMs);
+
+            if( e_eFSP_ARQ_RES_OK == l_eRes )
+            {
+                l_eRes = eFSP_ARQ_TxStep(p_ptCtx, p_uNowMs);
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_ARQ_RES eFSP_ARQ_GetPending(t_eFSP_ARQ_Ctx* const p_ptCtx, uint32_t* const p_puPendingN)
+{
+	/* Local variable */
+	e_eFSP_ARQ_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puPendingN ) )
+	{
+		l_eRes = e_eFSP_ARQ_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_ARQ_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            *p_puPendingN = (uint32_t)( (uint8_t)( p_ptCtx->uTxNext - p_ptCtx->uTxBase ) );
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_ARQ_IsStatusStillCoherent(const t_eFSP_ARQ_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->ptMsgTx ) || ( NULL == p_ptCtx->ptMsgRx ) || ( NULL == p_ptCtx->puTxArea ) ||
+        ( NULL == p_ptCtx->puRxArea ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check window validity */
+        if( ( p_ptCtx->uWindow < 1u ) || ( p_ptCtx->uWindow > EFSP_ARQ_MAXWINDOW ) ||
+            ( 0u != ( p_ptCtx->uWindow & ( p_ptCtx->uWindow - 1u ) ) ) || ( p_ptCtx->uSlotL < 1u ) ||
+            ( p_ptCtx->uRtoMs < 1u ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Check sequence validity, never more frames than the window and never a frame outside of it */
+            if( ( (uint8_t)( p_ptCtx->uTxNext - p_ptCtx->uTxBase ) > p_ptCtx->uWindow ) ||
+                ( ( p_ptCtx->uWindow < EFSP_ARQ_MAXWINDOW ) && ( 0u != ( p_ptCtx->uRxMask >> p_ptCtx->uWindow ) ) ) )
+            {
+                l_bRes = false;
+            }
+            else
+            {
+                l_bRes = true;
+            }
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_CheckCtx(const t_eFSP_ARQ_Ctx* p_ptCtx)
+{
+    e_eFSP_ARQ_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_ARQ_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_ARQ_IsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_ARQ_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_ARQ_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_RxStep(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+    e_eFSP_ARQ_RES l_eRes;
+    e_eFSP_MSGRX_RES l_eResRx;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    bool_t l_bRestart;
+
+    l_eResRx = eFSP_MSGRX_ReceiveChunk(p_ptCtx->ptMsgRx);
+    l_bRestart = false;
+
+    switch( l_eResRx )
+    {
+        case e_eFSP_MSGRX_RES_OK:
+        case e_eFSP_MSGRX_RES_FRAMERESTART:
+        {
+            /* Frame not completed yet */
+            l_eRes = e_eFSP_ARQ_RES_OK;
+            break;
+        }
+
+        case e_eFSP_MSGRX_RES_MESSAGERECEIVED:
+        {
+            if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(p_ptCtx->ptMsgRx, &l_puData, &l_uDataL) )
+            {
+                l_eRes = eFSP_ARQ_ElabFrame(p_ptCtx, l_puData, l_uDataL, p_uNowMs);
+                l_bRestart = true;
+            }
+            else
+            {
+                l_eRes = e_eFSP_ARQ_RES_MSGRXERROR;
+            }
+            break;
+        }
+
+        case e_eFSP_MSGRX_RES_BADFRAME:
+        case e_eFSP_MSGRX_RES_MESSAGETIMEOUT:
+        case e_eFSP_MSGRX_RES_OUTOFMEM:
+        {
+            /* The frame is lost, the peer will send it again */
+            l_eRes = e_eFSP_ARQ_RES_OK;
+            l_bRestart = true;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eFSP_ARQ_RES_MSGRXERROR;
+            break;
+        }
+    }
+
+    if( ( e_eFSP_ARQ_RES_OK == l_eRes ) && ( true == l_bRestart ) )
+    {
+        if( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_NewMsg(p_ptCtx->ptMsgRx) )
+        {
+            l_eRes = e_eFSP_ARQ_RES_MSGRXERROR;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_ElabFrame(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                         const uint32_t p_uDataL, const uint32_t p_uNowMs)
+{
+    e_eFSP_ARQ_RES l_eRes;
+    uint32_t l_uSackMask;
+
+    l_eRes = e_eFSP_ARQ_RES_OK;
+
+    if( ( EFSP_ARQ_HEADERSIZE <= p_uDataL ) && ( EFSP_ARQ_TYPEDATA == p_puData[0u] ) )
+    {
+        eFSP_ARQ_ElabData(p_ptCtx, p_puData[1u], &p_puData[EFSP_ARQ_HEADERSIZE], p_uDataL - EFSP_ARQ_HEADERSIZE);
+    }
+    else if( ( EFSP_ARQ_ACKSIZE == p_uDataL ) && ( EFSP_ARQ_TYPEACK == p_puData[0u] ) )
+    {
+        l_uSackMask =  (uint32_t)p_puData[2u];
+        l_uSackMask |= ( (uint32_t)p_puData[3u] ) << 8u;
+        l_uSackMask |= ( (uint32_t)p_puData[4u] ) << 16u;
+        l_uSackMask |= ( (uint32_t)p_puData[5u] ) << 24u;
+
+        l_eRes = eFSP_ARQ_ElabAck(p_ptCtx, p_puData[1u], l_uSackMask, p_uNowMs);
+    }
+    else if( ( EFSP_ARQ_PIGGYHEADERSIZE <= p_uDataL ) && ( EFSP_ARQ_TYPEDATAACK == p_puData[0u] ) )
+    {
+        /* Acknowledge first, the window of the peer is updated even if the payload is discarded */
+        l_uSackMask =  (uint32_t)p_puData[3u];
+        l_uSackMask |= ( (uint32_t)p_puData[4u] ) << 8u;
+        l_uSackMask |= ( (uint32_t)p_puData[5u] ) << 16u;
+        l_uSackMask |= ( (uint32_t)p_puData[6u] ) << 24u;
+
+        l_eRes = eFSP_ARQ_ElabAck(p_ptCtx, p_puData[2u], l_uSackMask, p_uNowMs);
+        eFSP_ARQ_ElabData(p_ptCtx, p_puData[1u], &p_puData[EFSP_ARQ_PIGGYHEADERSIZE],
+                          p_uDataL - EFSP_ARQ_PIGGYHEADERSIZE);
+    }
+    else
+    {
+        /* Unknown frame, discard */
+    }
+
+    return l_eRes;
+}
+
+static void eFSP_ARQ_ElabData(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t p_uSeq, const uint8_t* p_puData,
+                              const uint32_t p_uDataL)
+{
+    uint8_t l_uOff;
+    uint32_t l_uIdx;
+
+    l_uOff = (uint8_t)( p_uSeq - p_ptCtx->uRxNext );
+
+    if( l_uOff < p_ptCtx->uWindow )
+    {
+        /* Inside the receive window, store it once */
+        l_uIdx = (uint32_t)p_uSeq & ( p_ptCtx->uWindow - 1u );
+        if( ( 0u == ( p_ptCtx->uRxMask & ( 1u << l_uIdx ) ) ) && ( p_uDataL <= p_ptCtx->uSlotL ) )
+        {
+            (void)memcpy(&p_ptCtx->puRxArea[l_uIdx * p_ptCtx->uSlotL], p_puData, p_uDataL);
+            p_ptCtx->auRxLen[l_uIdx] = p_uDataL;
+            p_ptCtx->uRxMask |= ( 1u << l_uIdx );
+        }
+        p_ptCtx->bAckPend = true;
+    }
+    else if( l_uOff >= ( EFSP_ARQ_SEQSPACE - p_ptCtx->uWindow ) )
+    {
+        /* Already retrived, the acknowledge was lost */
+        p_ptCtx->bAckPend = true;
+    }
+    else
+    {
+        /* Outside of any valid window, discard */
+    }
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_ElabAck(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t p_uCumAck,
+                                       const uint32_t p_uSackMask, const uint32_t p_uNowMs)
+{
+    e_eFSP_ARQ_RES l_eRes;
+    t_eFSP_ARQ_Slot* l_ptSlot;
+    uint8_t l_uSeq;
+    uint32_t l_uBit;
+
+    l_eRes = e_eFSP_ARQ_RES_OK;
+
+    /* An acknowledge older than the window base or after the last sent frame is stale */
+    if( (uint8_t)( p_uCumAck - p_ptCtx->uTxBase ) <= (uint8_t)( p_ptCtx->uTxNext - p_ptCtx->uTxBase ) )
+    {
+        /* Cumulative part, every frame before p_uCumAck is retrived by the peer */
+        while( ( e_eFSP_ARQ_RES_OK == l_eRes ) && ( p_uCumAck != p_ptCtx->uTxBase ) )
+        {
+            l_ptSlot = &p_ptCtx->atTxSlot[(uint32_t)p_ptCtx->uTxBase & ( p_ptCtx->uWindow - 1u )];
+            l_eRes = eFSP_ARQ_AddSample(p_ptCtx, l_ptSlot, p_uNowMs);
+            l_ptSlot->eState = e_eFSP_ARQ_SLOT_FREE;
+            p_ptCtx->uTxBase++;
+        }
+
+        /* Selective part, bit n is the frame p_uCumAck + n, stored by the peer but not retrived yet */
+        l_uBit = 0u;
+        while( ( e_eFSP_ARQ_RES_OK == l_eRes ) && ( l_uBit < p_ptCtx->uWindow ) )
+        {
+            l_uSeq = (uint8_t)( p_uCumAck + l_uBit );
+            if( ( 0u != ( p_uSackMask & ( 1u << l_uBit ) ) ) &&
+                ( (uint8_t)( l_uSeq - p_ptCtx->uTxBase ) < (uint8_t)( p_ptCtx->uTxNext - p_ptCtx->uTxBase ) ) )
+            {
+                l_ptSlot = &p_ptCtx->atTxSlot[(uint32_t)l_uSeq & ( p_ptCtx->uWindow - 1u )];
+                l_eRes = eFSP_ARQ_AddSample(p_ptCtx, l_ptSlot, p_uNowMs);
+                if( e_eFSP_ARQ_SLOT_INFLIGHT == l_ptSlot->eState )
+                {
+                    /* Restart the timer, it's now used to probe a lost cumulative acknowledge */
+                    l_ptSlot->eState = e_eFSP_ARQ_SLOT_SACKED;
+                    l_ptSlot->uSentMs = p_uNowMs;
+                }
+            }
+            l_uBit++;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_AddSample(t_eFSP_ARQ_Ctx* const p_ptCtx, const t_eFSP_ARQ_Slot* p_ptSlot,
+                                         const uint32_t p_uNowMs)
+{
+    e_eFSP_ARQ_RES l_eRes;
+
+    /* Only the first acknowledge of a frame sent once is a valid sample */
+    if( ( NULL != p_ptCtx->ptRtte ) && ( e_eFSP_ARQ_SLOT_INFLIGHT == p_ptSlot->eState ) &&
+        ( false == p_ptSlot->bRetx ) )
+    {
+        if( e_eFSP_RTTE_RES_OK != eFSP_RTTE_AddSample(p_ptCtx->ptRtte, p_uNowMs - p_ptSlot->uSentMs) )
+        {
+            l_eRes = e_eFSP_ARQ_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_ARQ_RES_OK;
+        }
+    }
+    else
+    {
+        l_eRes = e_eFSP_ARQ_RES_OK;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_TxStep(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+    e_eFSP_ARQ_RES l_eRes;
+    e_eFSP_MSGTX_RES l_eResTx;
+
+    /* The acknowledge delay start from the first call that see it pending */
+    if( ( true == p_ptCtx->bAckPend ) && ( false == p_ptCtx->bAckArmed ) )
+    {
+        p_ptCtx->uAckPendMs = p_uNowMs;
+        p_ptCtx->bAckArmed = true;
+    }
+
+    if( false == p_ptCtx->bTxBusy )
+    {
+        l_eRes = eFSP_ARQ_StartNext(p_ptCtx, p_uNowMs);
+    }
+    else
+    {
+        l_eRes = e_eFSP_ARQ_RES_OK;
+    }
+
+    if( ( e_eFSP_ARQ_RES_OK == l_eRes ) && ( true == p_ptCtx->bTxBusy ) )
+    {
+        l_eResTx = eFSP_MSGTX_SendChunk(p_ptCtx->ptMsgTx);
+
+        switch( l_eResTx )
+        {
+            case e_eFSP_MSGTX_RES_OK:
+            {
+                /* Frame not completed yet */
+                break;
+            }
+
+            case e_eFSP_MSGTX_RES_MESSAGESENDED:
+            case e_eFSP_MSGTX_RES_MESSAGETIMEOUT:
+            {
+                /* A frame not sent in time is handled as a lost frame */
+                p_ptCtx->bTxBusy = false;
+                break;
+            }
+
+            default:
+            {
+                p_ptCtx->bTxBusy = false;
+                l_eRes = e_eFSP_ARQ_RES_MSGTXERROR;
+                break;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_StartNext(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+    e_eFSP_ARQ_RES l_eRes;
+    t_eFSP_ARQ_Slot* l_ptSlot;
+    uint8_t l_auHead[EFSP_ARQ_PIGGYHEADERSIZE];
+    uint32_t l_uRto;
+    uint32_t l_uIdx;
+    uint32_t l_uOff;
+    uint32_t l_uPendN;
+    bool_t l_bFound;
+    bool_t l_bRetx;
+
+    l_eRes = e_eFSP_ARQ_RES_OK;
+    l_uRto = p_ptCtx->uRtoMs;
+    l_uIdx = 0u;
+    l_ptSlot = NULL;
+
+    if( NULL != p_ptCtx->ptRtte )
+    {
+        if( e_eFSP_RTTE_RES_OK != eFSP_RTTE_GetRto(p_ptCtx->ptRtte, &l_uRto) )
+        {
+            l_eRes = e_eFSP_ARQ_RES_CORRUPTCTX;
+        }
+    }
+
+    /* Oldest frame first: a frame with an expired timeout, otherwise the first one never sent. A selectively
+     * acknowledged frame is sent again only when it's the oldest one, the peer has retrived it but the acknowledge
+     * was lost, and nothing else would make the peer send a new one */
+    l_uPendN = (uint32_t)( (uint8_t)( p_ptCtx->uTxNext - p_ptCtx->uTxBase ) );
+    l_bFound = false;
+    l_bRetx = false;
+    l_uOff = 0u;
+    while( ( e_eFSP_ARQ_RES_OK == l_eRes ) && ( false == l_bFound ) && ( l_uOff < l_uPendN ) )
+    {
+        l_uIdx = ( (uint32_t)p_ptCtx->uTxBase + l_uOff ) & ( p_ptCtx->uWindow - 1u );
+        l_ptSlot = &p_ptCtx->atTxSlot[l_uIdx];
+
+        if( ( ( e_eFSP_ARQ_SLOT_INFLIGHT == l_ptSlot->eState ) ||
+              ( ( e_eFSP_ARQ_SLOT_SACKED == l_ptSlot->eState ) && ( 0u == l_uOff ) ) ) &&
+            ( ( p_uNowMs - l_ptSlot->uSentMs ) >= l_uRto ) )
+        {
+            l_bFound = true;
+            l_bRetx = true;
+        }
+        else if( e_eFSP_ARQ_SLOT_QUEUED == l_ptSlot->eState )
+        {
+            l_bFound = true;
+        }
+        else
+        {
+            l_uOff++;
+        }
+    }
+
+    if( e_eFSP_ARQ_RES_OK == l_eRes )
+    {
+        if( ( true == l_bFound ) && ( NULL != l_ptSlot ) )
+        {
+            /* A pending acknowledge travel for free in the header of the data frame */
+            l_auHead[1u] = (uint8_t)( p_ptCtx->uTxBase + l_uOff );
+            if( true == p_ptCtx->bAckPend )
+            {
+                l_auHead[0u] = (uint8_t)EFSP_ARQ_TYPEDATAACK;
+                eFSP_ARQ_FillAck(p_ptCtx, &l_auHead[EFSP_ARQ_HEADERSIZE]);
+                l_eRes = eFSP_ARQ_StartFrame(p_ptCtx, l_auHead, EFSP_ARQ_PIGGYHEADERSIZE,
+                                             &p_ptCtx->puTxArea[l_uIdx * p_ptCtx->uSlotL], l_ptSlot->uLen);
+                if( e_eFSP_ARQ_RES_OK == l_eRes )
+                {
+                    p_ptCtx->bAckPend = false;
+                    p_ptCtx->bAckArmed = false;
+                }
+            }
+            else
+            {
+                l_auHead[0u] = (uint8_t)EFSP_ARQ_TYPEDATA;
+                l_eRes = eFSP_ARQ_StartFrame(p_ptCtx, l_auHead, EFSP_ARQ_HEADERSIZE,
+                                             &p_ptCtx->puTxArea[l_uIdx * p_ptCtx->uSlotL], l_ptSlot->uLen);
+            }
+
+            /* A frame not handed to the transmitter keeps its state, it's picked again on the next call */
+            if( e_eFSP_ARQ_RES_OK == l_eRes )
+            {
+                if( true == l_bRetx )
+                {
+                    l_ptSlot->bRetx = true;
+                    p_ptCtx->uRetxN++;
+
+                    /* The oldest frame is lost again, the link is slower than expected */
+                    if( ( 0u == l_uOff ) && ( NULL != p_ptCtx->ptRtte ) &&
+                        ( e_eFSP_RTTE_RES_OK != eFSP_RTTE_Backoff(p_ptCtx->ptRtte) ) )
+                    {
+                        l_eRes = e_eFSP_ARQ_RES_CORRUPTCTX;
+                    }
+                }
+
+                l_ptSlot->eState = e_eFSP_ARQ_SLOT_INFLIGHT;
+                l_ptSlot->uSentMs = p_uNowMs;
+            }
+        }
+        else if( ( true == p_ptCtx->bAckPend ) && ( ( p_uNowMs - p_ptCtx->uAckPendMs ) >= p_ptCtx->uAckDelayMs ) )
+        {
+            /* No data to carry it, a standalone acknowledge can not be delayed any more */
+            l_auHead[0u] = (uint8_t)EFSP_ARQ_TYPEACK;
+            eFSP_ARQ_FillAck(p_ptCtx, &l_auHead[1u]);
+            l_eRes = eFSP_ARQ_StartFrame(p_ptCtx, l_auHead, EFSP_ARQ_ACKSIZE, NULL, 0u);
+            if( e_eFSP_ARQ_RES_OK == l_eRes )
+            {
+                p_ptCtx->bAckPend = false;
+                p_ptCtx->bAckArmed = false;
+            }
+        }
+        else
+        {
+            /* Nothing to send */
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eFSP_ARQ_FillAck(const t_eFSP_ARQ_Ctx* p_ptCtx, uint8_t* p_puAck)
+{
+    uint32_t l_uSackMask;
+    uint32_t l_uIdx;
+    uint32_t l_uOff;
+
+    /* Bit n of the selective mask is the frame uRxNext + n */
+    l_uSackMask = 0u;
+    for( l_uOff = 0u; l_uOff < p_ptCtx->uWindow; l_uOff++ )
+    {
+        l_uIdx = ( (uint32_t)p_ptCtx->uRxNext + l_uOff ) & ( p_ptCtx->uWindow - 1u );
+        if( 0u != ( p_ptCtx->uRxMask & ( 1u << l_uIdx ) ) )
+        {
+            l_uSackMask |= ( 1u << l_uOff );
+        }
+    }
+
+    p_puAck[0u] = p_ptCtx->uRxNext;
+    p_puAck[1u] = (uint8_t) ( ( l_uSackMask        ) & 0x000000FFu );
+    p_puAck[2u] = (uint8_t) ( ( l_uSackMask >> 8u  ) & 0x000000FFu );
+    p_puAck[3u] = (uint8_t) ( ( l_uSackMask >> 16u ) & 0x000000FFu );
+    p_puAck[4u] = (uint8_t) ( ( l_uSackMask >> 24u ) & 0x000000FFu );
+}
+
+static e_eFSP_ARQ_RES eFSP_ARQ_StartFrame(t_eFSP_ARQ_Ctx* const p_ptCtx, const uint8_t* p_puHead,
+                                          const uint32_t p_uHeadL, const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    e_eFSP_ARQ_RES l_eRes;
+    uint8_t* l_puTxData;
+    uint32_t l_uTxMaxL;
+
+    if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_GetWherePutData(p_ptCtx->ptMsgTx, &l_puTxData, &l_uTxMaxL) )
+    {
+        l_eRes = e_eFSP_ARQ_RES_MSGTXERROR;
+    }
+    else if( l_uTxMaxL < ( p_uHeadL + p_uDataL ) )
+    {
+        l_eRes = e_eFSP_ARQ_RES_MSGTXERROR;
+    }
+    else
+    {
+        /* The payload is retained here, the frame is encoded again by the transmitter every time it's sent */
+        (void)memcpy(l_puTxData, p_puHead, p_uHeadL);
+        if( p_uDataL > 0u )
+        {
+            (void)memcpy(&l_puTxData[p_uHeadL], p_puData, p_uDataL);
+        }
+
+        if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_NewMessage(p_ptCtx->ptMsgTx, p_uHeadL + p_uDataL) )
+        {
+            l_eRes = e_eFSP_ARQ_RES_MSGTXERROR;
+        }
+        else
+        {
+            p_ptCtx->bTxBusy = true;
+            l_eRes = e_eFSP_ARQ_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
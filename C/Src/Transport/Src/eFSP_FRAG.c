@@ -0,0 +1,680 @@
+/**
+ * @file       eFSP_FRAG.c
+ *
+ * @brief      Fragmentation and reassembly of messages bigger than the buffers of the link
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_FRAG.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_FRAG_TxIsStatusStillCoherent(const t_eFSP_FRAG_TxCtx* p_ptCtx);
+static e_eFSP_FRAG_RES eFSP_FRAG_TxCheckCtx(const t_eFSP_FRAG_TxCtx* p_ptCtx);
+static bool_t eFSP_FRAG_RxIsStatusStillCoherent(const t_eFSP_FRAG_RxCtx* p_ptCtx);
+static e_eFSP_FRAG_RES eFSP_FRAG_RxCheckCtx(const t_eFSP_FRAG_RxCtx* p_ptCtx);
+static uint32_t eFSP_FRAG_GetFragN(const uint32_t p_uDataL, const uint32_t p_uFragL);
+static e_eFSP_FRAG_RES eFSP_FRAG_TxBuildFrag(const t_eFSP_FRAG_TxCtx* p_ptCtx, const uint32_t p_uFragIdx,
+                                             uint8_t* p_puFrag, const uint32_t p_uFragMaxL, uint32_t* const p_puFragL);
+static e_eFSP_FRAG_RES eFSP_FRAG_RxStartMsg(t_eFSP_FRAG_RxCtx* const p_ptCtx, const uint8_t p_uMsgId,
+                                            const uint32_t p_uDataL, const uint32_t p_uFragL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_FRAG_RES eFSP_FRAG_TxInitCtx(t_eFSP_FRAG_TxCtx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Initialize internal status */
+        p_ptCtx->puData = NULL;
+        p_ptCtx->uDataL = 0u;
+        p_ptCtx->uFragL = 0u;
+        p_ptCtx->uFragN = 0u;
+        p_ptCtx->uNextIdx = 0u;
+        p_ptCtx->uMsgId = 0u;
+        p_ptCtx->bHasMsg = false;
+        p_ptCtx->bIsInit = true;
+
+        l_eRes = e_eFSP_FRAG_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_TxIsInit(t_eFSP_FRAG_TxCtx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_FRAG_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_TxNewMsg(t_eFSP_FRAG_TxCtx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL,
+                                   const uint32_t p_uFragL)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_TxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            if( ( p_uDataL < 1u ) || ( p_uFragL < 1u ) || ( p_uFragL > EFSP_FRAG_MAXFRAGL ) )
+            {
+                l_eRes = e_eFSP_FRAG_RES_BADPARAM;
+            }
+            else if( eFSP_FRAG_GetFragN(p_uDataL, p_uFragL) > EFSP_FRAG_MAXFRAGN )
+            {
+                l_eRes = e_eFSP_FRAG_RES_BADPARAM;
+            }
+            else
+            {
+                /* A new ID let the peer discard what is left of the previous message */
+                if( true == p_ptCtx->bHasMsg )
+                {
+                    p_ptCtx->uMsgId++;
+                }
+
+                p_ptCtx->puData = p_puData;
+                p_ptCtx->uDataL = p_uDataL;
+                p_ptCtx->uFragL = p_uFragL;
+                p_ptCtx->uFragN = eFSP_FRAG_GetFragN(p_uDataL, p_uFragL);
+                p_ptCtx->uNextIdx = 0u;
+                p_ptCtx->bHasMsg = true;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_TxGetFrag(t_eFSP_FRAG_TxCtx* const p_ptCtx, uint8_t* p_puFrag, const uint32_t p_uFragMaxL,
+                                    uint32_t* const p_puFragL)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrag ) || ( NULL == p_puFragL ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_TxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            if( false == p_ptCtx->bHasMsg )
+            {
+                l_eRes = e_eFSP_FRAG_RES_NOINITMESSAGE;
+            }
+            else if( p_ptCtx->uNextIdx >= p_ptCtx->uFragN )
+            {
+                l_eRes = e_eFSP_FRAG_RES_MESSAGEENDED;
+            }
+            else
+            {
+                l_eRes = eFSP_FRAG_TxBuildFrag(p_ptCtx, p_ptCtx->uNextIdx, p_puFrag, p_uFragMaxL, p_puFragL);
+
+                if( e_eFSP_FRAG_RES_OK == l_eRes )
+                {
+                    p_ptCtx->uNextIdx++;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_TxGetFragAt(t_eFSP_FRAG_TxCtx* const p_ptCtx, const uint32_t p_uFragIdx, uint8_t* p_puFrag,
+                                      const uint32_t p_uFragMaxL, uint32_t* const p_puFragL)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrag ) || ( NULL == p_puFragL ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_TxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            if( false == p_ptCtx->bHasMsg )
+            {
+                l_eRes = e_eFSP_FRAG_RES_NOINITMESSAGE;
+            }
+            else if( p_uFragIdx >= p_ptCtx->uFragN )
+            {
+                l_eRes = e_eFSP_FRAG_RES_BADPARAM;
+            }
+            else
+            {
+                l_eRes = eFSP_FRAG_TxBuildFrag(p_ptCtx, p_uFragIdx, p_puFrag, p_uFragMaxL, p_puFragL);
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_RxInitCtx(t_eFSP_FRAG_RxCtx* const p_ptCtx, const t_eFSP_FRAG_RxInitData* p_ptInitData)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptInitData ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check pointer validity, a data area or a sink is needed */
+        if( ( NULL == p_ptInitData->puIMapArea ) ||
+            ( ( NULL == p_ptInitData->puIDataArea ) && ( NULL == p_ptInitData->fISink ) ) )
+        {
+            l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+        }
+        else if( ( p_ptInitData->uIMapAreaL < 1u ) ||
+                 ( ( NULL != p_ptInitData->puIDataArea ) && ( p_ptInitData->uIDataAreaL < 1u ) ) )
+        {
+            l_eRes = e_eFSP_FRAG_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->puDataArea = p_ptInitData->puIDataArea;
+            p_ptCtx->uDataAreaL = p_ptInitData->uIDataAreaL;
+            p_ptCtx->fSink = p_ptInitData->fISink;
+            p_ptCtx->ptSinkCtx = p_ptInitData->ptISinkCtx;
+            p_ptCtx->puMapArea = p_ptInitData->puIMapArea;
+            p_ptCtx->uMapAreaL = p_ptInitData->uIMapAreaL;
+            p_ptCtx->bHasMsg = false;
+            p_ptCtx->uMsgId = 0u;
+            p_ptCtx->uDataL = 0u;
+            p_ptCtx->uFragL = 0u;
+            p_ptCtx->uFragN = 0u;
+            p_ptCtx->uRecvN = 0u;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_FRAG_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_RxIsInit(t_eFSP_FRAG_RxCtx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_FRAG_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_RxNewMsg(t_eFSP_FRAG_RxCtx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_RxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            p_ptCtx->bHasMsg = false;
+            p_ptCtx->uRecvN = 0u;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_RxInsFrag(t_eFSP_FRAG_RxCtx* const p_ptCtx, const uint8_t* p_puFrag,
+                                    const uint32_t p_uFragL)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+    uint8_t l_uMsgId;
+    uint32_t l_uIdx;
+    uint32_t l_uFragL;
+    uint32_t l_uDataL;
+    uint32_t l_uFragN;
+    uint32_t l_uOffset;
+    uint32_t l_uPayL;
+    uint8_t l_uBit;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFrag ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_RxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            if( p_uFragL <= EFSP_FRAG_HEADERSIZE )
+            {
+                l_eRes = e_eFSP_FRAG_RES_BADFRAME;
+            }
+            else
+            {
+                /* Decode the header */
+                l_uMsgId  = p_puFrag[0u];
+                l_uIdx    =   (uint32_t)p_puFrag[1u];
+                l_uIdx   |= ( (uint32_t)p_puFrag[2u] ) << 8u;
+                l_uFragL  =   (uint32_t)p_puFrag[3u];
+                l_uFragL |= ( (uint32_t)p_puFrag[4u] ) << 8u;
+                l_uDataL  =   (uint32_t)p_puFrag[5u];
+                l_uDataL |= ( (uint32_t)p_puFrag[6u] ) << 8u;
+                l_uDataL |= ( (uint32_t)p_puFrag[7u] ) << 16u;
+                l_uDataL |= ( (uint32_t)p_puFrag[8u] ) << 24u;
+
+                if( ( l_uFragL < 1u ) || ( l_uDataL < 1u ) )
+                {
+                    l_eRes = e_eFSP_FRAG_RES_BADFRAME;
+                }
+                else
+                {
+                    /* Only the last fragment can be smaller than the others */
+                    l_uFragN = eFSP_FRAG_GetFragN(l_uDataL, l_uFragL);
+                    l_uOffset = l_uIdx * l_uFragL;
+                    l_uPayL = l_uFragL;
+
+                    if( ( l_uFragN > EFSP_FRAG_MAXFRAGN ) || ( l_uIdx >= l_uFragN ) )
+                    {
+                        l_eRes = e_eFSP_FRAG_RES_BADFRAME;
+                    }
+                    else
+                    {
+                        if( ( l_uDataL - l_uOffset ) < l_uPayL )
+                        {
+                            l_uPayL = l_uDataL - l_uOffset;
+                        }
+
+                        if( ( p_uFragL - EFSP_FRAG_HEADERSIZE ) != l_uPayL )
+                        {
+                            l_eRes = e_eFSP_FRAG_RES_BADFRAME;
+                        }
+                    }
+                }
+
+                /* A fragment of another message start it from scratch */
+                if( e_eFSP_FRAG_RES_OK == l_eRes )
+                {
+                    if( ( false == p_ptCtx->bHasMsg ) || ( l_uMsgId != p_ptCtx->uMsgId ) ||
+                        ( l_uDataL != p_ptCtx->uDataL ) || ( l_uFragL != p_ptCtx->uFragL ) )
+                    {
+                        l_eRes = eFSP_FRAG_RxStartMsg(p_ptCtx, l_uMsgId, l_uDataL, l_uFragL);
+                    }
+                }
+
+                if( e_eFSP_FRAG_RES_OK == l_eRes )
+                {
+                    l_uBit = (uint8_t)( 1u << ( l_uIdx & 0x07u ) );
+
+                    if( 0u == ( p_ptCtx->puMapArea[l_uIdx >> 3u] & l_uBit ) )
+                    {
+                        if( NULL != p_ptCtx->puDataArea )
+                        {
+                            (void)memcpy(&p_ptCtx->puDataArea[l_uOffset], &p_puFrag[EFSP_FRAG_HEADERSIZE], l_uPayL);
+                        }
+                        else if( true != p_ptCtx->fSink(p_ptCtx->ptSinkCtx, l_uOffset,
+                                                        &p_puFrag[EFSP_FRAG_HEADERSIZE], l_uPayL) )
+                        {
+                            l_eRes = e_eFSP_FRAG_RES_SINKCLBKERROR;
+                        }
+                        else
+                        {
+                            /* Stored by the sink */
+                        }
+
+                        if( e_eFSP_FRAG_RES_OK == l_eRes )
+                        {
+                            p_ptCtx->puMapArea[l_uIdx >> 3u] |= l_uBit;
+                            p_ptCtx->uRecvN++;
+
+                            if( p_ptCtx->uRecvN >= p_ptCtx->uFragN )
+                            {
+                                l_eRes = e_eFSP_FRAG_RES_MESSAGERECEIVED;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_RxGetProgress(t_eFSP_FRAG_RxCtx* const p_ptCtx, uint32_t* const p_puRecvN,
+                                        uint32_t* const p_puFragN)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRecvN ) || ( NULL == p_puFragN ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_RxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            if( false == p_ptCtx->bHasMsg )
+            {
+                l_eRes = e_eFSP_FRAG_RES_NOINITMESSAGE;
+            }
+            else
+            {
+                *p_puRecvN = p_ptCtx->uRecvN;
+                *p_puFragN = p_ptCtx->uFragN;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_FRAG_RES eFSP_FRAG_RxGetMsg(t_eFSP_FRAG_RxCtx* const p_ptCtx, uint8_t** p_ppuData, uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eFSP_FRAG_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eFSP_FRAG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_FRAG_RxCheckCtx(p_ptCtx);
+
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            if( ( false == p_ptCtx->bHasMsg ) || ( p_ptCtx->uRecvN < p_ptCtx->uFragN ) )
+            {
+                l_eRes = e_eFSP_FRAG_RES_NODATA;
+            }
+            else
+            {
+                *p_ppuData = p_ptCtx->puDataArea;
+                *p_puDataL = p_ptCtx->uDataL;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_FRAG_TxIsStatusStillCoherent(const t_eFSP_FRAG_TxCtx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+    if( false == p_ptCtx->bHasMsg )
+    {
+        l_bRes = true;
+    }
+    else if( NULL == p_ptCtx->puData )
+    {
+        l_bRes = false;
+    }
+    else if( ( p_ptCtx->uDataL < 1u ) || ( p_ptCtx->uFragL < 1u ) || ( p_ptCtx->uFragL > EFSP_FRAG_MAXFRAGL ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( p_ptCtx->uFragN != eFSP_FRAG_GetFragN(p_ptCtx->uDataL, p_ptCtx->uFragL) ) ||
+             ( p_ptCtx->uFragN > EFSP_FRAG_MAXFRAGN ) || ( p_ptCtx->uNextIdx > p_ptCtx->uFragN ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static e_eFSP_FRAG_RES eFSP_FRAG_TxCheckCtx(const t_eFSP_FRAG_TxCtx* p_ptCtx)
+{
+    e_eFSP_FRAG_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_FRAG_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_FRAG_TxIsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_FRAG_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_FRAG_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_FRAG_RxIsStatusStillCoherent(const t_eFSP_FRAG_RxCtx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->puMapArea ) || ( ( NULL == p_ptCtx->puDataArea ) && ( NULL == p_ptCtx->fSink ) ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_ptCtx->uMapAreaL < 1u ) || ( ( NULL != p_ptCtx->puDataArea ) && ( p_ptCtx->uDataAreaL < 1u ) ) )
+        {
+            l_bRes = false;
+        }
+        else if( false == p_ptCtx->bHasMsg )
+        {
+            l_bRes = true;
+        }
+        else if( ( p_ptCtx->uDataL < 1u ) || ( p_ptCtx->uFragL < 1u ) || ( p_ptCtx->uFragL > EFSP_FRAG_MAXFRAGL ) )
+        {
+            l_bRes = false;
+        }
+        else if( ( p_ptCtx->uFragN != eFSP_FRAG_GetFragN(p_ptCtx->uDataL, p_ptCtx->uFragL) ) ||
+                 ( ( ( p_ptCtx->uFragN - 1u ) >> 3u ) >= p_ptCtx->uMapAreaL ) ||
+                 ( p_ptCtx->uRecvN > p_ptCtx->uFragN ) )
+        {
+            l_bRes = false;
+        }
+        else if( ( NULL != p_ptCtx->puDataArea ) && ( p_ptCtx->uDataL > p_ptCtx->uDataAreaL ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_FRAG_RES eFSP_FRAG_RxCheckCtx(const t_eFSP_FRAG_RxCtx* p_ptCtx)
+{
+    e_eFSP_FRAG_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_FRAG_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_FRAG_RxIsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_FRAG_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_FRAG_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eFSP_FRAG_GetFragN(const uint32_t p_uDataL, const uint32_t p_uFragL)
+{
+    /* Rounded up without overflow, the sizes are never zero here */
+    return ( ( p_uDataL - 1u ) / p_uFragL ) + 1u;
+}
+
+static e_eFSP_FRAG_RES eFSP_FRAG_TxBuildFrag(const t_eFSP_FRAG_TxCtx* p_ptCtx, const uint32_t p_uFragIdx,
+                                             uint8_t* p_puFrag, const uint32_t p_uFragMaxL, uint32_t* const p_puFragL)
+{
+    e_eFSP_FRAG_RES l_eRes;
+    uint32_t l_uOffset;
+    uint32_t l_uPayL;
+
+    l_uOffset = p_uFragIdx * p_ptCtx->uFragL;
+    l_uPayL = p_ptCtx->uDataL - l_uOffset;
+
+    if( l_uPayL > p_ptCtx->uFragL )
+    {
+        l_uPayL = p_ptCtx->uFragL;
+    }
+
+    if( p_uFragMaxL < ( l_uPayL + EFSP_FRAG_HEADERSIZE ) )
+    {
+        l_eRes = e_eFSP_FRAG_RES_BADPARAM;
+    }
+    else
+    {
+        p_puFrag[0u] = p_ptCtx->uMsgId;
+        p_puFrag[1u] = (uint8_t) ( ( p_uFragIdx              ) & 0x000000FFu );
+        p_puFrag[2u] = (uint8_t) ( ( p_uFragIdx        >> 8u  ) & 0x000000FFu );
+        p_puFrag[3u] = (uint8_t) ( ( p_ptCtx->uFragL         ) & 0x000000FFu );
+        p_puFrag[4u] = (uint8_t) ( ( p_ptCtx->uFragL   >> 8u  ) & 0x000000FFu );
+        p_puFrag[5u] = (uint8_t) ( ( p_ptCtx->uDataL         ) & 0x000000FFu );
+        p_puFrag[6u] = (uint8_t) ( ( p_ptCtx->uDataL   >> 8u  ) & 0x000000FFu );
+        p_puFrag[7u] = (uint8_t) ( ( p_ptCtx->uDataL   >> 16u ) & 0x000000FFu );
+        p_puFrag[8u] = (uint8_t) ( ( p_ptCtx->uDataL   >> 24u ) & 0x000000FFu );
+
+        (void)memcpy(&p_puFrag[EFSP_FRAG_HEADERSIZE], &p_ptCtx->puData[l_uOffset], l_uPayL);
+        *p_puFragL = l_uPayL + EFSP_FRAG_HEADERSIZE;
+
+        l_eRes = e_eFSP_FRAG_RES_OK;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_FRAG_RES eFSP_FRAG_RxStartMsg(t_eFSP_FRAG_RxCtx* const p_ptCtx, const uint8_t p_uMsgId,
+                                            const uint32_t p_uDataL, const uint32_t p_uFragL)
+{
+    e_eFSP_FRAG_RES l_eRes;
+    uint32_t l_uFragN;
+
+    l_uFragN = eFSP_FRAG_GetFragN(p_uDataL, p_uFragL);
+
+    /* The current message is kept when the new one can not be received */
+    if( ( ( l_uFragN - 1u ) >> 3u ) >= p_ptCtx->uMapAreaL )
+    {
+        l_eRes = e_eFSP_FRAG_RES_OUTOFMEM;
+    }
+    else if( ( NULL != p_ptCtx->puDataArea ) && ( p_uDataL > p_ptCtx->uDataAreaL ) )
+    {
+        l_eRes = e_eFSP_FRAG_RES_OUTOFMEM;
+    }
+    else
+    {
+        (void)memset(p_ptCtx->puMapArea, 0, ( ( l_uFragN - 1u ) >> 3u ) + 1u);
+        p_ptCtx->uMsgId = p_uMsgId;
+        p_ptCtx->uDataL = p_uDataL;
+        p_ptCtx->uFragL = p_uFragL;
+        p_ptCtx->uFragN = l_uFragN;
+        p_ptCtx->uRecvN = 0u;
+        p_ptCtx->bHasMsg = true;
+
+        l_eRes = e_eFSP_FRAG_RES_OK;
+    }
+
+    return l_eRes;
+}
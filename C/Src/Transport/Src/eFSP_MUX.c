@@ -0,0 +1,852 @@
+/**
+ * @file       eFSP_MUX.c
+ *
+ * @brief      Logical channel multiplexer with deficit round robin scheduling, on top of a message transmitter and a
+ *             message receiver
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_MUX.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Biggest payload, limited by the size on two bytes stored in the queues */
+#define EFSP_MUX_MAXPAYL                                                ( 0xFFFFu )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_MUX_IsStatusStillCoherent(const t_eFSP_MUX_Ctx* p_ptCtx);
+static e_eFSP_MUX_RES eFSP_MUX_CheckCtx(const t_eFSP_MUX_Ctx* p_ptCtx);
+static e_eFSP_MUX_RES eFSP_MUX_RingFree(t_eFSP_SPSCR_Ctx* const p_ptRing, uint32_t* const p_puFreeL);
+static e_eFSP_MUX_RES eFSP_MUX_RingWrite(t_eFSP_SPSCR_Ctx* const p_ptRing, const uint8_t* p_puData,
+                                         const uint32_t p_uDataL);
+static e_eFSP_MUX_RES eFSP_MUX_RingRead(t_eFSP_SPSCR_Ctx* const p_ptRing, uint8_t* p_puData, const uint32_t p_uDataL);
+static e_eFSP_MUX_RES eFSP_MUX_RingPeek(t_eFSP_SPSCR_Ctx* const p_ptRing, uint8_t* p_puData, const uint32_t p_uDataL);
+static e_eFSP_MUX_RES eFSP_MUX_RingSkip(t_eFSP_SPSCR_Ctx* const p_ptRing, const uint32_t p_uDataL);
+static e_eFSP_MUX_RES eFSP_MUX_RingPush(t_eFSP_SPSCR_Ctx* const p_ptRing, const uint8_t* p_puData,
+                                        const uint32_t p_uDataL);
+static e_eFSP_MUX_RES eFSP_MUX_LoadHead(t_eFSP_SPSCR_Ctx* const p_ptRing, bool_t* const p_pbHead,
+                                        uint32_t* const p_puHeadL);
+static e_eFSP_MUX_RES eFSP_MUX_RxStep(t_eFSP_MUX_Ctx* const p_ptCtx);
+static e_eFSP_MUX_RES eFSP_MUX_Dispatch(t_eFSP_MUX_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                        const uint32_t p_uDataL);
+static e_eFSP_MUX_RES eFSP_MUX_TxStep(t_eFSP_MUX_Ctx* const p_ptCtx);
+static e_eFSP_MUX_RES eFSP_MUX_Pick(t_eFSP_MUX_Ctx* const p_ptCtx, bool_t* const p_pbFound);
+static e_eFSP_MUX_RES eFSP_MUX_StartFrame(t_eFSP_MUX_Ctx* const p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_MUX_RES eFSP_MUX_InitCtx(t_eFSP_MUX_Ctx* const p_ptCtx, const t_eFSP_MUX_InitData* p_ptInitData)
+{
+	/* Local variable */
+	e_eFSP_MUX_RES l_eRes;
+    uint8_t* l_puTxData;
+    uint32_t l_uTxMaxL;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptInitData ) )
+	{
+		l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check pointer validity */
+        if( ( NULL == p_ptInitData->ptIMsgTx ) || ( NULL == p_ptInitData->ptIMsgRx ) )
+        {
+            l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+        }
+        else
+        {
+            /* The transmitter must be initialized and able to contain the channel ID and at least one byte */
+            if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_GetWherePutData(p_ptInitData->ptIMsgTx, &l_puTxData,
+                                                                  &l_uTxMaxL) )
+            {
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else if( l_uTxMaxL <= EFSP_MUX_HEADERSIZE )
+            {
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else
+            {
+                /* Initialize internal status */
+                p_ptCtx->ptMsgTx = p_ptInitData->ptIMsgTx;
+                p_ptCtx->ptMsgRx = p_ptInitData->ptIMsgRx;
+
+                if( ( l_uTxMaxL - EFSP_MUX_HEADERSIZE ) > EFSP_MUX_MAXPAYL )
+                {
+                    p_ptCtx->uMaxPayL = EFSP_MUX_MAXPAYL;
+                }
+                else
+                {
+                    p_ptCtx->uMaxPayL = l_uTxMaxL - EFSP_MUX_HEADERSIZE;
+                }
+
+                for( l_uIdx = 0u; l_uIdx < EFSP_MUX_MAXCHAN; l_uIdx++ )
+                {
+                    (void)memset(&p_ptCtx->atChan[l_uIdx], 0, sizeof(t_eFSP_MUX_Chan));
+                    p_ptCtx->atChan[l_uIdx].bIsOpen = false;
+                }
+
+                p_ptCtx->uCurChan = 0u;
+                p_ptCtx->bCharged = false;
+                p_ptCtx->bTxBusy = false;
+                p_ptCtx->bIsInit = true;
+
+                l_eRes = e_eFSP_MUX_RES_OK;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MUX_RES eFSP_MUX_IsInit(t_eFSP_MUX_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_MUX_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_MUX_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MUX_RES eFSP_MUX_OpenChan(t_eFSP_MUX_Ctx* const p_ptCtx, const uint32_t p_uChanId,
+                                 const t_eFSP_MUX_ChanData* p_ptChanData)
+{
+	/* Local variable */
+	e_eFSP_MUX_RES l_eRes;
+    t_eFSP_MUX_Chan* l_ptChan;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptChanData ) )
+	{
+		l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_MUX_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            if( ( NULL == p_ptChanData->puITxArea ) || ( NULL == p_ptChanData->puIRxArea ) )
+            {
+                l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+            }
+            else if( ( p_uChanId >= EFSP_MUX_MAXCHAN ) || ( p_ptChanData->uIWeight < 1u ) ||
+                     ( p_ptChanData->uIWeight > EFSP_MUX_MAXWEIGHT ) ||
+                     ( p_ptChanData->uITxAreaL <= ( EFSP_MUX_LENSIZE + 1u ) ) ||
+                     ( p_ptChanData->uIRxAreaL <= ( EFSP_MUX_LENSIZE + 1u ) ) )
+            {
+                /* The ring keep a byte empty, so the area must contain a size, a byte and the empty one */
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else
+            {
+                l_ptChan = &p_ptCtx->atChan[p_uChanId];
+                l_ptChan->bIsOpen = false;
+
+                if( ( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_InitCtx(&l_ptChan->tTxRing, p_ptChanData->puITxArea,
+                                                                 p_ptChanData->uITxAreaL) ) ||
+                    ( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_InitCtx(&l_ptChan->tRxRing, p_ptChanData->puIRxArea,
+                                                                 p_ptChanData->uIRxAreaL) ) )
+                {
+                    l_eRes = e_eFSP_MUX_RES_BADPARAM;
+                }
+                else
+                {
+                    l_ptChan->uWeight = p_ptChanData->uIWeight;
+                    l_ptChan->uDeficit = 0u;
+                    l_ptChan->uTxHeadL = 0u;
+                    l_ptChan->bTxHead = false;
+                    l_ptChan->uRxHeadL = 0u;
+                    l_ptChan->bRxHead = false;
+                    l_ptChan->uDropN = 0u;
+                    l_ptChan->bIsOpen = true;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MUX_RES eFSP_MUX_Send(t_eFSP_MUX_Ctx* const p_ptCtx, const uint32_t p_uChanId, const uint8_t* p_puData,
+                             const uint32_t p_uDataL)
+{
+	/* Local variable */
+	e_eFSP_MUX_RES l_eRes;
+    t_eFSP_MUX_Chan* l_ptChan;
+    uint32_t l_uFreeL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+	{
+		l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_MUX_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            if( p_uChanId >= EFSP_MUX_MAXCHAN )
+            {
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else if( ( false == p_ptCtx->atChan[p_uChanId].bIsOpen ) || ( p_uDataL < 1u ) ||
+                     ( p_uDataL > p_ptCtx->uMaxPayL ) ||
+                     ( ( p_uDataL + EFSP_MUX_LENSIZE ) >= p_ptCtx->atChan[p_uChanId].tTxRing.uBuffL ) )
+            {
+                /* A payload that can never fit in the queue is a wrong parameter, not a full queue */
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else
+            {
+                l_ptChan = &p_ptCtx->atChan[p_uChanId];
+                l_eRes = eFSP_MUX_RingFree(&l_ptChan->tTxRing, &l_uFreeL);
+
+                if( e_eFSP_MUX_RES_OK == l_eRes )
+                {
+                    if( l_uFreeL < ( p_uDataL + EFSP_MUX_LENSIZE ) )
+                    {
+                        l_eRes = e_eFSP_MUX_RES_QUEUEFULL;
+                    }
+                    else
+                    {
+                        l_eRes = eFSP_MUX_RingPush(&l_ptChan->tTxRing, p_puData, p_uDataL);
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MUX_RES eFSP_MUX_Recv(t_eFSP_MUX_Ctx* const p_ptCtx, const uint32_t p_uChanId, uint8_t* p_puData,
+                             const uint32_t p_uDataMaxL, uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eFSP_MUX_RES l_eRes;
+    t_eFSP_MUX_Chan* l_ptChan;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_MUX_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            if( p_uChanId >= EFSP_MUX_MAXCHAN )
+            {
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else if( false == p_ptCtx->atChan[p_uChanId].bIsOpen )
+            {
+                l_eRes = e_eFSP_MUX_RES_BADPARAM;
+            }
+            else
+            {
+                l_ptChan = &p_ptCtx->atChan[p_uChanId];
+                l_eRes = eFSP_MUX_LoadHead(&l_ptChan->tRxRing, &l_ptChan->bRxHead, &l_ptChan->uRxHeadL);
+
+                if( e_eFSP_MUX_RES_OK == l_eRes )
+                {
+                    if( false == l_ptChan->bRxHead )
+                    {
+                        l_eRes = e_eFSP_MUX_RES_NODATA;
+                    }
+                    else if( l_ptChan->uRxHeadL > p_uDataMaxL )
+                    {
+                        l_eRes = e_eFSP_MUX_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        l_eRes = eFSP_MUX_RingRead(&l_ptChan->tRxRing, p_puData, l_ptChan->uRxHeadL);
+                        *p_puDataL = l_ptChan->uRxHeadL;
+                        l_ptChan->bRxHead = false;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_MUX_RES eFSP_MUX_Process(t_eFSP_MUX_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_MUX_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_MUX_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_MUX_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            l_eRes = eFSP_MUX_RxStep(p_ptCtx);
+
+            if( e_eFSP_MUX_RES_OK == l_eRes )
+            {
+                l_eRes = eFSP_MUX_TxStep(p_ptCtx);
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_MUX_IsStatusStillCoherent(const t_eFSP_MUX_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->ptMsgTx ) || ( NULL == p_ptCtx->ptMsgRx ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check scheduler validity */
+        if( ( p_ptCtx->uMaxPayL < 1u ) || ( p_ptCtx->uMaxPayL > EFSP_MUX_MAXPAYL ) ||
+            ( p_ptCtx->uCurChan >= EFSP_MUX_MAXCHAN ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Check channel validity, the deficit never reach a quantum plus the biggest payload */
+            l_bRes = true;
+            for( l_uIdx = 0u; l_uIdx < EFSP_MUX_MAXCHAN; l_uIdx++ )
+            {
+                if( true == p_ptCtx->atChan[l_uIdx].bIsOpen )
+                {
+                    if( ( p_ptCtx->atChan[l_uIdx].uWeight < 1u ) ||
+                        ( p_ptCtx->atChan[l_uIdx].uWeight > EFSP_MUX_MAXWEIGHT ) ||
+                        ( p_ptCtx->atChan[l_uIdx].uDeficit >= ( EFSP_MUX_MAXWEIGHT + EFSP_MUX_MAXPAYL ) ) )
+                    {
+                        l_bRes = false;
+                    }
+                }
+            }
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_CheckCtx(const t_eFSP_MUX_Ctx* p_ptCtx)
+{
+    e_eFSP_MUX_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_MUX_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_MUX_IsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_MUX_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RingFree(t_eFSP_SPSCR_Ctx* const p_ptRing, uint32_t* const p_puFreeL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    uint32_t l_uUsedL;
+
+    if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_GetUsed(p_ptRing, &l_uUsedL) )
+    {
+        l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+    }
+    else
+    {
+        /* One byte of the ring is always empty */
+        *p_puFreeL = p_ptRing->uBuffL - 1u - l_uUsedL;
+        l_eRes = e_eFSP_MUX_RES_OK;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RingWrite(t_eFSP_SPSCR_Ctx* const p_ptRing, const uint8_t* p_puData,
+                                         const uint32_t p_uDataL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    uint32_t l_uPushedL;
+
+    /* The free space is already checked, a partial push means a corrupted ring */
+    if( ( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_Push(p_ptRing, p_puData, p_uDataL, &l_uPushedL) ) ||
+        ( l_uPushedL != p_uDataL ) )
+    {
+        l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+    }
+    else
+    {
+        l_eRes = e_eFSP_MUX_RES_OK;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RingRead(t_eFSP_SPSCR_Ctx* const p_ptRing, uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    e_eFSP_MUX_RES l_eRes;
+
+    l_eRes = eFSP_MUX_RingPeek(p_ptRing, p_puData, p_uDataL);
+    if( e_eFSP_MUX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MUX_RingSkip(p_ptRing, p_uDataL);
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RingPeek(t_eFSP_SPSCR_Ctx* const p_ptRing, uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    uint8_t* l_puSpan;
+    uint32_t l_uSpanL;
+    uint32_t l_uUsedL;
+
+    /* The data is left in the ring. When the first span is shorter than the data, the span ends at the end of the
+     * memory area and the remaining part starts from the begin of it */
+    if( ( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_GetUsed(p_ptRing, &l_uUsedL) ) ||
+        ( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_GetReadSpan(p_ptRing, &l_puSpan, &l_uSpanL) ) )
+    {
+        l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+    }
+    else if( l_uUsedL < p_uDataL )
+    {
+        /* The size stored in the ring is bigger than the data */
+        l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+    }
+    else
+    {
+        if( l_uSpanL > p_uDataL )
+        {
+            l_uSpanL = p_uDataL;
+        }
+
+        (void)memcpy(p_puData, l_puSpan, l_uSpanL);
+        (void)memcpy(&p_puData[l_uSpanL], p_ptRing->puBuff, ( p_uDataL - l_uSpanL ) );
+        l_eRes = e_eFSP_MUX_RES_OK;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RingSkip(t_eFSP_SPSCR_Ctx* const p_ptRing, const uint32_t p_uDataL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    uint8_t* l_puSpan;
+    uint32_t l_uSpanL;
+    uint32_t l_uSkipL;
+
+    /* At most two spans, before and after the wrap around */
+    l_eRes = e_eFSP_MUX_RES_OK;
+    l_uSkipL = 0u;
+    while( ( e_eFSP_MUX_RES_OK == l_eRes ) && ( l_uSkipL < p_uDataL ) )
+    {
+        if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_GetReadSpan(p_ptRing, &l_puSpan, &l_uSpanL) )
+        {
+            l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+        }
+        else if( 0u == l_uSpanL )
+        {
+            /* The size stored in the ring is bigger than the data */
+            l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+        }
+        else
+        {
+            if( l_uSpanL > ( p_uDataL - l_uSkipL ) )
+            {
+                l_uSpanL = p_uDataL - l_uSkipL;
+            }
+
+            if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_Release(p_ptRing, l_uSpanL) )
+            {
+                l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+            }
+            else
+            {
+                l_uSkipL += l_uSpanL;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RingPush(t_eFSP_SPSCR_Ctx* const p_ptRing, const uint8_t* p_puData,
+                                        const uint32_t p_uDataL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    uint8_t l_auLen[EFSP_MUX_LENSIZE];
+
+    l_auLen[0u] = (uint8_t) ( ( p_uDataL        ) & 0x000000FFu );
+    l_auLen[1u] = (uint8_t) ( ( p_uDataL >> 8u  ) & 0x000000FFu );
+
+    l_eRes = eFSP_MUX_RingWrite(p_ptRing, l_auLen, EFSP_MUX_LENSIZE);
+    if( e_eFSP_MUX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MUX_RingWrite(p_ptRing, p_puData, p_uDataL);
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_LoadHead(t_eFSP_SPSCR_Ctx* const p_ptRing, bool_t* const p_pbHead,
+                                        uint32_t* const p_puHeadL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    uint8_t l_auLen[EFSP_MUX_LENSIZE];
+    uint32_t l_uUsedL;
+
+    /* The size of the oldest payload is moved out of the ring, so the payload can be read in place later */
+    if( true == *p_pbHead )
+    {
+        l_eRes = e_eFSP_MUX_RES_OK;
+    }
+    else if( e_eFSP_SPSCR_RES_OK != eFSP_SPSCR_GetUsed(p_ptRing, &l_uUsedL) )
+    {
+        l_eRes = e_eFSP_MUX_RES_CORRUPTCTX;
+    }
+    else if( l_uUsedL < EFSP_MUX_LENSIZE )
+    {
+        l_eRes = e_eFSP_MUX_RES_OK;
+    }
+    else
+    {
+        l_eRes = eFSP_MUX_RingRead(p_ptRing, l_auLen, EFSP_MUX_LENSIZE);
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            *p_puHeadL =  (uint32_t)l_auLen[0u];
+            *p_puHeadL |= ( (uint32_t)l_auLen[1u] ) << 8u;
+            *p_pbHead = true;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_RxStep(t_eFSP_MUX_Ctx* const p_ptCtx)
+{
+    e_eFSP_MUX_RES l_eRes;
+    e_eFSP_MSGRX_RES l_eResRx;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    bool_t l_bRestart;
+
+    l_eResRx = eFSP_MSGRX_ReceiveChunk(p_ptCtx->ptMsgRx);
+    l_bRestart = false;
+
+    switch( l_eResRx )
+    {
+        case e_eFSP_MSGRX_RES_OK:
+        case e_eFSP_MSGRX_RES_FRAMERESTART:
+        {
+            /* Frame not completed yet */
+            l_eRes = e_eFSP_MUX_RES_OK;
+            break;
+        }
+
+        case e_eFSP_MSGRX_RES_MESSAGERECEIVED:
+        {
+            if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(p_ptCtx->ptMsgRx, &l_puData, &l_uDataL) )
+            {
+                l_eRes = eFSP_MUX_Dispatch(p_ptCtx, l_puData, l_uDataL);
+                l_bRestart = true;
+            }
+            else
+            {
+                l_eRes = e_eFSP_MUX_RES_MSGRXERROR;
+            }
+            break;
+        }
+
+        case e_eFSP_MSGRX_RES_BADFRAME:
+        case e_eFSP_MSGRX_RES_MESSAGETIMEOUT:
+        case e_eFSP_MSGRX_RES_OUTOFMEM:
+        {
+            /* The frame is lost, the multiplexer does not retry */
+            l_eRes = e_eFSP_MUX_RES_OK;
+            l_bRestart = true;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eFSP_MUX_RES_MSGRXERROR;
+            break;
+        }
+    }
+
+    if( ( e_eFSP_MUX_RES_OK == l_eRes ) && ( true == l_bRestart ) )
+    {
+        if( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_NewMsg(p_ptCtx->ptMsgRx) )
+        {
+            l_eRes = e_eFSP_MUX_RES_MSGRXERROR;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_Dispatch(t_eFSP_MUX_Ctx* const p_ptCtx, const uint8_t* p_puData,
+                                        const uint32_t p_uDataL)
+{
+    e_eFSP_MUX_RES l_eRes;
+    t_eFSP_MUX_Chan* l_ptChan;
+    uint32_t l_uFreeL;
+    uint32_t l_uPayL;
+
+    l_eRes = e_eFSP_MUX_RES_OK;
+
+    /* Frames without payload or for an unknown channel are discarded */
+    if( ( p_uDataL > EFSP_MUX_HEADERSIZE ) && ( (uint32_t)p_puData[0u] < EFSP_MUX_MAXCHAN ) &&
+        ( ( p_uDataL - EFSP_MUX_HEADERSIZE ) <= EFSP_MUX_MAXPAYL ) )
+    {
+        l_ptChan = &p_ptCtx->atChan[p_puData[0u]];
+        l_uPayL = p_uDataL - EFSP_MUX_HEADERSIZE;
+
+        if( false == l_ptChan->bIsOpen )
+        {
+            l_ptChan->uDropN++;
+        }
+        else
+        {
+            l_eRes = eFSP_MUX_RingFree(&l_ptChan->tRxRing, &l_uFreeL);
+
+            if( e_eFSP_MUX_RES_OK == l_eRes )
+            {
+                if( l_uFreeL < ( l_uPayL + EFSP_MUX_LENSIZE ) )
+                {
+                    /* The application is not retriving this channel, the other ones can go on */
+                    l_ptChan->uDropN++;
+                }
+                else
+                {
+                    l_eRes = eFSP_MUX_RingPush(&l_ptChan->tRxRing, &p_puData[EFSP_MUX_HEADERSIZE], l_uPayL);
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_TxStep(t_eFSP_MUX_Ctx* const p_ptCtx)
+{
+    e_eFSP_MUX_RES l_eRes;
+    e_eFSP_MSGTX_RES l_eResTx;
+    bool_t l_bFound;
+
+    l_eRes = e_eFSP_MUX_RES_OK;
+
+    if( false == p_ptCtx->bTxBusy )
+    {
+        l_eRes = eFSP_MUX_Pick(p_ptCtx, &l_bFound);
+
+        if( ( e_eFSP_MUX_RES_OK == l_eRes ) && ( true == l_bFound ) )
+        {
+            l_eRes = eFSP_MUX_StartFrame(p_ptCtx);
+        }
+    }
+
+    if( ( e_eFSP_MUX_RES_OK == l_eRes ) && ( true == p_ptCtx->bTxBusy ) )
+    {
+        l_eResTx = eFSP_MSGTX_SendChunk(p_ptCtx->ptMsgTx);
+
+        switch( l_eResTx )
+        {
+            case e_eFSP_MSGTX_RES_OK:
+            {
+                /* Frame not completed yet */
+                break;
+            }
+
+            case e_eFSP_MSGTX_RES_MESSAGESENDED:
+            case e_eFSP_MSGTX_RES_MESSAGETIMEOUT:
+            {
+                /* A frame not sent in time is lost, the multiplexer does not retry */
+                p_ptCtx->bTxBusy = false;
+                break;
+            }
+
+            default:
+            {
+                p_ptCtx->bTxBusy = false;
+                l_eRes = e_eFSP_MUX_RES_MSGTXERROR;
+                break;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_Pick(t_eFSP_MUX_Ctx* const p_ptCtx, bool_t* const p_pbFound)
+{
+    e_eFSP_MUX_RES l_eRes;
+    t_eFSP_MUX_Chan* l_ptChan;
+    uint32_t l_uIdleN;
+
+    /* Deficit round robin: every time a channel with queued payloads is visited its deficit grows by its weight, and
+     * the channel keep the turn while the oldest payload fits in the deficit. The turn stay on the current channel
+     * between two calls, so a quantum is never added twice in the same round. An empty channel lose its deficit. */
+    l_eRes = e_eFSP_MUX_RES_OK;
+    l_uIdleN = 0u;
+    *p_pbFound = false;
+
+    while( ( e_eFSP_MUX_RES_OK == l_eRes ) && ( false == *p_pbFound ) && ( l_uIdleN < EFSP_MUX_MAXCHAN ) )
+    {
+        l_ptChan = &p_ptCtx->atChan[p_ptCtx->uCurChan];
+
+        if( true == l_ptChan->bIsOpen )
+        {
+            l_eRes = eFSP_MUX_LoadHead(&l_ptChan->tTxRing, &l_ptChan->bTxHead, &l_ptChan->uTxHeadL);
+        }
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            if( ( true == l_ptChan->bIsOpen ) && ( true == l_ptChan->bTxHead ) )
+            {
+                l_uIdleN = 0u;
+
+                if( false == p_ptCtx->bCharged )
+                {
+                    l_ptChan->uDeficit += l_ptChan->uWeight;
+                    p_ptCtx->bCharged = true;
+                }
+
+                if( l_ptChan->uTxHeadL <= l_ptChan->uDeficit )
+                {
+                    /* The deficit is charged only when the transmitter accept the frame */
+                    *p_pbFound = true;
+                }
+                else
+                {
+                    p_ptCtx->uCurChan = ( p_ptCtx->uCurChan + 1u ) % EFSP_MUX_MAXCHAN;
+                    p_ptCtx->bCharged = false;
+                }
+            }
+            else
+            {
+                l_ptChan->uDeficit = 0u;
+                l_uIdleN++;
+                p_ptCtx->uCurChan = ( p_ptCtx->uCurChan + 1u ) % EFSP_MUX_MAXCHAN;
+                p_ptCtx->bCharged = false;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_MUX_RES eFSP_MUX_StartFrame(t_eFSP_MUX_Ctx* const p_ptCtx)
+{
+    e_eFSP_MUX_RES l_eRes;
+    e_eFSP_MSGTX_RES l_eResTx;
+    t_eFSP_MUX_Chan* l_ptChan;
+    uint8_t* l_puTxData;
+    uint32_t l_uTxMaxL;
+
+    l_ptChan = &p_ptCtx->atChan[p_ptCtx->uCurChan];
+
+    if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_GetWherePutData(p_ptCtx->ptMsgTx, &l_puTxData, &l_uTxMaxL) )
+    {
+        l_eRes = e_eFSP_MUX_RES_MSGTXERROR;
+    }
+    else if( l_uTxMaxL < ( l_ptChan->uTxHeadL + EFSP_MUX_HEADERSIZE ) )
+    {
+        l_eRes = e_eFSP_MUX_RES_MSGTXERROR;
+    }
+    else
+    {
+        /* The payload is copied from the queue directly in the transmitter, and it's removed from the queue only
+         * when the transmitter accept the frame. Otherwise the same payload is sent again in the next call */
+        l_puTxData[0u] = (uint8_t)p_ptCtx->uCurChan;
+        l_eRes = eFSP_MUX_RingPeek(&l_ptChan->tTxRing, &l_puTxData[EFSP_MUX_HEADERSIZE], l_ptChan->uTxHeadL);
+
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            l_eResTx = eFSP_MSGTX_NewMessage(p_ptCtx->ptMsgTx, l_ptChan->uTxHeadL + EFSP_MUX_HEADERSIZE);
+
+            if( e_eFSP_MSGTX_RES_NOCREDIT == l_eResTx )
+            {
+                /* The receiver of the peer has no room yet, nothing is consumed and the frame is retried later */
+                l_eRes = e_eFSP_MUX_RES_OK;
+            }
+            else if( e_eFSP_MSGTX_RES_OK != l_eResTx )
+            {
+                l_eRes = e_eFSP_MUX_RES_MSGTXERROR;
+            }
+            else
+            {
+                l_eRes = eFSP_MUX_RingSkip(&l_ptChan->tTxRing, l_ptChan->uTxHeadL);
+
+                if( e_eFSP_MUX_RES_OK == l_eRes )
+                {
+                    l_ptChan->bTxHead = false;
+                    l_ptChan->uDeficit -= l_ptChan->uTxHeadL;
+                    p_ptCtx->bTxBusy = true;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
@@ -0,0 +1,716 @@
+/**
+ * @file       eFSP_NEGO.c
+ *
+ * @brief      Link capability negotiation at link up, on top of a message transmitter and a message receiver
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_NEGO.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_NEGO_TYPECAP                                               ( 0x10u )
+#define EFSP_NEGO_VERSION                                               ( 0x01u )
+
+/* Handshake state carried by a capability frame: the capabilities of the peer are unknown, known, or known and the
+ * agreed settings are about to be applied */
+#define EFSP_NEGO_PEERUNKNOWN                                           ( 0x00u )
+#define EFSP_NEGO_PEERKNOWN                                             ( 0x01u )
+#define EFSP_NEGO_PEERDONE                                              ( 0x02u )
+
+/* Every option known to this version, and the biggest payload of the fixed length fields */
+#define EFSP_NEGO_CRCALL                                                ( 0x07u )
+#define EFSP_NEGO_LENALL                                                ( 0x0Fu )
+#define EFSP_NEGO_FRMALL                                                ( 0x07u )
+#define EFSP_NEGO_LEN8MAX                                               ( 0xFFu )
+#define EFSP_NEGO_LEN16MAX                                              ( 0xFFFFu )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_NEGO_IsStatusStillCoherent(const t_eFSP_NEGO_Ctx* p_ptCtx);
+static e_eFSP_NEGO_RES eFSP_NEGO_CheckCtx(const t_eFSP_NEGO_Ctx* p_ptCtx);
+static bool_t eFSP_NEGO_IsCapsValid(const t_eFSP_NEGO_Caps* p_ptCaps);
+static bool_t eFSP_NEGO_IsBaseValid(const uint32_t p_uCrcL, const uint32_t p_uLenL, const uint32_t p_uFrm);
+static e_eFSP_NEGO_RES eFSP_NEGO_RxStep(t_eFSP_NEGO_Ctx* const p_ptCtx);
+static void eFSP_NEGO_ElabFrame(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL);
+static void eFSP_NEGO_Agree(t_eFSP_NEGO_Ctx* const p_ptCtx);
+static e_eFSP_NEGO_RES eFSP_NEGO_TxStep(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+static e_eFSP_NEGO_RES eFSP_NEGO_StartCaps(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uNowMs);
+static e_eFSP_NEGO_RES eFSP_NEGO_Apply(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uCrcL,
+                                       const uint32_t p_uLenL, const uint32_t p_uFrm, const uint32_t p_uCmpL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_NEGO_RES eFSP_NEGO_InitCtx(t_eFSP_NEGO_Ctx* const p_ptCtx, const t_eFSP_NEGO_InitData* p_ptInitData)
+{
+	/* Local variable */
+	e_eFSP_NEGO_RES l_eRes;
+    uint8_t* l_puTxData;
+    uint32_t l_uTxMaxL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptInitData ) )
+	{
+		l_eRes = e_eFSP_NEGO_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check pointer validity */
+        if( ( NULL == p_ptInitData->ptIMsgTx ) || ( NULL == p_ptInitData->ptIMsgRx ) )
+        {
+            l_eRes = e_eFSP_NEGO_RES_BADPOINTER;
+        }
+        else
+        {
+            /* Check data validity */
+            if( ( false == eFSP_NEGO_IsCapsValid(&p_ptInitData->tICaps) ) ||
+                ( false == eFSP_NEGO_IsBaseValid(p_ptInitData->uIBaseCrcL, p_ptInitData->uIBaseLenL,
+                                                 p_ptInitData->uIBaseFrm) ) ||
+                ( p_ptInitData->uIRetryMs < 1u ) || ( p_ptInitData->uILingerMs < 1u ) )
+            {
+                l_eRes = e_eFSP_NEGO_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->ptMsgTx = p_ptInitData->ptIMsgTx;
+                p_ptCtx->ptMsgRx = p_ptInitData->ptIMsgRx;
+
+                /* The transmitter and the receiver must be initialized, and the transmitter must contain a
+                 * capability frame with the base profile */
+                l_eRes = eFSP_NEGO_Apply(p_ptCtx, p_ptInitData->uIBaseCrcL, p_ptInitData->uIBaseLenL,
+                                         p_ptInitData->uIBaseFrm, EFSP_HDR_CMPNONE);
+
+                if( e_eFSP_NEGO_RES_OK != l_eRes )
+                {
+                    l_eRes = e_eFSP_NEGO_RES_BADPARAM;
+                }
+                else if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_GetWherePutData(p_ptInitData->ptIMsgTx, &l_puTxData,
+                                                                           &l_uTxMaxL) )
+                {
+                    l_eRes = e_eFSP_NEGO_RES_BADPARAM;
+                }
+                else if( l_uTxMaxL < EFSP_NEGO_CAPSIZE )
+                {
+                    l_eRes = e_eFSP_NEGO_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Initialize internal status */
+                    p_ptCtx->tLocal = p_ptInitData->tICaps;
+                    p_ptCtx->tPeer = p_ptInitData->tICaps;
+                    p_ptCtx->tLink.uMaxPayL = 0u;
+                    p_ptCtx->tLink.uCrcL = p_ptInitData->uIBaseCrcL;
+                    p_ptCtx->tLink.uLenL = p_ptInitData->uIBaseLenL;
+                    p_ptCtx->tLink.uFrm = p_ptInitData->uIBaseFrm;
+                    p_ptCtx->tLink.uCmpL = EFSP_HDR_CMPNONE;
+                    p_ptCtx->tLink.uWindow = 0u;
+                    p_ptCtx->uBaseCrcL = p_ptInitData->uIBaseCrcL;
+                    p_ptCtx->uBaseLenL = p_ptInitData->uIBaseLenL;
+                    p_ptCtx->uBaseFrm = p_ptInitData->uIBaseFrm;
+                    p_ptCtx->uRetryMs = p_ptInitData->uIRetryMs;
+                    p_ptCtx->uLingerMs = p_ptInitData->uILingerMs;
+                    p_ptCtx->eState = e_eFSP_NEGO_ST_HELLO;
+                    p_ptCtx->bPeerKnown = false;
+                    p_ptCtx->bSendPend = false;
+                    p_ptCtx->bSentOnce = false;
+                    p_ptCtx->bTxBusy = false;
+                    p_ptCtx->uLastTxMs = 0u;
+                    p_ptCtx->bIsInit = true;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_NEGO_RES eFSP_NEGO_IsInit(t_eFSP_NEGO_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_NEGO_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_NEGO_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_NEGO_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_NEGO_RES eFSP_NEGO_Process(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+	/* Local variable */
+	e_eFSP_NEGO_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_NEGO_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_NEGO_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_NEGO_RES_OK == l_eRes )
+        {
+            if( e_eFSP_NEGO_ST_LINKUP == p_ptCtx->eState )
+            {
+                /* The transmitter and the receiver belong to the user now */
+                l_eRes = e_eFSP_NEGO_RES_LINKUP;
+            }
+            else
+            {
+                l_eRes = eFSP_NEGO_RxStep(p_ptCtx);
+
+                if( e_eFSP_NEGO_RES_OK == l_eRes )
+                {
+                    l_eRes = eFSP_NEGO_TxStep(p_ptCtx, p_uNowMs);
+                }
+
+                /* The peer stopped asking for the capabilities, every frame of the handshake is sent */
+                if( ( e_eFSP_NEGO_RES_OK == l_eRes ) && ( e_eFSP_NEGO_ST_LINGER == p_ptCtx->eState ) &&
+                    ( false == p_ptCtx->bTxBusy ) && ( false == p_ptCtx->bSendPend ) &&
+                    ( ( p_uNowMs - p_ptCtx->uLastTxMs ) >= p_ptCtx->uLingerMs ) )
+                {
+                    l_eRes = eFSP_NEGO_Apply(p_ptCtx, p_ptCtx->tLink.uCrcL, p_ptCtx->tLink.uLenL, p_ptCtx->tLink.uFrm,
+                                             p_ptCtx->tLink.uCmpL);
+
+                    if( e_eFSP_NEGO_RES_OK == l_eRes )
+                    {
+                        p_ptCtx->eState = e_eFSP_NEGO_ST_LINKUP;
+                        l_eRes = e_eFSP_NEGO_RES_LINKUP;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_NEGO_RES eFSP_NEGO_GetLink(t_eFSP_NEGO_Ctx* const p_ptCtx, t_eFSP_NEGO_Link* const p_ptLink)
+{
+	/* Local variable */
+	e_eFSP_NEGO_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptLink ) )
+	{
+		l_eRes = e_eFSP_NEGO_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_NEGO_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_NEGO_RES_OK == l_eRes )
+        {
+            if( e_eFSP_NEGO_ST_LINKUP != p_ptCtx->eState )
+            {
+                l_eRes = e_eFSP_NEGO_RES_LINKDOWN;
+            }
+            else
+            {
+                *p_ptLink = p_ptCtx->tLink;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_NEGO_IsStatusStillCoherent(const t_eFSP_NEGO_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx->ptMsgTx ) || ( NULL == p_ptCtx->ptMsgRx ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( false == eFSP_NEGO_IsCapsValid(&p_ptCtx->tLocal) ) ||
+            ( false == eFSP_NEGO_IsBaseValid(p_ptCtx->uBaseCrcL, p_ptCtx->uBaseLenL, p_ptCtx->uBaseFrm) ) ||
+            ( p_ptCtx->uRetryMs < 1u ) || ( p_ptCtx->uLingerMs < 1u ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Check state validity, the peer is always known once the agreement is done */
+            if( ( p_ptCtx->eState > e_eFSP_NEGO_ST_LINKUP ) ||
+                ( ( e_eFSP_NEGO_ST_HELLO != p_ptCtx->eState ) && ( false == p_ptCtx->bPeerKnown ) ) )
+            {
+                l_bRes = false;
+            }
+            else
+            {
+                l_bRes = true;
+            }
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_NEGO_RES eFSP_NEGO_CheckCtx(const t_eFSP_NEGO_Ctx* p_ptCtx)
+{
+    e_eFSP_NEGO_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_NEGO_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_NEGO_IsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_NEGO_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_NEGO_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSP_NEGO_IsCapsValid(const t_eFSP_NEGO_Caps* p_ptCaps)
+{
+    bool_t l_bRes;
+
+    /* The window must be usable by eFSP_ARQ */
+    if( ( p_ptCaps->uMaxPayL < 1u ) || ( p_ptCaps->uWindow < 1u ) || ( p_ptCaps->uWindow > EFSP_ARQ_MAXWINDOW ) ||
+        ( 0u != ( p_ptCaps->uWindow & ( p_ptCaps->uWindow - 1u ) ) ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSP_NEGO_IsBaseValid(const uint32_t p_uCrcL, const uint32_t p_uLenL, const uint32_t p_uFrm)
+{
+    bool_t l_bRes;
+
+    if( ( EFSP_HDR_CRCNONE != p_uCrcL ) && ( EFSP_HDR_CRC16 != p_uCrcL ) && ( EFSP_HDR_CRC32 != p_uCrcL ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( EFSP_HDR_LEN8 != p_uLenL ) && ( EFSP_HDR_LEN16 != p_uLenL ) && ( EFSP_HDR_LEN32 != p_uLenL ) &&
+             ( EFSP_HDR_LENVAR != p_uLenL ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( EFSP_FRM_ESC != p_uFrm ) && ( EFSP_FRM_COBS != p_uFrm ) && ( EFSP_FRM_TRSP != p_uFrm ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static e_eFSP_NEGO_RES eFSP_NEGO_RxStep(t_eFSP_NEGO_Ctx* const p_ptCtx)
+{
+    e_eFSP_NEGO_RES l_eRes;
+    e_eFSP_MSGRX_RES l_eResRx;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    bool_t l_bRestart;
+
+    l_eResRx = eFSP_MSGRX_ReceiveChunk(p_ptCtx->ptMsgRx);
+    l_bRestart = false;
+
+    switch( l_eResRx )
+    {
+        case e_eFSP_MSGRX_RES_OK:
+        case e_eFSP_MSGRX_RES_FRAMERESTART:
+        {
+            /* Frame not completed yet */
+            l_eRes = e_eFSP_NEGO_RES_OK;
+            break;
+        }
+
+        case e_eFSP_MSGRX_RES_MESSAGERECEIVED:
+        {
+            if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(p_ptCtx->ptMsgRx, &l_puData, &l_uDataL) )
+            {
+                eFSP_NEGO_ElabFrame(p_ptCtx, l_puData, l_uDataL);
+                l_eRes = e_eFSP_NEGO_RES_OK;
+                l_bRestart = true;
+            }
+            else
+            {
+                l_eRes = e_eFSP_NEGO_RES_MSGRXERROR;
+            }
+            break;
+        }
+
+        case e_eFSP_MSGRX_RES_BADFRAME:
+        case e_eFSP_MSGRX_RES_MESSAGETIMEOUT:
+        case e_eFSP_MSGRX_RES_OUTOFMEM:
+        {
+            /* The frame is lost, the capabilities are sent again by the retry timer of the peer */
+            l_eRes = e_eFSP_NEGO_RES_OK;
+            l_bRestart = true;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eFSP_NEGO_RES_MSGRXERROR;
+            break;
+        }
+    }
+
+    if( ( e_eFSP_NEGO_RES_OK == l_eRes ) && ( true == l_bRestart ) )
+    {
+        if( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_NewMsg(p_ptCtx->ptMsgRx) )
+        {
+            l_eRes = e_eFSP_NEGO_RES_MSGRXERROR;
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eFSP_NEGO_ElabFrame(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    t_eFSP_NEGO_Caps l_tCaps;
+    uint8_t l_uPeerState;
+
+    if( ( EFSP_NEGO_CAPSIZE <= p_uDataL ) && ( EFSP_NEGO_TYPECAP == p_puData[0u] ) &&
+        ( EFSP_NEGO_VERSION <= p_puData[1u] ) && ( EFSP_NEGO_PEERDONE >= p_puData[2u] ) )
+    {
+        l_uPeerState = p_puData[2u];
+
+        l_tCaps.uMaxPayL =  (uint32_t)p_puData[3u];
+        l_tCaps.uMaxPayL |= ( (uint32_t)p_puData[4u] ) << 8u;
+        l_tCaps.uMaxPayL |= ( (uint32_t)p_puData[5u] ) << 16u;
+        l_tCaps.uMaxPayL |= ( (uint32_t)p_puData[6u] ) << 24u;
+
+        /* Options unknown to this version are not usable */
+        l_tCaps.uCrcMask = ( (uint32_t)p_puData[7u] ) & EFSP_NEGO_CRCALL;
+        l_tCaps.uLenMask = ( (uint32_t)p_puData[8u] ) & EFSP_NEGO_LENALL;
+        l_tCaps.uFrmMask = ( (uint32_t)p_puData[9u] ) & EFSP_NEGO_FRMALL;
+        l_tCaps.uFeatMask = ( (uint32_t)p_puData[10u] ) & EFSP_NEGO_FEATCMP;
+        l_tCaps.uWindow = (uint32_t)p_puData[11u];
+
+        if( true == eFSP_NEGO_IsCapsValid(&l_tCaps) )
+        {
+            if( e_eFSP_NEGO_ST_HELLO == p_ptCtx->eState )
+            {
+                p_ptCtx->tPeer = l_tCaps;
+                p_ptCtx->bPeerKnown = true;
+                p_ptCtx->bSendPend = true;
+
+                if( EFSP_NEGO_PEERUNKNOWN != l_uPeerState )
+                {
+                    /* Both nodes know both capabilities, so they reach the same agreement */
+                    eFSP_NEGO_Agree(p_ptCtx);
+                    p_ptCtx->eState = e_eFSP_NEGO_ST_LINGER;
+                }
+            }
+            else if( EFSP_NEGO_PEERDONE != l_uPeerState )
+            {
+                /* The peer missed the last frame, keep the base profile a bit more */
+                p_ptCtx->bSendPend = true;
+            }
+            else
+            {
+                /* Never answer to a completed handshake, or the two nodes would never stop */
+            }
+        }
+    }
+    else
+    {
+        /* Unknown frame, discard */
+    }
+}
+
+static void eFSP_NEGO_Agree(t_eFSP_NEGO_Ctx* const p_ptCtx)
+{
+    uint32_t l_uMask;
+    uint32_t l_uMaxPayL;
+
+    /* Strongest common CRC */
+    l_uMask = p_ptCtx->tLocal.uCrcMask & p_ptCtx->tPeer.uCrcMask;
+
+    if( 0u != ( l_uMask & EFSP_NEGO_CRC32 ) )
+    {
+        p_ptCtx->tLink.uCrcL = EFSP_HDR_CRC32;
+    }
+    else if( 0u != ( l_uMask & EFSP_NEGO_CRC16 ) )
+    {
+        p_ptCtx->tLink.uCrcL = EFSP_HDR_CRC16;
+    }
+    else if( 0u != ( l_uMask & EFSP_NEGO_CRCNONE ) )
+    {
+        p_ptCtx->tLink.uCrcL = EFSP_HDR_CRCNONE;
+    }
+    else
+    {
+        p_ptCtx->tLink.uCrcL = p_ptCtx->uBaseCrcL;
+    }
+
+    /* Shortest common length field, a fixed field shorter than the varint of the biggest payload is preferred */
+    l_uMask = p_ptCtx->tLocal.uLenMask & p_ptCtx->tPeer.uLenMask;
+
+    if( p_ptCtx->tLocal.uMaxPayL < p_ptCtx->tPeer.uMaxPayL )
+    {
+        l_uMaxPayL = p_ptCtx->tLocal.uMaxPayL;
+    }
+    else
+    {
+        l_uMaxPayL = p_ptCtx->tPeer.uMaxPayL;
+    }
+
+    if( ( 0u != ( l_uMask & EFSP_NEGO_LEN8 ) ) && ( l_uMaxPayL <= EFSP_NEGO_LEN8MAX ) )
+    {
+        p_ptCtx->tLink.uLenL = EFSP_HDR_LEN8;
+    }
+    else if( ( 0u != ( l_uMask & EFSP_NEGO_LEN16 ) ) && ( l_uMaxPayL <= EFSP_NEGO_LEN16MAX ) )
+    {
+        p_ptCtx->tLink.uLenL = EFSP_HDR_LEN16;
+    }
+    else if( 0u != ( l_uMask & EFSP_NEGO_LENVAR ) )
+    {
+        p_ptCtx->tLink.uLenL = EFSP_HDR_LENVAR;
+    }
+    else if( 0u != ( l_uMask & EFSP_NEGO_LEN32 ) )
+    {
+        p_ptCtx->tLink.uLenL = EFSP_HDR_LEN32;
+    }
+    else
+    {
+        p_ptCtx->tLink.uLenL = p_ptCtx->uBaseLenL;
+    }
+
+    /* The base length field can be too short for the payload */
+    if( ( EFSP_HDR_LEN8 == p_ptCtx->tLink.uLenL ) && ( l_uMaxPayL > EFSP_NEGO_LEN8MAX ) )
+    {
+        l_uMaxPayL = EFSP_NEGO_LEN8MAX;
+    }
+    else if( ( EFSP_HDR_LEN16 == p_ptCtx->tLink.uLenL ) && ( l_uMaxPayL > EFSP_NEGO_LEN16MAX ) )
+    {
+        l_uMaxPayL = EFSP_NEGO_LEN16MAX;
+    }
+    else
+    {
+        /* The length field can contain the payload */
+    }
+
+    p_ptCtx->tLink.uMaxPayL = l_uMaxPayL;
+
+    /* Common framing engine with the lowest overhead */
+    l_uMask = p_ptCtx->tLocal.uFrmMask & p_ptCtx->tPeer.uFrmMask;
+
+    if( 0u != ( l_uMask & EFSP_NEGO_FRMTRSP ) )
+    {
+        p_ptCtx->tLink.uFrm = EFSP_FRM_TRSP;
+    }
+    else if( 0u != ( l_uMask & EFSP_NEGO_FRMCOBS ) )
+    {
+        p_ptCtx->tLink.uFrm = EFSP_FRM_COBS;
+    }
+    else if( 0u != ( l_uMask & EFSP_NEGO_FRMESC ) )
+    {
+        p_ptCtx->tLink.uFrm = EFSP_FRM_ESC;
+    }
+    else
+    {
+        p_ptCtx->tLink.uFrm = p_ptCtx->uBaseFrm;
+    }
+
+    if( 0u != ( p_ptCtx->tLocal.uFeatMask & p_ptCtx->tPeer.uFeatMask & EFSP_NEGO_FEATCMP ) )
+    {
+        p_ptCtx->tLink.uCmpL = EFSP_HDR_CMP;
+    }
+    else
+    {
+        p_ptCtx->tLink.uCmpL = EFSP_HDR_CMPNONE;
+    }
+
+    /* Both windows are powers of two, so is the smallest */
+    if( p_ptCtx->tLocal.uWindow < p_ptCtx->tPeer.uWindow )
+    {
+        p_ptCtx->tLink.uWindow = p_ptCtx->tLocal.uWindow;
+    }
+    else
+    {
+        p_ptCtx->tLink.uWindow = p_ptCtx->tPeer.uWindow;
+    }
+}
+
+static e_eFSP_NEGO_RES eFSP_NEGO_TxStep(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+    e_eFSP_NEGO_RES l_eRes;
+    e_eFSP_MSGTX_RES l_eResTx;
+
+    l_eRes = e_eFSP_NEGO_RES_OK;
+
+    if( false == p_ptCtx->bTxBusy )
+    {
+        /* An answer is sent as soon as possible, the first frames are sent again till the peer answer */
+        if( ( true == p_ptCtx->bSendPend ) || ( false == p_ptCtx->bSentOnce ) ||
+            ( ( e_eFSP_NEGO_ST_HELLO == p_ptCtx->eState ) &&
+              ( ( p_uNowMs - p_ptCtx->uLastTxMs ) >= p_ptCtx->uRetryMs ) ) )
+        {
+            l_eRes = eFSP_NEGO_StartCaps(p_ptCtx, p_uNowMs);
+        }
+    }
+
+    if( ( e_eFSP_NEGO_RES_OK == l_eRes ) && ( true == p_ptCtx->bTxBusy ) )
+    {
+        l_eResTx = eFSP_MSGTX_SendChunk(p_ptCtx->ptMsgTx);
+
+        switch( l_eResTx )
+        {
+            case e_eFSP_MSGTX_RES_OK:
+            {
+                /* Frame not completed yet */
+                break;
+            }
+
+            case e_eFSP_MSGTX_RES_MESSAGESENDED:
+            case e_eFSP_MSGTX_RES_MESSAGETIMEOUT:
+            {
+                /* A frame not sent in time is handled as a lost frame */
+                p_ptCtx->bTxBusy = false;
+                break;
+            }
+
+            default:
+            {
+                p_ptCtx->bTxBusy = false;
+                l_eRes = e_eFSP_NEGO_RES_MSGTXERROR;
+                break;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_NEGO_RES eFSP_NEGO_StartCaps(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uNowMs)
+{
+    e_eFSP_NEGO_RES l_eRes;
+    uint8_t* l_puTxData;
+    uint32_t l_uTxMaxL;
+
+    if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_GetWherePutData(p_ptCtx->ptMsgTx, &l_puTxData, &l_uTxMaxL) )
+    {
+        l_eRes = e_eFSP_NEGO_RES_MSGTXERROR;
+    }
+    else if( l_uTxMaxL < EFSP_NEGO_CAPSIZE )
+    {
+        l_eRes = e_eFSP_NEGO_RES_MSGTXERROR;
+    }
+    else
+    {
+        l_puTxData[0u] = (uint8_t) EFSP_NEGO_TYPECAP;
+        l_puTxData[1u] = (uint8_t) EFSP_NEGO_VERSION;
+
+        if( e_eFSP_NEGO_ST_LINGER == p_ptCtx->eState )
+        {
+            l_puTxData[2u] = (uint8_t) EFSP_NEGO_PEERDONE;
+        }
+        else if( true == p_ptCtx->bPeerKnown )
+        {
+            l_puTxData[2u] = (uint8_t) EFSP_NEGO_PEERKNOWN;
+        }
+        else
+        {
+            l_puTxData[2u] = (uint8_t) EFSP_NEGO_PEERUNKNOWN;
+        }
+
+        l_puTxData[3u] = (uint8_t) (   p_ptCtx->tLocal.uMaxPayL          & 0x000000FFu );
+        l_puTxData[4u] = (uint8_t) ( ( p_ptCtx->tLocal.uMaxPayL >> 8u  ) & 0x000000FFu );
+        l_puTxData[5u] = (uint8_t) ( ( p_ptCtx->tLocal.uMaxPayL >> 16u ) & 0x000000FFu );
+        l_puTxData[6u] = (uint8_t) ( ( p_ptCtx->tLocal.uMaxPayL >> 24u ) & 0x000000FFu );
+        l_puTxData[7u] = (uint8_t) ( p_ptCtx->tLocal.uCrcMask & EFSP_NEGO_CRCALL );
+        l_puTxData[8u] = (uint8_t) ( p_ptCtx->tLocal.uLenMask & EFSP_NEGO_LENALL );
+        l_puTxData[9u] = (uint8_t) ( p_ptCtx->tLocal.uFrmMask & EFSP_NEGO_FRMALL );
+        l_puTxData[10u] = (uint8_t) ( p_ptCtx->tLocal.uFeatMask & EFSP_NEGO_FEATCMP );
+        l_puTxData[11u] = (uint8_t) p_ptCtx->tLocal.uWindow;
+
+        if( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_NewMessage(p_ptCtx->ptMsgTx, EFSP_NEGO_CAPSIZE) )
+        {
+            l_eRes = e_eFSP_NEGO_RES_MSGTXERROR;
+        }
+        else
+        {
+            p_ptCtx->bTxBusy = true;
+            p_ptCtx->bSendPend = false;
+            p_ptCtx->bSentOnce = true;
+            p_ptCtx->uLastTxMs = p_uNowMs;
+            l_eRes = e_eFSP_NEGO_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSP_NEGO_RES eFSP_NEGO_Apply(t_eFSP_NEGO_Ctx* const p_ptCtx, const uint32_t p_uCrcL,
+                                       const uint32_t p_uLenL, const uint32_t p_uFrm, const uint32_t p_uCmpL)
+{
+    e_eFSP_NEGO_RES l_eRes;
+
+    /* The transmitter is free, and a frame half received with the old settings is discarded */
+    if( ( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_SetHeader(p_ptCtx->ptMsgTx, p_uCrcL, p_uLenL) ) ||
+        ( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_SetFraming(p_ptCtx->ptMsgTx, p_uFrm) ) ||
+        ( e_eFSP_MSGTX_RES_OK != eFSP_MSGTX_SetCompression(p_ptCtx->ptMsgTx, p_uCmpL) ) )
+    {
+        l_eRes = e_eFSP_NEGO_RES_MSGTXERROR;
+    }
+    else if( ( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_SetHeader(p_ptCtx->ptMsgRx, p_uCrcL, p_uLenL) ) ||
+             ( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_SetFraming(p_ptCtx->ptMsgRx, p_uFrm) ) ||
+             ( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_SetCompression(p_ptCtx->ptMsgRx, p_uCmpL) ) ||
+             ( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_NewMsg(p_ptCtx->ptMsgRx) ) )
+    {
+        l_eRes = e_eFSP_NEGO_RES_MSGRXERROR;
+    }
+    else
+    {
+        l_eRes = e_eFSP_NEGO_RES_OK;
+    }
+
+    return l_eRes;
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+/**
+ * @file       eFSP_RTTE.h
+ *
+ * @brief      Round trip time estimator and adaptive retransmission timeout
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_RTTE_H
+#define EFSP_RTTE_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Biggest timeout that can be handled, the smoothed values are kept scaled by 8 and must not overflow */
+#define EFSP_RTTE_MAXRTOMS                                              ( 0x0FFFFFFFu )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_RTTE_RES_OK = 0,
+    e_eFSP_RTTE_RES_BADPARAM,
+    e_eFSP_RTTE_RES_BADPOINTER,
+	e_eFSP_RTTE_RES_CORRUPTCTX,
+    e_eFSP_RTTE_RES_NOINITLIB
+}e_eFSP_RTTE_RES;
+
+typedef struct
+{
+    bool_t   bIsInit;
+    bool_t   bHasSample;
+    uint32_t uSRttQ;
+    uint32_t uRttVarQ;
+    uint32_t uRtoMs;
+    uint32_t uInitRtoMs;
+    uint32_t uMinRtoMs;
+    uint32_t uMaxRtoMs;
+}t_eFSP_RTTE_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the estimator of a single link. Until the first sample is added the timeout is the initial
+ *              one.
+ *
+ * @param[in]   p_ptCtx         - Estimator context
+ * @param[in]   p_uInitRtoMs    - Timeout used before any round trip time is measured
+ * @param[in]   p_uMinRtoMs     - Lower bound of the timeout, must cover the jitter that the variance can not see
+ * @param[in]   p_uMaxRtoMs     - Upper bound of the timeout, also used as limit of the backoff
+ *
+ * @return      e_eFSP_RTTE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_RTTE_RES_BADPARAM       - Bounds are zero, inverted, over EFSP_RTTE_MAXRTOMS or the initial
+ *                                               value is out of bounds
+ *              e_eFSP_RTTE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_RTTE_RES eFSP_RTTE_InitCtx(t_eFSP_RTTE_Ctx* const p_ptCtx, const uint32_t p_uInitRtoMs,
+                                  const uint32_t p_uMinRtoMs, const uint32_t p_uMaxRtoMs);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Estimator context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_RTTE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_RTTE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_RTTE_RES eFSP_RTTE_IsInit(t_eFSP_RTTE_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Add the round trip time of a completed exchange and update the smoothed round trip time, its variance
+ *              and the timeout (Jacobson/Karels). Only exchanges completed at the first attempt must be added, the
+ *              answer of a retried frame can not be matched with the right attempt (Karn).
+ *
+ * @param[in]   p_ptCtx         - Estimator context
+ * @param[in]   p_uRttMs        - Measured round trip time, values over the upper bound are limited to it
+ *
+ * @return      e_eFSP_RTTE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_RTTE_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_RTTE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_RTTE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_RTTE_RES eFSP_RTTE_AddSample(t_eFSP_RTTE_Ctx* const p_ptCtx, const uint32_t p_uRttMs);
+
+/**
+ * @brief       Double the timeout after an exchange is lost, up to the upper bound. The next sample added restore
+ *              the timeout computed from the smoothed values.
+ *
+ * @param[in]   p_ptCtx         - Estimator context
+ *
+ * @return      e_eFSP_RTTE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_RTTE_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_RTTE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_RTTE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_RTTE_RES eFSP_RTTE_Backoff(t_eFSP_RTTE_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Retrive the current timeout of the link. The value can be passed to eFSP_MSGTX_SetTimeout or to
+ *              eFSP_MSGRX_SetTimeout before starting the next exchange.
+ *
+ * @param[in]   p_ptCtx         - Estimator context
+ * @param[out]  p_puRtoMs       - Pointer to a uint32_t variable where the timeout will be placed
+ *
+ * @return      e_eFSP_RTTE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_RTTE_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_RTTE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_RTTE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_RTTE_RES eFSP_RTTE_GetRto(t_eFSP_RTTE_Ctx* const p_ptCtx, uint32_t* const p_puRtoMs);
+
+/**
+ * @brief       Retrive the smoothed round trip time and its mean deviation, both in ms
+ *
+ * @param[in]   p_ptCtx         - Estimator context
+ * @param[out]  p_puSRttMs      - Pointer to a uint32_t variable where the smoothed round trip time will be placed
+ * @param[out]  p_puRttVarMs    - Pointer to a uint32_t variable where the mean deviation will be placed
+ *
+ * @return      e_eFSP_RTTE_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_RTTE_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_RTTE_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_RTTE_RES_OK             - Operation ended correctly
+ */
+e_eFSP_RTTE_RES eFSP_RTTE_GetRtt(t_eFSP_RTTE_Ctx* const p_ptCtx, uint32_t* const p_puSRttMs,
+                                 uint32_t* const p_puRttVarMs);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_RTTE_H */
@@ -0,0 +1,208 @@
+/**
+ * @file       eFSP_SPSCR.h
+ *
+ * @brief      Single producer single consumer lock free ring buffer
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_SPSCR_H
+#define EFSP_SPSCR_H
+
+
+
+/* The C11 atomics are included before the C linkage block, the header can not be included by C++ inside it */
+#if !defined(EFSP_SPSCR_MEMBARRIER) && defined(__STDC_VERSION__) && ( __STDC_VERSION__ >= 201112L ) && \
+    !defined(__STDC_NO_ATOMICS__)
+    #include <stdatomic.h>
+#endif
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Barrier used to order the access to the data area with respect to the publication of the read and write index.
+ * On a single core MCU a compiler barrier is enough, on a multi core system or when the producer is a DMA with a
+ * data cache the user must define it as an hardware barrier (e.g. __DMB()) */
+#ifndef EFSP_SPSCR_MEMBARRIER
+    #if defined(__STDC_VERSION__) && ( __STDC_VERSION__ >= 201112L ) && !defined(__STDC_NO_ATOMICS__)
+        #define EFSP_SPSCR_MEMBARRIER()                                 atomic_thread_fence(memory_order_seq_cst)
+    #elif defined(__GNUC__) || defined(__clang__) || defined(__ICCARM__)
+        #define EFSP_SPSCR_MEMBARRIER()                                 __asm volatile ("" : : : "memory")
+    #else
+        #define EFSP_SPSCR_MEMBARRIER()
+    #endif
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_SPSCR_RES_OK = 0,
+    e_eFSP_SPSCR_RES_BADPARAM,
+    e_eFSP_SPSCR_RES_BADPOINTER,
+	e_eFSP_SPSCR_RES_CORRUPTCTX,
+    e_eFSP_SPSCR_RES_NOINITLIB
+}e_eFSP_SPSCR_RES;
+
+typedef struct
+{
+    bool_t            bIsInit;
+	uint8_t*          puBuff;
+	uint32_t          uBuffL;
+    volatile uint32_t uWrIdx;
+    volatile uint32_t uRdIdx;
+}t_eFSP_SPSCR_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the ring buffer context. One byte of the memory area is always left empty in order to
+ *              distinguish a full ring from an empty one, so the usable size is p_uBuffL - 1.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[in]   p_puBuff        - Pointer to a memory area that we will use as ring buffer
+ * @param[in]   p_uBuffL        - Dimension in byte of the p_puBuff
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_BADPARAM       - In case of an invalid parameter passed to the function
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_InitCtx(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_IsInit(t_eFSP_SPSCR_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Producer side. Retrive the biggest contiguous free area where the producer (ISR, DMA) can write data.
+ *              The data is not visible to the consumer until eFSP_SPSCR_CommitWrite is called.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the location of the free area will be placed
+ * @param[out]  p_puMaxDataL    - Pointer to a uint32_t variable where the size of the free area will be placed
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_SPSCR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_GetWriteSpan(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                         uint32_t* const p_puMaxDataL);
+
+/**
+ * @brief       Producer side. Publish to the consumer p_uWrittenL bytes written in the area retrived with
+ *              eFSP_SPSCR_GetWriteSpan.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[in]   p_uWrittenL     - Number of bytes written
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_BADPARAM       - p_uWrittenL is greater than the contiguous free area
+ *		        e_eFSP_SPSCR_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_SPSCR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_CommitWrite(t_eFSP_SPSCR_Ctx* const p_ptCtx, const uint32_t p_uWrittenL);
+
+/**
+ * @brief       Producer side. Copy and publish as many bytes as possible of p_puData, handling the wrap around of the
+ *              ring. Useful in an UART ISR that receive few bytes at time.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[in]   p_puData        - Pointer to the data to insert
+ * @param[in]   p_uDataL        - Size of the data to insert
+ * @param[out]  p_puPushedL     - Pointer to a uint32_t variable where the number of inserted bytes will be placed
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_SPSCR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly, if the ring is full p_puPushedL is less
+ *                                                than p_uDataL
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_Push(t_eFSP_SPSCR_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL,
+                                 uint32_t* const p_puPushedL);
+
+/**
+ * @brief       Consumer side. Retrive the biggest contiguous area of data published by the producer. The data is not
+ *              removed from the ring until eFSP_SPSCR_Release is called, so it can be elaborated in place.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[out]  p_ppuData       - Pointer to a Pointer where the location of the data will be placed
+ * @param[out]  p_puDataL       - Pointer to a uint32_t variable where the size of the data will be placed
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_SPSCR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_GetReadSpan(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                        uint32_t* const p_puDataL);
+
+/**
+ * @brief       Consumer side. Give back to the producer p_uReadL bytes of the area retrived with
+ *              eFSP_SPSCR_GetReadSpan.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[in]   p_uReadL        - Number of bytes consumed
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_BADPARAM       - p_uReadL is greater than the contiguous data area
+ *		        e_eFSP_SPSCR_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_SPSCR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_Release(t_eFSP_SPSCR_Ctx* const p_ptCtx, const uint32_t p_uReadL);
+
+/**
+ * @brief       Retrive the total number of bytes stored in the ring. Can be called from both sides, but the value is
+ *              only a snapshot because the other side can change it concurrently.
+ *
+ * @param[in]   p_ptCtx         - Ring buffer context
+ * @param[out]  p_puUsedL       - Pointer to a uint32_t variable where the number of stored bytes will be placed
+ *
+ * @return      e_eFSP_SPSCR_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_SPSCR_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_SPSCR_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_SPSCR_RES_OK             - Operation ended correctly
+ */
+e_eFSP_SPSCR_RES eFSP_SPSCR_GetUsed(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint32_t* const p_puUsedL);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_SPSCR_H */
@@ -0,0 +1,210 @@
+/**
+ * @file       eFSP_TIMW.h
+ *
+ * @brief      Hierarchical timer wheel shared between many contexts
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_TIMW_H
+#define EFSP_TIMW_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eCU_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* Number of bits of the tick handled by every level of the wheel. With the default value the first level has a
+ * resolution of one tick, and the whole wheel cover 2^20 ticks, that are more than 17 minutes with a 1 ms tick. Longer
+ * timeouts are supported, they are simply cascaded again when the last level expire */
+#ifndef EFSP_TIMW_LVL0BITS
+    #define EFSP_TIMW_LVL0BITS                                          ( 8u )
+#endif
+
+#ifndef EFSP_TIMW_LVL1BITS
+    #define EFSP_TIMW_LVL1BITS                                          ( 6u )
+#endif
+
+#ifndef EFSP_TIMW_LVL2BITS
+    #define EFSP_TIMW_LVL2BITS                                          ( 6u )
+#endif
+
+#define EFSP_TIMW_LVL0SLOTS                                             ( 1u << EFSP_TIMW_LVL0BITS )
+#define EFSP_TIMW_LVL1SLOTS                                             ( 1u << EFSP_TIMW_LVL1BITS )
+#define EFSP_TIMW_LVL2SLOTS                                             ( 1u << EFSP_TIMW_LVL2BITS )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+typedef enum
+{
+    e_eFSP_TIMW_RES_OK = 0,
+    e_eFSP_TIMW_RES_BADPARAM,
+    e_eFSP_TIMW_RES_BADPOINTER,
+	e_eFSP_TIMW_RES_CORRUPTCTX,
+    e_eFSP_TIMW_RES_NOFIRED,
+    e_eFSP_TIMW_RES_NOINITLIB
+}e_eFSP_TIMW_RES;
+
+/* Timer node, must be embedded in the structure that own the deadline. The node is linked in the wheel while armed,
+ * so it must not be moved or destroyed before being canceled */
+typedef struct t_eFSP_TIMW_NodeStr
+{
+    struct t_eFSP_TIMW_NodeStr*  ptNext;
+    struct t_eFSP_TIMW_NodeStr*  ptPrev;
+    struct t_eFSP_TIMW_NodeStr** pptList;
+    uint32_t                     uExpire;
+    uint32_t                     uId;
+}t_eFSP_TIMW_Node;
+
+typedef struct
+{
+    bool_t            bIsInit;
+    uint32_t          uNow;
+    uint32_t          uArmedN;
+    t_eFSP_TIMW_Node* ptFired;
+    t_eFSP_TIMW_Node* aptLvl0[EFSP_TIMW_LVL0SLOTS];
+    t_eFSP_TIMW_Node* aptLvl1[EFSP_TIMW_LVL1SLOTS];
+    t_eFSP_TIMW_Node* aptLvl2[EFSP_TIMW_LVL2SLOTS];
+}t_eFSP_TIMW_Ctx;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Initialize the timer wheel context
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[in]   p_uNow          - Current value of the tick, can be any value of a free running counter
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_InitCtx(t_eFSP_TIMW_Ctx* const p_ptCtx, const uint32_t p_uNow);
+
+/**
+ * @brief       Check if the lib is initialized
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[out]  p_pbIsInit      - Pointer to a bool_t variable that will be filled with true if the lib is initialized
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_IsInit(t_eFSP_TIMW_Ctx* const p_ptCtx, bool_t* p_pbIsInit);
+
+/**
+ * @brief       Initialize a timer node, must be called once before using it with any wheel
+ *
+ * @param[in]   p_ptNode        - Timer node
+ * @param[in]   p_uId           - Identifier returned by eFSP_TIMW_PopFired when the node expire
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_InitNode(t_eFSP_TIMW_Node* const p_ptNode, const uint32_t p_uId);
+
+/**
+ * @brief       Arm, or re-arm, a timer node in O(1). The node expire p_uTimeout ticks after the current value of the
+ *              tick passed with eFSP_TIMW_Advance. An armed or fired node is removed before being armed again.
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[in]   p_ptNode        - Timer node
+ * @param[in]   p_uTimeout      - Timeout in ticks, zero make the node fire immediately
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TIMW_RES_BADPARAM       - The timeout is too big to be compared with the free running tick
+ *		        e_eFSP_TIMW_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TIMW_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_Start(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode,
+                                const uint32_t p_uTimeout);
+
+/**
+ * @brief       Remove in O(1) a timer node from the wheel, armed or fired. Nothing is done for an idle node.
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[in]   p_ptNode        - Timer node
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TIMW_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TIMW_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_Cancel(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode);
+
+/**
+ * @brief       Retrive the ticks remaining before a node expire. An idle or already fired node has no time left.
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[in]   p_ptNode        - Timer node
+ * @param[out]  p_puRemain      - Pointer to a uint32_t variable where the remaining ticks will be placed
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TIMW_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TIMW_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_GetRemain(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode,
+                                    uint32_t* const p_puRemain);
+
+/**
+ * @brief       Move the wheel to the current value of the tick, with a single sweep of the slots that are passed. The
+ *              expired nodes are moved in the fired list, the other armed nodes are not touched.
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[in]   p_uNow          - Current value of the tick
+ * @param[out]  p_puFiredN      - Pointer to a uint32_t variable where the number of nodes fired now will be placed
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TIMW_RES_BADPARAM       - p_uNow is before the current tick of the wheel
+ *		        e_eFSP_TIMW_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TIMW_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_Advance(t_eFSP_TIMW_Ctx* const p_ptCtx, const uint32_t p_uNow, uint32_t* const p_puFiredN);
+
+/**
+ * @brief       Retrive and remove one node from the fired list, so the poller touch only the expired owners. The
+ *              fired nodes are not returned in any particular order.
+ *
+ * @param[in]   p_ptCtx         - Timer wheel context
+ * @param[out]  p_puId          - Pointer to a uint32_t variable where the identifier of the fired node will be placed
+ *
+ * @return      e_eFSP_TIMW_RES_BADPOINTER     - In case of bad pointer passed to the function
+ *		        e_eFSP_TIMW_RES_NOINITLIB      - Need to init context before taking some action
+ *		        e_eFSP_TIMW_RES_CORRUPTCTX     - In case of an corrupted context
+ *              e_eFSP_TIMW_RES_NOFIRED        - No more fired nodes
+ *              e_eFSP_TIMW_RES_OK             - Operation ended correctly
+ */
+e_eFSP_TIMW_RES eFSP_TIMW_PopFired(t_eFSP_TIMW_Ctx* const p_ptCtx, uint32_t* const p_puId);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_TIMW_H */
@@ -0,0 +1,325 @@
+/**
+ * @file       eFSP_RTTE.c
+ *
+ * @brief      Round trip time estimator and adaptive retransmission timeout
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_RTTE.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+/* The smoothed round trip time is kept scaled by 8 and its mean deviation scaled by 4, so the gains of 1/8 and 1/4
+ * become simple shifts and no resolution is lost on short links */
+#define EFSP_RTTE_SRTTSHIFT                                             ( 3u )
+#define EFSP_RTTE_RTTVARSHIFT                                           ( 2u )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_RTTE_IsStatusStillCoherent(const t_eFSP_RTTE_Ctx* p_ptCtx);
+static e_eFSP_RTTE_RES eFSP_RTTE_CheckCtx(const t_eFSP_RTTE_Ctx* p_ptCtx);
+static uint32_t eFSP_RTTE_CalcRto(const t_eFSP_RTTE_Ctx* p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_RTTE_RES eFSP_RTTE_InitCtx(t_eFSP_RTTE_Ctx* const p_ptCtx, const uint32_t p_uInitRtoMs,
+                                  const uint32_t p_uMinRtoMs, const uint32_t p_uMaxRtoMs)
+{
+	/* Local variable */
+	e_eFSP_RTTE_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_RTTE_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity */
+        if( ( p_uMinRtoMs < 1u ) || ( p_uMinRtoMs > p_uMaxRtoMs ) || ( p_uMaxRtoMs > EFSP_RTTE_MAXRTOMS ) ||
+            ( p_uInitRtoMs < p_uMinRtoMs ) || ( p_uInitRtoMs > p_uMaxRtoMs ) )
+        {
+            l_eRes = e_eFSP_RTTE_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->bHasSample = false;
+            p_ptCtx->uSRttQ = 0u;
+            p_ptCtx->uRttVarQ = 0u;
+            p_ptCtx->uRtoMs = p_uInitRtoMs;
+            p_ptCtx->uInitRtoMs = p_uInitRtoMs;
+            p_ptCtx->uMinRtoMs = p_uMinRtoMs;
+            p_ptCtx->uMaxRtoMs = p_uMaxRtoMs;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_RTTE_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_RTTE_RES eFSP_RTTE_IsInit(t_eFSP_RTTE_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_RTTE_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_RTTE_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_RTTE_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_RTTE_RES eFSP_RTTE_AddSample(t_eFSP_RTTE_Ctx* const p_ptCtx, const uint32_t p_uRttMs)
+{
+	/* Local variable */
+	e_eFSP_RTTE_RES l_eRes;
+    uint32_t l_uRtt;
+    uint32_t l_uSRtt;
+    uint32_t l_uErr;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_RTTE_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_RTTE_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_RTTE_RES_OK == l_eRes )
+        {
+            /* A sample over the upper bound can not make the timeout any longer, limit it so nothing can overflow */
+            if( p_uRttMs > p_ptCtx->uMaxRtoMs )
+            {
+                l_uRtt = p_ptCtx->uMaxRtoMs;
+            }
+            else
+            {
+                l_uRtt = p_uRttMs;
+            }
+
+            if( false == p_ptCtx->bHasSample )
+            {
+                /* First measure: SRTT = R, RTTVAR = R / 2 */
+                p_ptCtx->uSRttQ = l_uRtt << EFSP_RTTE_SRTTSHIFT;
+                p_ptCtx->uRttVarQ = l_uRtt << ( EFSP_RTTE_RTTVARSHIFT - 1u );
+                p_ptCtx->bHasSample = true;
+            }
+            else
+            {
+                /* RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, computed with the old SRTT */
+                l_uSRtt = p_ptCtx->uSRttQ >> EFSP_RTTE_SRTTSHIFT;
+                if( l_uRtt >= l_uSRtt )
+                {
+                    l_uErr = l_uRtt - l_uSRtt;
+                    /* SRTT = 7/8 SRTT + 1/8 R */
+                    p_ptCtx->uSRttQ += l_uErr;
+                }
+                else
+                {
+                    l_uErr = l_uSRtt - l_uRtt;
+                    p_ptCtx->uSRttQ -= l_uErr;
+                }
+
+                p_ptCtx->uRttVarQ = p_ptCtx->uRttVarQ - ( p_ptCtx->uRttVarQ >> EFSP_RTTE_RTTVARSHIFT ) + l_uErr;
+            }
+
+            /* The backoff is over, a new answer has been received */
+            p_ptCtx->uRtoMs = eFSP_RTTE_CalcRto(p_ptCtx);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_RTTE_RES eFSP_RTTE_Backoff(t_eFSP_RTTE_Ctx* const p_ptCtx)
+{
+	/* Local variable */
+	e_eFSP_RTTE_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_RTTE_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_RTTE_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_RTTE_RES_OK == l_eRes )
+        {
+            if( p_ptCtx->uRtoMs > ( p_ptCtx->uMaxRtoMs / 2u ) )
+            {
+                p_ptCtx->uRtoMs = p_ptCtx->uMaxRtoMs;
+            }
+            else
+            {
+                p_ptCtx->uRtoMs = p_ptCtx->uRtoMs * 2u;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_RTTE_RES eFSP_RTTE_GetRto(t_eFSP_RTTE_Ctx* const p_ptCtx, uint32_t* const p_puRtoMs)
+{
+	/* Local variable */
+	e_eFSP_RTTE_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRtoMs ) )
+	{
+		l_eRes = e_eFSP_RTTE_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_RTTE_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_RTTE_RES_OK == l_eRes )
+        {
+            *p_puRtoMs = p_ptCtx->uRtoMs;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_RTTE_RES eFSP_RTTE_GetRtt(t_eFSP_RTTE_Ctx* const p_ptCtx, uint32_t* const p_puSRttMs,
+                                 uint32_t* const p_puRttVarMs)
+{
+	/* Local variable */
+	e_eFSP_RTTE_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSRttMs ) || ( NULL == p_puRttVarMs ) )
+	{
+		l_eRes = e_eFSP_RTTE_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_RTTE_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_RTTE_RES_OK == l_eRes )
+        {
+            *p_puSRttMs = p_ptCtx->uSRttQ >> EFSP_RTTE_SRTTSHIFT;
+            *p_puRttVarMs = p_ptCtx->uRttVarQ >> EFSP_RTTE_RTTVARSHIFT;
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_RTTE_IsStatusStillCoherent(const t_eFSP_RTTE_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check bounds validity */
+	if( ( p_ptCtx->uMinRtoMs < 1u ) || ( p_ptCtx->uMinRtoMs > p_ptCtx->uMaxRtoMs ) ||
+        ( p_ptCtx->uMaxRtoMs > EFSP_RTTE_MAXRTOMS ) || ( p_ptCtx->uInitRtoMs < p_ptCtx->uMinRtoMs ) ||
+        ( p_ptCtx->uInitRtoMs > p_ptCtx->uMaxRtoMs ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check estimation validity, the smoothed values can never go over the limited samples */
+        if( ( p_ptCtx->uRtoMs < p_ptCtx->uMinRtoMs ) || ( p_ptCtx->uRtoMs > p_ptCtx->uMaxRtoMs ) ||
+            ( ( p_ptCtx->uSRttQ >> EFSP_RTTE_SRTTSHIFT ) > p_ptCtx->uMaxRtoMs ) ||
+            ( ( p_ptCtx->uRttVarQ >> EFSP_RTTE_RTTVARSHIFT ) > p_ptCtx->uMaxRtoMs ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_RTTE_RES eFSP_RTTE_CheckCtx(const t_eFSP_RTTE_Ctx* p_ptCtx)
+{
+    e_eFSP_RTTE_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_RTTE_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_RTTE_IsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_RTTE_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_RTTE_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eFSP_RTTE_CalcRto(const t_eFSP_RTTE_Ctx* p_ptCtx)
+{
+    uint32_t l_uRto;
+    uint32_t l_uVar;
+
+    /* RTO = SRTT + max(1, 4 * RTTVAR), the scaled deviation is already multiplied by 4. No overflow is possible because
+     * the sum is limited to five times EFSP_RTTE_MAXRTOMS */
+    l_uVar = p_ptCtx->uRttVarQ;
+    if( l_uVar < 1u )
+    {
+        l_uVar = 1u;
+    }
+
+    l_uRto = ( p_ptCtx->uSRttQ >> EFSP_RTTE_SRTTSHIFT ) + l_uVar;
+
+    if( l_uRto < p_ptCtx->uMinRtoMs )
+    {
+        l_uRto = p_ptCtx->uMinRtoMs;
+    }
+    else if( l_uRto > p_ptCtx->uMaxRtoMs )
+    {
+        l_uRto = p_ptCtx->uMaxRtoMs;
+    }
+    else
+    {
+        /* Value already in the bounds */
+    }
+
+    return l_uRto;
+}
@@ -0,0 +1,418 @@
+/**
+ * @file       eFSP_SPSCR.c
+ *
+ * @brief      Single producer single consumer lock free ring buffer
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_SPSCR.h"
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_SPSCR_IsStatusStillCoherent(const t_eFSP_SPSCR_Ctx* p_ptCtx);
+static e_eFSP_SPSCR_RES eFSP_SPSCR_CheckCtx(const t_eFSP_SPSCR_Ctx* p_ptCtx);
+static uint32_t eFSP_SPSCR_GetFreeCont(const uint32_t p_uWrIdx, const uint32_t p_uRdIdx, const uint32_t p_uBuffL);
+static uint32_t eFSP_SPSCR_GetUsedCont(const uint32_t p_uWrIdx, const uint32_t p_uRdIdx, const uint32_t p_uBuffL);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_SPSCR_RES eFSP_SPSCR_InitCtx(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint8_t* p_puBuff, const uint32_t p_uBuffL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Check data validity, one byte is always left empty */
+        if( p_uBuffL < 2u )
+        {
+            l_eRes = e_eFSP_SPSCR_RES_BADPARAM;
+        }
+        else
+        {
+            /* Initialize internal status */
+            p_ptCtx->puBuff = p_puBuff;
+            p_ptCtx->uBuffL = p_uBuffL;
+            p_ptCtx->uWrIdx = 0u;
+            p_ptCtx->uRdIdx = 0u;
+            p_ptCtx->bIsInit = true;
+
+            l_eRes = e_eFSP_SPSCR_RES_OK;
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_IsInit(t_eFSP_SPSCR_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_SPSCR_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_GetWriteSpan(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                         uint32_t* const p_puMaxDataL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+    uint32_t l_uWrIdx;
+    uint32_t l_uRdIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puMaxDataL ) )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_SPSCR_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_SPSCR_RES_OK == l_eRes )
+        {
+            /* The write index is owned by the producer, the read index must be loaded only once */
+            l_uWrIdx = p_ptCtx->uWrIdx;
+            l_uRdIdx = p_ptCtx->uRdIdx;
+
+            /* The consumer must have finished to read the released area before we write on it */
+            EFSP_SPSCR_MEMBARRIER();
+
+            *p_ppuData = &p_ptCtx->puBuff[l_uWrIdx];
+            *p_puMaxDataL = eFSP_SPSCR_GetFreeCont(l_uWrIdx, l_uRdIdx, p_ptCtx->uBuffL);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_CommitWrite(t_eFSP_SPSCR_Ctx* const p_ptCtx, const uint32_t p_uWrittenL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+    uint32_t l_uWrIdx;
+    uint32_t l_uRdIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_SPSCR_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_SPSCR_RES_OK == l_eRes )
+        {
+            l_uWrIdx = p_ptCtx->uWrIdx;
+            l_uRdIdx = p_ptCtx->uRdIdx;
+
+            /* Free space can only grow concurrently, so this check is always safe */
+            if( p_uWrittenL > eFSP_SPSCR_GetFreeCont(l_uWrIdx, l_uRdIdx, p_ptCtx->uBuffL) )
+            {
+                l_eRes = e_eFSP_SPSCR_RES_BADPARAM;
+            }
+            else
+            {
+                /* Data must be written in memory before the consumer can see the new write index */
+                EFSP_SPSCR_MEMBARRIER();
+
+                l_uWrIdx += p_uWrittenL;
+                if( l_uWrIdx >= p_ptCtx->uBuffL )
+                {
+                    l_uWrIdx = 0u;
+                }
+
+                p_ptCtx->uWrIdx = l_uWrIdx;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_Push(t_eFSP_SPSCR_Ctx* const p_ptCtx, const uint8_t* p_puData, const uint32_t p_uDataL,
+                                 uint32_t* const p_puPushedL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+    uint8_t* l_puSpan;
+    uint32_t l_uSpanL;
+    uint32_t l_uRemL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) || ( NULL == p_puPushedL ) )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_puPushedL = 0u;
+        l_uSpanL = 1u;
+        l_eRes = e_eFSP_SPSCR_RES_OK;
+
+        /* At most two span are needed, the tail and the head of the ring */
+        while( ( e_eFSP_SPSCR_RES_OK == l_eRes ) && ( *p_puPushedL < p_uDataL ) && ( l_uSpanL > 0u ) )
+        {
+            l_puSpan = NULL;
+            l_uSpanL = 0u;
+            l_eRes = eFSP_SPSCR_GetWriteSpan(p_ptCtx, &l_puSpan, &l_uSpanL);
+
+            if( ( e_eFSP_SPSCR_RES_OK == l_eRes ) && ( l_uSpanL > 0u ) )
+            {
+                l_uRemL = p_uDataL - *p_puPushedL;
+                if( l_uSpanL > l_uRemL )
+                {
+                    l_uSpanL = l_uRemL;
+                }
+
+                (void)memcpy(l_puSpan, &p_puData[*p_puPushedL], l_uSpanL);
+                l_eRes = eFSP_SPSCR_CommitWrite(p_ptCtx, l_uSpanL);
+
+                if( e_eFSP_SPSCR_RES_OK == l_eRes )
+                {
+                    *p_puPushedL += l_uSpanL;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_GetReadSpan(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint8_t** p_ppuData,
+                                        uint32_t* const p_puDataL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+    uint32_t l_uWrIdx;
+    uint32_t l_uRdIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ppuData ) || ( NULL == p_puDataL ) )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_SPSCR_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_SPSCR_RES_OK == l_eRes )
+        {
+            /* The read index is owned by the consumer, the write index must be loaded only once */
+            l_uRdIdx = p_ptCtx->uRdIdx;
+            l_uWrIdx = p_ptCtx->uWrIdx;
+
+            /* Data must be read from memory only after the write index that published it */
+            EFSP_SPSCR_MEMBARRIER();
+
+            *p_ppuData = &p_ptCtx->puBuff[l_uRdIdx];
+            *p_puDataL = eFSP_SPSCR_GetUsedCont(l_uWrIdx, l_uRdIdx, p_ptCtx->uBuffL);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_Release(t_eFSP_SPSCR_Ctx* const p_ptCtx, const uint32_t p_uReadL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+    uint32_t l_uWrIdx;
+    uint32_t l_uRdIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_SPSCR_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_SPSCR_RES_OK == l_eRes )
+        {
+            l_uRdIdx = p_ptCtx->uRdIdx;
+            l_uWrIdx = p_ptCtx->uWrIdx;
+
+            /* Stored data can only grow concurrently, so this check is always safe */
+            if( p_uReadL > eFSP_SPSCR_GetUsedCont(l_uWrIdx, l_uRdIdx, p_ptCtx->uBuffL) )
+            {
+                l_eRes = e_eFSP_SPSCR_RES_BADPARAM;
+            }
+            else
+            {
+                /* Data must be read from memory before the producer can overwrite it */
+                EFSP_SPSCR_MEMBARRIER();
+
+                l_uRdIdx += p_uReadL;
+                if( l_uRdIdx >= p_ptCtx->uBuffL )
+                {
+                    l_uRdIdx = 0u;
+                }
+
+                p_ptCtx->uRdIdx = l_uRdIdx;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_SPSCR_RES eFSP_SPSCR_GetUsed(t_eFSP_SPSCR_Ctx* const p_ptCtx, uint32_t* const p_puUsedL)
+{
+	/* Local variable */
+	e_eFSP_SPSCR_RES l_eRes;
+    uint32_t l_uWrIdx;
+    uint32_t l_uRdIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puUsedL ) )
+	{
+		l_eRes = e_eFSP_SPSCR_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_SPSCR_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_SPSCR_RES_OK == l_eRes )
+        {
+            l_uRdIdx = p_ptCtx->uRdIdx;
+            l_uWrIdx = p_ptCtx->uWrIdx;
+
+            if( l_uWrIdx >= l_uRdIdx )
+            {
+                *p_puUsedL = l_uWrIdx - l_uRdIdx;
+            }
+            else
+            {
+                *p_puUsedL = ( p_ptCtx->uBuffL - l_uRdIdx ) + l_uWrIdx;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_SPSCR_IsStatusStillCoherent(const t_eFSP_SPSCR_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx->puBuff )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        /* Check index validity */
+        if( ( p_ptCtx->uBuffL < 2u ) || ( p_ptCtx->uWrIdx >= p_ptCtx->uBuffL ) ||
+            ( p_ptCtx->uRdIdx >= p_ptCtx->uBuffL ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_SPSCR_RES eFSP_SPSCR_CheckCtx(const t_eFSP_SPSCR_Ctx* p_ptCtx)
+{
+    e_eFSP_SPSCR_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_SPSCR_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_SPSCR_IsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_SPSCR_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_SPSCR_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static uint32_t eFSP_SPSCR_GetFreeCont(const uint32_t p_uWrIdx, const uint32_t p_uRdIdx, const uint32_t p_uBuffL)
+{
+    uint32_t l_uFreeL;
+
+    if( p_uWrIdx >= p_uRdIdx )
+    {
+        /* Free area goes until the end of the buffer, the last byte must stay empty if the reader is at zero */
+        l_uFreeL = p_uBuffL - p_uWrIdx;
+        if( 0u == p_uRdIdx )
+        {
+            l_uFreeL--;
+        }
+    }
+    else
+    {
+        /* Free area goes until one byte before the reader */
+        l_uFreeL = ( p_uRdIdx - p_uWrIdx ) - 1u;
+    }
+
+    return l_uFreeL;
+}
+
+static uint32_t eFSP_SPSCR_GetUsedCont(const uint32_t p_uWrIdx, const uint32_t p_uRdIdx, const uint32_t p_uBuffL)
+{
+    uint32_t l_uUsedL;
+
+    if( p_uWrIdx >= p_uRdIdx )
+    {
+        /* Stored data goes until the writer */
+        l_uUsedL = p_uWrIdx - p_uRdIdx;
+    }
+    else
+    {
+        /* Stored data goes until the end of the buffer */
+        l_uUsedL = p_uBuffL - p_uRdIdx;
+    }
+
+    return l_uUsedL;
+}
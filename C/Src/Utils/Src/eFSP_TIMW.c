@@ -0,0 +1,496 @@
+/**
+ * @file       eFSP_TIMW.c
+ *
+ * @brief      Hierarchical timer wheel shared between many contexts
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TIMW.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_TIMW_LVL1SHIFT                                             ( EFSP_TIMW_LVL0BITS )
+#define EFSP_TIMW_LVL2SHIFT                                             ( EFSP_TIMW_LVL0BITS + EFSP_TIMW_LVL1BITS )
+#define EFSP_TIMW_WHEELRANGE                ( 1u << ( EFSP_TIMW_LVL0BITS + EFSP_TIMW_LVL1BITS + EFSP_TIMW_LVL2BITS ) )
+#define EFSP_TIMW_MAXTIMEOUT                                            ( 0x7FFFFFFFu )
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_TIMW_IsStatusStillCoherent(const t_eFSP_TIMW_Ctx* p_ptCtx);
+static e_eFSP_TIMW_RES eFSP_TIMW_CheckCtx(const t_eFSP_TIMW_Ctx* p_ptCtx);
+static void eFSP_TIMW_Link(t_eFSP_TIMW_Node** p_pptList, t_eFSP_TIMW_Node* const p_ptNode);
+static void eFSP_TIMW_Unlink(t_eFSP_TIMW_Node* const p_ptNode);
+static void eFSP_TIMW_Place(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode);
+static void eFSP_TIMW_Cascade(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node** p_pptList);
+static uint32_t eFSP_TIMW_Tick(t_eFSP_TIMW_Ctx* const p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+e_eFSP_TIMW_RES eFSP_TIMW_InitCtx(t_eFSP_TIMW_Ctx* const p_ptCtx, const uint32_t p_uNow)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+    uint32_t l_uIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Initialize internal status */
+        p_ptCtx->uNow = p_uNow;
+        p_ptCtx->uArmedN = 0u;
+        p_ptCtx->ptFired = NULL;
+
+        for( l_uIdx = 0u; l_uIdx < EFSP_TIMW_LVL0SLOTS; l_uIdx++ )
+        {
+            p_ptCtx->aptLvl0[l_uIdx] = NULL;
+        }
+
+        for( l_uIdx = 0u; l_uIdx < EFSP_TIMW_LVL1SLOTS; l_uIdx++ )
+        {
+            p_ptCtx->aptLvl1[l_uIdx] = NULL;
+        }
+
+        for( l_uIdx = 0u; l_uIdx < EFSP_TIMW_LVL2SLOTS; l_uIdx++ )
+        {
+            p_ptCtx->aptLvl2[l_uIdx] = NULL;
+        }
+
+        p_ptCtx->bIsInit = true;
+        l_eRes = e_eFSP_TIMW_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_IsInit(t_eFSP_TIMW_Ctx* const p_ptCtx, bool_t* p_pbIsInit)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsInit ) )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        *p_pbIsInit = p_ptCtx->bIsInit;
+        l_eRes = e_eFSP_TIMW_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_InitNode(t_eFSP_TIMW_Node* const p_ptNode, const uint32_t p_uId)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptNode )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        /* The node is idle */
+        p_ptNode->ptNext = NULL;
+        p_ptNode->ptPrev = NULL;
+        p_ptNode->pptList = NULL;
+        p_ptNode->uExpire = 0u;
+        p_ptNode->uId = p_uId;
+        l_eRes = e_eFSP_TIMW_RES_OK;
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_Start(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode,
+                                const uint32_t p_uTimeout)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptNode ) )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TIMW_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_TIMW_RES_OK == l_eRes )
+        {
+            if( p_uTimeout > EFSP_TIMW_MAXTIMEOUT )
+            {
+                l_eRes = e_eFSP_TIMW_RES_BADPARAM;
+            }
+            else
+            {
+                /* Remove the node from the current list, if any */
+                if( NULL != p_ptNode->pptList )
+                {
+                    if( &p_ptCtx->ptFired != p_ptNode->pptList )
+                    {
+                        p_ptCtx->uArmedN--;
+                    }
+                    eFSP_TIMW_Unlink(p_ptNode);
+                }
+
+                p_ptNode->uExpire = p_ptCtx->uNow + p_uTimeout;
+
+                if( 0u == p_uTimeout )
+                {
+                    /* Already expired */
+                    eFSP_TIMW_Link(&p_ptCtx->ptFired, p_ptNode);
+                }
+                else
+                {
+                    eFSP_TIMW_Place(p_ptCtx, p_ptNode);
+                    p_ptCtx->uArmedN++;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_Cancel(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptNode ) )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TIMW_CheckCtx(p_ptCtx);
+
+        if( ( e_eFSP_TIMW_RES_OK == l_eRes ) && ( NULL != p_ptNode->pptList ) )
+        {
+            if( &p_ptCtx->ptFired != p_ptNode->pptList )
+            {
+                p_ptCtx->uArmedN--;
+            }
+            eFSP_TIMW_Unlink(p_ptNode);
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_GetRemain(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode,
+                                    uint32_t* const p_puRemain)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+    uint32_t l_uToExpire;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptNode ) || ( NULL == p_puRemain ) )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TIMW_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_TIMW_RES_OK == l_eRes )
+        {
+            if( ( NULL == p_ptNode->pptList ) || ( &p_ptCtx->ptFired == p_ptNode->pptList ) )
+            {
+                /* Idle or fired */
+                *p_puRemain = 0u;
+            }
+            else
+            {
+                /* An armed node never has more than EFSP_TIMW_MAXTIMEOUT ticks to go */
+                l_uToExpire = p_ptNode->uExpire - p_ptCtx->uNow;
+                if( l_uToExpire <= EFSP_TIMW_MAXTIMEOUT )
+                {
+                    *p_puRemain = l_uToExpire;
+                }
+                else
+                {
+                    *p_puRemain = 0u;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_Advance(t_eFSP_TIMW_Ctx* const p_ptCtx, const uint32_t p_uNow, uint32_t* const p_puFiredN)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puFiredN ) )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TIMW_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_TIMW_RES_OK == l_eRes )
+        {
+            if( ( p_uNow - p_ptCtx->uNow ) > EFSP_TIMW_MAXTIMEOUT )
+            {
+                /* The tick can not go back */
+                l_eRes = e_eFSP_TIMW_RES_BADPARAM;
+            }
+            else
+            {
+                *p_puFiredN = 0u;
+
+                /* Sweep every passed slot, stop as soon as nothing is armed anymore */
+                while( ( p_ptCtx->uNow != p_uNow ) && ( p_ptCtx->uArmedN > 0u ) )
+                {
+                    *p_puFiredN += eFSP_TIMW_Tick(p_ptCtx);
+                }
+
+                /* An empty wheel can jump directly to the current tick */
+                p_ptCtx->uNow = p_uNow;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSP_TIMW_RES eFSP_TIMW_PopFired(t_eFSP_TIMW_Ctx* const p_ptCtx, uint32_t* const p_puId)
+{
+	/* Local variable */
+	e_eFSP_TIMW_RES l_eRes;
+    t_eFSP_TIMW_Node* l_ptNode;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puId ) )
+	{
+		l_eRes = e_eFSP_TIMW_RES_BADPOINTER;
+	}
+	else
+	{
+        l_eRes = eFSP_TIMW_CheckCtx(p_ptCtx);
+
+        if( e_eFSP_TIMW_RES_OK == l_eRes )
+        {
+            l_ptNode = p_ptCtx->ptFired;
+
+            if( NULL == l_ptNode )
+            {
+                l_eRes = e_eFSP_TIMW_RES_NOFIRED;
+            }
+            else
+            {
+                /* The node become idle */
+                eFSP_TIMW_Unlink(l_ptNode);
+                *p_puId = l_ptNode->uId;
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSP_TIMW_IsStatusStillCoherent(const t_eFSP_TIMW_Ctx* p_ptCtx)
+{
+    bool_t l_bRes;
+
+	/* The fired list can not have a previous element, and nothing armed means empty slots in the first level */
+	if( ( NULL != p_ptCtx->ptFired ) && ( NULL != p_ptCtx->ptFired->ptPrev ) )
+	{
+		l_bRes = false;
+	}
+	else
+	{
+        if( ( 0u == p_ptCtx->uArmedN ) &&
+            ( NULL != p_ptCtx->aptLvl0[p_ptCtx->uNow & ( EFSP_TIMW_LVL0SLOTS - 1u )] ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+	}
+
+    return l_bRes;
+}
+
+static e_eFSP_TIMW_RES eFSP_TIMW_CheckCtx(const t_eFSP_TIMW_Ctx* p_ptCtx)
+{
+    e_eFSP_TIMW_RES l_eRes;
+
+    /* Check Init */
+    if( false == p_ptCtx->bIsInit )
+    {
+        l_eRes = e_eFSP_TIMW_RES_NOINITLIB;
+    }
+    else
+    {
+        /* Check internal status validity */
+        if( false == eFSP_TIMW_IsStatusStillCoherent(p_ptCtx) )
+        {
+            l_eRes = e_eFSP_TIMW_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSP_TIMW_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eFSP_TIMW_Link(t_eFSP_TIMW_Node** p_pptList, t_eFSP_TIMW_Node* const p_ptNode)
+{
+    /* Insert in head */
+    p_ptNode->pptList = p_pptList;
+    p_ptNode->ptPrev = NULL;
+    p_ptNode->ptNext = *p_pptList;
+
+    if( NULL != *p_pptList )
+    {
+        (*p_pptList)->ptPrev = p_ptNode;
+    }
+
+    *p_pptList = p_ptNode;
+}
+
+static void eFSP_TIMW_Unlink(t_eFSP_TIMW_Node* const p_ptNode)
+{
+    if( NULL == p_ptNode->ptPrev )
+    {
+        /* Head of the list */
+        *p_ptNode->pptList = p_ptNode->ptNext;
+    }
+    else
+    {
+        p_ptNode->ptPrev->ptNext = p_ptNode->ptNext;
+    }
+
+    if( NULL != p_ptNode->ptNext )
+    {
+        p_ptNode->ptNext->ptPrev = p_ptNode->ptPrev;
+    }
+
+    p_ptNode->ptNext = NULL;
+    p_ptNode->ptPrev = NULL;
+    p_ptNode->pptList = NULL;
+}
+
+static void eFSP_TIMW_Place(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node* const p_ptNode)
+{
+    uint32_t l_uToExpire;
+    uint32_t l_uSlotTick;
+
+    /* Choose the level by the distance from now, and the slot by the expire tick */
+    l_uToExpire = p_ptNode->uExpire - p_ptCtx->uNow;
+
+    if( l_uToExpire < EFSP_TIMW_LVL0SLOTS )
+    {
+        eFSP_TIMW_Link(&p_ptCtx->aptLvl0[p_ptNode->uExpire & ( EFSP_TIMW_LVL0SLOTS - 1u )], p_ptNode);
+    }
+    else if( l_uToExpire < ( 1u << EFSP_TIMW_LVL2SHIFT ) )
+    {
+        l_uSlotTick = p_ptNode->uExpire >> EFSP_TIMW_LVL1SHIFT;
+        eFSP_TIMW_Link(&p_ptCtx->aptLvl1[l_uSlotTick & ( EFSP_TIMW_LVL1SLOTS - 1u )], p_ptNode);
+    }
+    else
+    {
+        /* Out of the wheel range, park it in the farthest slot and it will be placed again when cascaded */
+        if( l_uToExpire < EFSP_TIMW_WHEELRANGE )
+        {
+            l_uSlotTick = p_ptNode->uExpire >> EFSP_TIMW_LVL2SHIFT;
+        }
+        else
+        {
+            l_uSlotTick = ( p_ptCtx->uNow + ( EFSP_TIMW_WHEELRANGE - 1u ) ) >> EFSP_TIMW_LVL2SHIFT;
+        }
+        eFSP_TIMW_Link(&p_ptCtx->aptLvl2[l_uSlotTick & ( EFSP_TIMW_LVL2SLOTS - 1u )], p_ptNode);
+    }
+}
+
+static void eFSP_TIMW_Cascade(t_eFSP_TIMW_Ctx* const p_ptCtx, t_eFSP_TIMW_Node** p_pptList)
+{
+    t_eFSP_TIMW_Node* l_ptNode;
+
+    /* Move every node of the slot to a lower level */
+    while( NULL != *p_pptList )
+    {
+        l_ptNode = *p_pptList;
+        eFSP_TIMW_Unlink(l_ptNode);
+        eFSP_TIMW_Place(p_ptCtx, l_ptNode);
+    }
+}
+
+static uint32_t eFSP_TIMW_Tick(t_eFSP_TIMW_Ctx* const p_ptCtx)
+{
+    uint32_t l_uFiredN;
+    uint32_t l_uIdx0;
+    uint32_t l_uIdx1;
+    t_eFSP_TIMW_Node* l_ptNode;
+
+    l_uFiredN = 0u;
+    p_ptCtx->uNow++;
+
+    l_uIdx0 = p_ptCtx->uNow & ( EFSP_TIMW_LVL0SLOTS - 1u );
+
+    /* First level completed a turn, bring down the next slot of the upper levels */
+    if( 0u == l_uIdx0 )
+    {
+        l_uIdx1 = ( p_ptCtx->uNow >> EFSP_TIMW_LVL1SHIFT ) & ( EFSP_TIMW_LVL1SLOTS - 1u );
+
+        if( 0u == l_uIdx1 )
+        {
+            eFSP_TIMW_Cascade(p_ptCtx,
+                              &p_ptCtx->aptLvl2[( p_ptCtx->uNow >> EFSP_TIMW_LVL2SHIFT ) & ( EFSP_TIMW_LVL2SLOTS - 1u )]);
+        }
+
+        eFSP_TIMW_Cascade(p_ptCtx, &p_ptCtx->aptLvl1[l_uIdx1]);
+    }
+
+    /* Everything in the current slot of the first level is expired */
+    while( NULL != p_ptCtx->aptLvl0[l_uIdx0] )
+    {
+        l_ptNode = p_ptCtx->aptLvl0[l_uIdx0];
+        eFSP_TIMW_Unlink(l_ptNode);
+        eFSP_TIMW_Link(&p_ptCtx->ptFired, l_ptNode);
+        p_ptCtx->uArmedN--;
+        l_uFiredN++;
+    }
+
+    return l_uFiredN;
+}
@@ -22,6 +22,7 @@ extern "C" {
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eFSP_STANDARDTYPE.h"
+#include "eCU_TYPE.h"
 
 
 
@@ -36,6 +37,55 @@ extern "C" {
 #define EFSP_MIN_MSGDE_PAYLOAD                               									  ( ( uint32_t ) 0x01u )
 #define EFSP_MIN_MSGDE_BUFFLEN                       ( ( uint32_t ) ( EFSP_MSGDE_HEADERSIZE + EFSP_MIN_MSGDE_PAYLOAD ) )
 
+/* Header profiles: the header is the CRC of the length and payload followed by the payload length, both stored in
+ * Little Endian on the number of bytes below. The default profile is CRC32 and 32 bit length, the header sizes above */
+#define EFSP_HDR_CRCNONE                                                ( ( uint32_t ) 0x00u )
+#define EFSP_HDR_CRC16                                                  ( ( uint32_t ) 0x02u )
+#define EFSP_HDR_CRC32                                                  ( ( uint32_t ) 0x04u )
+#define EFSP_HDR_LEN8                                                   ( ( uint32_t ) 0x01u )
+#define EFSP_HDR_LEN16                                                  ( ( uint32_t ) 0x02u )
+#define EFSP_HDR_LEN32                                                  ( ( uint32_t ) 0x04u )
+
+/* Length stored as LEB128 varint: 7 bit for every byte starting from the lower ones, the MSB is set when another byte
+ * follows. Lengths lower than 128 use a single byte, the biggest use EFSP_HDR_LENVARMAX bytes */
+#define EFSP_HDR_LENVAR                                                 ( ( uint32_t ) 0x00u )
+#define EFSP_HDR_LENVARMAX                                              ( ( uint32_t ) 0x05u )
+
+/* Whitening: with EFSP_HDR_WHT a byte after the length store the XOR mask applied to the payload, choosen by the
+ * encoder to reduce the bytes that the framing engine must escape. The CRC is calculated before the whitening */
+#define EFSP_HDR_WHTNONE                                                ( ( uint32_t ) 0x00u )
+#define EFSP_HDR_WHT                                                    ( ( uint32_t ) 0x01u )
+
+/* Compression: with EFSP_HDR_CMP a byte after the mask tell if the payload is sent as it is or compressed with LZSS.
+ * The encoder compress only when the payload get shorter, the length and the CRC refer to the sent payload */
+#define EFSP_HDR_CMPNONE                                                ( ( uint32_t ) 0x00u )
+#define EFSP_HDR_CMP                                                    ( ( uint32_t ) 0x01u )
+#define EFSP_HDR_CMPRAW                                                 ( ( uint8_t ) 0x00u )
+#define EFSP_HDR_CMPLZSS                                                ( ( uint8_t ) 0x01u )
+
+/* Delta frames: with EFSP_HDR_DLT two bytes after the compression flag tell if the payload is a key frame, sent as it
+ * is, or the difference from the last key frame, and the sequence number of that key frame. A difference from a key
+ * frame that the decoder does not have is a bad frame */
+#define EFSP_HDR_DLTNONE                                                ( ( uint32_t ) 0x00u )
+#define EFSP_HDR_DLT                                                    ( ( uint32_t ) 0x02u )
+#define EFSP_HDR_DLTKEY                                                 ( ( uint8_t ) 0x00u )
+#define EFSP_HDR_DLTDIFF                                                ( ( uint8_t ) 0x01u )
+
+/* Forward error correction: Reed-Solomon parity bytes added to every 32 byte block of the whole message, header
+ * included, after the whitening. The decoder correct the frame before checking the CRC. Only the bytes of the message
+ * are protected, errors on the bytes added by the framing engine are not corrected */
+#define EFSP_FEC_NONE                                                   ( ( uint32_t ) 0x00u )
+#define EFSP_FEC_RS4                                                    ( ( uint32_t ) 0x04u )
+#define EFSP_FEC_RS8                                                    ( ( uint32_t ) 0x08u )
+#define EFSP_FEC_RS16                                                   ( ( uint32_t ) 0x10u )
+
+/* Framing engines: escape based byte stuffing, that can double the size of the frame, Consistent Overhead Byte
+ * Stuffing, that add at most a byte every 254 bytes of frame, or transparent framing, where a sync sequence and the
+ * escaped header are followed by the raw payload of the declared length. The default engine is EFSP_FRM_ESC */
+#define EFSP_FRM_ESC                                                    ( ( uint32_t ) 0x00u )
+#define EFSP_FRM_COBS                                                   ( ( uint32_t ) 0x01u )
+#define EFSP_FRM_TRSP                                                   ( ( uint32_t ) 0x02u )
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -1,9 +1,22 @@
 #include "eFSP_MSGETST.h"
 #include "eFSP_MSGDTST.h"
 #include "eFSP_MSGDMSGETST.h"
+#include "eFSP_COBSTST.h"
+#include "eFSP_TRSPTST.h"
+#include "eFSP_LZSSTST.h"
+#include "eFSP_DLTTST.h"
+#include "eFSP_FECTST.h"
 #include "eFSP_MSGTXTST.h"
 #include "eFSP_MSGRXTST.h"
 #include "eFSP_MSGRXMSGTXTST.h"
+#include "eFSP_SPSCRTST.h"
+#include "eFSP_TIMWTST.h"
+#include "eFSP_RTTETST.h"
+#include "eFSP_ARQTST.h"
+#include "eFSP_MUXTST.h"
+#include "eFSP_FRAGTST.h"
+#include "eFSP_NEGOTST.h"
+#include "eFSP_FOUTTST.h"
 
 
 int main(void);
@@ -15,9 +28,22 @@ int main(void)
     eFSP_MSGETST_ExeTest();
     eFSP_MSGDTST_ExeTest();
     eFSP_MSGDMSGETST_ExeTest();
+    eFSP_COBSTST_ExeTest();
+    eFSP_TRSPTST_ExeTest();
+    eFSP_LZSSTST_ExeTest();
+    eFSP_DLTTST_ExeTest();
+    eFSP_FECTST_ExeTest();
     eFSP_MSGTXTST_ExeTest();
     eFSP_MSGRXTST_ExeTest();
     eFSP_MSGRXMSGTXTST_ExeTest();
+    eFSP_SPSCRTST_ExeTest();
+    eFSP_TIMWTST_ExeTest();
+    eFSP_RTTETST_ExeTest();
+    eFSP_ARQTST_ExeTest();
+    eFSP_MUXTST_ExeTest();
+    eFSP_FRAGTST_ExeTest();
+    eFSP_NEGOTST_ExeTest();
+    eFSP_FOUTTST_ExeTest();
 
     return 0;
 }
@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_COBSTST.h
+ *
+ * @brief      Consistent Overhead Byte Stuffing test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_COBSTST_H
+#define EFSP_COBSTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the consistent overhead byte stuffing module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_COBSTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_COBSTST_H */
\ No newline at end of file
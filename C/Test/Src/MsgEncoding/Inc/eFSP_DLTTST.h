@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_DLTTST.h
+ *
+ * @brief      In place delta encoding test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_DLTTST_H
+#define EFSP_DLTTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the in place delta encoding module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_DLTTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_DLTTST_H */
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_FECTST.h
+ *
+ * @brief      Forward error correction test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_FECTST_H
+#define EFSP_FECTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the forward error correction module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_FECTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_FECTST_H */
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_LZSSTST.h
+ *
+ * @brief      In place LZSS compression test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_LZSSTST_H
+#define EFSP_LZSSTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the in place lzss compression module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_LZSSTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_LZSSTST_H */
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_TRSPTST.h
+ *
+ * @brief      Length delimited transparent framing test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_TRSPTST_H
+#define EFSP_TRSPTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the length delimited transparent framing module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_TRSPTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_TRSPTST_H */
\ No newline at end of file
@@ -0,0 +1,1505 @@
+/**
+ * @file       eFSP_COBSTST.c
+ *
+ * @brief      Consistent Overhead Byte Stuffing test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_COBSTST.h"
+#include "eFSP_COBS.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_COBSTST_EncFrame(t_eFSP_COBS_EncCtx* p_ptCtx, const uint32_t p_uFrameL, uint8_t* p_puEnc,
+                                    const uint32_t p_uEncL, const uint32_t p_uChunkL, uint32_t* const p_puGetL);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_COBSTST_BadPointer(void);
+static void eFSP_COBSTST_BadInit(void);
+static void eFSP_COBSTST_BadParamEntr(void);
+static void eFSP_COBSTST_CorruptContext(void);
+static void eFSP_COBSTST_Encode(void);
+static void eFSP_COBSTST_Decode(void);
+static void eFSP_COBSTST_DecodeErr(void);
+static void eFSP_COBSTST_RoundTrip(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_COBSTST_ExeTest(void)
+{
+	(void)printf("\n\nCOBS TEST START \n\n");
+
+    eFSP_COBSTST_BadPointer();
+    eFSP_COBSTST_BadInit();
+    eFSP_COBSTST_BadParamEntr();
+    eFSP_COBSTST_CorruptContext();
+    eFSP_COBSTST_Encode();
+    eFSP_COBSTST_Decode();
+    eFSP_COBSTST_DecodeErr();
+    eFSP_COBSTST_RoundTrip();
+
+    (void)printf("\n\nCOBS TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_COBSTST_EncFrame(t_eFSP_COBS_EncCtx* p_ptCtx, const uint32_t p_uFrameL, uint8_t* p_puEnc,
+                             const uint32_t p_uEncL, const uint32_t p_uChunkL, uint32_t* const p_puGetL)
+{
+    bool_t l_bRes;
+    e_eFSP_COBS_RES l_eRes;
+    uint32_t l_uGetL;
+
+    /* Encode the frame placed in the memory area, p_uChunkL bytes at time */
+    *p_puGetL = 0u;
+    l_eRes = eFSP_COBS_NewEncFrame(p_ptCtx, p_uFrameL);
+
+    while( ( e_eFSP_COBS_RES_OK == l_eRes ) && ( *p_puGetL < p_uEncL ) )
+    {
+        l_uGetL = 0u;
+        if( p_uChunkL < ( p_uEncL - *p_puGetL ) )
+        {
+            l_eRes = eFSP_COBS_GetEncChunk(p_ptCtx, &p_puEnc[*p_puGetL], p_uChunkL, &l_uGetL);
+        }
+        else
+        {
+            l_eRes = eFSP_COBS_GetEncChunk(p_ptCtx, &p_puEnc[*p_puGetL], p_uEncL - *p_puGetL, &l_uGetL);
+        }
+        *p_puGetL += l_uGetL;
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == l_eRes )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_COBSTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_EncCtx l_tEnc;
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bVal1;
+    bool_t l_bVal2;
+    bool_t l_bVal3;
+
+    /* Function */
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InitEncCtx(NULL, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InitEncCtx(&l_tEnc, NULL, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_NewEncFrame(NULL, 1u) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_RestartEncFrame(NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetEncRemL(NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetEncRemL(&l_tEnc, NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetEncChunk(NULL, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetEncChunk(&l_tEnc, NULL, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetEncChunk(&l_tEnc, l_auMem, sizeof(l_auMem), NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InitDecCtx(NULL, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InitDecCtx(&l_tDec, NULL, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_NewDecFrame(NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecData(NULL, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecData(&l_tDec, NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecData(&l_tDec, &l_puData, NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecState(NULL, &l_bVal1, &l_bVal2, &l_bVal3) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecState(&l_tDec, NULL, &l_bVal2, &l_bVal3) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecState(&l_tDec, &l_bVal1, NULL, &l_bVal3) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_GetDecState(&l_tDec, &l_bVal1, &l_bVal2, NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InsEncChunk(NULL, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InsEncChunk(&l_tDec, NULL, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPOINTER == eFSP_COBS_InsEncChunk(&l_tDec, l_auMem, sizeof(l_auMem), NULL) )
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadPointer 22 -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_EncCtx l_tEnc;
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bVal1;
+    bool_t l_bVal2;
+    bool_t l_bVal3;
+
+    /* Init only the coherent part of the context */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 2  -- FAIL \n");
+    }
+
+    l_tEnc.bIsInit = false;
+    l_tDec.bIsInit = false;
+
+    /* Function */
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_NewEncFrame(&l_tEnc, 1u) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_GetEncChunk(&l_tEnc, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_GetDecState(&l_tDec, &l_bVal1, &l_bVal2, &l_bVal3) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITLIB == eFSP_COBS_InsEncChunk(&l_tDec, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 10 -- FAIL \n");
+    }
+
+
+    /* A frame must be started before getting it */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITFRAME == eFSP_COBS_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITFRAME == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_NOINITFRAME == eFSP_COBS_GetEncChunk(&l_tEnc, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadInit 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadInit 14 -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_EncCtx l_tEnc;
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t  l_auEnc[10u];
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_COBS_RES_BADPARAM == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, 0u) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPARAM == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, 0u) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPARAM == eFSP_COBS_NewEncFrame(&l_tEnc, 0u) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPARAM == eFSP_COBS_NewEncFrame(&l_tEnc, sizeof(l_auMem) + 1u) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewEncFrame(&l_tEnc, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPARAM == eFSP_COBS_GetEncChunk(&l_tEnc, l_auEnc, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADPARAM == eFSP_COBS_InsEncChunk(&l_tDec, l_auEnc, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_BadParamEntr 9  -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_EncCtx l_tEnc;
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    l_tEnc.puBuff = NULL;
+    if( e_eFSP_COBS_RES_CORRUPTCTX == eFSP_COBS_NewEncFrame(&l_tEnc, 1u) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 2  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewEncFrame(&l_tEnc, 5u) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 4  -- FAIL \n");
+    }
+
+    l_tEnc.uCntr = 6u;
+    if( e_eFSP_COBS_RES_CORRUPTCTX == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 5  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 6  -- FAIL \n");
+    }
+
+    l_tEnc.uBlkL = EFSP_COBS_MAXBLOCK + 1u;
+    if( e_eFSP_COBS_RES_CORRUPTCTX == eFSP_COBS_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 7  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 8  -- FAIL \n");
+    }
+
+    l_tDec.uCntr = sizeof(l_auMem) + 1u;
+    if( e_eFSP_COBS_RES_CORRUPTCTX == eFSP_COBS_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 9  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 10 -- FAIL \n");
+    }
+
+    l_tDec.eSt = (e_eFSP_COBS_DECSM)( e_eFSP_COBS_DECSM_BAD + 1 );
+    if( e_eFSP_COBS_RES_CORRUPTCTX == eFSP_COBS_InsEncChunk(&l_tDec, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_CorruptContext 11 -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_Encode(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_EncCtx l_tEnc;
+    uint8_t  l_auMem[300u];
+    uint8_t  l_auEnc[310u];
+    uint32_t l_uVal;
+    uint32_t l_uI;
+    bool_t l_bIsOk;
+
+    /* Zeros are replaced by the distance of the next one */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 1  -- FAIL \n");
+    }
+
+    l_auMem[0u] = 0x11u;
+    l_auMem[1u] = 0x22u;
+    l_auMem[2u] = 0x00u;
+    l_auMem[3u] = 0x33u;
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewEncFrame(&l_tEnc, 4u) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 7u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetEncChunk(&l_tEnc, l_auEnc, 3u, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 4  -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auEnc[0u] ) && ( 0x03u == l_auEnc[1u] ) && ( 0x11u == l_auEnc[2u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == eFSP_COBS_GetEncChunk(&l_tEnc, l_auEnc, sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 7  -- FAIL \n");
+    }
+
+    if( ( 0x22u == l_auEnc[0u] ) && ( 0x02u == l_auEnc[1u] ) && ( 0x33u == l_auEnc[2u] ) && ( 0x00u == l_auEnc[3u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == eFSP_COBS_GetEncChunk(&l_tEnc, l_auEnc, sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 10 -- FAIL \n");
+    }
+
+
+    /* Restart from the first byte */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 7u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 12 -- FAIL \n");
+    }
+
+    if( true == eFSP_COBSTST_EncFrame(&l_tEnc, 4u, l_auEnc, sizeof(l_auEnc), 1u, &l_uVal) )
+    {
+        if( 7u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 13 -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auEnc[0u] ) && ( 0x03u == l_auEnc[1u] ) && ( 0x02u == l_auEnc[4u] ) && ( 0x00u == l_auEnc[6u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 14 -- FAIL \n");
+    }
+
+
+    /* Only zeros */
+    l_auMem[0u] = 0x00u;
+    l_auMem[1u] = 0x00u;
+    if( true == eFSP_COBSTST_EncFrame(&l_tEnc, 1u, l_auEnc, sizeof(l_auEnc), sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 15 -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auEnc[0u] ) && ( 0x01u == l_auEnc[1u] ) && ( 0x01u == l_auEnc[2u] ) && ( 0x00u == l_auEnc[3u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 16 -- FAIL \n");
+    }
+
+    if( true == eFSP_COBSTST_EncFrame(&l_tEnc, 2u, l_auEnc, sizeof(l_auEnc), sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 17 -- FAIL \n");
+    }
+
+    if( ( 0x01u == l_auEnc[1u] ) && ( 0x01u == l_auEnc[2u] ) && ( 0x01u == l_auEnc[3u] ) && ( 0x00u == l_auEnc[4u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 18 -- FAIL \n");
+    }
+
+
+    /* A full block does not need the zero */
+    for( l_uI = 0u; l_uI < sizeof(l_auMem); l_uI++ )
+    {
+        l_auMem[l_uI] = (uint8_t)( ( l_uI % 255u ) + 1u );
+    }
+    if( true == eFSP_COBSTST_EncFrame(&l_tEnc, EFSP_COBS_MAXBLOCK, l_auEnc, sizeof(l_auEnc), 7u, &l_uVal) )
+    {
+        if( ( EFSP_COBS_MAXBLOCK + 3u ) == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 19 -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auEnc[0u] ) && ( 0xFFu == l_auEnc[1u] ) && ( 0x01u == l_auEnc[2u] ) && ( 0xFEu == l_auEnc[255u] ) && ( 0x00u == l_auEnc[256u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 20 -- FAIL \n");
+    }
+
+    if( true == eFSP_COBSTST_EncFrame(&l_tEnc, EFSP_COBS_MAXBLOCK + 1u, l_auEnc, sizeof(l_auEnc), 7u, &l_uVal) )
+    {
+        if( ( EFSP_COBS_MAXBLOCK + 5u ) == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Encode 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Encode 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 21 -- FAIL \n");
+    }
+
+    if( ( 0xFFu == l_auEnc[1u] ) && ( 0xFEu == l_auEnc[255u] ) && ( 0x02u == l_auEnc[256u] ) && ( 0xFFu == l_auEnc[257u] ) && ( 0x00u == l_auEnc[258u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Encode 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 22 -- FAIL \n");
+    }
+
+
+    /* The overhead never exceed the bound */
+    l_bIsOk = true;
+    for( l_uI = 1u; l_uI <= sizeof(l_auMem); l_uI++ )
+    {
+        if( ( true != eFSP_COBSTST_EncFrame(&l_tEnc, l_uI, l_auEnc, sizeof(l_auEnc), 13u, &l_uVal) ) ||
+            ( l_uVal > ( l_uI + 2u + ( l_uI / EFSP_COBS_MAXBLOCK ) + 1u ) ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+    if( true == l_bIsOk )
+    {
+        (void)printf("eFSP_COBSTST_Encode 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Encode 23 -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_Decode(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bWaitSof;
+    bool_t l_bEnded;
+    bool_t l_bBad;
+    uint8_t l_auEnc[] = { 0x55u, 0x00u, 0x00u, 0x03u, 0x11u, 0x22u, 0x02u, 0x33u, 0x00u, 0x66u };
+    uint8_t l_auZero[] = { 0x00u, 0x01u, 0x01u, 0x00u };
+
+    /* Byte before the delimiter are discarded, and so the empty frames before the first code */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_Decode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecState(&l_tDec, &l_bWaitSof, &l_bEnded, &l_bBad) )
+    {
+        if( ( true == l_bWaitSof ) && ( false == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_COBSTST_Decode 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InsEncChunk(&l_tDec, l_auEnc, 5u, &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Decode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecState(&l_tDec, &l_bWaitSof, &l_bEnded, &l_bBad) )
+    {
+        if( ( false == l_bWaitSof ) && ( false == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_COBSTST_Decode 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( l_auMem == l_puData ) && ( 1u == l_uVal ) )
+        {
+            (void)printf("eFSP_COBSTST_Decode 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == eFSP_COBS_InsEncChunk(&l_tDec, &l_auEnc[5u], 5u, &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Decode 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecState(&l_tDec, &l_bWaitSof, &l_bEnded, &l_bBad) )
+    {
+        if( ( false == l_bWaitSof ) && ( true == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_COBSTST_Decode 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Decode 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 8  -- FAIL \n");
+    }
+
+    if( ( 0x11u == l_auMem[0u] ) && ( 0x22u == l_auMem[1u] ) && ( 0x00u == l_auMem[2u] ) && ( 0x33u == l_auMem[3u] ) )
+    {
+        (void)printf("eFSP_COBSTST_Decode 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == eFSP_COBS_InsEncChunk(&l_tDec, &l_auEnc[9u], 1u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Decode 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 10 -- FAIL \n");
+    }
+
+
+    /* A frame of zeros */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_COBSTST_Decode 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == eFSP_COBS_InsEncChunk(&l_tDec, l_auZero, sizeof(l_auZero), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_Decode 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( 1u == l_uVal ) && ( 0x00u == l_puData[0u] ) )
+        {
+            (void)printf("eFSP_COBSTST_Decode 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_Decode 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_Decode 13 -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_DecodeErr(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[3u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bWaitSof;
+    bool_t l_bEnded;
+    bool_t l_bBad;
+    uint8_t l_auRestart[] = { 0x00u, 0x04u, 0x11u, 0x00u, 0x02u, 0x33u, 0x00u };
+    uint8_t l_auEmpty[] = { 0x00u, 0x01u, 0x00u };
+    uint8_t l_auLong[] = { 0x00u, 0x05u, 0x11u, 0x22u, 0x33u, 0x44u, 0x00u };
+    uint8_t l_auLongZero[] = { 0x00u, 0x04u, 0x11u, 0x22u, 0x33u, 0x01u, 0x00u };
+
+    /* A delimiter inside a block start a new frame */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMERESTART == eFSP_COBS_InsEncChunk(&l_tDec, l_auRestart, sizeof(l_auRestart), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_FRAMEENDED == eFSP_COBS_InsEncChunk(&l_tDec, &l_auRestart[4u], 3u, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( 1u == l_uVal ) && ( 0x33u == l_puData[0u] ) )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 5  -- FAIL \n");
+    }
+
+
+    /* Empty frame */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADFRAME == eFSP_COBS_InsEncChunk(&l_tDec, l_auEmpty, sizeof(l_auEmpty), &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_GetDecState(&l_tDec, &l_bWaitSof, &l_bEnded, &l_bBad) )
+    {
+        if( ( false == l_bWaitSof ) && ( false == l_bEnded ) && ( true == l_bBad ) )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_BADFRAME == eFSP_COBS_InsEncChunk(&l_tDec, l_auEmpty, sizeof(l_auEmpty), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 9  -- FAIL \n");
+    }
+
+
+    /* Frame bigger than the memory area, the byte that does not fit is not used */
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OUTOFMEM == eFSP_COBS_InsEncChunk(&l_tDec, l_auLong, sizeof(l_auLong), &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OUTOFMEM == eFSP_COBS_InsEncChunk(&l_tDec, l_auLongZero, sizeof(l_auLongZero), &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_COBSTST_DecodeErr 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_DecodeErr 13 -- FAIL \n");
+    }
+}
+
+void eFSP_COBSTST_RoundTrip(void)
+{
+    /* Local variable */
+    t_eFSP_COBS_EncCtx l_tEnc;
+    t_eFSP_COBS_DecCtx l_tDec;
+    uint8_t  l_auMem[600u];
+    uint8_t  l_auEnc[610u];
+    uint8_t  l_auDec[600u];
+    uint8_t* l_puData;
+    uint32_t l_uEncL;
+    uint32_t l_uUsedL;
+    uint32_t l_uDecL;
+    uint32_t l_uSeed;
+    uint32_t l_uL;
+    uint32_t l_uI;
+    uint32_t l_uErrN;
+    e_eFSP_COBS_RES l_eRes;
+
+    /* Random frames, with many zeros in the first ones, are encoded and decoded a few bytes at time */
+    l_uErrN = 0u;
+    l_uSeed = 0x12345678u;
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_COBSTST_RoundTrip 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_RoundTrip 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_COBS_RES_OK == eFSP_COBS_InitDecCtx(&l_tDec, l_auDec, sizeof(l_auDec)) )
+    {
+        (void)printf("eFSP_COBSTST_RoundTrip 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_RoundTrip 2  -- FAIL \n");
+    }
+
+
+    for( l_uL = 1u; l_uL <= sizeof(l_auMem); l_uL += 7u )
+    {
+        for( l_uI = 0u; l_uI < l_uL; l_uI++ )
+        {
+            l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+            if( ( l_uL < 300u ) && ( 0u == ( ( l_uSeed >> 16u ) % 4u ) ) )
+            {
+                l_auMem[l_uI] = 0x00u;
+            }
+            else
+            {
+                l_auMem[l_uI] = (uint8_t)( l_uSeed >> 16u );
+            }
+        }
+
+        l_eRes = eFSP_COBS_NewDecFrame(&l_tDec);
+        l_uI = 0u;
+        if( ( e_eFSP_COBS_RES_OK != l_eRes ) ||
+            ( true != eFSP_COBSTST_EncFrame(&l_tEnc, l_uL, l_auEnc, sizeof(l_auEnc), 11u, &l_uEncL) ) )
+        {
+            l_uErrN++;
+        }
+        else
+        {
+            while( ( e_eFSP_COBS_RES_OK == l_eRes ) && ( l_uI < l_uEncL ) )
+            {
+                l_uUsedL = 0u;
+                if( ( l_uEncL - l_uI ) > 5u )
+                {
+                    l_eRes = eFSP_COBS_InsEncChunk(&l_tDec, &l_auEnc[l_uI], 5u, &l_uUsedL);
+                }
+                else
+                {
+                    l_eRes = eFSP_COBS_InsEncChunk(&l_tDec, &l_auEnc[l_uI], l_uEncL - l_uI, &l_uUsedL);
+                }
+                l_uI += l_uUsedL;
+            }
+
+            if( ( e_eFSP_COBS_RES_FRAMEENDED != l_eRes ) || ( l_uEncL != l_uI ) ||
+                ( e_eFSP_COBS_RES_OK != eFSP_COBS_GetDecData(&l_tDec, &l_puData, &l_uDecL) ) || ( l_uL != l_uDecL ) ||
+                ( 0 != memcmp(l_auMem, l_puData, l_uL) ) )
+            {
+                l_uErrN++;
+            }
+        }
+    }
+
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_COBSTST_RoundTrip 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_COBSTST_RoundTrip 3  -- FAIL \n");
+    }
+}
@@ -0,0 +1,562 @@
+/**
+ * @file       eFSP_DLTTST.c
+ *
+ * @brief      In place delta encoding test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_DLTTST.h"
+#include "eFSP_DLT.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_DLTTST_BadPointer(void);
+static void eFSP_DLTTST_BadParamEntr(void);
+static void eFSP_DLTTST_Encode(void);
+static void eFSP_DLTTST_Decode(void);
+static void eFSP_DLTTST_DecodeErr(void);
+static void eFSP_DLTTST_RoundTrip(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_DLTTST_ExeTest(void)
+{
+	(void)printf("\n\nDLT TEST START \n\n");
+
+    eFSP_DLTTST_BadPointer();
+    eFSP_DLTTST_BadParamEntr();
+    eFSP_DLTTST_Encode();
+    eFSP_DLTTST_Decode();
+    eFSP_DLTTST_DecodeErr();
+    eFSP_DLTTST_RoundTrip();
+
+    (void)printf("\n\nDLT TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_DLTTST_BadPointer(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[10u] = {0u};
+    uint8_t  l_auBase[10u] = {0u};
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_DLT_RES_BADPOINTER == eFSP_DLT_Encode(NULL, l_auBase, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPOINTER == eFSP_DLT_Encode(l_auMem, NULL, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPOINTER == eFSP_DLT_Encode(l_auMem, l_auBase, sizeof(l_auMem), NULL) )
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPOINTER == eFSP_DLT_Decode(NULL, sizeof(l_auMem), l_auBase, sizeof(l_auBase), 1u) )
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPOINTER == eFSP_DLT_Decode(l_auMem, sizeof(l_auMem), NULL, sizeof(l_auBase), 1u) )
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+void eFSP_DLTTST_BadParamEntr(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[10u] = {0u};
+    uint8_t  l_auBase[10u] = {0u};
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_DLT_RES_BADPARAM == eFSP_DLT_Encode(l_auMem, l_auBase, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPARAM == eFSP_DLT_Decode(l_auMem, sizeof(l_auMem), l_auBase, sizeof(l_auBase), 0u) )
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPARAM == eFSP_DLT_Decode(l_auMem, sizeof(l_auMem), l_auBase, 10u, sizeof(l_auMem) + 1u) )
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADPARAM == eFSP_DLT_Decode(l_auMem, sizeof(l_auMem), l_auBase, 0u, 1u) )
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_BadParamEntr 4  -- FAIL \n");
+    }
+}
+
+void eFSP_DLTTST_Encode(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auBase[20u];
+    uint8_t  l_auRnd[] = {0x10u, 0x21u, 0x32u, 0x43u, 0x54u, 0x65u, 0x76u, 0x87u};
+    uint32_t l_uVal;
+    uint32_t l_uI;
+
+    /* Function */
+    for( l_uI = 0u; l_uI < sizeof(l_auBase); l_uI++ )
+    {
+        l_auBase[l_uI] = (uint8_t)l_uI;
+    }
+
+    /* Five bytes equal to the base, two different and thirteen equal */
+    (void)memcpy(l_auMem, l_auBase, sizeof(l_auMem));
+    l_auMem[5u] = 0xFAu;
+    l_auMem[6u] = 0x09u;
+    if( e_eFSP_DLT_RES_OK == eFSP_DLT_Encode(l_auMem, l_auBase, sizeof(l_auMem), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_DLTTST_Encode 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_Encode 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 1  -- FAIL \n");
+    }
+
+    if( ( 0x05u == l_auMem[0u] ) && ( 0xFFu == l_auMem[1u] ) && ( 0x0Fu == l_auMem[2u] ) && ( 0x4Du == l_auMem[3u] ) )
+    {
+        (void)printf("eFSP_DLTTST_Encode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 2  -- FAIL \n");
+    }
+
+
+    /* The first bytes can be different, the control byte is over the bytes equal to the base */
+    (void)memcpy(l_auMem, l_auBase, sizeof(l_auMem));
+    l_auMem[0u] = 0xFFu;
+    l_auMem[1u] = 0xFEu;
+    l_auMem[2u] = 0xFDu;
+    if( e_eFSP_DLT_RES_OK == eFSP_DLT_Encode(l_auMem, l_auBase, sizeof(l_auMem), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_DLTTST_Encode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_Encode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 3  -- FAIL \n");
+    }
+
+    if( ( 0xFFu == l_auMem[0u] ) && ( 0xFFu == l_auMem[1u] ) && ( 0xFFu == l_auMem[2u] ) && ( 0x71u == l_auMem[3u] ) )
+    {
+        (void)printf("eFSP_DLTTST_Encode 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 4  -- FAIL \n");
+    }
+
+
+    /* Same data */
+    (void)memcpy(l_auMem, l_auBase, sizeof(l_auMem));
+    if( e_eFSP_DLT_RES_OK == eFSP_DLT_Encode(l_auMem, l_auBase, sizeof(l_auMem), &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_DLTTST_Encode 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_Encode 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 5  -- FAIL \n");
+    }
+
+    if( 0x14u == l_auMem[0u] )
+    {
+        (void)printf("eFSP_DLTTST_Encode 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 6  -- FAIL \n");
+    }
+
+
+    /* Data that does not get shorter is left as it is */
+    l_uVal = 0u;
+    if( e_eFSP_DLT_RES_NOGAIN == eFSP_DLT_Encode(l_auRnd, l_auBase, sizeof(l_auRnd), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_DLTTST_Encode 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_Encode 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 7  -- FAIL \n");
+    }
+
+    if( ( 0x10u == l_auRnd[0u] ) && ( 0x43u == l_auRnd[3u] ) && ( 0x87u == l_auRnd[7u] ) )
+    {
+        (void)printf("eFSP_DLTTST_Encode 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_NOGAIN == eFSP_DLT_Encode(l_auBase, l_auBase, 1u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_DLTTST_Encode 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_Encode 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 9  -- FAIL \n");
+    }
+
+    if( 0x00u == l_auBase[0u] )
+    {
+        (void)printf("eFSP_DLTTST_Encode 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Encode 10 -- FAIL \n");
+    }
+}
+
+void eFSP_DLTTST_Decode(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auBase[20u];
+    uint32_t l_uVal;
+    uint32_t l_uI;
+
+    /* Function */
+    for( l_uI = 0u; l_uI < sizeof(l_auBase); l_uI++ )
+    {
+        l_auBase[l_uI] = (uint8_t)l_uI;
+    }
+
+    (void)memcpy(l_auMem, l_auBase, sizeof(l_auMem));
+    l_auMem[5u] = 0xFAu;
+    l_auMem[6u] = 0x09u;
+    l_auMem[19u] = 0xAAu;
+    if( e_eFSP_DLT_RES_OK == eFSP_DLT_Encode(l_auMem, l_auBase, sizeof(l_auMem), &l_uVal) )
+    {
+        if( 6u == l_uVal )
+        {
+            (void)printf("eFSP_DLTTST_Decode 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_Decode 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Decode 1  -- FAIL \n");
+    }
+
+
+    /* The memory area must contain the data */
+    if( e_eFSP_DLT_RES_OUTOFMEM == eFSP_DLT_Decode(l_auMem, 19u, l_auBase, sizeof(l_auBase), l_uVal) )
+    {
+        (void)printf("eFSP_DLTTST_Decode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Decode 2  -- FAIL \n");
+    }
+
+    if( ( 0x05u == l_auMem[0u] ) && ( 0xFFu == l_auMem[1u] ) )
+    {
+        (void)printf("eFSP_DLTTST_Decode 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Decode 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_OK == eFSP_DLT_Decode(l_auMem, sizeof(l_auMem), l_auBase, sizeof(l_auBase), l_uVal) )
+    {
+        (void)printf("eFSP_DLTTST_Decode 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Decode 4  -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auMem[0u] ) && ( 0x04u == l_auMem[4u] ) && ( 0xFAu == l_auMem[5u] ) && ( 0x09u == l_auMem[6u] ) )
+    {
+        (void)printf("eFSP_DLTTST_Decode 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Decode 5  -- FAIL \n");
+    }
+
+    if( ( 0x07u == l_auMem[7u] ) && ( 0x12u == l_auMem[18u] ) && ( 0xAAu == l_auMem[19u] ) )
+    {
+        (void)printf("eFSP_DLTTST_Decode 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_Decode 6  -- FAIL \n");
+    }
+}
+
+void eFSP_DLTTST_DecodeErr(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auBase[20u] = {0u};
+    uint8_t  l_auLong[] = {0x14u};
+    uint8_t  l_auShort[] = {0x05u};
+    uint8_t  l_auLitCut[] = {0x11u, 0x40u};
+    uint8_t  l_auOver[] = {0xAAu, 0x20u, 0xBBu, 0x21u};
+
+    /* Function */
+    if( e_eFSP_DLT_RES_BADFRAME == eFSP_DLT_Decode(l_auLong, sizeof(l_auLong), l_auBase, 1u, sizeof(l_auLong)) )
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADFRAME == eFSP_DLT_Decode(l_auShort, sizeof(l_auShort), l_auBase, 1u, sizeof(l_auShort)) )
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_DLT_RES_BADFRAME == eFSP_DLT_Decode(l_auLitCut, sizeof(l_auLitCut), l_auBase, 2u, sizeof(l_auLitCut)) )
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 3  -- FAIL \n");
+    }
+
+
+    /* The data would overwrite the stream still to decode, nothing is written */
+    (void)memset(l_auMem, 0x55, sizeof(l_auMem));
+    (void)memcpy(l_auMem, l_auOver, sizeof(l_auOver));
+    if( e_eFSP_DLT_RES_BADFRAME == eFSP_DLT_Decode(l_auMem, sizeof(l_auMem), l_auBase, 4u, sizeof(l_auOver)) )
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 4  -- FAIL \n");
+    }
+
+    if( ( 0xAAu == l_auMem[0u] ) && ( 0x21u == l_auMem[3u] ) && ( 0x55u == l_auMem[4u] ) )
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_DecodeErr 5  -- FAIL \n");
+    }
+}
+
+void eFSP_DLTTST_RoundTrip(void)
+{
+    /* Local variable */
+    uint8_t  l_auBase[200u];
+    uint8_t  l_auData[200u];
+    uint8_t  l_auMem[200u];
+    uint32_t l_uN;
+    uint32_t l_uL;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uDltL;
+    uint32_t l_uGainN;
+    uint32_t l_uErrN;
+    e_eFSP_DLT_RES l_eRes;
+
+    /* Function */
+    l_uErrN = 0u;
+    l_uGainN = 0u;
+    l_uSeed = 0x2468ACE1u;
+
+    for( l_uI = 0u; l_uI < sizeof(l_auBase); l_uI++ )
+    {
+        l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+        l_auBase[l_uI] = (uint8_t)( l_uSeed >> 16u );
+    }
+
+    /* Every length with an increasing number of bytes changed in random positions. The data is always restored, even
+     * when not encoded */
+    for( l_uN = 0u; l_uN < 64u; l_uN += 3u )
+    {
+        for( l_uL = 1u; l_uL <= sizeof(l_auData); l_uL++ )
+        {
+            (void)memcpy(l_auData, l_auBase, l_uL);
+
+            for( l_uI = 0u; l_uI < l_uN; l_uI++ )
+            {
+                l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                l_auData[( l_uSeed >> 16u ) % l_uL] ^= (uint8_t)( 1u + ( ( l_uSeed >> 8u ) % 255u ) );
+            }
+
+            (void)memcpy(l_auMem, l_auData, l_uL);
+            l_uDltL = 0u;
+            l_eRes = eFSP_DLT_Encode(l_auMem, l_auBase, l_uL, &l_uDltL);
+
+            if( e_eFSP_DLT_RES_OK == l_eRes )
+            {
+                l_uGainN++;
+
+                if( ( l_uDltL >= l_uL ) ||
+                    ( e_eFSP_DLT_RES_OK != eFSP_DLT_Decode(l_auMem, l_uL, l_auBase, l_uL, l_uDltL) ) )
+                {
+                    l_uErrN++;
+                }
+            }
+            else if( e_eFSP_DLT_RES_NOGAIN != l_eRes )
+            {
+                l_uErrN++;
+            }
+            else
+            {
+                /* Left as it is */
+            }
+
+            if( 0 != memcmp(l_auMem, l_auData, l_uL) )
+            {
+                l_uErrN++;
+            }
+        }
+    }
+
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_DLTTST_RoundTrip 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_RoundTrip 1  -- FAIL \n");
+    }
+
+    if( l_uGainN > ( 10u * sizeof(l_auData) ) )
+    {
+        (void)printf("eFSP_DLTTST_RoundTrip 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_RoundTrip 2  -- FAIL \n");
+    }
+
+
+    /* A few changes in a long message */
+    (void)memcpy(l_auMem, l_auBase, sizeof(l_auMem));
+    l_auMem[0u] ^= 0x01u;
+    l_auMem[1u] ^= 0x01u;
+    l_auMem[100u] ^= 0x80u;
+    l_auMem[150u] ^= 0x80u;
+    if( e_eFSP_DLT_RES_OK == eFSP_DLT_Encode(l_auMem, l_auBase, sizeof(l_auMem), &l_uDltL) )
+    {
+        if( l_uDltL < 20u )
+        {
+            (void)printf("eFSP_DLTTST_RoundTrip 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_DLTTST_RoundTrip 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_DLTTST_RoundTrip 3  -- FAIL \n");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,624 @@
+/**
+ * @file       eFSP_FECTST.c
+ *
+ * @brief      Forward error correction test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_FECTST.h"
+#include "eFSP_FEC.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_FECTST_BadPointer(void);
+static void eFSP_FECTST_BadParamEntr(void);
+static void eFSP_FECTST_Length(void);
+static void eFSP_FECTST_Encode(void);
+static void eFSP_FECTST_Decode(void);
+static void eFSP_FECTST_Burst(void);
+static void eFSP_FECTST_DecodeErr(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_FECTST_ExeTest(void)
+{
+	(void)printf("\n\nFEC TEST START \n\n");
+
+    eFSP_FECTST_BadPointer();
+    eFSP_FECTST_BadParamEntr();
+    eFSP_FECTST_Length();
+    eFSP_FECTST_Encode();
+    eFSP_FECTST_Decode();
+    eFSP_FECTST_Burst();
+    eFSP_FECTST_DecodeErr();
+
+    (void)printf("\n\nFEC TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_FECTST_BadPointer(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u] = {0u};
+    uint32_t l_uVal;
+    uint32_t l_uFixN;
+
+    /* Function */
+    if( e_eFSP_FEC_RES_BADPOINTER == eFSP_FEC_Encode(NULL, sizeof(l_auMem), 4u, EFSP_FEC_RS4, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPOINTER == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 4u, EFSP_FEC_RS4, NULL) )
+    {
+        (void)printf("eFSP_FECTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPOINTER == eFSP_FEC_Decode(NULL, 8u, EFSP_FEC_RS4, &l_uVal, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPOINTER == eFSP_FEC_Decode(l_auMem, 8u, EFSP_FEC_RS4, NULL, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPOINTER == eFSP_FEC_Decode(l_auMem, 8u, EFSP_FEC_RS4, &l_uVal, NULL) )
+    {
+        (void)printf("eFSP_FECTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadPointer 5  -- FAIL \n");
+    }
+}
+
+void eFSP_FECTST_BadParamEntr(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u] = {0u};
+    uint32_t l_uVal;
+    uint32_t l_uFixN;
+
+    /* Function */
+    if( e_eFSP_FEC_RES_BADPARAM == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 0u, EFSP_FEC_RS4, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPARAM == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 4u, EFSP_FEC_NONE, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPARAM == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 4u, 1u, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPARAM == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 4u, EFSP_FEC_MAXPAR + 1u, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_OUTOFMEM == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 17u, EFSP_FEC_RS4, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_OUTOFMEM == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 21u, EFSP_FEC_RS4, &l_uVal) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPARAM == eFSP_FEC_Decode(l_auMem, 8u, EFSP_FEC_NONE, &l_uVal, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADPARAM == eFSP_FEC_Decode(l_auMem, 8u, EFSP_FEC_MAXPAR + 1u, &l_uVal, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_BadParamEntr 8  -- FAIL \n");
+    }
+}
+
+void eFSP_FECTST_Length(void)
+{
+    /* Function */
+    if( 0u == eFSP_FEC_GetParL(0u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 1  -- FAIL \n");
+    }
+
+    if( 8u == eFSP_FEC_GetParL(1u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 2  -- FAIL \n");
+    }
+
+    if( 8u == eFSP_FEC_GetParL(32u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 3  -- FAIL \n");
+    }
+
+    if( 16u == eFSP_FEC_GetParL(33u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 4  -- FAIL \n");
+    }
+
+    if( 0u == eFSP_FEC_GetParL(33u, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_FECTST_Length 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 5  -- FAIL \n");
+    }
+
+    if( 0u == eFSP_FEC_GetDataL(8u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 6  -- FAIL \n");
+    }
+
+    if( 1u == eFSP_FEC_GetDataL(9u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 7  -- FAIL \n");
+    }
+
+    if( 32u == eFSP_FEC_GetDataL(40u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 8  -- FAIL \n");
+    }
+
+    if( 32u == eFSP_FEC_GetDataL(48u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 9  -- FAIL \n");
+    }
+
+    if( 34u == eFSP_FEC_GetDataL(50u, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_FECTST_Length 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 10 -- FAIL \n");
+    }
+
+    if( 50u == eFSP_FEC_GetDataL(50u, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_FECTST_Length 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Length 11 -- FAIL \n");
+    }
+}
+
+void eFSP_FECTST_Encode(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auExp[4u] = {0x01u, 0x02u, 0x03u, 0x04u};
+    uint32_t l_uFrameL;
+
+    /* Function */
+    (void)memset(l_auMem, 0xCCu, sizeof(l_auMem));
+    (void)memcpy(l_auMem, l_auExp, sizeof(l_auExp));
+    l_uFrameL = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Encode(l_auMem, 8u, 4u, EFSP_FEC_RS4, &l_uFrameL) )
+    {
+        if( ( 8u == l_uFrameL ) && ( 0 == memcmp(l_auMem, l_auExp, sizeof(l_auExp)) ) && ( 0xCCu == l_auMem[8u] ) )
+        {
+            (void)printf("eFSP_FECTST_Encode 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Encode 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Encode 1  -- FAIL \n");
+    }
+
+
+    /* Data all zero, parity all zero */
+    (void)memset(l_auMem, 0u, sizeof(l_auMem));
+    l_uFrameL = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 10u, EFSP_FEC_RS4, &l_uFrameL) )
+    {
+        if( ( 14u == l_uFrameL ) && ( 0u == l_auMem[10u] ) && ( 0u == l_auMem[13u] ) )
+        {
+            (void)printf("eFSP_FECTST_Encode 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Encode 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Encode 2  -- FAIL \n");
+    }
+
+
+    /* Single byte data */
+    (void)memset(l_auMem, 0u, sizeof(l_auMem));
+    l_auMem[0u] = 0x01u;
+    l_uFrameL = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 1u, EFSP_FEC_RS4, &l_uFrameL) )
+    {
+        if( ( 5u == l_uFrameL ) && ( 0x01u == l_auMem[0u] ) && ( 0u == l_auMem[5u] ) )
+        {
+            (void)printf("eFSP_FECTST_Encode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Encode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Encode 3  -- FAIL \n");
+    }
+}
+
+void eFSP_FECTST_Decode(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[140u];
+    uint8_t  l_auExp[100u];
+    uint32_t l_uIdx;
+    uint32_t l_uFrameL;
+    uint32_t l_uDataL;
+    uint32_t l_uFixN;
+
+    /* Function */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auExp); l_uIdx++ )
+    {
+        l_auExp[l_uIdx] = (uint8_t)( ( l_uIdx * 37u ) + 11u );
+    }
+
+    (void)memcpy(l_auMem, l_auExp, sizeof(l_auExp));
+    l_uFrameL = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), sizeof(l_auExp), EFSP_FEC_RS8, &l_uFrameL) )
+    {
+        if( 132u == l_uFrameL )
+        {
+            (void)printf("eFSP_FECTST_Decode 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Decode 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Decode 1  -- FAIL \n");
+    }
+
+
+    /* No error */
+    l_uDataL = 0u;
+    l_uFixN = 1u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Decode(l_auMem, l_uFrameL, EFSP_FEC_RS8, &l_uDataL, &l_uFixN) )
+    {
+        if( ( 100u == l_uDataL ) && ( 0u == l_uFixN ) && ( 0 == memcmp(l_auMem, l_auExp, sizeof(l_auExp)) ) )
+        {
+            (void)printf("eFSP_FECTST_Decode 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Decode 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Decode 2  -- FAIL \n");
+    }
+
+
+    /* An error in the first byte, one in the parity and one in the last byte */
+    l_auMem[0u] ^= 0x01u;
+    l_auMem[110u] ^= 0xFFu;
+    l_auMem[131u] ^= 0x80u;
+    l_uDataL = 0u;
+    l_uFixN = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Decode(l_auMem, l_uFrameL, EFSP_FEC_RS8, &l_uDataL, &l_uFixN) )
+    {
+        if( ( 100u == l_uDataL ) && ( 3u == l_uFixN ) && ( 0 == memcmp(l_auMem, l_auExp, sizeof(l_auExp)) ) )
+        {
+            (void)printf("eFSP_FECTST_Decode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Decode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Decode 3  -- FAIL \n");
+    }
+
+
+    /* Four errors in the same codeword */
+    l_auMem[1u] ^= 0x11u;
+    l_auMem[5u] ^= 0x22u;
+    l_auMem[9u] ^= 0x33u;
+    l_auMem[13u] ^= 0x44u;
+    l_uDataL = 0u;
+    l_uFixN = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Decode(l_auMem, l_uFrameL, EFSP_FEC_RS8, &l_uDataL, &l_uFixN) )
+    {
+        if( ( 100u == l_uDataL ) && ( 4u == l_uFixN ) && ( 0 == memcmp(l_auMem, l_auExp, sizeof(l_auExp)) ) )
+        {
+            (void)printf("eFSP_FECTST_Decode 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Decode 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Decode 4  -- FAIL \n");
+    }
+
+
+    /* Minimum parity */
+    (void)memcpy(l_auMem, l_auExp, sizeof(l_auExp));
+    l_uFrameL = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 33u, 2u, &l_uFrameL) )
+    {
+        if( 37u == l_uFrameL )
+        {
+            (void)printf("eFSP_FECTST_Decode 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Decode 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Decode 5  -- FAIL \n");
+    }
+
+    l_auMem[32u] ^= 0x5Au;
+    l_auMem[35u] ^= 0xA5u;
+    l_uDataL = 0u;
+    l_uFixN = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Decode(l_auMem, l_uFrameL, 2u, &l_uDataL, &l_uFixN) )
+    {
+        if( ( 33u == l_uDataL ) && ( 2u == l_uFixN ) && ( 0 == memcmp(l_auMem, l_auExp, 33u) ) )
+        {
+            (void)printf("eFSP_FECTST_Decode 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_Decode 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Decode 6  -- FAIL \n");
+    }
+}
+
+void eFSP_FECTST_Burst(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[320u];
+    uint8_t  l_auExp[200u];
+    uint32_t l_uIdx;
+    uint32_t l_uStart;
+    uint32_t l_uFrameL;
+    uint32_t l_uDataL;
+    uint32_t l_uFixN;
+    bool_t   l_bRes;
+
+    /* Seven interleaved codewords correct a burst of 7 * 8 bytes starting anywhere */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auExp); l_uIdx++ )
+    {
+        l_auExp[l_uIdx] = (uint8_t)( l_uIdx ^ 0x5Au );
+    }
+
+    l_bRes = true;
+
+    for( l_uStart = 0u; l_uStart <= ( 200u + 112u - 56u ); l_uStart++ )
+    {
+        (void)memcpy(l_auMem, l_auExp, sizeof(l_auExp));
+        l_uFrameL = 0u;
+
+        if( ( e_eFSP_FEC_RES_OK != eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), sizeof(l_auExp), EFSP_FEC_RS16,
+                                                   &l_uFrameL) ) || ( 312u != l_uFrameL ) )
+        {
+            l_bRes = false;
+        }
+
+        for( l_uIdx = l_uStart; l_uIdx < ( l_uStart + 56u ); l_uIdx++ )
+        {
+            l_auMem[l_uIdx] = (uint8_t)~l_auMem[l_uIdx];
+        }
+
+        l_uDataL = 0u;
+        l_uFixN = 0u;
+
+        if( ( e_eFSP_FEC_RES_OK != eFSP_FEC_Decode(l_auMem, l_uFrameL, EFSP_FEC_RS16, &l_uDataL, &l_uFixN) ) ||
+            ( 200u != l_uDataL ) || ( 56u != l_uFixN ) || ( 0 != memcmp(l_auMem, l_auExp, sizeof(l_auExp)) ) )
+        {
+            l_bRes = false;
+        }
+    }
+
+    if( true == l_bRes )
+    {
+        (void)printf("eFSP_FECTST_Burst 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_Burst 1  -- FAIL \n");
+    }
+}
+
+void eFSP_FECTST_DecodeErr(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[60u];
+    uint32_t l_uIdx;
+    uint32_t l_uFrameL;
+    uint32_t l_uDataL;
+    uint32_t l_uFixN;
+
+    /* Function */
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auMem); l_uIdx++ )
+    {
+        l_auMem[l_uIdx] = (uint8_t)l_uIdx;
+    }
+
+    /* Size that no data can give */
+    if( e_eFSP_FEC_RES_BADFRAME == eFSP_FEC_Decode(l_auMem, 4u, EFSP_FEC_RS4, &l_uDataL, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FEC_RES_BADFRAME == eFSP_FEC_Decode(l_auMem, 37u, EFSP_FEC_RS4, &l_uDataL, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 2  -- FAIL \n");
+    }
+
+
+    /* Three errors in a codeword that correct two */
+    l_uFrameL = 0u;
+    if( e_eFSP_FEC_RES_OK == eFSP_FEC_Encode(l_auMem, sizeof(l_auMem), 20u, EFSP_FEC_RS4, &l_uFrameL) )
+    {
+        if( 24u == l_uFrameL )
+        {
+            (void)printf("eFSP_FECTST_DecodeErr 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FECTST_DecodeErr 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 3  -- FAIL \n");
+    }
+
+    l_auMem[0u] ^= 0x01u;
+    l_auMem[7u] ^= 0x02u;
+    l_auMem[21u] ^= 0x04u;
+    if( e_eFSP_FEC_RES_BADFRAME == eFSP_FEC_Decode(l_auMem, l_uFrameL, EFSP_FEC_RS4, &l_uDataL, &l_uFixN) )
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FECTST_DecodeErr 4  -- FAIL \n");
+    }
+}
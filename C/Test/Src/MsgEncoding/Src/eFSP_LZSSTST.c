@@ -0,0 +1,637 @@
+/**
+ * @file       eFSP_LZSSTST.c
+ *
+ * @brief      In place LZSS compression test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_LZSSTST.h"
+#include "eFSP_LZSS.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_LZSSTST_BadPointer(void);
+static void eFSP_LZSSTST_BadParamEntr(void);
+static void eFSP_LZSSTST_Compress(void);
+static void eFSP_LZSSTST_Decompress(void);
+static void eFSP_LZSSTST_DecompressErr(void);
+static void eFSP_LZSSTST_RoundTrip(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_LZSSTST_ExeTest(void)
+{
+	(void)printf("\n\nLZSS TEST START \n\n");
+
+    eFSP_LZSSTST_BadPointer();
+    eFSP_LZSSTST_BadParamEntr();
+    eFSP_LZSSTST_Compress();
+    eFSP_LZSSTST_Decompress();
+    eFSP_LZSSTST_DecompressErr();
+    eFSP_LZSSTST_RoundTrip();
+
+    (void)printf("\n\nLZSS TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_LZSSTST_BadPointer(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[10u] = {0u};
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_LZSS_RES_BADPOINTER == eFSP_LZSS_Compress(NULL, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADPOINTER == eFSP_LZSS_Compress(l_auMem, sizeof(l_auMem), NULL) )
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADPOINTER == eFSP_LZSS_Decompress(NULL, sizeof(l_auMem), 1u, &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADPOINTER == eFSP_LZSS_Decompress(l_auMem, sizeof(l_auMem), 1u, NULL) )
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadPointer 4  -- FAIL \n");
+    }
+}
+
+void eFSP_LZSSTST_BadParamEntr(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[10u] = {0u};
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_LZSS_RES_BADPARAM == eFSP_LZSS_Compress(l_auMem, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADPARAM == eFSP_LZSS_Decompress(l_auMem, sizeof(l_auMem), 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADPARAM == eFSP_LZSS_Decompress(l_auMem, sizeof(l_auMem), sizeof(l_auMem) + 1u, &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_BadParamEntr 3  -- FAIL \n");
+    }
+}
+
+void eFSP_LZSSTST_Compress(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auRnd[] = {0x10u, 0x21u, 0x32u, 0x43u, 0x54u, 0x65u, 0x76u, 0x87u};
+    uint8_t  l_auShort[] = {0x41u, 0x41u, 0x41u};
+    uint32_t l_uVal;
+    uint32_t l_uI;
+
+    /* Function */
+    for( l_uI = 0u; l_uI < sizeof(l_auMem); l_uI++ )
+    {
+        l_auMem[l_uI] = 0x41u;
+    }
+
+    /* Length, two literals and a match that overlap the bytes it is building */
+    if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Compress(l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        if( 6u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Compress 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Compress 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 1  -- FAIL \n");
+    }
+
+    if( ( 20u == l_auMem[0u] ) && ( 0x01u == l_auMem[1u] ) && ( 0x41u == l_auMem[2u] ) && ( 0x41u == l_auMem[3u] ) )
+    {
+        (void)printf("eFSP_LZSSTST_Compress 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 2  -- FAIL \n");
+    }
+
+    if( ( ( EFSP_LZSS_MATCHFLAG | 15u ) == l_auMem[4u] ) && ( 0x00u == l_auMem[5u] ) )
+    {
+        (void)printf("eFSP_LZSSTST_Compress 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 3  -- FAIL \n");
+    }
+
+
+    /* Data that does not get shorter is left as it is */
+    l_uVal = 0u;
+    if( e_eFSP_LZSS_RES_NOGAIN == eFSP_LZSS_Compress(l_auRnd, sizeof(l_auRnd), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Compress 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Compress 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 4  -- FAIL \n");
+    }
+
+    if( ( 0x10u == l_auRnd[0u] ) && ( 0x43u == l_auRnd[3u] ) && ( 0x87u == l_auRnd[7u] ) )
+    {
+        (void)printf("eFSP_LZSSTST_Compress 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_NOGAIN == eFSP_LZSS_Compress(l_auShort, sizeof(l_auShort), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Compress 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Compress 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 6  -- FAIL \n");
+    }
+
+    if( ( 0x41u == l_auShort[0u] ) && ( 0x41u == l_auShort[2u] ) )
+    {
+        (void)printf("eFSP_LZSSTST_Compress 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Compress 7  -- FAIL \n");
+    }
+}
+
+void eFSP_LZSSTST_Decompress(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auStream[] = {0x0Cu, 0x00u, 0x41u, 0x87u, 0x00u, 0x00u, 0x42u};
+    uint32_t l_uVal;
+    uint32_t l_uI;
+    bool_t l_bOk;
+
+    /* Function */
+    (void)memset(l_auMem, 0x41, sizeof(l_auMem));
+    if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Compress(l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        if( 6u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_OUTOFMEM == eFSP_LZSS_Decompress(l_auMem, 19u, l_uVal, &l_uVal) )
+    {
+        if( 6u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Decompress(l_auMem, sizeof(l_auMem), l_uVal, &l_uVal) )
+    {
+        if( 20u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 3  -- FAIL \n");
+    }
+
+
+    l_bOk = true;
+    for( l_uI = 0u; l_uI < sizeof(l_auMem); l_uI++ )
+    {
+        if( 0x41u != l_auMem[l_uI] )
+        {
+            l_bOk = false;
+        }
+    }
+    if( true == l_bOk )
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 4  -- FAIL \n");
+    }
+
+
+    /* The first match build more data than the stream it consume, the memory area need a byte more */
+    (void)memcpy(l_auMem, l_auStream, sizeof(l_auStream));
+    if( e_eFSP_LZSS_RES_OUTOFMEM == eFSP_LZSS_Decompress(l_auMem, 12u, sizeof(l_auStream), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 5  -- FAIL \n");
+    }
+
+    if( ( 0x0Cu == l_auMem[0u] ) && ( 0x87u == l_auMem[3u] ) && ( 0x42u == l_auMem[6u] ) )
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Decompress(l_auMem, 13u, sizeof(l_auStream), &l_uVal) )
+    {
+        if( 12u == l_uVal )
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_Decompress 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 7  -- FAIL \n");
+    }
+
+    if( ( 0x41u == l_auMem[0u] ) && ( 0x41u == l_auMem[10u] ) && ( 0x42u == l_auMem[11u] ) )
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_Decompress 8  -- FAIL \n");
+    }
+}
+
+void eFSP_LZSSTST_DecompressErr(void)
+{
+    /* Local variable */
+    uint8_t  l_auMem[20u];
+    uint8_t  l_auNoEnd[] = {0x80u};
+    uint8_t  l_auZero[] = {0x00u, 0x00u, 0x41u};
+    uint8_t  l_auBig[] = {0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x10u, 0x00u, 0x41u};
+    uint8_t  l_auFar[] = {0x03u, 0x80u, 0x00u};
+    uint8_t  l_auFar2[] = {0x05u, 0x00u, 0x41u, 0x80u, 0x01u};
+    uint8_t  l_auLitCut[] = {0x02u, 0x01u, 0x41u};
+    uint8_t  l_auMatchCut[] = {0x04u, 0x00u, 0x41u, 0x80u};
+    uint8_t  l_auShort[] = {0x03u, 0x00u, 0x41u};
+    uint8_t  l_auLong[] = {0x01u, 0x01u, 0x41u, 0x42u};
+    uint8_t  l_auLong2[] = {0x02u, 0x00u, 0x41u, 0x80u, 0x00u};
+    uint8_t  l_auHuge[] = {0x15u, 0x00u, 0x41u, 0x91u, 0x00u};
+    uint32_t l_uVal;
+
+    /* Function */
+    l_uVal = 0u;
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auNoEnd, sizeof(l_auNoEnd), sizeof(l_auNoEnd), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auZero, sizeof(l_auZero), sizeof(l_auZero), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auBig, sizeof(l_auBig), sizeof(l_auBig), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auFar, sizeof(l_auFar), sizeof(l_auFar), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auFar2, sizeof(l_auFar2), sizeof(l_auFar2), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auLitCut, sizeof(l_auLitCut), sizeof(l_auLitCut), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auMatchCut, sizeof(l_auMatchCut), sizeof(l_auMatchCut), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auShort, sizeof(l_auShort), sizeof(l_auShort), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auLong, sizeof(l_auLong), sizeof(l_auLong), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_LZSS_RES_BADFRAME == eFSP_LZSS_Decompress(l_auLong2, sizeof(l_auLong2), sizeof(l_auLong2), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 10 -- FAIL \n");
+    }
+
+    if( 0u == l_uVal )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 11 -- FAIL \n");
+    }
+
+
+    /* The memory area can not contain the data, nothing is written */
+    (void)memcpy(l_auMem, l_auHuge, sizeof(l_auHuge));
+    if( e_eFSP_LZSS_RES_OUTOFMEM == eFSP_LZSS_Decompress(l_auMem, sizeof(l_auMem), sizeof(l_auHuge), &l_uVal) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 12 -- FAIL \n");
+    }
+
+    if( ( 0x15u == l_auMem[0u] ) && ( 0x41u == l_auMem[2u] ) && ( 0x91u == l_auMem[3u] ) && ( 0u == l_uVal ) )
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_DecompressErr 13 -- FAIL \n");
+    }
+}
+
+void eFSP_LZSSTST_RoundTrip(void)
+{
+    /* Local variable */
+    uint8_t  l_auData[300u];
+    uint8_t  l_auMem[300u + 16u];
+    const char* l_pcText = "The quick brown fox jumps over the lazy dog. ";
+    uint32_t l_uD;
+    uint32_t l_uL;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uCmpL;
+    uint32_t l_uDecL;
+    uint32_t l_uGainN;
+    uint32_t l_uErrN;
+    e_eFSP_LZSS_RES l_eRes;
+
+    /* Function */
+    l_uErrN = 0u;
+    l_uGainN = 0u;
+    l_uSeed = 0x13579BDFu;
+
+    /* Random, few symbols, text and zeros, of every length. The data is always restored, even when not compressed */
+    for( l_uD = 0u; l_uD < 4u; l_uD++ )
+    {
+        for( l_uL = 1u; l_uL <= sizeof(l_auData); l_uL++ )
+        {
+            for( l_uI = 0u; l_uI < l_uL; l_uI++ )
+            {
+                l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                if( 0u == l_uD )
+                {
+                    l_auData[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                }
+                else if( 1u == l_uD )
+                {
+                    l_auData[l_uI] = (uint8_t)( ( l_uSeed >> 16u ) % 3u );
+                }
+                else if( 2u == l_uD )
+                {
+                    l_auData[l_uI] = (uint8_t)l_pcText[l_uI % 45u];
+                }
+                else
+                {
+                    l_auData[l_uI] = 0x00u;
+                }
+            }
+
+            (void)memcpy(l_auMem, l_auData, l_uL);
+            l_uCmpL = 0u;
+            l_uDecL = 0u;
+            l_eRes = eFSP_LZSS_Compress(l_auMem, l_uL, &l_uCmpL);
+
+            if( e_eFSP_LZSS_RES_OK == l_eRes )
+            {
+                l_uGainN++;
+
+                if( ( l_uCmpL >= l_uL ) ||
+                    ( e_eFSP_LZSS_RES_OK != eFSP_LZSS_Decompress(l_auMem, sizeof(l_auMem), l_uCmpL, &l_uDecL) ) ||
+                    ( l_uDecL != l_uL ) )
+                {
+                    l_uErrN++;
+                }
+            }
+            else if( e_eFSP_LZSS_RES_NOGAIN != l_eRes )
+            {
+                l_uErrN++;
+            }
+            else
+            {
+                /* Left as it is */
+            }
+
+            if( 0 != memcmp(l_auMem, l_auData, l_uL) )
+            {
+                l_uErrN++;
+            }
+        }
+    }
+
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_LZSSTST_RoundTrip 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_RoundTrip 1  -- FAIL \n");
+    }
+
+
+    /* Random data never compress, the others almost always */
+    if( ( l_uGainN > ( 2u * ( sizeof(l_auData) - 10u ) ) ) && ( l_uGainN < ( 3u * sizeof(l_auData) ) ) )
+    {
+        (void)printf("eFSP_LZSSTST_RoundTrip 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_RoundTrip 2  -- FAIL \n");
+    }
+
+
+    /* Text and zeros compress well */
+    (void)memset(l_auMem, 0, sizeof(l_auData));
+    if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Compress(l_auMem, sizeof(l_auData), &l_uCmpL) )
+    {
+        if( l_uCmpL < 16u )
+        {
+            (void)printf("eFSP_LZSSTST_RoundTrip 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_RoundTrip 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_RoundTrip 3  -- FAIL \n");
+    }
+
+    for( l_uI = 0u; l_uI < sizeof(l_auData); l_uI++ )
+    {
+        l_auMem[l_uI] = (uint8_t)l_pcText[l_uI % 45u];
+    }
+    if( e_eFSP_LZSS_RES_OK == eFSP_LZSS_Compress(l_auMem, sizeof(l_auData), &l_uCmpL) )
+    {
+        if( l_uCmpL < 60u )
+        {
+            (void)printf("eFSP_LZSSTST_RoundTrip 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_LZSSTST_RoundTrip 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_LZSSTST_RoundTrip 4  -- FAIL \n");
+    }
+}
@@ -15,6 +15,20 @@
 #include "eFSP_MSGD.h"
 #include "eCU_CRC.h"
 #include <stdio.h>
+#include <time.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_MSGDMSGETST_BENCHL                                         ( 250u )
+#define EFSP_MSGDMSGETST_BENCHN                                         ( 2000u )
+#define EFSP_MSGDMSGETST_STATUSL                                        ( 64u )
+#define EFSP_MSGDMSGETST_FECL                                           ( 100u )
+#define EFSP_MSGDMSGETST_FECN                                           ( 200u )
+#define EFSP_MSGDMSGETST_FECTRY                                         ( 16u )
+#define EFSP_MSGDMSGETST_FECTOUT                                        ( 64u )
 
 
 
@@ -38,6 +52,14 @@ struct t_eFSP_MSGE_CrcCtxUser
  **********************************************************************************************************************/
 static bool_t eFSP_MSGDMSGETST_c32SAdapt(t_eFSP_MSGD_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD, const uint32_t p_uDLen, uint32_t* const p_puC32Val);
 static bool_t eFSP_MSGDMSGETST_c32SAdaptE(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD, const uint32_t p_uDLen, uint32_t* const p_puC32Val);
+static bool_t eFSP_MSGDMSGETST_RoundTrip(t_eFSP_MSGE_Ctx* p_ptEnc, t_eFSP_MSGD_Ctx* p_ptDec, const uint8_t* p_puPay,
+                                         const uint32_t p_uPayL, uint32_t* const p_puWireL);
+static bool_t eFSP_MSGDMSGETST_Encode(t_eFSP_MSGE_Ctx* p_ptEnc, const uint8_t* p_puPay, const uint32_t p_uPayL,
+                                      uint8_t* p_puWire, const uint32_t p_uWireMaxL, uint32_t* const p_puWireL);
+static bool_t eFSP_MSGDMSGETST_Decode(t_eFSP_MSGD_Ctx* p_ptDec, uint8_t* p_puWire, const uint32_t p_uWireL,
+                                      const uint8_t* p_puPay, const uint32_t p_uPayL);
+static void eFSP_MSGDMSGETST_Corrupt(const uint32_t p_uFrm, uint8_t* p_puWire, const uint32_t p_uWireL,
+                                     const uint32_t p_uErrN, uint32_t* const p_puSeed);
 
 
 
@@ -45,6 +67,14 @@ static bool_t eFSP_MSGDMSGETST_c32SAdaptE(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uin
  *   PRIVATE FUNCTION DECLARATION
  **********************************************************************************************************************/
 static void eFSP_MSGDMSGETST_Common(void);
+static void eFSP_MSGDMSGETST_Profiles(void);
+static void eFSP_MSGDMSGETST_VarLen(void);
+static void eFSP_MSGDMSGETST_Framing(void);
+static void eFSP_MSGDMSGETST_Transparent(void);
+static void eFSP_MSGDMSGETST_Whitening(void);
+static void eFSP_MSGDMSGETST_Compression(void);
+static void eFSP_MSGDMSGETST_Delta(void);
+static void eFSP_MSGDMSGETST_Fec(void);
 
 
 
@@ -57,6 +87,22 @@ void eFSP_MSGDMSGETST_ExeTest(void)
 
     eFSP_MSGDMSGETST_Common();
 
+    eFSP_MSGDMSGETST_Profiles();
+
+    eFSP_MSGDMSGETST_VarLen();
+
+    eFSP_MSGDMSGETST_Framing();
+
+    eFSP_MSGDMSGETST_Transparent();
+
+    eFSP_MSGDMSGETST_Whitening();
+
+    eFSP_MSGDMSGETST_Compression();
+
+    eFSP_MSGDMSGETST_Delta();
+
+    eFSP_MSGDMSGETST_Fec();
+
     (void)printf("\n\nMESSAGE DECODER ENCODER TEST END \n\n");
 }
 
@@ -112,6 +158,164 @@ bool_t eFSP_MSGDMSGETST_c32SAdaptE(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uint32_t p
 
     return l_bRes;
 }
+bool_t eFSP_MSGDMSGETST_RoundTrip(t_eFSP_MSGE_Ctx* p_ptEnc, t_eFSP_MSGD_Ctx* p_ptDec, const uint8_t* p_puPay,
+                                  const uint32_t p_uPayL, uint32_t* const p_puWireL)
+{
+    bool_t l_bRes;
+    uint8_t l_auWire[( 2u * ( EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX ) ) + 2u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uUsedL;
+
+    /* Encode the payload in a single chunk, and decode it */
+    *p_puWireL = 0u;
+    l_uUsedL = 0u;
+    l_uDataL = 0u;
+    l_puData = NULL;
+
+    if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_GetWherePutData(p_ptEnc, &l_puData, &l_uDataL) ) || ( l_uDataL < p_uPayL ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        (void)memcpy(l_puData, p_puPay, p_uPayL);
+
+        if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_NewMessage(p_ptEnc, p_uPayL) ) ||
+            ( e_eFSP_MSGE_RES_MESSAGEENDED != eFSP_MSGE_GetEncChunk(p_ptEnc, l_auWire, sizeof(l_auWire), p_puWireL) ) ||
+            ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_NewMsg(p_ptDec) ) ||
+            ( e_eFSP_MSGD_RES_MESSAGEENDED != eFSP_MSGD_InsEncChunk(p_ptDec, l_auWire, *p_puWireL, &l_uUsedL) ) ||
+            ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_GetDecodedData(p_ptDec, &l_puData, &l_uDataL) ) )
+        {
+            l_bRes = false;
+        }
+        else if( ( p_uPayL != l_uDataL ) || ( *p_puWireL != l_uUsedL ) || ( 0 != memcmp(l_puData, p_puPay, p_uPayL) ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_MSGDMSGETST_Encode(t_eFSP_MSGE_Ctx* p_ptEnc, const uint8_t* p_puPay, const uint32_t p_uPayL,
+                               uint8_t* p_puWire, const uint32_t p_uWireMaxL, uint32_t* const p_puWireL)
+{
+    bool_t l_bRes;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Encode the payload in a single chunk */
+    *p_puWireL = 0u;
+    l_uDataL = 0u;
+    l_puData = NULL;
+
+    if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_GetWherePutData(p_ptEnc, &l_puData, &l_uDataL) ) || ( l_uDataL < p_uPayL ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        (void)memcpy(l_puData, p_puPay, p_uPayL);
+
+        if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_NewMessage(p_ptEnc, p_uPayL) ) ||
+            ( e_eFSP_MSGE_RES_MESSAGEENDED != eFSP_MSGE_GetEncChunk(p_ptEnc, p_puWire, p_uWireMaxL, p_puWireL) ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+    }
+
+    return l_bRes;
+}
+
+
+bool_t eFSP_MSGDMSGETST_Decode(t_eFSP_MSGD_Ctx* p_ptDec, uint8_t* p_puWire, const uint32_t p_uWireL,
+                               const uint8_t* p_puPay, const uint32_t p_uPayL)
+{
+    bool_t l_bRes;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uUsedL;
+
+    /* Decode a whole frame, and compare it with the payload that was sent */
+    l_uUsedL = 0u;
+    l_uDataL = 0u;
+    l_puData = NULL;
+
+    if( ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_NewMsg(p_ptDec) ) ||
+        ( e_eFSP_MSGD_RES_MESSAGEENDED != eFSP_MSGD_InsEncChunk(p_ptDec, p_puWire, p_uWireL, &l_uUsedL) ) ||
+        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_GetDecodedData(p_ptDec, &l_puData, &l_uDataL) ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( p_uPayL != l_uDataL ) || ( p_uWireL != l_uUsedL ) || ( 0 != memcmp(l_puData, p_puPay, p_uPayL) ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+void eFSP_MSGDMSGETST_Corrupt(const uint32_t p_uFrm, uint8_t* p_puWire, const uint32_t p_uWireL,
+                              const uint32_t p_uErrN, uint32_t* const p_puSeed)
+{
+    uint32_t l_uN;
+    uint32_t l_uIdx;
+    uint32_t l_uCode;
+    uint8_t l_uNew;
+    bool_t l_bData;
+
+    /* Change p_uErrN bytes of data, never the bytes used by the framing engine to find the frame */
+    l_uN = 0u;
+
+    while( l_uN < p_uErrN )
+    {
+        *p_puSeed = ( *p_puSeed * 1103515245u ) + 12345u;
+        l_uIdx = 1u + ( ( *p_puSeed >> 8u ) % ( p_uWireL - 2u ) );
+        l_uNew = (uint8_t)( p_puWire[l_uIdx] ^ (uint8_t)( 1u + ( ( *p_puSeed >> 24u ) % 0xFFu ) ) );
+
+        if( EFSP_FRM_ESC == p_uFrm )
+        {
+            /* Never a special char, never the byte after an escape */
+            l_bData = ( ( p_puWire[l_uIdx] < ECU_SOF ) || ( p_puWire[l_uIdx] > ECU_ESC ) ) &&
+                      ( ( l_uNew < ECU_SOF ) || ( l_uNew > ECU_ESC ) ) && ( ECU_ESC != p_puWire[l_uIdx - 1u] );
+        }
+        else if( EFSP_FRM_COBS == p_uFrm )
+        {
+            /* Never a code byte, never the delimiter */
+            l_uCode = 1u;
+            while( l_uCode < l_uIdx )
+            {
+                l_uCode += p_puWire[l_uCode];
+            }
+            l_bData = ( l_uCode != l_uIdx ) && ( EFSP_COBS_DELIM != l_uNew );
+        }
+        else
+        {
+            /* Only the raw part at the end of the frame */
+            l_bData = ( ( l_uIdx + 32u ) >= p_uWireL );
+        }
+
+        if( true == l_bData )
+        {
+            p_puWire[l_uIdx] = l_uNew;
+            l_uN++;
+        }
+    }
+}
+
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
@@ -328,3 +532,2115 @@ void eFSP_MSGDMSGETST_Common(void)
 
 }
 
+void eFSP_MSGDMSGETST_Profiles(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[50u] = {0u};
+    uint32_t l_uEncMaxPaySize;
+    uint8_t* l_puEncPayLoc;
+    uint8_t l_auEncDataSend[100u];
+    uint32_t l_uEncToSendSize;
+
+    /* Local variable for message DECODER */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[50u] = {0u};
+    uint32_t l_uDecCounter;
+    uint8_t* l_puDecPayLoc;
+    uint32_t l_uDecPaySize;
+
+    /* Profiles */
+    const uint32_t l_auCrcL[] = {EFSP_HDR_CRCNONE, EFSP_HDR_CRC16, EFSP_HDR_CRC32};
+    const uint32_t l_auLenL[] = {EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32};
+    uint32_t l_uC;
+    uint32_t l_uL;
+    uint32_t l_uI;
+    uint32_t l_uErrN;
+
+    /* Every profile can be encoded and decoded, and the header size is the sum of the field sizes */
+    l_uErrN = 0u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 2  -- FAIL \n");
+    }
+
+
+    for( l_uC = 0u; l_uC < 3u; l_uC++ )
+    {
+        for( l_uL = 0u; l_uL < 3u; l_uL++ )
+        {
+            l_uEncToSendSize = 0u;
+            l_uEncMaxPaySize = 0u;
+            l_uDecPaySize = 0u;
+            l_puDecPayLoc = NULL;
+
+            if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetHeader(&l_tCtxEnc, l_auCrcL[l_uC], l_auLenL[l_uL]) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetHeader(&l_tCtxDec, l_auCrcL[l_uC], l_auLenL[l_uL]) ) ||
+                ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_GetWherePutData(&l_tCtxEnc, &l_puEncPayLoc, &l_uEncMaxPaySize) ) )
+            {
+                l_uErrN++;
+            }
+            else
+            {
+                /* Payload with every special char of the byte stuffer */
+                for( l_uI = 0u; l_uI < 16u; l_uI++ )
+                {
+                    l_puEncPayLoc[l_uI] = (uint8_t)( ECU_SOF + ( l_uI % 3u ) + l_uC + l_uL );
+                }
+
+                if( ( ( sizeof(l_auEemEncoderArea) - ( l_auCrcL[l_uC] + l_auLenL[l_uL] ) ) != l_uEncMaxPaySize ) ||
+                    ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_NewMessage(&l_tCtxEnc, 16u) ) ||
+                    ( e_eFSP_MSGE_RES_MESSAGEENDED != eFSP_MSGE_GetEncChunk(&l_tCtxEnc, l_auEncDataSend,
+                                                                            sizeof(l_auEncDataSend),
+                                                                            &l_uEncToSendSize) ) ||
+                    ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_NewMsg(&l_tCtxDec) ) ||
+                    ( e_eFSP_MSGD_RES_MESSAGEENDED != eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auEncDataSend,
+                                                                            l_uEncToSendSize, &l_uDecCounter) ) ||
+                    ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_GetDecodedData(&l_tCtxDec, &l_puDecPayLoc, &l_uDecPaySize) ) )
+                {
+                    l_uErrN++;
+                }
+                else if( ( 16u != l_uDecPaySize ) || ( l_uEncToSendSize != l_uDecCounter ) )
+                {
+                    l_uErrN++;
+                }
+                else
+                {
+                    for( l_uI = 0u; l_uI < 16u; l_uI++ )
+                    {
+                        if( l_puEncPayLoc[l_uI] != l_puDecPayLoc[l_uI] )
+                        {
+                            l_uErrN++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 3  -- FAIL \n");
+    }
+
+
+    /* A decoder with a different profile discard the message */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtxEnc, 16u) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtxEnc, l_auEncDataSend, sizeof(l_auEncDataSend), &l_uEncToSendSize) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auEncDataSend, l_uEncToSendSize, &l_uDecCounter) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Profiles 9  -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_VarLen(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[300u] = {0u};
+    uint32_t l_uEncMaxPaySize;
+    uint8_t* l_puEncPayLoc;
+    uint8_t l_auEncDataSend[700u];
+    uint32_t l_uEncToSendSize;
+
+    /* Local variable for message DECODER */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[300u] = {0u};
+    uint32_t l_uDecCounter;
+    uint8_t* l_puDecPayLoc;
+    uint32_t l_uDecPaySize;
+
+    /* Profiles and payload sizes, around the size where the length need a second byte */
+    const uint32_t l_auCrcL[] = {EFSP_HDR_CRCNONE, EFSP_HDR_CRC16, EFSP_HDR_CRC32};
+    const uint32_t l_auPayL[] = {1u, 127u, 128u, 200u};
+    uint32_t l_uC;
+    uint32_t l_uP;
+    uint32_t l_uI;
+    uint32_t l_uErrN;
+
+    /* Every size is encoded and decoded, and the frame carry only the bytes of the length that are needed */
+    l_uErrN = 0u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 2  -- FAIL \n");
+    }
+
+
+    for( l_uC = 0u; l_uC < 3u; l_uC++ )
+    {
+        for( l_uP = 0u; l_uP < 4u; l_uP++ )
+        {
+            l_uEncToSendSize = 0u;
+            l_uEncMaxPaySize = 0u;
+            l_uDecPaySize = 0u;
+            l_puDecPayLoc = NULL;
+
+            if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetHeader(&l_tCtxEnc, l_auCrcL[l_uC], EFSP_HDR_LENVAR) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetHeader(&l_tCtxDec, l_auCrcL[l_uC], EFSP_HDR_LENVAR) ) ||
+                ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_GetWherePutData(&l_tCtxEnc, &l_puEncPayLoc, &l_uEncMaxPaySize) ) )
+            {
+                l_uErrN++;
+            }
+            else
+            {
+                /* Payload with every special char of the byte stuffer */
+                for( l_uI = 0u; l_uI < l_auPayL[l_uP]; l_uI++ )
+                {
+                    l_puEncPayLoc[l_uI] = (uint8_t)( ECU_SOF + ( l_uI % 3u ) + l_uC );
+                }
+
+                if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_NewMessage(&l_tCtxEnc, l_auPayL[l_uP]) ) ||
+                    ( e_eFSP_MSGE_RES_MESSAGEENDED != eFSP_MSGE_GetEncChunk(&l_tCtxEnc, l_auEncDataSend,
+                                                                            sizeof(l_auEncDataSend),
+                                                                            &l_uEncToSendSize) ) ||
+                    ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_NewMsg(&l_tCtxDec) ) ||
+                    ( e_eFSP_MSGD_RES_MESSAGEENDED != eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auEncDataSend,
+                                                                            l_uEncToSendSize, &l_uDecCounter) ) ||
+                    ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_GetDecodedData(&l_tCtxDec, &l_puDecPayLoc, &l_uDecPaySize) ) )
+                {
+                    l_uErrN++;
+                }
+                else if( ( l_auPayL[l_uP] != l_uDecPaySize ) || ( l_uEncToSendSize != l_uDecCounter ) ||
+                         ( &l_auMemDecoderArea[l_auCrcL[l_uC] + 1u + ( l_auPayL[l_uP] / 128u )] != l_puDecPayLoc ) )
+                {
+                    l_uErrN++;
+                }
+                else
+                {
+                    for( l_uI = 0u; l_uI < l_auPayL[l_uP]; l_uI++ )
+                    {
+                        if( (uint8_t)( ECU_SOF + ( l_uI % 3u ) + l_uC ) != l_puDecPayLoc[l_uI] )
+                        {
+                            l_uErrN++;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 3  -- FAIL \n");
+    }
+
+
+    /* A decoder with a fixed length discard the message */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC16, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC16, EFSP_HDR_LEN16) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtxEnc, &l_puEncPayLoc, &l_uEncMaxPaySize) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 6  -- FAIL \n");
+    }
+
+    l_puEncPayLoc[0u] = 0x01u;
+    l_puEncPayLoc[1u] = 0x02u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtxEnc, 2u) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtxEnc, l_auEncDataSend, sizeof(l_auEncDataSend), &l_uEncToSendSize) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auEncDataSend, l_uEncToSendSize, &l_uDecCounter) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_VarLen 10 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_Framing(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX] = {0u};
+    uint32_t l_uEncMaxPaySize;
+    uint8_t* l_puEncPayLoc;
+    uint8_t l_auPayload[EFSP_MSGDMSGETST_BENCHL];
+
+    /* Local variable for message DECODER */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX] = {0u};
+
+    /* Payload distributions: only zeros, only special char of the byte stuffer, random and text */
+    const uint32_t l_auFrm[] = {EFSP_FRM_ESC, EFSP_FRM_COBS, EFSP_FRM_TRSP};
+    const char* l_apcFrmName[] = {"esc", "cobs", "trsp"};
+    const char* l_apcName[] = {"zero", "special", "random", "text"};
+    const char* l_pcText = "The quick brown fox jumps over the lazy dog. ";
+    uint32_t l_auWireL[3u][4u];
+    uint32_t l_uD;
+    uint32_t l_uF;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uErrN;
+    clock_t l_tStart;
+    clock_t l_tEnd;
+
+    /* Function */
+    l_uErrN = 0u;
+    l_uSeed = 0x2468ACE1u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtxEnc, &l_puEncPayLoc, &l_uEncMaxPaySize) )
+    {
+        if( EFSP_MSGDMSGETST_BENCHL <= l_uEncMaxPaySize )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Framing 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Framing 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 3  -- FAIL \n");
+    }
+
+
+    (void)printf("\n  Framing engine benchmark, %u byte of payload, %u messages \n", EFSP_MSGDMSGETST_BENCHL,
+                 EFSP_MSGDMSGETST_BENCHN);
+
+    for( l_uD = 0u; l_uD < 4u; l_uD++ )
+    {
+        for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_BENCHL; l_uI++ )
+        {
+            l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+            switch( l_uD )
+            {
+                case 0u:
+                {
+                    l_auPayload[l_uI] = 0x00u;
+                    break;
+                }
+
+                case 1u:
+                {
+                    l_auPayload[l_uI] = (uint8_t)( ECU_SOF + ( ( l_uSeed >> 16u ) % 3u ) );
+                    break;
+                }
+
+                case 2u:
+                {
+                    l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                    break;
+                }
+
+                default:
+                {
+                    l_auPayload[l_uI] = (uint8_t)l_pcText[l_uI % 45u];
+                    break;
+                }
+            }
+        }
+
+        for( l_uF = 0u; l_uF < 3u; l_uF++ )
+        {
+            l_auWireL[l_uF][l_uD] = 0u;
+
+            /* The same payload is encoded and decoded many times */
+            if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFraming(&l_tCtxEnc, l_auFrm[l_uF]) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFraming(&l_tCtxDec, l_auFrm[l_uF]) ) )
+            {
+                l_uErrN++;
+            }
+            else
+            {
+                l_tStart = clock();
+                for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_BENCHN; l_uI++ )
+                {
+                    if( true != eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload,
+                                                           EFSP_MSGDMSGETST_BENCHL, &l_auWireL[l_uF][l_uD]) )
+                    {
+                        l_uErrN++;
+                    }
+                }
+                l_tEnd = clock();
+
+                (void)printf("  %-4s %-8s wire %4u byte, %8.3f MB/s \n", l_apcFrmName[l_uF], l_apcName[l_uD], l_auWireL[l_uF][l_uD],
+                             ( ( (double)EFSP_MSGDMSGETST_BENCHL * (double)EFSP_MSGDMSGETST_BENCHN ) /
+                               ( ( (double)( l_tEnd - l_tStart ) / (double)CLOCKS_PER_SEC ) + 1e-9 ) ) / 1e6 );
+            }
+        }
+    }
+
+    (void)printf("\n");
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 4  -- FAIL \n");
+    }
+
+
+    /* COBS overhead is bounded, escape can double the special char */
+    l_uErrN = 0u;
+    for( l_uD = 0u; l_uD < 4u; l_uD++ )
+    {
+        l_uI = EFSP_HDR_CRC32 + EFSP_HDR_LEN32 + EFSP_MSGDMSGETST_BENCHL;
+        if( l_auWireL[1u][l_uD] > ( l_uI + 2u + ( l_uI / EFSP_COBS_MAXBLOCK ) + 1u ) )
+        {
+            l_uErrN++;
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 5  -- FAIL \n");
+    }
+
+    if( l_auWireL[0u][1u] > ( 2u * EFSP_MSGDMSGETST_BENCHL ) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 6  -- FAIL \n");
+    }
+
+    if( l_auWireL[1u][1u] < l_auWireL[0u][1u] )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 7  -- FAIL \n");
+    }
+
+
+    /* Both side must use the same engine */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 9  -- FAIL \n");
+    }
+
+    if( false == eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, 10u, &l_uI) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Framing 10 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_Transparent(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[64u] = {0u};
+
+    /* Local variable for message DECODER */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[64u] = {0u};
+
+    /* Header profiles and frames */
+    const uint32_t l_auCrcL[] = {EFSP_HDR_CRCNONE, EFSP_HDR_CRC16, EFSP_HDR_CRC32};
+    const uint32_t l_auLenL[] = {EFSP_HDR_LEN8, EFSP_HDR_LEN16, EFSP_HDR_LEN32, EFSP_HDR_LENVAR};
+    uint8_t l_auPayload[40u];
+    uint8_t l_auWire[140u];
+    uint8_t l_auWireB[20u];
+    uint8_t* l_puData;
+    uint32_t l_uWireL;
+    uint32_t l_uWireBL;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint32_t l_uC;
+    uint32_t l_uL;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uErrN;
+    bool_t l_bVar;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 4  -- FAIL \n");
+    }
+
+
+    /* Every profile, payloads full of sync and escape bytes. Only the header can be escaped */
+    l_uErrN = 0u;
+    l_uSeed = 0x13579BDFu;
+    for( l_uC = 0u; l_uC < 3u; l_uC++ )
+    {
+        for( l_uL = 0u; l_uL < 4u; l_uL++ )
+        {
+            if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetHeader(&l_tCtxEnc, l_auCrcL[l_uC], l_auLenL[l_uL]) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetHeader(&l_tCtxDec, l_auCrcL[l_uC], l_auLenL[l_uL]) ) )
+            {
+                l_uErrN++;
+            }
+
+            for( l_uVar32 = 1u; l_uVar32 <= sizeof(l_auPayload); l_uVar32++ )
+            {
+                for( l_uI = 0u; l_uI < l_uVar32; l_uI++ )
+                {
+                    l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                    if( 0u == ( ( l_uSeed >> 16u ) % 3u ) )
+                    {
+                        l_auPayload[l_uI] = EFSP_TRSP_SYNC1;
+                    }
+                    else if( 1u == ( ( l_uSeed >> 16u ) % 3u ) )
+                    {
+                        l_auPayload[l_uI] = EFSP_TRSP_SYNC2;
+                    }
+                    else
+                    {
+                        l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                    }
+                }
+
+                if( ( true != eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, l_uVar32, &l_uWireL) ) ||
+                    ( l_uWireL > ( EFSP_TRSP_SYNCL + ( 2u * ( l_auCrcL[l_uC] + EFSP_HDR_LENVARMAX ) ) + l_uVar32 ) ) )
+                {
+                    l_uErrN++;
+                }
+            }
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 5  -- FAIL \n");
+    }
+
+
+    /* A frame hidden in the payload of a corrupted one is received */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 7  -- FAIL \n");
+    }
+
+    l_auPayload[0u] = 0x61u;
+    l_auPayload[1u] = 0x62u;
+    l_auPayload[2u] = 0x63u;
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 3u, l_auWireB, sizeof(l_auWireB), &l_uWireBL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 8  -- FAIL \n");
+    }
+
+    l_auPayload[0u] = 0x10u;
+    l_auPayload[1u] = 0x20u;
+    (void)memcpy(&l_auPayload[2u], l_auWireB, l_uWireBL);
+    l_auPayload[l_uWireBL + 2u] = 0x30u;
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, l_uWireBL + 3u, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 9  -- FAIL \n");
+    }
+
+    l_auWire[l_uWireL - 1u] = 0x31u;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL, &l_uConsumed) )
+    {
+        if( l_uWireL == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtxDec, &l_puData, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( 0x61u == l_puData[0u] ) && ( 0x63u == l_puData[2u] ) )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 12 -- FAIL \n");
+    }
+
+
+    /* A wrong length swallow the sync of the next frame, the decoder find it again */
+    for( l_uI = 0u; l_uI < 10u; l_uI++ )
+    {
+        l_auPayload[l_uI] = (uint8_t)( 0x40u + l_uI );
+    }
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 10u, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 13 -- FAIL \n");
+    }
+
+    l_auWire[l_uWireL - 11u] = 14u;
+    l_auPayload[0u] = 0x71u;
+    l_auPayload[1u] = 0x72u;
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 2u, &l_auWire[l_uWireL], sizeof(l_auWire) - l_uWireL, &l_uWireBL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_FRAMERESTART == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL + l_uWireBL, &l_uConsumed) )
+    {
+        if( ( l_uWireL + 4u ) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtxDec, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtxDec, &l_auWire[l_uConsumed], l_uWireBL - 4u, &l_uVar32) )
+    {
+        if( ( l_uWireBL - 4u ) == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtxDec, &l_puData, &l_uVar32) )
+    {
+        if( ( 2u == l_uVar32 ) && ( 0x71u == l_puData[0u] ) && ( 0x72u == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 19 -- FAIL \n");
+    }
+
+
+    /* A length bigger than the memory area is a bad frame too */
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 2u, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 20 -- FAIL \n");
+    }
+
+    l_auWire[l_uWireL - 3u] = 0x70u;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_FRAMERESTART == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL, &l_uConsumed) )
+    {
+        if( ( l_uWireL - 2u ) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsWaitingSof(&l_tCtxDec, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 23 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Transparent 23 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Transparent 23 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_Whitening(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX + EFSP_HDR_WHT] = {0u};
+
+    /* Local variable for message DECODER */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX + EFSP_HDR_WHT] = {0u};
+
+    /* Payload distributions: only zeros, only special char of the byte stuffer, random and text */
+    const uint32_t l_auFrm[] = {EFSP_FRM_ESC, EFSP_FRM_COBS, EFSP_FRM_TRSP};
+    const char* l_pcText = "The quick brown fox jumps over the lazy dog. ";
+    uint8_t l_auPayload[EFSP_MSGDMSGETST_BENCHL];
+    uint8_t l_auWire[40u];
+    uint8_t l_auWireB[20u];
+    uint32_t l_auWireL[2u];
+    uint32_t l_uWireL;
+    uint32_t l_uWireBL;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint32_t l_uD;
+    uint32_t l_uF;
+    uint32_t l_uW;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uErrN;
+    uint8_t* l_puData;
+
+    /* Function */
+    l_uErrN = 0u;
+    l_uSeed = 0x2468ACE1u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 2  -- FAIL \n");
+    }
+
+
+    /* Every engine and distribution is received, with and without whitening */
+    for( l_uD = 0u; l_uD < 4u; l_uD++ )
+    {
+        for( l_uF = 0u; l_uF < 3u; l_uF++ )
+        {
+            for( l_uW = 0u; l_uW < 2u; l_uW++ )
+            {
+                for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_BENCHL; l_uI++ )
+                {
+                    l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                    if( 0u == l_uD )
+                    {
+                        l_auPayload[l_uI] = 0x00u;
+                    }
+                    else if( 1u == l_uD )
+                    {
+                        l_auPayload[l_uI] = (uint8_t)( ECU_SOF + ( ( l_uSeed >> 16u ) % 3u ) );
+                    }
+                    else if( 2u == l_uD )
+                    {
+                        l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                    }
+                    else
+                    {
+                        l_auPayload[l_uI] = (uint8_t)l_pcText[l_uI % 45u];
+                    }
+                }
+
+                if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFraming(&l_tCtxEnc, l_auFrm[l_uF]) ) ||
+                    ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFraming(&l_tCtxDec, l_auFrm[l_uF]) ) ||
+                    ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetWhitening(&l_tCtxEnc, l_uW) ) ||
+                    ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetWhitening(&l_tCtxDec, l_uW) ) ||
+                    ( true != eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload,
+                                                         EFSP_MSGDMSGETST_BENCHL, &l_auWireL[l_uW]) ) )
+                {
+                    l_uErrN++;
+                }
+            }
+
+            /* The special char are not escaped anymore, only the mask and the CRC can grow the frame */
+            if( ( l_auWireL[1u] > ( l_auWireL[0u] + 1u + EFSP_HDR_CRC32 ) ) ||
+                ( ( EFSP_FRM_ESC == l_auFrm[l_uF] ) && ( 1u == l_uD ) &&
+                  ( l_auWireL[1u] > ( EFSP_MSGDMSGETST_BENCHL + 2u + ( 2u * ( EFSP_HDR_CRC32 + EFSP_HDR_LEN32 + 1u ) ) ) ) ) )
+            {
+                l_uErrN++;
+            }
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 3  -- FAIL \n");
+    }
+
+
+    /* A corrupted mask make the CRC fail */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetWhitening(&l_tCtxEnc, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetWhitening(&l_tCtxDec, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 9  -- FAIL \n");
+    }
+
+    l_auPayload[0u] = ECU_SOF;
+    l_auPayload[1u] = ECU_SOF;
+    l_auPayload[2u] = 0x10u;
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 3u, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 10 -- FAIL \n");
+    }
+
+    if( 0xFFu == l_auWire[l_uWireL - 5u] )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 11 -- FAIL \n");
+    }
+
+    l_auWire[l_uWireL - 5u] = 0xF0u;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL, &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 13 -- FAIL \n");
+    }
+
+
+    /* With the transparent engine the data of a bad frame is scanned as it was received */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 15 -- FAIL \n");
+    }
+
+    l_auPayload[0u] = 0x61u;
+    l_auPayload[1u] = 0x62u;
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 2u, l_auWireB, sizeof(l_auWireB), &l_uWireBL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 16 -- FAIL \n");
+    }
+
+    l_auPayload[0u] = 0x10u;
+    (void)memcpy(&l_auPayload[1u], l_auWireB, l_uWireBL);
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, l_uWireBL + 1u, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 17 -- FAIL \n");
+    }
+
+    if( 0x00u == l_auWire[l_uWireL - l_uWireBL - 2u] )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 18 -- FAIL \n");
+    }
+
+    l_auWire[l_uWireL - l_uWireBL - 2u] = 0x01u;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL, &l_uConsumed) )
+    {
+        if( l_uWireL == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Whitening 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Whitening 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtxDec, &l_puData, &l_uVar32) )
+    {
+        if( ( 2u == l_uVar32 ) && ( 0x61u == l_puData[0u] ) && ( 0x62u == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Whitening 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Whitening 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Whitening 21 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_Compression(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX + EFSP_HDR_WHT +
+                                EFSP_HDR_CMP] = {0u};
+
+    /* Local variable for message DECODER, with some more bytes to decompress the payload in place */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX + EFSP_HDR_WHT +
+                                EFSP_HDR_CMP + 16u] = {0u};
+
+    /* Payload distributions: only zeros, only special char of the byte stuffer, random and text */
+    const uint32_t l_auFrm[] = {EFSP_FRM_ESC, EFSP_FRM_COBS, EFSP_FRM_TRSP};
+    const char* l_pcText = "The quick brown fox jumps over the lazy dog. ";
+    uint8_t l_auPayload[EFSP_MSGDMSGETST_BENCHL];
+    uint8_t l_auWire[40u];
+    uint32_t l_auWireL[2u];
+    uint32_t l_uWireL;
+    uint32_t l_uConsumed;
+    uint32_t l_uD;
+    uint32_t l_uF;
+    uint32_t l_uW;
+    uint32_t l_uC;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uErrN;
+
+    /* Function */
+    l_uErrN = 0u;
+    l_uSeed = 0x1F2E3D4Cu;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC32, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 4  -- FAIL \n");
+    }
+
+
+    /* Every engine and distribution is received, with and without compression and whitening */
+    for( l_uD = 0u; l_uD < 4u; l_uD++ )
+    {
+        for( l_uF = 0u; l_uF < 3u; l_uF++ )
+        {
+            for( l_uW = 0u; l_uW < 2u; l_uW++ )
+            {
+                for( l_uC = 0u; l_uC < 2u; l_uC++ )
+                {
+                    for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_BENCHL; l_uI++ )
+                    {
+                        l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                        if( 0u == l_uD )
+                        {
+                            l_auPayload[l_uI] = 0x00u;
+                        }
+                        else if( 1u == l_uD )
+                        {
+                            l_auPayload[l_uI] = (uint8_t)( ECU_SOF + ( ( l_uSeed >> 16u ) % 3u ) );
+                        }
+                        else if( 2u == l_uD )
+                        {
+                            l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                        }
+                        else
+                        {
+                            l_auPayload[l_uI] = (uint8_t)l_pcText[l_uI % 45u];
+                        }
+                    }
+
+                    if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFraming(&l_tCtxEnc, l_auFrm[l_uF]) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFraming(&l_tCtxDec, l_auFrm[l_uF]) ) ||
+                        ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetWhitening(&l_tCtxEnc, l_uW) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetWhitening(&l_tCtxDec, l_uW) ) ||
+                        ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetCompression(&l_tCtxEnc, l_uC) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetCompression(&l_tCtxDec, l_uC) ) ||
+                        ( true != eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload,
+                                                             EFSP_MSGDMSGETST_BENCHL, &l_auWireL[l_uC]) ) )
+                    {
+                        l_uErrN++;
+                    }
+                }
+
+                /* Only the flag is added to a payload that does not compress, zeros and text get far shorter */
+                if( ( l_auWireL[1u] > ( l_auWireL[0u] + 1u ) ) ||
+                    ( ( ( 0u == l_uD ) || ( 3u == l_uD ) ) && ( ( 2u * l_auWireL[1u] ) > l_auWireL[0u] ) ) )
+                {
+                    l_uErrN++;
+                }
+            }
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 5  -- FAIL \n");
+    }
+
+
+    /* The CRC is calculated on the compressed payload */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetWhitening(&l_tCtxEnc, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetWhitening(&l_tCtxDec, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetCompression(&l_tCtxEnc, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetCompression(&l_tCtxDec, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 13 -- FAIL \n");
+    }
+
+    (void)memset(l_auPayload, 0x41, 20u);
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, 20u, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 14 -- FAIL \n");
+    }
+
+    if( 0x8Fu == l_auWire[l_uWireL - 3u] )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 15 -- FAIL \n");
+    }
+
+    l_auWire[l_uWireL - 3u] = 0x90u;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL, &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Compression 17 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_Delta(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[EFSP_MSGDMSGETST_STATUSL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX + EFSP_HDR_WHT +
+                                EFSP_HDR_CMP + EFSP_HDR_DLT] = {0u};
+    uint8_t  l_auBaseEnc[EFSP_MSGDMSGETST_STATUSL];
+
+    /* Local variable for message DECODER, with some more bytes to decompress the payload in place */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[EFSP_MSGDMSGETST_STATUSL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX + EFSP_HDR_WHT +
+                                EFSP_HDR_CMP + EFSP_HDR_DLT + 16u] = {0u};
+    uint8_t  l_auBaseDec[EFSP_MSGDMSGETST_STATUSL];
+
+    /* A status message where only a counter and a measure change, but once */
+    const uint32_t l_auFrm[] = {EFSP_FRM_ESC, EFSP_FRM_COBS, EFSP_FRM_TRSP};
+    uint8_t l_auPayload[EFSP_MSGDMSGETST_STATUSL];
+    uint8_t l_auWire[100u];
+    uint32_t l_auWireL[2u];
+    uint32_t l_uWireL;
+    uint32_t l_uConsumed;
+    uint32_t l_uF;
+    uint32_t l_uW;
+    uint32_t l_uC;
+    uint32_t l_uL;
+    uint32_t l_uN;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uErrN;
+
+    /* Function */
+    l_uErrN = 0u;
+    l_uSeed = 0x5A6B7C8Du;
+
+    /* Every engine receive the same messages, with and without delta frames */
+    for( l_uF = 0u; l_uF < 3u; l_uF++ )
+    {
+        for( l_uW = 0u; l_uW < 2u; l_uW++ )
+        {
+            for( l_uC = 0u; l_uC < 2u; l_uC++ )
+            {
+                for( l_uL = 0u; l_uL < 2u; l_uL++ )
+                {
+                    l_auWireL[l_uL] = 0u;
+
+                    if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea,
+                                                                  sizeof(l_auEemEncoderArea), l_fCrcEnc,
+                                                                  &l_tCtxCrcEnc) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea,
+                                                                  sizeof(l_auMemDecoderArea), l_fCrcPDec,
+                                                                  &l_tCtxCrcDec) ) ||
+                        ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC32, EFSP_HDR_LENVAR) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LENVAR) ) ||
+                        ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFraming(&l_tCtxEnc, l_auFrm[l_uF]) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFraming(&l_tCtxDec, l_auFrm[l_uF]) ) ||
+                        ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetWhitening(&l_tCtxEnc, l_uW) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetWhitening(&l_tCtxDec, l_uW) ) ||
+                        ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetCompression(&l_tCtxEnc, l_uC) ) ||
+                        ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetCompression(&l_tCtxDec, l_uC) ) )
+                    {
+                        l_uErrN++;
+                    }
+                    else if( ( 1u == l_uL ) &&
+                             ( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetDelta(&l_tCtxEnc, l_auBaseEnc, sizeof(l_auBaseEnc),
+                                                                          8u) ) ||
+                               ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetDelta(&l_tCtxDec, l_auBaseDec,
+                                                                          sizeof(l_auBaseDec)) ) ) )
+                    {
+                        l_uErrN++;
+                    }
+                    else
+                    {
+                        for( l_uN = 0u; l_uN < 20u; l_uN++ )
+                        {
+                            for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_STATUSL; l_uI++ )
+                            {
+                                l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+
+                                if( 13u == l_uN )
+                                {
+                                    l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                                }
+                                else
+                                {
+                                    l_auPayload[l_uI] = (uint8_t)( l_uI * 7u );
+                                }
+                            }
+
+                            l_auPayload[0u] = (uint8_t)l_uN;
+                            l_auPayload[33u] = (uint8_t)( l_uN * 3u );
+
+                            if( true != eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload,
+                                                                   EFSP_MSGDMSGETST_STATUSL, &l_uWireL) )
+                            {
+                                l_uErrN++;
+                            }
+
+                            l_auWireL[l_uL] += l_uWireL;
+                        }
+                    }
+                }
+
+                /* The differences are far shorter than the whole messages */
+                if( ( 2u * l_auWireL[1u] ) > l_auWireL[0u] )
+                {
+                    l_uErrN++;
+                }
+            }
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 1  -- FAIL \n");
+    }
+
+
+    /* A lost key frame make the decoder refuse the differences till the next key frame */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxEnc, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtxDec, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetWhitening(&l_tCtxEnc, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetWhitening(&l_tCtxDec, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetCompression(&l_tCtxEnc, EFSP_HDR_CMPNONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetCompression(&l_tCtxDec, EFSP_HDR_CMPNONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_ResetDelta(&l_tCtxEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 10 -- FAIL \n");
+    }
+
+    if( true == eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, EFSP_MSGDMSGETST_STATUSL, &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_ResetDelta(&l_tCtxEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 12 -- FAIL \n");
+    }
+
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, EFSP_MSGDMSGETST_STATUSL, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        if( 0u == l_tCtxEnc.uDltN )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Delta 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Delta 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 13 -- FAIL \n");
+    }
+
+    l_auPayload[0u]++;
+    if( true == eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, EFSP_MSGDMSGETST_STATUSL, l_auWire, sizeof(l_auWire), &l_uWireL) )
+    {
+        if( 1u == l_tCtxEnc.uDltN )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Delta 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Delta 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtxDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtxDec, l_auWire, l_uWireL, &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_ResetDelta(&l_tCtxEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 17 -- FAIL \n");
+    }
+
+    if( true == eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, EFSP_MSGDMSGETST_STATUSL, &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 18 -- FAIL \n");
+    }
+
+    l_auPayload[0u]++;
+    l_auPayload[33u]++;
+    if( true == eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, EFSP_MSGDMSGETST_STATUSL, &l_uWireL) )
+    {
+        if( 20u > l_uWireL )
+        {
+            (void)printf("eFSP_MSGDMSGETST_Delta 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDMSGETST_Delta 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Delta 19 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDMSGETST_Fec(void)
+{
+    /* Local variable for message ENCODER */
+    t_eFSP_MSGE_Ctx l_tCtxEnc;
+    t_eFSP_MSGE_CrcCtx  l_tCtxCrcEnc;
+    f_eFSP_MSGE_CrcCb l_fCrcEnc = &eFSP_MSGDMSGETST_c32SAdaptE;
+    uint8_t  l_auEemEncoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX] = {0u};
+
+    /* Local variable for message DECODER */
+    t_eFSP_MSGD_Ctx l_tCtxDec;
+    t_eFSP_MSGD_CrcCtx  l_tCtxCrcDec;
+    f_eFSP_MSGD_CrcCb l_fCrcPDec = &eFSP_MSGDMSGETST_c32SAdapt;
+    uint8_t  l_auMemDecoderArea[EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX] = {0u};
+
+    /* Every engine and correction, bit error rate of the simulated channel */
+    const uint32_t l_auFrm[] = {EFSP_FRM_ESC, EFSP_FRM_COBS, EFSP_FRM_TRSP};
+    const uint32_t l_auFec[] = {EFSP_FEC_NONE, EFSP_FEC_RS4, EFSP_FEC_RS8, EFSP_FEC_RS16};
+    const char* l_apcFecName[] = {"none", "rs4", "rs8", "rs16"};
+    const double l_adBer[] = {0.0, 1e-5, 1e-4, 5e-4, 1e-3, 3e-3};
+    double l_adGood[6u][4u];
+    uint8_t l_auPayload[EFSP_MSGDMSGETST_FECL];
+    uint8_t l_auWire[( 2u * ( EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX ) ) + 2u];
+    uint8_t l_auSent[( 2u * ( EFSP_MSGDMSGETST_BENCHL + EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX ) ) + 2u];
+    uint32_t l_uWireL;
+    uint32_t l_uThr;
+    uint32_t l_uCostL;
+    uint32_t l_uGoodL;
+    uint32_t l_uWrongN;
+    uint32_t l_uTryN;
+    uint32_t l_uB;
+    uint32_t l_uF;
+    uint32_t l_uR;
+    uint32_t l_uN;
+    uint32_t l_uI;
+    uint32_t l_uSeed;
+    uint32_t l_uErrN;
+    bool_t l_bDone;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxEnc, l_auEemEncoderArea, sizeof(l_auEemEncoderArea), l_fCrcEnc, &l_tCtxCrcEnc) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtxDec, l_auMemDecoderArea, sizeof(l_auMemDecoderArea), l_fCrcPDec, &l_tCtxCrcDec) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 2  -- FAIL \n");
+    }
+
+
+    /* Every engine correct up to half of the parity bytes of a codeword, when the framing bytes are left untouched */
+    l_uErrN = 0u;
+    l_uSeed = 0x0F1E2D3Cu;
+    for( l_uF = 0u; l_uF < 3u; l_uF++ )
+    {
+        for( l_uR = 1u; l_uR < 4u; l_uR++ )
+        {
+            if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFraming(&l_tCtxEnc, l_auFrm[l_uF]) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFraming(&l_tCtxDec, l_auFrm[l_uF]) ) ||
+                ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFec(&l_tCtxEnc, l_auFec[l_uR]) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFec(&l_tCtxDec, l_auFec[l_uR]) ) )
+            {
+                l_uErrN++;
+            }
+
+            for( l_uN = 0u; l_uN < 20u; l_uN++ )
+            {
+                for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_FECL; l_uI++ )
+                {
+                    l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                    l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                }
+
+                if( true != eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, EFSP_MSGDMSGETST_FECL, l_auWire,
+                                                    sizeof(l_auWire), &l_uWireL) )
+                {
+                    l_uErrN++;
+                }
+                else
+                {
+                    eFSP_MSGDMSGETST_Corrupt(l_auFrm[l_uF], l_auWire, l_uWireL, l_auFec[l_uR] / 2u, &l_uSeed);
+                    if( true != eFSP_MSGDMSGETST_Decode(&l_tCtxDec, l_auWire, l_uWireL, l_auPayload,
+                                                        EFSP_MSGDMSGETST_FECL) )
+                    {
+                        l_uErrN++;
+                    }
+                }
+            }
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 3  -- FAIL \n");
+    }
+
+
+    /* The same errors are not corrected without parity */
+    l_uErrN = 0u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFec(&l_tCtxEnc, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFec(&l_tCtxDec, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 5  -- FAIL \n");
+    }
+
+    for( l_uN = 0u; l_uN < 20u; l_uN++ )
+    {
+        if( true != eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, EFSP_MSGDMSGETST_FECL, l_auWire, sizeof(l_auWire),
+                                            &l_uWireL) )
+        {
+            l_uErrN++;
+        }
+        else
+        {
+            eFSP_MSGDMSGETST_Corrupt(EFSP_FRM_TRSP, l_auWire, l_uWireL, 1u, &l_uSeed);
+            if( false != eFSP_MSGDMSGETST_Decode(&l_tCtxDec, l_auWire, l_uWireL, l_auPayload, EFSP_MSGDMSGETST_FECL) )
+            {
+                l_uErrN++;
+            }
+        }
+    }
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 6  -- FAIL \n");
+    }
+
+
+    /* Both side must use the same correction */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFec(&l_tCtxEnc, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 7  -- FAIL \n");
+    }
+
+    if( false == eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, 10u, &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFec(&l_tCtxDec, EFSP_FEC_RS8) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 9  -- FAIL \n");
+    }
+
+    if( true == eFSP_MSGDMSGETST_RoundTrip(&l_tCtxEnc, &l_tCtxDec, l_auPayload, 10u, &l_uWireL) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 10 -- FAIL \n");
+    }
+
+
+
+    /* Goodput on a channel that flip every bit with the same probability. A frame that is not received is sent again
+     * after a timeout, that cost as the transmission of EFSP_MSGDMSGETST_FECTOUT bytes */
+    l_uErrN = 0u;
+    l_uWrongN = 0u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtxEnc, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtxDec, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 12 -- FAIL \n");
+    }
+
+
+    (void)printf("\n  Forward error correction benchmark, %u byte of payload, %u messages, esc framing \n",
+                 EFSP_MSGDMSGETST_FECL, EFSP_MSGDMSGETST_FECN);
+    (void)printf("  %-8s %8s %8s %8s %8s \n", "ber", l_apcFecName[0u], l_apcFecName[1u], l_apcFecName[2u],
+                 l_apcFecName[3u]);
+    for( l_uB = 0u; l_uB < 6u; l_uB++ )
+    {
+        l_uThr = (uint32_t)( l_adBer[l_uB] * 4294967295.0 );
+
+        for( l_uR = 0u; l_uR < 4u; l_uR++ )
+        {
+            l_uCostL = 0u;
+            l_uGoodL = 0u;
+            l_uSeed = 0x2468ACE1u;
+
+            if( ( e_eFSP_MSGE_RES_OK != eFSP_MSGE_SetFec(&l_tCtxEnc, l_auFec[l_uR]) ) ||
+                ( e_eFSP_MSGD_RES_OK != eFSP_MSGD_SetFec(&l_tCtxDec, l_auFec[l_uR]) ) )
+            {
+                l_uErrN++;
+            }
+
+            for( l_uN = 0u; l_uN < EFSP_MSGDMSGETST_FECN; l_uN++ )
+            {
+                for( l_uI = 0u; l_uI < EFSP_MSGDMSGETST_FECL; l_uI++ )
+                {
+                    l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                    l_auPayload[l_uI] = (uint8_t)( l_uSeed >> 16u );
+                }
+
+                if( true != eFSP_MSGDMSGETST_Encode(&l_tCtxEnc, l_auPayload, EFSP_MSGDMSGETST_FECL, l_auSent,
+                                                    sizeof(l_auSent), &l_uWireL) )
+                {
+                    l_uErrN++;
+                }
+                else
+                {
+                    l_bDone = false;
+                    l_uTryN = 0u;
+
+                    while( ( false == l_bDone ) && ( l_uTryN < EFSP_MSGDMSGETST_FECTRY ) )
+                    {
+                        (void)memcpy(l_auWire, l_auSent, l_uWireL);
+                        for( l_uI = 0u; l_uI < ( 8u * l_uWireL ); l_uI++ )
+                        {
+                            l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+                            if( l_uSeed < l_uThr )
+                            {
+                                l_auWire[l_uI / 8u] ^= (uint8_t)( 1u << ( l_uI % 8u ) );
+                            }
+                        }
+
+                        l_uCostL += l_uWireL;
+                        l_uTryN++;
+
+                        if( true == eFSP_MSGDMSGETST_Decode(&l_tCtxDec, l_auWire, l_uWireL, l_auPayload,
+                                                            EFSP_MSGDMSGETST_FECL) )
+                        {
+                            l_bDone = true;
+                            l_uGoodL += EFSP_MSGDMSGETST_FECL;
+                        }
+                        else
+                        {
+                            l_uCostL += EFSP_MSGDMSGETST_FECTOUT;
+
+                            /* A frame received with a wrong payload is worse than a lost one */
+                            if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtxDec, &l_bDone) )
+                            {
+                                if( true == l_bDone )
+                                {
+                                    l_uWrongN++;
+                                }
+                            }
+                            l_bDone = false;
+                        }
+                    }
+                }
+            }
+
+            l_adGood[l_uB][l_uR] = (double)l_uGoodL / (double)l_uCostL;
+        }
+
+        (void)printf("  %-8.0e %8.3f %8.3f %8.3f %8.3f \n", l_adBer[l_uB], l_adGood[l_uB][0u], l_adGood[l_uB][1u],
+                     l_adGood[l_uB][2u], l_adGood[l_uB][3u]);
+    }
+
+    (void)printf("\n");
+    if( ( 0u == l_uErrN ) && ( 0u == l_uWrongN ) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 13 -- FAIL \n");
+    }
+
+
+    /* The parity cost some bandwidth on a clean channel, and save a lot of retransmission on a noisy one */
+    if( ( l_adGood[0u][0u] > l_adGood[0u][1u] ) && ( l_adGood[0u][1u] > l_adGood[0u][2u] ) && ( l_adGood[0u][2u] > l_adGood[0u][3u] ) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 14 -- FAIL \n");
+    }
+
+    if( ( l_adGood[5u][2u] > l_adGood[5u][0u] ) && ( l_adGood[5u][1u] > l_adGood[5u][0u] ) )
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDMSGETST_Fec 15 -- FAIL \n");
+    }
+}
@@ -55,6 +55,15 @@ static void eFSP_MSGDTST_ErrorAndContinueEx(void);
 static void eFSP_MSGDTST_ErrorShortFrame(void);
 static void eFSP_MSGDTST_ErrorBadStuff(void);
 static void eFSP_MSGDTST_Corner(void);
+static void eFSP_MSGDTST_DeclaredLen(void);
+static void eFSP_MSGDTST_HeaderProfile(void);
+static void eFSP_MSGDTST_VarLen(void);
+static void eFSP_MSGDTST_Framing(void);
+static void eFSP_MSGDTST_Transparent(void);
+static void eFSP_MSGDTST_Whitening(void);
+static void eFSP_MSGDTST_Compression(void);
+static void eFSP_MSGDTST_Delta(void);
+static void eFSP_MSGDTST_Fec(void);
 
 
 
@@ -82,6 +91,15 @@ void eFSP_MSGDTST_ExeTest(void)
     eFSP_MSGDTST_ErrorShortFrame();
     eFSP_MSGDTST_ErrorBadStuff();
     eFSP_MSGDTST_Corner();
+    eFSP_MSGDTST_DeclaredLen();
+    eFSP_MSGDTST_HeaderProfile();
+    eFSP_MSGDTST_VarLen();
+    eFSP_MSGDTST_Framing();
+    eFSP_MSGDTST_Transparent();
+    eFSP_MSGDTST_Whitening();
+    eFSP_MSGDTST_Compression();
+    eFSP_MSGDTST_Delta();
+    eFSP_MSGDTST_Fec();
 
     (void)printf("\n\nMESSAGE DECODER TEST END \n\n");
 }
@@ -4357,3 +4375,3272 @@ void eFSP_MSGDTST_Corner(void)
         (void)printf("eFSP_MSGDTST_Corner 4  -- FAIL \n");
     }
 }
+
+void eFSP_MSGDTST_DeclaredLen(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uConsumed;
+    uint32_t l_uDeclaredL;
+    bool_t l_bIsKnown;
+
+    /* Function */
+    (void)eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc);
+    (void)eFSP_MSGD_NewMsg(&l_tCtx);
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_GetDeclaredLen(NULL, &l_bIsKnown, &l_uDeclaredL) )
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_GetDeclaredLen(&l_tCtx, NULL, &l_uDeclaredL) )
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bIsKnown, NULL) )
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bIsKnown, &l_uDeclaredL) )
+    {
+        if( ( false == l_bIsKnown ) && ( 0u == l_uDeclaredL ) )
+        {
+            (void)printf("eFSP_MSGDTST_DeclaredLen 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_DeclaredLen 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 4  -- FAIL \n");
+    }
+
+
+    /* Function, header not complete */
+    (void)eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, 6u, &l_uConsumed);
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bIsKnown, &l_uDeclaredL) )
+    {
+        if( ( false == l_bIsKnown ) && ( 0u == l_uDeclaredL ) )
+        {
+            (void)printf("eFSP_MSGDTST_DeclaredLen 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_DeclaredLen 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 5  -- FAIL \n");
+    }
+
+
+    /* Function, header received */
+    (void)eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrame[6u], 3u, &l_uConsumed);
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bIsKnown, &l_uDeclaredL) )
+    {
+        if( ( true == l_bIsKnown ) && ( 2u == l_uDeclaredL ) )
+        {
+            (void)printf("eFSP_MSGDTST_DeclaredLen 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_DeclaredLen 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 6  -- FAIL \n");
+    }
+
+
+    /* Function, corrupted context */
+    l_tCtx.fCrc = NULL;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bIsKnown, &l_uDeclaredL) )
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_DeclaredLen 7  -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_HeaderProfile(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrameC16[] = {ECU_SOF, 0x44u, 0x7Bu, 0x03u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+    uint8_t l_auFrameBadC16[] = {ECU_SOF, 0x44u, 0x7Cu, 0x03u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+    uint8_t l_auFrameNoC[] = {ECU_SOF, 0x03u, 0x00u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+    uint8_t l_auFrameNoCLong[] = {ECU_SOF, 0x02u, 0x00u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+
+    /* Function */
+    l_tCtx.tBUNSTFCtx.bIsInit = false;
+    l_tCtx.ptCrcCtx = &l_tCtxAdapterCrc;
+    l_tCtx.fCrc = l_fCrcPTest;
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_SetHeader(NULL, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_NOINITLIB == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetHeader(&l_tCtx, 0x03u, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRC16, 0x08u) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 5  -- FAIL \n");
+    }
+
+
+    /* CRC16 and 8 bit len */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 4u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameC16, 3u, &l_uConsumed) )
+    {
+        if( 3u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 1u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrameC16[3u], 2u, &l_uConsumed) )
+    {
+        if( 2u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( ( true == l_bVar ) && ( 3u == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrameC16[5u], 3u, &l_uConsumed) )
+    {
+        if( 3u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( &l_auMemArea[3u] == l_puPayLoadLoc ) && ( 0x01u == l_puPayLoadLoc[0u] ) && ( 0x03u == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 18 -- FAIL \n");
+    }
+
+
+    /* Only the lower 16 bit of the CRC are checked */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameBadC16, sizeof(l_auFrameBadC16), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 21 -- FAIL \n");
+    }
+
+
+    /* No CRC and 16 bit len */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN16) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 24 -- FAIL \n");
+    }
+
+    l_tCtxAdapterCrc.eLastEr = e_eCU_CRC_RES_BADPOINTER;
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameNoC, sizeof(l_auFrameNoC), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameNoC) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( ( true == l_bVar ) && ( e_eCU_CRC_RES_BADPOINTER == l_tCtxAdapterCrc.eLastEr ) )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 26 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 26 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( &l_auMemArea[2u] == l_puPayLoadLoc ) )
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 27 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_HeaderProfile 27 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 27 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 28 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameNoCLong, sizeof(l_auFrameNoCLong), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 29 -- FAIL \n");
+    }
+
+
+    /* Corrupted header profile */
+    l_tCtx.uCrcL = 0x01u;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 30 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 31 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 31 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 32 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 32 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 33 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 33 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 34 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 34 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 35 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_HeaderProfile 35 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_VarLen(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[200u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint32_t l_uI;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrame[] = {ECU_SOF, 0x03u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+    uint8_t l_auFrameC16[] = {ECU_SOF, 0x44u, 0x7Bu, 0x03u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+    uint8_t l_auFrameLong[134u];
+    uint8_t l_auFrameShort[] = {ECU_SOF, 0x04u, 0x01u, 0x02u, 0x03u, ECU_EOF};
+    uint8_t l_auFrameMalf[] = {ECU_SOF, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x10u, 0x01u, ECU_EOF};
+
+    /* Function */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 2  -- FAIL \n");
+    }
+
+
+    /* One byte of length */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 2u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrame) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( &l_auMemArea[1u] == l_puPayLoadLoc ) && ( 0x01u == l_puPayLoadLoc[0u] ) && ( 0x03u == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 7  -- FAIL \n");
+    }
+
+
+    /* Two bytes of length, received one byte at a time */
+    l_auFrameLong[0u] = ECU_SOF;
+    l_auFrameLong[1u] = 0x82u;
+    l_auFrameLong[2u] = 0x01u;
+    for( l_uI = 0u; l_uI < 130u; l_uI++ )
+    {
+        l_auFrameLong[3u + l_uI] = (uint8_t)( l_uI & 0x7Fu );
+    }
+    l_auFrameLong[133u] = ECU_EOF;
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameLong, 2u, &l_uConsumed) )
+    {
+        if( 2u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 1u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrameLong[2u], 1u, &l_uConsumed) )
+    {
+        if( 1u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( ( true == l_bVar ) && ( 130u == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 131u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrameLong[3u], 131u, &l_uConsumed) )
+    {
+        if( 131u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 130u == l_uVar32 ) && ( &l_auMemArea[2u] == l_puPayLoadLoc ) && ( 0x7Fu == l_puPayLoadLoc[127u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 16 -- FAIL \n");
+    }
+
+
+    /* Length not coherent with the payload and malformed length */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameShort, sizeof(l_auFrameShort), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameMalf, 6u, &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 0u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 21 -- FAIL \n");
+    }
+
+
+    /* CRC16, the length follow the CRC */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 4u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameC16, sizeof(l_auFrameC16), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameC16) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( &l_auMemArea[3u] == l_puPayLoadLoc ) )
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 26 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_VarLen 26 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_VarLen 26 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_Framing(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrame[] = {0x55u, 0x00u, 0x03u, 0x03u, 0x01u, 0x02u, 0x02u, 0x00u};
+    uint8_t l_auFrameEmpty[] = {0x00u, 0x01u, 0x00u};
+    uint8_t l_auFrameEsc[] = {ECU_SOF, 0x03u};
+
+    /* Function */
+    l_tCtx.tBUNSTFCtx.bIsInit = false;
+    l_tCtx.ptCrcCtx = &l_tCtxAdapterCrc;
+    l_tCtx.fCrc = l_fCrcPTest;
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_SetFraming(NULL, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_NOINITLIB == eFSP_MSGD_SetFraming(&l_tCtx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 3  -- FAIL \n");
+    }
+
+    if( EFSP_FRM_ESC == l_tCtx.uFrm )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetFraming(&l_tCtx, 0x03u) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 5  -- FAIL \n");
+    }
+
+
+    /* The message in progress is discarded when the engine change */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameEsc, sizeof(l_auFrameEsc), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameEsc) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsWaitingSof(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsWaitingSof(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 11 -- FAIL \n");
+    }
+
+
+    /* Zero delimited frame, the byte before the delimiter are discarded */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, 4u, &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsWaitingSof(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 4u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrame[4u], 4u, &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( 0x01u == l_puPayLoadLoc[0u] ) && ( 0x00u == l_puPayLoadLoc[1u] ) && ( 0x02u == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 17 -- FAIL \n");
+    }
+
+
+    /* Empty frame */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameEmpty, sizeof(l_auFrameEmpty), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Framing 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Framing 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 20 -- FAIL \n");
+    }
+
+
+    /* Corrupted engine */
+    l_tCtx.uFrm = 0x03u;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Framing 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Framing 22 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_Transparent(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrame[] = {0x55u, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x03u, EFSP_TRSP_SYNC1, 0x11u, EFSP_TRSP_ESC, 0x77u};
+    uint8_t l_auFrameLong[] = {EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x30u, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x01u, 0x99u};
+    uint8_t l_auFrameHdr[] = {EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x03u, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x01u, 0x00u,
+                              0xAAu};
+
+    /* Function */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtx, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 3  -- FAIL \n");
+    }
+
+    if( EFSP_FRM_TRSP == l_tCtx.uFrm )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 4  -- FAIL \n");
+    }
+
+
+    /* Sync sequence, header and payload of the declared length, without end of frame */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsWaitingSof(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, 4u, &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsWaitingSof(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrame[4u], 4u, &l_uConsumed) )
+    {
+        if( 3u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 0u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( EFSP_TRSP_SYNC1 == l_puPayLoadLoc[0u] ) && ( 0x11u == l_puPayLoadLoc[1u] ) && ( EFSP_TRSP_ESC == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 13 -- FAIL \n");
+    }
+
+
+    /* A length that can not be received is discarded, and the decoder search the next sync */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_FRAMERESTART == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameLong, sizeof(l_auFrameLong), &l_uConsumed) )
+    {
+        if( 3u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrameLong[3u], 4u, &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 1u == l_uVar32 ) && ( 0x99u == l_puPayLoadLoc[0u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 18 -- FAIL \n");
+    }
+
+
+    /* A sync inside the header restart the frame */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN16) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 4u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_FRAMERESTART == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameHdr, sizeof(l_auFrameHdr), &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrameHdr[4u], 4u, &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 23 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 23 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 1u == l_uVar32 ) && ( 0xAAu == l_puPayLoadLoc[0u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Transparent 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 24 -- FAIL \n");
+    }
+
+
+    /* Corrupted engine */
+    l_tCtx.uFrm = 0x03u;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Transparent 26 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_Whitening(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrame[] = {ECU_SOF, 0x03u, 0xFFu, (uint8_t)~ECU_SOF, (uint8_t)~ECU_EOF, (uint8_t)~ECU_ESC, ECU_EOF};
+    uint8_t l_auFrameTrsp[] = {EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x02u, 0x55u, 0x55u, 0x00u};
+
+    /* Function */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 1  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_WHTNONE == l_tCtx.uWhtL )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetWhitening(&l_tCtx, 0x02u) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 5  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_WHT == l_tCtx.uWhtL )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 6  -- FAIL \n");
+    }
+
+
+    /* The mask is part of the header */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, 3u, &l_uConsumed) )
+    {
+        if( 3u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 4u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 10 -- FAIL \n");
+    }
+
+
+    /* The payload is restored when the frame ends */
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrame[3u], 4u, &l_uConsumed) )
+    {
+        if( 4u == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( ECU_SOF == l_puPayLoadLoc[0u] ) && ( ECU_EOF == l_puPayLoadLoc[1u] ) && ( ECU_ESC == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( ECU_SOF == l_puPayLoadLoc[0u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 15 -- FAIL \n");
+    }
+
+
+    /* Without whitening the mask is a byte of payload, and the length is wrong */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetWhitening(&l_tCtx, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 18 -- FAIL \n");
+    }
+
+
+    /* The transparent engine */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtx, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameTrsp, sizeof(l_auFrameTrsp), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameTrsp) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 2u == l_uVar32 ) && ( 0x00u == l_puPayLoadLoc[0u] ) && ( 0x55u == l_puPayLoadLoc[1u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Whitening 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 22 -- FAIL \n");
+    }
+
+
+    /* Corrupted whitening */
+    l_tCtx.uWhtL = 0x02u;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Whitening 24 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_Compression(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrame[] = {ECU_SOF, 0x06u, 0x01u, 0x14u, 0x01u, 0x41u, 0x41u, 0x8Fu, 0x00u, ECU_EOF};
+    uint8_t l_auFrameRaw[] = {ECU_SOF, 0x02u, 0x00u, 0x11u, 0x22u, ECU_EOF};
+    uint8_t l_auFrameUnk[] = {ECU_SOF, 0x02u, 0x02u, 0x11u, 0x22u, ECU_EOF};
+    uint8_t l_auFrameBad[] = {ECU_SOF, 0x02u, 0x01u, 0x80u, 0x00u, ECU_EOF};
+    uint8_t l_auFrameBig[] = {ECU_SOF, 0x05u, 0x01u, 0x32u, 0x00u, 0x41u, 0xAEu, 0x00u, ECU_EOF};
+    uint8_t l_auFrameTrsp[] = {EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x06u, 0x01u, 0x14u, 0x01u, 0x42u, 0x42u, 0x8Fu, 0x00u};
+
+    /* Function */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 1  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_CMPNONE == l_tCtx.uCmpL ) && ( 0u == l_tCtx.uDecL ) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetCompression(&l_tCtx, 0x02u) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 5  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_CMP == l_tCtx.uCmpL )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 6  -- FAIL \n");
+    }
+
+
+    /* The payload is decompressed when the frame ends */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrame) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 20u == l_uVar32 ) && ( &l_auMemArea[2u] == l_puPayLoadLoc ) && ( 0x41u == l_puPayLoadLoc[0u] ) && ( 0x41u == l_puPayLoadLoc[19u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 20u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( ( true == l_bVar ) && ( 6u == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 13 -- FAIL \n");
+    }
+
+
+    /* A new message forget the decompressed payload */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 0u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 15 -- FAIL \n");
+    }
+
+
+    /* Payload sent as it is */
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameRaw, sizeof(l_auFrameRaw), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 2u == l_uVar32 ) && ( 0x11u == l_puPayLoadLoc[0u] ) && ( 0x22u == l_puPayLoadLoc[1u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 17 -- FAIL \n");
+    }
+
+
+    /* Unknown flag, malformed stream, and a payload bigger than the memory area */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameUnk, sizeof(l_auFrameUnk), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameBad, sizeof(l_auFrameBad), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameBig, sizeof(l_auFrameBig), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 5u == l_uVar32 ) && ( 0x32u == l_puPayLoadLoc[0u] ) && ( 0xAEu == l_puPayLoadLoc[3u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 25 -- FAIL \n");
+    }
+
+
+    /* Without compression the flag is a byte of payload, and the length is wrong */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetCompression(&l_tCtx, EFSP_HDR_CMPNONE) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 27 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 28 -- FAIL \n");
+    }
+
+
+    /* The transparent engine */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 29 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFraming(&l_tCtx, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 30 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameTrsp, sizeof(l_auFrameTrsp), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameTrsp) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 31 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 31 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 31 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 20u == l_uVar32 ) && ( 0x42u == l_puPayLoadLoc[0u] ) && ( 0x42u == l_puPayLoadLoc[19u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Compression 32 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Compression 32 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 32 -- FAIL \n");
+    }
+
+
+    /* Corrupted compression */
+    l_tCtx.uCmpL = 0x02u;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 33 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 33 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Compression 34 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Compression 34 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_Delta(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auBase[12u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrameKey[] = {ECU_SOF, 0x0Au, 0x00u, 0x01u, 0x10u, 0x11u, 0x12u, 0x13u, 0x14u, 0x15u, 0x16u, 0x17u, 0x18u,
+                              0x19u, ECU_EOF};
+    uint8_t l_auFrameDiff[] = {ECU_SOF, 0x03u, 0x01u, 0x01u, 0x09u, 0x80u, 0x20u, ECU_EOF};
+    uint8_t l_auFrameSame[] = {ECU_SOF, 0x01u, 0x01u, 0x01u, 0x0Au, ECU_EOF};
+    uint8_t l_auFrameSeq[] = {ECU_SOF, 0x01u, 0x01u, 0x02u, 0x0Au, ECU_EOF};
+    uint8_t l_auFrameUnk[] = {ECU_SOF, 0x01u, 0x02u, 0x01u, 0x0Au, ECU_EOF};
+    uint8_t l_auFrameBad[] = {ECU_SOF, 0x01u, 0x01u, 0x01u, 0x0Bu, ECU_EOF};
+    uint8_t l_auFrameBig[] = {ECU_SOF, 0x0Du, 0x00u, 0x03u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u,
+                              0x44u, 0x44u, 0x44u, 0x44u, ECU_EOF};
+    uint8_t l_auFrameBigDiff[] = {ECU_SOF, 0x01u, 0x01u, 0x03u, 0x0Du, ECU_EOF};
+
+    /* Function */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 1  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLTNONE == l_tCtx.uDltL ) && ( NULL == l_tCtx.puDltBase ) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_SetDelta(&l_tCtx, NULL, sizeof(l_auBase)) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetDelta(&l_tCtx, l_auBase, 0u) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase)) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 6  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLT == l_tCtx.uDltL ) && ( 0u == l_tCtx.uDltUseL ) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 7  -- FAIL \n");
+    }
+
+
+    /* A difference is refused till a key frame is received */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameSame, sizeof(l_auFrameSame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 9  -- FAIL \n");
+    }
+
+
+    /* The key frame become the base */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameKey, sizeof(l_auFrameKey), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameKey) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 10u == l_uVar32 ) && ( &l_auMemArea[3u] == l_puPayLoadLoc ) && ( 0x10u == l_puPayLoadLoc[0u] ) && ( 0x19u == l_puPayLoadLoc[9u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 12 -- FAIL \n");
+    }
+
+    if( ( 10u == l_tCtx.uDltUseL ) && ( 0x01u == l_tCtx.uDltSeq ) && ( 0x10u == l_auBase[0u] ) && ( 0x19u == l_auBase[9u] ) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 13 -- FAIL \n");
+    }
+
+
+    /* The difference is rebuilt when the frame ends */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameDiff, sizeof(l_auFrameDiff), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameDiff) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 10u == l_uVar32 ) && ( &l_auMemArea[3u] == l_puPayLoadLoc ) && ( 0x10u == l_puPayLoadLoc[0u] ) && ( 0x99u == l_puPayLoadLoc[9u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 10u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( ( true == l_bVar ) && ( 3u == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 20 -- FAIL \n");
+    }
+
+
+    /* The base is still the key frame */
+    if( ( 10u == l_tCtx.uDltUseL ) && ( 0x19u == l_auBase[9u] ) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameSame, sizeof(l_auFrameSame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 10u == l_uVar32 ) && ( 0x19u == l_puPayLoadLoc[9u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 24 -- FAIL \n");
+    }
+
+
+    /* Difference from an unknown key frame, unknown kind of frame and malformed stream */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameSeq, sizeof(l_auFrameSeq), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 27 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 27 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 27 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 28 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameUnk, sizeof(l_auFrameUnk), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 29 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 30 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameBad, sizeof(l_auFrameBad), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 31 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 31 -- FAIL \n");
+    }
+
+
+    /* A key frame bigger than the base is received, but the next differences are not */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 32 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 32 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameBig, sizeof(l_auFrameBig), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 33 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 33 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 13u == l_uVar32 ) && ( 0x44u == l_puPayLoadLoc[12u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Delta 34 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Delta 34 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 34 -- FAIL \n");
+    }
+
+    if( 0u == l_tCtx.uDltUseL )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 35 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 35 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 36 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 36 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameBigDiff, sizeof(l_auFrameBigDiff), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 37 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 37 -- FAIL \n");
+    }
+
+
+    /* Without delta frames the fields are bytes of payload, and the length is wrong */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 38 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 38 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 39 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 39 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 40 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 40 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameKey, sizeof(l_auFrameKey), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 41 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 41 -- FAIL \n");
+    }
+
+
+    /* Corrupted delta */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase)) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 42 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 42 -- FAIL \n");
+    }
+
+    l_tCtx.puDltBase = NULL;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 43 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 43 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameKey, sizeof(l_auFrameKey), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Delta 44 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Delta 44 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGDTST_Fec(void)
+{
+    /* Local variable */
+    t_eFSP_MSGD_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGDTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uConsumed;
+    uint32_t l_uVar32;
+    uint8_t* l_puPayLoadLoc;
+    bool_t l_bVar;
+    uint8_t l_auFrame[] = {ECU_SOF, 0x03u, 0x10u, 0x11u, 0x12u, 0xA6u, 0x9Cu, 0xA6u, 0x8Cu, ECU_EOF};
+    uint8_t l_auFrameTwo[] = {ECU_SOF, 0x07u, 0x10u, 0x11u, 0x12u, 0xA6u, 0x00u, 0xA6u, 0x8Cu, ECU_EOF};
+    uint8_t l_auFrameThree[] = {ECU_SOF, 0x07u, 0x10u, 0x55u, 0x12u, 0xA6u, 0x00u, 0xA6u, 0x8Cu, ECU_EOF};
+    uint8_t l_auFrameStart[] = {ECU_SOF, 0x03u, 0x10u};
+
+    /* Function */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcPTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 1  -- FAIL \n");
+    }
+
+    if( EFSP_FEC_NONE == l_tCtx.uFecL )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPOINTER == eFSP_MSGD_SetFec(NULL, EFSP_FEC_RS4) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetFec(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADPARAM == eFSP_MSGD_SetFec(&l_tCtx, EFSP_FEC_MAXPAR + 1u) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 6  -- FAIL \n");
+    }
+
+
+    /* Without the correction the parity is seen as payload */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 8  -- FAIL \n");
+    }
+
+
+    /* The parity is removed */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_SetFec(&l_tCtx, EFSP_FEC_RS4) )
+    {
+        if( EFSP_FEC_RS4 == l_tCtx.uFecL )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrame, sizeof(l_auFrame), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrame) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( &l_auMemArea[1u] == l_puPayLoadLoc ) && ( 0x10u == l_puPayLoadLoc[0u] ) && ( 0x12u == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsAFullMsgDecoded(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 14 -- FAIL \n");
+    }
+
+
+    /* Two wrong bytes, one of them in the header, are corrected */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameTwo, sizeof(l_auFrameTwo), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameTwo) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedData(&l_tCtx, &l_puPayLoadLoc, &l_uVar32) )
+    {
+        if( ( 3u == l_uVar32 ) && ( 0x10u == l_puPayLoadLoc[0u] ) && ( 0x11u == l_puPayLoadLoc[1u] ) && ( 0x12u == l_puPayLoadLoc[2u] ) )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDeclaredLen(&l_tCtx, &l_bVar, &l_uVar32) )
+    {
+        if( ( true == l_bVar ) && ( 3u == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( false == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 19 -- FAIL \n");
+    }
+
+
+    /* Three wrong bytes are too many */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_BADFRAME == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameThree, sizeof(l_auFrameThree), &l_uConsumed) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_IsFrameBad(&l_tCtx, &l_bVar) )
+    {
+        if( true == l_bVar )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 22 -- FAIL \n");
+    }
+
+
+    /* The parity is waited too */
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_InsEncChunk(&l_tCtx, l_auFrameStart, sizeof(l_auFrameStart), &l_uConsumed) )
+    {
+        if( sizeof(l_auFrameStart) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 7u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_MESSAGEENDED == eFSP_MSGD_InsEncChunk(&l_tCtx, &l_auFrame[3u], sizeof(l_auFrame) - 3u, &l_uConsumed) )
+    {
+        if( ( sizeof(l_auFrame) - 3u ) == l_uConsumed )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 26 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 26 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_OK == eFSP_MSGD_GetDecodedLen(&l_tCtx, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGDTST_Fec 27 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGDTST_Fec 27 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 27 -- FAIL \n");
+    }
+
+
+    /* Corrupted fec */
+    l_tCtx.uFecL = 3u;
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 28 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGD_RES_CORRUPTCTX == eFSP_MSGD_GetMostEffDatLen(&l_tCtx, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGDTST_Fec 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGDTST_Fec 29 -- FAIL \n");
+    }
+}
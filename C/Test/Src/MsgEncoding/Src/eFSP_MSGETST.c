@@ -47,6 +47,14 @@ static void eFSP_MSGETST_BadClBck(void);
 static void eFSP_MSGETST_MsgEnd(void);
 static void eFSP_MSGETST_General(void);
 static void eFSP_MSGETST_General2(void);
+static void eFSP_MSGETST_HeaderProfile(void);
+static void eFSP_MSGETST_VarLen(void);
+static void eFSP_MSGETST_Framing(void);
+static void eFSP_MSGETST_Transparent(void);
+static void eFSP_MSGETST_Whitening(void);
+static void eFSP_MSGETST_Compression(void);
+static void eFSP_MSGETST_Delta(void);
+static void eFSP_MSGETST_Fec(void);
 
 
 
@@ -66,6 +74,14 @@ void eFSP_MSGETST_ExeTest(void)
     eFSP_MSGETST_MsgEnd();
     eFSP_MSGETST_General();
     eFSP_MSGETST_General2();
+    eFSP_MSGETST_HeaderProfile();
+    eFSP_MSGETST_VarLen();
+    eFSP_MSGETST_Framing();
+    eFSP_MSGETST_Transparent();
+    eFSP_MSGETST_Whitening();
+    eFSP_MSGETST_Compression();
+    eFSP_MSGETST_Delta();
+    eFSP_MSGETST_Fec();
 
     (void)printf("\n\nMESSAGE ENCODER TEST END \n\n");
 }
@@ -1382,4 +1398,3264 @@ void eFSP_MSGETST_General2(void)
     {
         (void)printf("eFSP_MSGETST_General2 10 -- FAIL \n");
     }
+}
+
+void eFSP_MSGETST_HeaderProfile(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auEncArea[20u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint8_t* l_puData;
+
+    /* Function */
+    l_tCtx.tBSTFCtx.bIsInit = false;
+    l_tCtx.ptCrcCtx = &l_tCtxAdapterCrc;
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_BADPOINTER == eFSP_MSGE_SetHeader(NULL, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_NOINITLIB == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, 0x01u, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC16, 0x05u) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, 0x03u) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 6  -- FAIL \n");
+    }
+
+
+    /* Default header */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[EFSP_MSGEN_HEADERSIZE] == l_puData ) && ( ( sizeof(l_auMemArea) - EFSP_MSGEN_HEADERSIZE ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 7  -- FAIL \n");
+    }
+
+
+    /* CRC16 and 8 bit len */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[3u] == l_puData ) && ( ( sizeof(l_auMemArea) - 3u ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_NewMessage(&l_tCtx, 0x100u) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 10 -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    l_puData[2u] = 0x03u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 11 -- FAIL \n");
+    }
+
+    if( ( 0x44u == l_auMemArea[0u] ) && ( 0x7Bu == l_auMemArea[1u] ) && ( 0x03u == l_auMemArea[2u] ) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 8u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 8u == l_uVar32 ) && ( ECU_SOF == l_auEncArea[0u] ) && ( 0x44u == l_auEncArea[1u] ) && ( 0x7Bu == l_auEncArea[2u] ) && ( 0x03u == l_auEncArea[3u] ) && ( 0x01u == l_auEncArea[4u] ) && ( 0x03u == l_auEncArea[6u] ) && ( ECU_EOF == l_auEncArea[7u] ) )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 14 -- FAIL \n");
+    }
+
+
+    /* No CRC and 16 bit len, the callback is not used */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN16) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[2u] == l_puData ) && ( ( sizeof(l_auMemArea) - 2u ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 16 -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    l_puData[2u] = 0x03u;
+    l_tCtxAdapterCrc.eLastEr = e_eCU_CRC_RES_BADPOINTER;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 17 -- FAIL \n");
+    }
+
+    if( ( e_eCU_CRC_RES_BADPOINTER == l_tCtxAdapterCrc.eLastEr ) && ( 0x03u == l_auMemArea[0u] ) && ( 0x00u == l_auMemArea[1u] ) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 7u == l_uVar32 ) && ( ECU_SOF == l_auEncArea[0u] ) && ( 0x03u == l_auEncArea[1u] ) && ( 0x00u == l_auEncArea[2u] ) && ( 0x01u == l_auEncArea[3u] ) && ( ECU_EOF == l_auEncArea[6u] ) )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 19 -- FAIL \n");
+    }
+
+
+    /* Corrupted header profile */
+    l_tCtx.uLenL = 0x03u;
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( &l_auMemArea[EFSP_MSGEN_HEADERSIZE] == l_puData )
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 23 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_HeaderProfile 23 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_HeaderProfile 23 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_VarLen(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auEncArea[310u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    f_eFSP_MSGE_CrcCb l_fCrcTestErr = &eFSP_MSGETST_c32SAdaptEr;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint32_t l_uI;
+    uint8_t* l_puData;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, EFSP_HDR_CRC32 + EFSP_HDR_LENVARMAX, l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 3  -- FAIL \n");
+    }
+
+
+    /* The payload is always placed after the biggest header */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[EFSP_HDR_LENVARMAX] == l_puData ) && ( ( sizeof(l_auMemArea) - EFSP_HDR_LENVARMAX ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_NewMessage(&l_tCtx, sizeof(l_auMemArea) - EFSP_HDR_LENVARMAX + 1u) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 6  -- FAIL \n");
+    }
+
+
+    /* Short message, one byte of length */
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    l_puData[2u] = 0x03u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 7  -- FAIL \n");
+    }
+
+    if( ( 0x03u == l_auMemArea[0u] ) && ( 0x01u == l_auMemArea[1u] ) && ( 0x02u == l_auMemArea[2u] ) && ( 0x03u == l_auMemArea[3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 6u == l_uVar32 ) && ( ECU_SOF == l_auEncArea[0u] ) && ( 0x03u == l_auEncArea[1u] ) && ( 0x01u == l_auEncArea[2u] ) && ( 0x03u == l_auEncArea[4u] ) && ( ECU_EOF == l_auEncArea[5u] ) )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 10 -- FAIL \n");
+    }
+
+
+    /* Two bytes of length, the payload must be copied again for every message */
+    for( l_uI = 0u; l_uI < 200u; l_uI++ )
+    {
+        l_puData[l_uI] = (uint8_t)( l_uI & 0x7Fu );
+    }
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 200u) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 11 -- FAIL \n");
+    }
+
+    if( ( 0xC8u == l_auMemArea[0u] ) && ( 0x01u == l_auMemArea[1u] ) && ( 0x00u == l_auMemArea[2u] ) && ( 0x47u == l_auMemArea[201u] ) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 204u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 13 -- FAIL \n");
+    }
+
+
+    /* Biggest message */
+    for( l_uI = 0u; l_uI < ( sizeof(l_auMemArea) - EFSP_HDR_LENVARMAX ); l_uI++ )
+    {
+        l_puData[l_uI] = 0x10u;
+    }
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, sizeof(l_auMemArea) - EFSP_HDR_LENVARMAX) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 14 -- FAIL \n");
+    }
+
+    if( ( 0xA7u == l_auMemArea[0u] ) && ( 0x02u == l_auMemArea[1u] ) && ( 0x10u == l_auMemArea[2u] ) && ( 0x10u == l_auMemArea[296u] ) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 299u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 16 -- FAIL \n");
+    }
+
+
+    /* With CRC the length follow the CRC, and the payload is left in place if the CRC callback fails */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LENVAR) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[EFSP_HDR_CRC16 + EFSP_HDR_LENVARMAX] == l_puData ) && ( ( sizeof(l_auMemArea) - EFSP_HDR_CRC16 - EFSP_HDR_LENVARMAX ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 18 -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    l_puData[2u] = 0x03u;
+    l_tCtx.fCrc = l_fCrcTestErr;
+    if( e_eFSP_MSGE_RES_CRCCLBKERROR == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 19 -- FAIL \n");
+    }
+
+    if( ( 0x01u == l_puData[0u] ) && ( 0x02u == l_puData[1u] ) && ( 0x03u == l_puData[2u] ) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 20 -- FAIL \n");
+    }
+
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 21 -- FAIL \n");
+    }
+
+    if( ( 0x44u == l_auMemArea[0u] ) && ( 0x7Bu == l_auMemArea[1u] ) && ( 0x03u == l_auMemArea[2u] ) && ( 0x01u == l_auMemArea[3u] ) && ( 0x03u == l_auMemArea[5u] ) )
+    {
+        (void)printf("eFSP_MSGETST_VarLen 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 8u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_VarLen 23 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_VarLen 23 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_VarLen 23 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_Framing(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auEncArea[40u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint8_t* l_puData;
+
+    /* Function */
+    l_tCtx.tBSTFCtx.bIsInit = false;
+    l_tCtx.ptCrcCtx = &l_tCtxAdapterCrc;
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_BADPOINTER == eFSP_MSGE_SetFraming(NULL, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_NOINITLIB == eFSP_MSGE_SetFraming(&l_tCtx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 3  -- FAIL \n");
+    }
+
+    if( EFSP_FRM_ESC == l_tCtx.uFrm )
+    {
+        (void)printf("eFSP_MSGETST_Framing 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetFraming(&l_tCtx, 0x03u) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 5  -- FAIL \n");
+    }
+
+
+    /* Zero delimited frame, the zero of the payload is replaced */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 8  -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x00u;
+    l_puData[2u] = 0x02u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 7u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Framing 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Framing 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, 2u, &l_uVar32) )
+    {
+        if( ( 2u == l_uVar32 ) && ( 0x00u == l_auEncArea[0u] ) && ( 0x03u == l_auEncArea[1u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Framing 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Framing 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 5u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Framing 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Framing 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 12 -- FAIL \n");
+    }
+
+    if( ( 0x03u == l_auEncArea[0u] ) && ( 0x01u == l_auEncArea[1u] ) && ( 0x02u == l_auEncArea[2u] ) && ( 0x02u == l_auEncArea[3u] ) && ( 0x00u == l_auEncArea[4u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 7u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Framing 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Framing 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 15 -- FAIL \n");
+    }
+
+
+    /* Back to the escape engine */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtx, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 17 -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x00u;
+    l_puData[2u] = 0x02u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 6u == l_uVar32 ) && ( ECU_SOF == l_auEncArea[0u] ) && ( 0x00u == l_auEncArea[3u] ) && ( ECU_EOF == l_auEncArea[5u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Framing 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Framing 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 19 -- FAIL \n");
+    }
+
+
+    /* Corrupted engine */
+    l_tCtx.uFrm = 0x03u;
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Framing 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Framing 22 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_Transparent(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[200u];
+    uint8_t  l_auEncArea[210u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint32_t l_uI;
+    uint8_t* l_puData;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtx, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 3  -- FAIL \n");
+    }
+
+    if( EFSP_FRM_TRSP == l_tCtx.uFrm )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 4  -- FAIL \n");
+    }
+
+
+    /* Sync sequence, header and payload as it is */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 5  -- FAIL \n");
+    }
+
+    l_puData[0u] = EFSP_TRSP_SYNC1;
+    l_puData[1u] = 0x11u;
+    l_puData[2u] = EFSP_TRSP_ESC;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Transparent 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Transparent 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, 3u, &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Transparent 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Transparent 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 8  -- FAIL \n");
+    }
+
+    if( ( EFSP_TRSP_SYNC1 == l_auEncArea[0u] ) && ( EFSP_TRSP_SYNC2 == l_auEncArea[1u] ) && ( 0x03u == l_auEncArea[2u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 3u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Transparent 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Transparent 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 10 -- FAIL \n");
+    }
+
+    if( ( EFSP_TRSP_SYNC1 == l_auEncArea[0u] ) && ( 0x11u == l_auEncArea[1u] ) && ( EFSP_TRSP_ESC == l_auEncArea[2u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Transparent 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Transparent 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 13 -- FAIL \n");
+    }
+
+
+    /* A length equal to the sync is escaped */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 14 -- FAIL \n");
+    }
+
+    for( l_uI = 0u; l_uI < EFSP_TRSP_SYNC1; l_uI++ )
+    {
+        l_puData[l_uI] = EFSP_TRSP_SYNC1;
+    }
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, EFSP_TRSP_SYNC1) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetRemByteToGet(&l_tCtx, &l_uVar32) )
+    {
+        if( ( EFSP_TRSP_SYNC1 + 4u ) == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Transparent 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Transparent 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( EFSP_TRSP_SYNC1 + 4u ) == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Transparent 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Transparent 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 17 -- FAIL \n");
+    }
+
+    if( ( EFSP_TRSP_ESC == l_auEncArea[2u] ) && ( 0xE3u == l_auEncArea[3u] ) && ( EFSP_TRSP_SYNC1 == l_auEncArea[4u] ) && ( EFSP_TRSP_SYNC1 == l_auEncArea[EFSP_TRSP_SYNC1 + 3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 18 -- FAIL \n");
+    }
+
+
+    /* Corrupted engine */
+    l_tCtx.uFrm = 0x03u;
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetFraming(&l_tCtx, 0x03u) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Transparent 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Transparent 21 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_Whitening(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auEncArea[40u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint8_t* l_puData;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 1  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_WHTNONE == l_tCtx.uWhtL )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetWhitening(&l_tCtx, 0x02u) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 5  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_WHT == l_tCtx.uWhtL )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 6  -- FAIL \n");
+    }
+
+
+    /* The payload follow the mask */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[2u] == l_puData ) && ( ( sizeof(l_auMemArea) - 2u ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_Whitening 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Whitening 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 7  -- FAIL \n");
+    }
+
+
+    /* A payload of special char is XORed and sent without escape */
+    l_puData[0u] = ECU_SOF;
+    l_puData[1u] = ECU_EOF;
+    l_puData[2u] = ECU_ESC;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 7u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Whitening 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Whitening 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 9  -- FAIL \n");
+    }
+
+    if( ( ECU_SOF == l_auEncArea[0u] ) && ( 0x03u == l_auEncArea[1u] ) && ( 0xFFu == l_auEncArea[2u] ) && ( (uint8_t)~ECU_SOF == l_auEncArea[3u] ) && ( (uint8_t)~ECU_ESC == l_auEncArea[5u] ) && ( ECU_EOF == l_auEncArea[6u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 10 -- FAIL \n");
+    }
+
+
+    /* The restarted message is the whitened one */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 7u == l_uVar32 ) && ( 0xFFu == l_auEncArea[2u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Whitening 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Whitening 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 12 -- FAIL \n");
+    }
+
+
+    /* Nothing to escape, no mask */
+    l_puData[0u] = 0x11u;
+    l_puData[1u] = 0x22u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Whitening 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Whitening 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 14 -- FAIL \n");
+    }
+
+    if( ( 0x02u == l_auEncArea[1u] ) && ( 0x00u == l_auEncArea[2u] ) && ( 0x11u == l_auEncArea[3u] ) && ( 0x22u == l_auEncArea[4u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 15 -- FAIL \n");
+    }
+
+
+    /* Zeros do not expand a COBS frame */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 16 -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x00u;
+    l_puData[1u] = 0x00u;
+    l_puData[2u] = 0x00u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 8u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Whitening 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Whitening 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 18 -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auEncArea[0u] ) && ( 0x02u == l_auEncArea[1u] ) && ( 0x03u == l_auEncArea[2u] ) && ( 0x01u == l_auEncArea[3u] ) && ( 0x00u == l_auEncArea[7u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 19 -- FAIL \n");
+    }
+
+
+    /* The transparent engine send the payload as it is */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFraming(&l_tCtx, EFSP_FRM_TRSP) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 20 -- FAIL \n");
+    }
+
+    l_puData[0u] = ECU_SOF;
+    l_puData[1u] = 0x00u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Whitening 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Whitening 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 22 -- FAIL \n");
+    }
+
+    if( ( 0x00u == l_auEncArea[3u] ) && ( ECU_SOF == l_auEncArea[4u] ) && ( 0x00u == l_auEncArea[5u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 23 -- FAIL \n");
+    }
+
+
+    /* The mask does not fit in the smallest buffer with the biggest header */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, EFSP_MIN_MSGEN_BUFFLEN, l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN16) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 27 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 28 -- FAIL \n");
+    }
+
+
+    /* Corrupted whitening */
+    l_tCtx.uWhtL = 0x02u;
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 29 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGETST_Whitening 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Whitening 30 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_Compression(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auEncArea[40u];
+    uint8_t  l_auRefArea[40u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    f_eFSP_MSGE_CrcCb l_fCrcTestErr = &eFSP_MSGETST_c32SAdaptEr;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint32_t l_uRefL;
+    uint32_t l_uIdx;
+    bool_t l_bSame;
+    uint8_t* l_puData;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 1  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_CMPNONE == l_tCtx.uCmpL )
+    {
+        (void)printf("eFSP_MSGETST_Compression 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetCompression(&l_tCtx, 0x02u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 5  -- FAIL \n");
+    }
+
+    if( EFSP_HDR_CMP == l_tCtx.uCmpL )
+    {
+        (void)printf("eFSP_MSGETST_Compression 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 6  -- FAIL \n");
+    }
+
+
+    /* The payload follow the flag */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[2u] == l_puData ) && ( ( sizeof(l_auMemArea) - 2u ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_Compression 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 7  -- FAIL \n");
+    }
+
+
+    /* A repetitive payload is sent compressed, the length is the one of the compressed payload */
+    (void)memset(l_puData, 0x41, 20u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 20u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 10u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Compression 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 9  -- FAIL \n");
+    }
+
+    if( ( ECU_SOF == l_auEncArea[0u] ) && ( 0x06u == l_auEncArea[1u] ) && ( EFSP_HDR_CMPLZSS == l_auEncArea[2u] ) && ( 20u == l_auEncArea[3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 10 -- FAIL \n");
+    }
+
+    if( ( 0x01u == l_auEncArea[4u] ) && ( 0x41u == l_auEncArea[5u] ) && ( 0x8Fu == l_auEncArea[7u] ) && ( 0x00u == l_auEncArea[8u] ) && ( ECU_EOF == l_auEncArea[9u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 11 -- FAIL \n");
+    }
+
+
+    /* The restarted message is the compressed one */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 10u == l_uVar32 ) && ( 0x06u == l_auEncArea[1u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Compression 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 13 -- FAIL \n");
+    }
+
+
+    /* A payload that does not get shorter is sent as it is */
+    l_puData[0u] = 0x11u;
+    l_puData[1u] = 0x22u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Compression 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 15 -- FAIL \n");
+    }
+
+    if( ( 0x02u == l_auEncArea[1u] ) && ( EFSP_HDR_CMPRAW == l_auEncArea[2u] ) && ( 0x11u == l_auEncArea[3u] ) && ( 0x22u == l_auEncArea[4u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 16 -- FAIL \n");
+    }
+
+
+    /* The compressed payload is whitened, the flag is not */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( &l_auMemArea[3u] == l_puData )
+        {
+            (void)printf("eFSP_MSGETST_Compression 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 18 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, ECU_SOF, 20u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 20u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 11u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Compression 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 20 -- FAIL \n");
+    }
+
+    if( ( 0x06u == l_auEncArea[1u] ) && ( 0xFFu == l_auEncArea[2u] ) && ( EFSP_HDR_CMPLZSS == l_auEncArea[3u] ) && ( (uint8_t)~20u == l_auEncArea[4u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 21 -- FAIL \n");
+    }
+
+    if( ( (uint8_t)~ECU_SOF == l_auEncArea[6u] ) && ( (uint8_t)~ECU_SOF == l_auEncArea[7u] ) && ( ECU_EOF == l_auEncArea[10u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 22 -- FAIL \n");
+    }
+
+
+    /* A payload compressed before a CRC error is lost, it can not be started again until it is copied again */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 24 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 20u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 20u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auRefArea, sizeof(l_auRefArea), &l_uRefL) )
+    {
+        if( ( l_uRefL > 11u ) && ( l_uRefL < 20u ) )
+        {
+            (void)printf("eFSP_MSGETST_Compression 26 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 26 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 27 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 20u);
+    l_tCtx.fCrc = l_fCrcTestErr;
+    if( e_eFSP_MSGE_RES_CRCCLBKERROR == eFSP_MSGE_NewMessage(&l_tCtx, 20u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 28 -- FAIL \n");
+    }
+
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_NOINITMESSAGE == eFSP_MSGE_NewMessage(&l_tCtx, 20u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 29 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 30 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 20u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 20u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 31 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 31 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( l_uRefL == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Compression 32 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 32 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 32 -- FAIL \n");
+    }
+
+
+    l_bSame = true;
+    for( l_uIdx = 0u; l_uIdx < l_uRefL; l_uIdx++ )
+    {
+        if( l_auRefArea[l_uIdx] != l_auEncArea[l_uIdx] )
+        {
+            l_bSame = false;
+        }
+    }
+    if( true == l_bSame )
+    {
+        (void)printf("eFSP_MSGETST_Compression 33 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 33 -- FAIL \n");
+    }
+
+
+
+    /* A payload that was not compressed is left in place, and can be started again */
+    l_puData[0u] = 0x11u;
+    l_puData[1u] = 0x22u;
+    l_tCtx.fCrc = l_fCrcTestErr;
+    if( e_eFSP_MSGE_RES_CRCCLBKERROR == eFSP_MSGE_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 34 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 34 -- FAIL \n");
+    }
+
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 35 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 35 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( l_uVar32 > 8u )
+        {
+            (void)printf("eFSP_MSGETST_Compression 36 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Compression 36 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 36 -- FAIL \n");
+    }
+
+
+
+
+    /* The flag does not fit in the smallest buffer with the biggest header */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, EFSP_MIN_MSGEN_BUFFLEN, l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 37 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 37 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 38 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 38 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN16) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 39 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 39 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 40 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 40 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 41 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 41 -- FAIL \n");
+    }
+
+
+    /* Corrupted compression */
+    l_tCtx.uCmpL = 0x02u;
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 42 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 42 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGETST_Compression 43 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Compression 43 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_Delta(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    t_eFSP_MSGE_Ctx l_tCtxRef;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auMemRef[40u];
+    uint8_t  l_auEncArea[40u];
+    uint8_t  l_auRefArea[40u];
+    uint8_t  l_auBase[20u];
+    uint8_t  l_auBaseRef[20u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    f_eFSP_MSGE_CrcCb l_fCrcTestErr = &eFSP_MSGETST_c32SAdaptEr;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint32_t l_uRefL;
+    uint32_t l_uI;
+    bool_t l_bSame;
+    uint8_t* l_puData;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 1  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLTNONE == l_tCtx.uDltL ) && ( NULL == l_tCtx.puDltBase ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPOINTER == eFSP_MSGE_SetDelta(&l_tCtx, NULL, sizeof(l_auBase), 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetDelta(&l_tCtx, l_auBase, 0u, 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase), 0u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase), 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 7  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLT == l_tCtx.uDltL ) && ( 0u == l_tCtx.uDltUseL ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 8  -- FAIL \n");
+    }
+
+
+    /* The payload follow the kind of frame and the sequence number */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[3u] == l_puData ) && ( ( sizeof(l_auMemArea) - 3u ) == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_Delta 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 9  -- FAIL \n");
+    }
+
+
+    /* The first message is a key frame, and become the base */
+    for( l_uI = 0u; l_uI < 10u; l_uI++ )
+    {
+        l_puData[l_uI] = (uint8_t)( 0x10u + l_uI );
+    }
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 10u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 15u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 11 -- FAIL \n");
+    }
+
+    if( ( ECU_SOF == l_auEncArea[0u] ) && ( 0x0Au == l_auEncArea[1u] ) && ( EFSP_HDR_DLTKEY == l_auEncArea[2u] ) && ( 0x01u == l_auEncArea[3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 12 -- FAIL \n");
+    }
+
+    if( ( 0x10u == l_auEncArea[4u] ) && ( 0x19u == l_auEncArea[13u] ) && ( ECU_EOF == l_auEncArea[14u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 13 -- FAIL \n");
+    }
+
+    if( ( 10u == l_tCtx.uDltUseL ) && ( 0x10u == l_auBase[0u] ) && ( 0x19u == l_auBase[9u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 14 -- FAIL \n");
+    }
+
+
+    /* A message of the same length is sent as the difference from the key frame */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 15 -- FAIL \n");
+    }
+
+    for( l_uI = 0u; l_uI < 10u; l_uI++ )
+    {
+        l_puData[l_uI] = (uint8_t)( 0x10u + l_uI );
+    }
+    l_puData[9u] = 0x99u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 10u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 8u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 17 -- FAIL \n");
+    }
+
+    if( ( 0x03u == l_auEncArea[1u] ) && ( EFSP_HDR_DLTDIFF == l_auEncArea[2u] ) && ( 0x01u == l_auEncArea[3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 18 -- FAIL \n");
+    }
+
+    if( ( 0x09u == l_auEncArea[4u] ) && ( 0x80u == l_auEncArea[5u] ) && ( 0x20u == l_auEncArea[6u] ) && ( ECU_EOF == l_auEncArea[7u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 19 -- FAIL \n");
+    }
+
+
+    /* The base is still the key frame */
+    if( ( 10u == l_tCtx.uDltUseL ) && ( 0x19u == l_auBase[9u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 20 -- FAIL \n");
+    }
+
+
+    /* The restarted message is the difference */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 8u == l_uVar32 ) && ( 0x03u == l_auEncArea[1u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Delta 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 22 -- FAIL \n");
+    }
+
+
+    /* A message equal to the key frame */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 23 -- FAIL \n");
+    }
+
+    (void)memcpy(l_puData, l_auBase, 10u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 10u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 6u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 25 -- FAIL \n");
+    }
+
+    if( ( 0x01u == l_auEncArea[1u] ) && ( EFSP_HDR_DLTDIFF == l_auEncArea[2u] ) && ( 0x01u == l_auEncArea[3u] ) && ( 0x0Au == l_auEncArea[4u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 26 -- FAIL \n");
+    }
+
+
+    /* After the configured number of differences a key frame is sent again */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 27 -- FAIL \n");
+    }
+
+    (void)memcpy(l_puData, l_auBase, 10u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 10u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 28 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 15u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 29 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 29 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 29 -- FAIL \n");
+    }
+
+    if( ( 0x0Au == l_auEncArea[1u] ) && ( EFSP_HDR_DLTKEY == l_auEncArea[2u] ) && ( 0x02u == l_auEncArea[3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 30 -- FAIL \n");
+    }
+
+
+    /* A message of a different length is a key frame */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 31 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 31 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x55, 5u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 5u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 32 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 32 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 10u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 33 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 33 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 33 -- FAIL \n");
+    }
+
+    if( ( 0x05u == l_auEncArea[1u] ) && ( EFSP_HDR_DLTKEY == l_auEncArea[2u] ) && ( 0x03u == l_auEncArea[3u] ) && ( 5u == l_tCtx.uDltUseL ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 34 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 34 -- FAIL \n");
+    }
+
+
+    /* A message too different from the key frame is a key frame */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 35 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 35 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x66, 5u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 5u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 36 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 36 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 10u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 37 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 37 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 37 -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLTKEY == l_auEncArea[2u] ) && ( 0x04u == l_auEncArea[3u] ) && ( 0x66u == l_auBase[0u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 38 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 38 -- FAIL \n");
+    }
+
+
+    /* A reset force a key frame */
+    if( e_eFSP_MSGE_RES_BADPOINTER == eFSP_MSGE_ResetDelta(NULL) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 39 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 39 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_ResetDelta(&l_tCtx) )
+    {
+        if( 0u == l_tCtx.uDltUseL )
+        {
+            (void)printf("eFSP_MSGETST_Delta 40 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 40 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 40 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 41 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 41 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x66, 5u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 5u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 42 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 42 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 10u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 43 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 43 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 43 -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLTKEY == l_auEncArea[2u] ) && ( 0x05u == l_auEncArea[3u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 44 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 44 -- FAIL \n");
+    }
+
+
+    /* A message bigger than the base is a key frame that can not be used as base */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 45 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 45 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x77, 25u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 25u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 46 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 46 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( 30u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 47 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 47 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 47 -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_DLTKEY == l_auEncArea[2u] ) && ( 0x06u == l_auEncArea[3u] ) && ( 0u == l_tCtx.uDltUseL ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 48 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 48 -- FAIL \n");
+    }
+
+
+    /* A CRC error leave the state of the differences untouched, the payload must be copied again */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 49 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 49 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtxRef, l_auMemRef, sizeof(l_auMemRef), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 50 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 50 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtxRef, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+        {
+            (void)printf("eFSP_MSGETST_Delta 51 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 51 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 51 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetCompression(&l_tCtxRef, EFSP_HDR_CMP) )
+        {
+            (void)printf("eFSP_MSGETST_Delta 52 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 52 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 52 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase), 4u) )
+    {
+        if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetDelta(&l_tCtxRef, l_auBaseRef, sizeof(l_auBaseRef), 4u) )
+        {
+            (void)printf("eFSP_MSGETST_Delta 53 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 53 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 53 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 54 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 54 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 16u);
+    l_tCtx.fCrc = l_fCrcTestErr;
+    if( e_eFSP_MSGE_RES_CRCCLBKERROR == eFSP_MSGE_NewMessage(&l_tCtx, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 55 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 55 -- FAIL \n");
+    }
+
+    if( ( 0u == l_tCtx.uDltSeq ) && ( 0u == l_tCtx.uDltN ) && ( 0u == l_tCtx.uDltUseL ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 56 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 56 -- FAIL \n");
+    }
+
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_NOINITMESSAGE == eFSP_MSGE_NewMessage(&l_tCtx, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 57 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 57 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 58 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 58 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 16u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 59 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 59 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 60 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 60 -- FAIL \n");
+    }
+
+    if( ( 1u == l_tCtx.uDltSeq ) && ( 16u == l_tCtx.uDltUseL ) && ( 0x41u == l_auBase[0u] ) && ( 0x41u == l_auBase[15u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 61 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 61 -- FAIL \n");
+    }
+
+
+    /* The key frame is the one of an encoder that never failed */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtxRef, &l_puData, &l_uRefL) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 62 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 62 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 16u);
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtxRef, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 63 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 63 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtxRef, l_auRefArea, sizeof(l_auRefArea), &l_uRefL) )
+    {
+        if( l_uRefL == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Delta 64 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 64 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 64 -- FAIL \n");
+    }
+
+
+    l_bSame = true;
+    for( l_uI = 0u; l_uI < l_uRefL; l_uI++ )
+    {
+        if( l_auRefArea[l_uI] != l_auEncArea[l_uI] )
+        {
+            l_bSame = false;
+        }
+    }
+    if( true == l_bSame )
+    {
+        (void)printf("eFSP_MSGETST_Delta 65 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 65 -- FAIL \n");
+    }
+
+
+    /* The difference overwrite the payload, the base and the counters are left as they were */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 66 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 66 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 16u);
+    l_puData[15u] = 0x42u;
+    l_tCtx.fCrc = l_fCrcTestErr;
+    if( e_eFSP_MSGE_RES_CRCCLBKERROR == eFSP_MSGE_NewMessage(&l_tCtx, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 67 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 67 -- FAIL \n");
+    }
+
+    if( ( 1u == l_tCtx.uDltSeq ) && ( 0u == l_tCtx.uDltN ) && ( 16u == l_tCtx.uDltUseL ) && ( 0x41u == l_auBase[15u] ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 68 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 68 -- FAIL \n");
+    }
+
+    l_tCtx.fCrc = l_fCrcTest;
+    if( e_eFSP_MSGE_RES_NOINITMESSAGE == eFSP_MSGE_NewMessage(&l_tCtx, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 69 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 69 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 70 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 70 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 16u);
+    l_puData[15u] = 0x42u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 71 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 71 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 72 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 72 -- FAIL \n");
+    }
+
+    if( ( 1u == l_tCtx.uDltSeq ) && ( 1u == l_tCtx.uDltN ) && ( 16u == l_tCtx.uDltUseL ) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 73 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 73 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtxRef, &l_puData, &l_uRefL) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 74 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 74 -- FAIL \n");
+    }
+
+    (void)memset(l_puData, 0x41, 16u);
+    l_puData[15u] = 0x42u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtxRef, 16u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 75 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 75 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtxRef, l_auRefArea, sizeof(l_auRefArea), &l_uRefL) )
+    {
+        if( ( l_uRefL == l_uVar32 ) && ( l_uRefL < 16u ) )
+        {
+            (void)printf("eFSP_MSGETST_Delta 76 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Delta 76 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 76 -- FAIL \n");
+    }
+
+
+    l_bSame = true;
+    for( l_uI = 0u; l_uI < l_uRefL; l_uI++ )
+    {
+        if( l_auRefArea[l_uI] != l_auEncArea[l_uI] )
+        {
+            l_bSame = false;
+        }
+    }
+    if( true == l_bSame )
+    {
+        (void)printf("eFSP_MSGETST_Delta 77 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 77 -- FAIL \n");
+    }
+
+
+
+
+    /* The fields do not fit in the smallest buffer with the biggest header */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, EFSP_MIN_MSGEN_BUFFLEN, l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 78 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 78 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase), 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 79 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 79 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_ResetDelta(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 80 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 80 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 81 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 81 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetDelta(&l_tCtx, l_auBase, sizeof(l_auBase), 2u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 82 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 82 -- FAIL \n");
+    }
+
+
+    /* Corrupted delta */
+    l_tCtx.uDltKeyN = 0u;
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 83 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 83 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 84 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 84 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_ResetDelta(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Delta 85 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Delta 85 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGETST_Fec(void)
+{
+    /* Local variable */
+    t_eFSP_MSGE_Ctx l_tCtx;
+    uint8_t  l_auMemArea[40u];
+    uint8_t  l_auEncArea[60u];
+    f_eFSP_MSGE_CrcCb l_fCrcTest = &eFSP_MSGETST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    uint32_t l_uVar32;
+    uint32_t l_uI;
+    uint8_t* l_puData;
+
+    /* Function */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea), l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 1  -- FAIL \n");
+    }
+
+    if( EFSP_FEC_NONE == l_tCtx.uFecL )
+    {
+        (void)printf("eFSP_MSGETST_Fec 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPOINTER == eFSP_MSGE_SetFec(NULL, EFSP_FEC_RS4) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetFec(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetFec(&l_tCtx, EFSP_FEC_MAXPAR + 1u) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFec(&l_tCtx, EFSP_FEC_RS4) )
+    {
+        if( EFSP_FEC_RS4 == l_tCtx.uFecL )
+        {
+            (void)printf("eFSP_MSGETST_Fec 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Fec 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 7  -- FAIL \n");
+    }
+
+
+    /* The payload leave space for the parity */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( ( &l_auMemArea[1u] == l_puData ) && ( 31u == l_uVar32 ) )
+        {
+            (void)printf("eFSP_MSGETST_Fec 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Fec 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_NewMessage(&l_tCtx, 32u) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 9  -- FAIL \n");
+    }
+
+
+    /* The parity follow the message */
+    l_puData[0u] = 0x10u;
+    l_puData[1u] = 0x11u;
+    l_puData[2u] = 0x12u;
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 10u == l_uVar32 ) && ( 0x03u == l_auEncArea[1u] ) && ( 0x12u == l_auEncArea[4u] ) && ( 0xA6u == l_auEncArea[5u] ) && ( 0x9Cu == l_auEncArea[6u] ) && ( 0xA6u == l_auEncArea[7u] ) && ( 0x8Cu == l_auEncArea[8u] ) && ( ECU_EOF == l_auEncArea[9u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Fec 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Fec 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( 10u == l_uVar32 ) && ( 0x03u == l_auEncArea[1u] ) && ( 0x12u == l_auEncArea[4u] ) && ( 0xA6u == l_auEncArea[5u] ) && ( 0x9Cu == l_auEncArea[6u] ) && ( 0xA6u == l_auEncArea[7u] ) && ( 0x8Cu == l_auEncArea[8u] ) && ( ECU_EOF == l_auEncArea[9u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Fec 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Fec 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 13 -- FAIL \n");
+    }
+
+
+    /* The biggest payload */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 14 -- FAIL \n");
+    }
+
+    for( l_uI = 0u; l_uI < 31u; l_uI++ )
+    {
+        l_puData[l_uI] = 0x00u;
+    }
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_NewMessage(&l_tCtx, 31u) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_MESSAGEENDED == eFSP_MSGE_GetEncChunk(&l_tCtx, l_auEncArea, sizeof(l_auEncArea), &l_uVar32) )
+    {
+        if( ( l_uVar32 >= 38u ) && ( 0x1Fu == l_auEncArea[1u] ) && ( ECU_EOF == l_auEncArea[l_uVar32 - 1u] ) )
+        {
+            (void)printf("eFSP_MSGETST_Fec 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Fec 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 16 -- FAIL \n");
+    }
+
+
+    /* A bigger header does not leave space for the payload and the parity */
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFec(&l_tCtx, EFSP_FEC_RS16) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        if( 23u == l_uVar32 )
+        {
+            (void)printf("eFSP_MSGETST_Fec 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGETST_Fec 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_InitCtx(&l_tCtx, l_auMemArea, EFSP_MIN_MSGEN_BUFFLEN, l_fCrcTest, &l_tCtxAdapterCrc) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetFec(&l_tCtx, EFSP_FEC_RS4) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFec(&l_tCtx, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRCNONE, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_OK == eFSP_MSGE_SetFec(&l_tCtx, EFSP_FEC_RS4) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_BADPARAM == eFSP_MSGE_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 24 -- FAIL \n");
+    }
+
+
+    /* Corrupted fec */
+    l_tCtx.uFecL = 3u;
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_GetWherePutData(&l_tCtx, &l_puData, &l_uVar32) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGE_RES_CORRUPTCTX == eFSP_MSGE_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGETST_Fec 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGETST_Fec 26 -- FAIL \n");
+    }
 }
\ No newline at end of file
@@ -0,0 +1,1916 @@
+/**
+ * @file       eFSP_TRSPTST.c
+ *
+ * @brief      Length delimited transparent framing test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TRSPTST.h"
+#include "eFSP_TRSP.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_TRSPTST_EncFrame(t_eFSP_TRSP_EncCtx* p_ptCtx, const uint32_t p_uFrameL, const uint32_t p_uHdrL,
+                                    uint8_t* p_puEnc, const uint32_t p_uEncL, const uint32_t p_uChunkL,
+                                    uint32_t* const p_puGetL);
+static e_eFSP_TRSP_RES eFSP_TRSPTST_DecFrame(t_eFSP_TRSP_DecCtx* p_ptCtx, const uint32_t p_uHdrL,
+                                             const uint32_t p_uRawL, const uint8_t* p_puEnc, const uint32_t p_uEncL,
+                                             const uint32_t p_uChunkL, uint32_t* const p_puUsedL);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_TRSPTST_BadPointer(void);
+static void eFSP_TRSPTST_BadInit(void);
+static void eFSP_TRSPTST_BadParamEntr(void);
+static void eFSP_TRSPTST_CorruptContext(void);
+static void eFSP_TRSPTST_Encode(void);
+static void eFSP_TRSPTST_Decode(void);
+static void eFSP_TRSPTST_DecodeErr(void);
+static void eFSP_TRSPTST_RoundTrip(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_TRSPTST_ExeTest(void)
+{
+	(void)printf("\n\nTRSP TEST START \n\n");
+
+    eFSP_TRSPTST_BadPointer();
+    eFSP_TRSPTST_BadInit();
+    eFSP_TRSPTST_BadParamEntr();
+    eFSP_TRSPTST_CorruptContext();
+    eFSP_TRSPTST_Encode();
+    eFSP_TRSPTST_Decode();
+    eFSP_TRSPTST_DecodeErr();
+    eFSP_TRSPTST_RoundTrip();
+
+    (void)printf("\n\nTRSP TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_TRSPTST_EncFrame(t_eFSP_TRSP_EncCtx* p_ptCtx, const uint32_t p_uFrameL, const uint32_t p_uHdrL,
+                             uint8_t* p_puEnc, const uint32_t p_uEncL, const uint32_t p_uChunkL,
+                             uint32_t* const p_puGetL)
+{
+    bool_t l_bRes;
+    e_eFSP_TRSP_RES l_eRes;
+    uint32_t l_uGetL;
+
+    /* Encode the frame placed in the memory area, p_uChunkL bytes at time */
+    *p_puGetL = 0u;
+    l_eRes = eFSP_TRSP_NewEncFrame(p_ptCtx, p_uFrameL, p_uHdrL);
+
+    while( ( e_eFSP_TRSP_RES_OK == l_eRes ) && ( *p_puGetL < p_uEncL ) )
+    {
+        l_uGetL = 0u;
+        if( p_uChunkL < ( p_uEncL - *p_puGetL ) )
+        {
+            l_eRes = eFSP_TRSP_GetEncChunk(p_ptCtx, &p_puEnc[*p_puGetL], p_uChunkL, &l_uGetL);
+        }
+        else
+        {
+            l_eRes = eFSP_TRSP_GetEncChunk(p_ptCtx, &p_puEnc[*p_puGetL], p_uEncL - *p_puGetL, &l_uGetL);
+        }
+        *p_puGetL += l_uGetL;
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == l_eRes )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+e_eFSP_TRSP_RES eFSP_TRSPTST_DecFrame(t_eFSP_TRSP_DecCtx* p_ptCtx, const uint32_t p_uHdrL, const uint32_t p_uRawL,
+                                      const uint8_t* p_puEnc, const uint32_t p_uEncL, const uint32_t p_uChunkL,
+                                      uint32_t* const p_puUsedL)
+{
+    e_eFSP_TRSP_RES l_eRes;
+    uint32_t l_uUsedL;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Decode p_uChunkL bytes at time, the header has a fixed size */
+    *p_puUsedL = 0u;
+    l_eRes = eFSP_TRSP_NewDecFrame(p_ptCtx);
+
+    while( ( ( e_eFSP_TRSP_RES_OK == l_eRes ) || ( e_eFSP_TRSP_RES_NEEDLEN == l_eRes ) ) && ( *p_puUsedL < p_uEncL ) )
+    {
+        l_uUsedL = 0u;
+        if( p_uChunkL < ( p_uEncL - *p_puUsedL ) )
+        {
+            l_eRes = eFSP_TRSP_InsEncChunk(p_ptCtx, &p_puEnc[*p_puUsedL], p_uChunkL, &l_uUsedL);
+        }
+        else
+        {
+            l_eRes = eFSP_TRSP_InsEncChunk(p_ptCtx, &p_puEnc[*p_puUsedL], p_uEncL - *p_puUsedL, &l_uUsedL);
+        }
+        *p_puUsedL += l_uUsedL;
+
+        if( ( e_eFSP_TRSP_RES_NEEDLEN == l_eRes ) &&
+            ( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(p_ptCtx, &l_puData, &l_uDataL) ) )
+        {
+            if( l_uDataL < p_uHdrL )
+            {
+                l_eRes = eFSP_TRSP_SetDecHdrL(p_ptCtx, p_uHdrL);
+            }
+            else
+            {
+                l_eRes = eFSP_TRSP_SetDecRawL(p_ptCtx, p_uRawL);
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_TRSPTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_EncCtx l_tEnc;
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bVal1;
+    bool_t l_bVal2;
+    bool_t l_bVal3;
+
+    /* Function */
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InitEncCtx(NULL, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InitEncCtx(&l_tEnc, NULL, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_NewEncFrame(NULL, 1u, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_RestartEncFrame(NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetEncRemL(NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetEncRemL(&l_tEnc, NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetEncChunk(NULL, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetEncChunk(&l_tEnc, NULL, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auMem, sizeof(l_auMem), NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InitDecCtx(NULL, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InitDecCtx(&l_tDec, NULL, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_NewDecFrame(NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecData(NULL, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecData(&l_tDec, NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecState(NULL, &l_bVal1, &l_bVal2, &l_bVal3) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecState(&l_tDec, NULL, &l_bVal2, &l_bVal3) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecState(&l_tDec, &l_bVal1, NULL, &l_bVal3) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_GetDecState(&l_tDec, &l_bVal1, &l_bVal2, NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_SetDecHdrL(NULL, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_SetDecRawL(NULL, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InsEncChunk(NULL, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InsEncChunk(&l_tDec, NULL, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPOINTER == eFSP_TRSP_InsEncChunk(&l_tDec, l_auMem, sizeof(l_auMem), NULL) )
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadPointer 24 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_EncCtx l_tEnc;
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bVal1;
+    bool_t l_bVal2;
+    bool_t l_bVal3;
+
+    /* Init only the coherent part of the context */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 2  -- FAIL \n");
+    }
+
+    l_tEnc.bIsInit = false;
+    l_tDec.bIsInit = false;
+
+    /* Function */
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_NewEncFrame(&l_tEnc, 1u, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_GetDecState(&l_tDec, &l_bVal1, &l_bVal2, &l_bVal3) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_SetDecHdrL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_SetDecRawL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITLIB == eFSP_TRSP_InsEncChunk(&l_tDec, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 12 -- FAIL \n");
+    }
+
+
+    /* A frame must be started before getting it */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITFRAME == eFSP_TRSP_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITFRAME == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NOINITFRAME == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadInit 16 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_EncCtx l_tEnc;
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t  l_auEnc[10u];
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_NewEncFrame(&l_tEnc, 0u, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_NewEncFrame(&l_tEnc, sizeof(l_auMem) + 1u, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_NewEncFrame(&l_tEnc, 4u, 5u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewEncFrame(&l_tEnc, sizeof(l_auMem), sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auEnc, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_InsEncChunk(&l_tDec, l_auEnc, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 10 -- FAIL \n");
+    }
+
+
+    /* The lengths can be set only when requested */
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_SetDecHdrL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_SetDecRawL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 12 -- FAIL \n");
+    }
+
+    l_auEnc[0u] = EFSP_TRSP_SYNC1;
+    l_auEnc[1u] = EFSP_TRSP_SYNC2;
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, l_auEnc, 2u, &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_BadParamEntr 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_BadParamEntr 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADPARAM == eFSP_TRSP_SetDecHdrL(&l_tDec, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_BadParamEntr 14 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_EncCtx l_tEnc;
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint32_t l_uVal;
+
+    /* Function */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    l_tEnc.puBuff = NULL;
+    if( e_eFSP_TRSP_RES_CORRUPTCTX == eFSP_TRSP_NewEncFrame(&l_tEnc, 1u, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 2  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewEncFrame(&l_tEnc, 5u, 2u) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 4  -- FAIL \n");
+    }
+
+    l_tEnc.uCntr = 6u;
+    if( e_eFSP_TRSP_RES_CORRUPTCTX == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 5  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewEncFrame(&l_tEnc, 5u, 2u) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 7  -- FAIL \n");
+    }
+
+    l_tEnc.uHdrL = 6u;
+    if( e_eFSP_TRSP_RES_CORRUPTCTX == eFSP_TRSP_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 8  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 9  -- FAIL \n");
+    }
+
+    l_tDec.uCntr = sizeof(l_auMem) + 1u;
+    if( e_eFSP_TRSP_RES_CORRUPTCTX == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 10 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 11 -- FAIL \n");
+    }
+
+    l_tDec.uCntr = 4u;
+    l_tDec.uRawL = 7u;
+    if( e_eFSP_TRSP_RES_CORRUPTCTX == eFSP_TRSP_SetDecRawL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 12 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 13 -- FAIL \n");
+    }
+
+    l_tDec.eSt = (e_eFSP_TRSP_DECSM)( e_eFSP_TRSP_DECSM_BAD + 1 );
+    if( e_eFSP_TRSP_RES_CORRUPTCTX == eFSP_TRSP_InsEncChunk(&l_tDec, l_auMem, sizeof(l_auMem), &l_uVal) )
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_CorruptContext 14 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_Encode(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_EncCtx l_tEnc;
+    uint8_t  l_auMem[300u];
+    uint8_t  l_auEnc[320u];
+    uint32_t l_uVal;
+    uint32_t l_uI;
+    bool_t l_bIsOk;
+
+    /* Only the sync and the escape byte of the header are escaped */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 1  -- FAIL \n");
+    }
+
+    l_auMem[0u] = 0x11u;
+    l_auMem[1u] = EFSP_TRSP_SYNC1;
+    l_auMem[2u] = 0x22u;
+    l_auMem[3u] = EFSP_TRSP_ESC;
+    l_auMem[4u] = EFSP_TRSP_ESC;
+    l_auMem[5u] = EFSP_TRSP_SYNC1;
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewEncFrame(&l_tEnc, 6u, 4u) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 10u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auEnc, 5u, &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 4  -- FAIL \n");
+    }
+
+    if( ( EFSP_TRSP_SYNC1 == l_auEnc[0u] ) && ( EFSP_TRSP_SYNC2 == l_auEnc[1u] ) && ( 0x11u == l_auEnc[2u] ) && ( EFSP_TRSP_ESC == l_auEnc[3u] ) && ( 0xE3u == l_auEnc[4u] ) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auEnc, sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 7  -- FAIL \n");
+    }
+
+    if( ( 0x22u == l_auEnc[0u] ) && ( EFSP_TRSP_ESC == l_auEnc[1u] ) && ( 0x94u == l_auEnc[2u] ) && ( EFSP_TRSP_ESC == l_auEnc[3u] ) && ( EFSP_TRSP_SYNC1 == l_auEnc[4u] ) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == eFSP_TRSP_GetEncChunk(&l_tEnc, l_auEnc, sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 10 -- FAIL \n");
+    }
+
+
+    /* Restart from the sync sequence */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_RestartEncFrame(&l_tEnc) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetEncRemL(&l_tEnc, &l_uVal) )
+    {
+        if( 10u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 12 -- FAIL \n");
+    }
+
+    if( true == eFSP_TRSPTST_EncFrame(&l_tEnc, 6u, 4u, l_auEnc, sizeof(l_auEnc), 1u, &l_uVal) )
+    {
+        if( 10u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 13 -- FAIL \n");
+    }
+
+    if( ( EFSP_TRSP_SYNC1 == l_auEnc[0u] ) && ( 0xE3u == l_auEnc[4u] ) && ( 0x94u == l_auEnc[7u] ) && ( EFSP_TRSP_SYNC1 == l_auEnc[9u] ) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 14 -- FAIL \n");
+    }
+
+
+    /* Without header the frame is copied as it is */
+    if( true == eFSP_TRSPTST_EncFrame(&l_tEnc, 6u, 0u, l_auEnc, sizeof(l_auEnc), sizeof(l_auEnc), &l_uVal) )
+    {
+        if( 8u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Encode 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Encode 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 15 -- FAIL \n");
+    }
+
+    if( ( EFSP_TRSP_SYNC2 == l_auEnc[1u] ) && ( 0x11u == l_auEnc[2u] ) && ( EFSP_TRSP_SYNC1 == l_auEnc[3u] ) && ( EFSP_TRSP_SYNC1 == l_auEnc[7u] ) )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 16 -- FAIL \n");
+    }
+
+
+    /* Only the header adds overhead */
+    for( l_uI = 0u; l_uI < sizeof(l_auMem); l_uI++ )
+    {
+        l_auMem[l_uI] = EFSP_TRSP_SYNC1;
+    }
+    l_bIsOk = true;
+    for( l_uI = 1u; l_uI <= sizeof(l_auMem); l_uI++ )
+    {
+        if( ( true != eFSP_TRSPTST_EncFrame(&l_tEnc, l_uI, l_uI / 30u, l_auEnc, sizeof(l_auEnc), 13u, &l_uVal) ) ||
+            ( l_uVal != ( l_uI + EFSP_TRSP_SYNCL + ( l_uI / 30u ) ) ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+    if( true == l_bIsOk )
+    {
+        (void)printf("eFSP_TRSPTST_Encode 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Encode 17 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_Decode(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[10u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bWaitSync;
+    bool_t l_bEnded;
+    bool_t l_bBad;
+    uint8_t l_auEnc[] = { 0x55u, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x11u, EFSP_TRSP_ESC, 0xE3u, 0x22u,
+                          EFSP_TRSP_ESC, 0x94u, 0x33u, EFSP_TRSP_SYNC1, 0x66u };
+    uint8_t l_auFalse[] = { EFSP_TRSP_SYNC1, 0x11u, EFSP_TRSP_SYNC2, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x44u };
+
+    /* Byte before the sync sequence are discarded */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecState(&l_tDec, &l_bWaitSync, &l_bEnded, &l_bBad) )
+    {
+        if( ( true == l_bWaitSync ) && ( false == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InsEncChunk(&l_tDec, l_auEnc, 3u, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecState(&l_tDec, &l_bWaitSync, &l_bEnded, &l_bBad) )
+    {
+        if( ( true == l_bWaitSync ) && ( false == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[3u], 10u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecState(&l_tDec, &l_bWaitSync, &l_bEnded, &l_bBad) )
+    {
+        if( ( false == l_bWaitSync ) && ( false == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[4u], 9u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 7  -- FAIL \n");
+    }
+
+
+    /* The header is decoded and then the raw part */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecHdrL(&l_tDec, 2u) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[4u], 9u, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( l_auMem == l_puData ) && ( 2u == l_uVal ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecHdrL(&l_tDec, 4u) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[7u], 6u, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecRawL(&l_tDec, 2u) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[10u], 1u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[11u], 2u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecState(&l_tDec, &l_bWaitSync, &l_bEnded, &l_bBad) )
+    {
+        if( ( false == l_bWaitSync ) && ( true == l_bEnded ) && ( false == l_bBad ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( 6u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 17 -- FAIL \n");
+    }
+
+    if( ( 0x11u == l_auMem[0u] ) && ( EFSP_TRSP_SYNC1 == l_auMem[1u] ) && ( 0x22u == l_auMem[2u] ) && ( EFSP_TRSP_ESC == l_auMem[3u] ) && ( 0x33u == l_auMem[4u] ) && ( EFSP_TRSP_SYNC1 == l_auMem[5u] ) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auEnc[12u], 1u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 19 -- FAIL \n");
+    }
+
+
+    /* Half a sync sequence is discarded */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, l_auFalse, sizeof(l_auFalse), &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 21 -- FAIL \n");
+    }
+
+
+    /* A frame without raw part */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecHdrL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auFalse[5u], 1u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 23 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 23 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == eFSP_TRSP_SetDecRawL(&l_tDec, 0u) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( 1u == l_uVal ) && ( 0x44u == l_puData[0u] ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 25 -- FAIL \n");
+    }
+
+
+    /* A new frame keeps the old data, so it can be searched again */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_Decode 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( 0u == l_uVal ) && ( 0x44u == l_auMem[0u] ) )
+        {
+            (void)printf("eFSP_TRSPTST_Decode 27 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_Decode 27 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_Decode 27 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_DecodeErr(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[4u];
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    bool_t l_bWaitSync;
+    bool_t l_bEnded;
+    bool_t l_bBad;
+    uint8_t l_auRestart[] = { EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x11u, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x22u };
+    uint8_t l_auRawSync[] = { EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x11u, EFSP_TRSP_SYNC1, EFSP_TRSP_SYNC2, 0x22u };
+
+    /* A sync inside the header start a new frame */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, l_auRestart, sizeof(l_auRestart), &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecHdrL(&l_tDec, 2u) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMERESTART == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRestart[2u], 4u, &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRestart[4u], 2u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 6  -- FAIL \n");
+    }
+
+
+    /* A sync inside the raw part is data */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, l_auRawSync, sizeof(l_auRawSync), &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecHdrL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRawSync[2u], 4u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecRawL(&l_tDec, 3u) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_FRAMEENDED == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRawSync[3u], 3u, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uVal) )
+    {
+        if( ( 4u == l_uVal ) && ( EFSP_TRSP_SYNC1 == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 13 -- FAIL \n");
+    }
+
+
+    /* Header bigger than the memory area */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, l_auRawSync, sizeof(l_auRawSync), &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OUTOFMEM == eFSP_TRSP_SetDecHdrL(&l_tDec, sizeof(l_auMem) + 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_GetDecState(&l_tDec, &l_bWaitSync, &l_bEnded, &l_bBad) )
+    {
+        if( ( false == l_bWaitSync ) && ( false == l_bEnded ) && ( true == l_bBad ) )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADFRAME == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRawSync[2u], 4u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 18 -- FAIL \n");
+    }
+
+
+    /* Raw part bigger than the memory area */
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_NewDecFrame(&l_tDec) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, l_auRawSync, sizeof(l_auRawSync), &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_SetDecHdrL(&l_tDec, 1u) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_NEEDLEN == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRawSync[2u], 4u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OUTOFMEM == eFSP_TRSP_SetDecRawL(&l_tDec, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_BADFRAME == eFSP_TRSP_InsEncChunk(&l_tDec, &l_auRawSync[3u], 3u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TRSPTST_DecodeErr 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_DecodeErr 24 -- FAIL \n");
+    }
+}
+
+void eFSP_TRSPTST_RoundTrip(void)
+{
+    /* Local variable */
+    t_eFSP_TRSP_EncCtx l_tEnc;
+    t_eFSP_TRSP_DecCtx l_tDec;
+    uint8_t  l_auMem[600u];
+    uint8_t  l_auEnc[620u];
+    uint8_t  l_auDec[600u];
+    uint8_t* l_puData;
+    uint32_t l_uEncL;
+    uint32_t l_uUsedL;
+    uint32_t l_uDecL;
+    uint32_t l_uHdrL;
+    uint32_t l_uSeed;
+    uint32_t l_uL;
+    uint32_t l_uI;
+    uint32_t l_uErrN;
+
+    /* Random frames, with many sync and escape bytes, are encoded and decoded a few bytes at time */
+    l_uErrN = 0u;
+    l_uSeed = 0x12345678u;
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitEncCtx(&l_tEnc, l_auMem, sizeof(l_auMem)) )
+    {
+        (void)printf("eFSP_TRSPTST_RoundTrip 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_RoundTrip 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TRSP_RES_OK == eFSP_TRSP_InitDecCtx(&l_tDec, l_auDec, sizeof(l_auDec)) )
+    {
+        (void)printf("eFSP_TRSPTST_RoundTrip 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_RoundTrip 2  -- FAIL \n");
+    }
+
+
+    for( l_uL = 1u; l_uL <= sizeof(l_auMem); l_uL += 7u )
+    {
+        for( l_uI = 0u; l_uI < l_uL; l_uI++ )
+        {
+            l_uSeed = ( l_uSeed * 1103515245u ) + 12345u;
+            if( 0u == ( ( l_uSeed >> 16u ) % 4u ) )
+            {
+                l_auMem[l_uI] = EFSP_TRSP_SYNC1;
+            }
+            else if( 1u == ( ( l_uSeed >> 16u ) % 4u ) )
+            {
+                l_auMem[l_uI] = EFSP_TRSP_ESC;
+            }
+            else
+            {
+                l_auMem[l_uI] = (uint8_t)( l_uSeed >> 16u );
+            }
+        }
+        l_uHdrL = ( l_uL % 9u ) + 1u;
+        if( l_uHdrL > l_uL )
+        {
+            l_uHdrL = l_uL;
+        }
+
+        if( true != eFSP_TRSPTST_EncFrame(&l_tEnc, l_uL, l_uHdrL, l_auEnc, sizeof(l_auEnc), 11u, &l_uEncL) )
+        {
+            l_uErrN++;
+        }
+        else if( ( e_eFSP_TRSP_RES_FRAMEENDED != eFSP_TRSPTST_DecFrame(&l_tDec, l_uHdrL, l_uL - l_uHdrL, l_auEnc,
+                                                                       l_uEncL, 5u, &l_uUsedL) ) ||
+                 ( l_uEncL != l_uUsedL ) ||
+                 ( e_eFSP_TRSP_RES_OK != eFSP_TRSP_GetDecData(&l_tDec, &l_puData, &l_uDecL) ) || ( l_uL != l_uDecL ) ||
+                 ( 0 != memcmp(l_auMem, l_puData, l_uL) ) )
+        {
+            l_uErrN++;
+        }
+        else
+        {
+            /* Frame ok */
+        }
+    }
+
+    if( 0u == l_uErrN )
+    {
+        (void)printf("eFSP_TRSPTST_RoundTrip 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TRSPTST_RoundTrip 3  -- FAIL \n");
+    }
+}
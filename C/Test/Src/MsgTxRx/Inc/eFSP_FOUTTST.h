@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_FOUTTST.h
+ *
+ * @brief      Encode once fan-out test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_FOUTTST_H
+#define EFSP_FOUTTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the encode once fan-out module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_FOUTTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_FOUTTST_H */
\ No newline at end of file
@@ -0,0 +1,2406 @@
+/**
+ * @file       eFSP_FOUTTST.c
+ *
+ * @brief      Encode once fan-out test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_FOUTTST.h"
+#include "eFSP_FOUT.h"
+#include "eFSP_MSGTX.h"
+#include "eCU_CRC.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_FOUTTST_MEMSIZE                                            ( 64u )
+#define EFSP_FOUTTST_FRAMESIZE                                          ( 128u )
+#define EFSP_FOUTTST_LINESIZE                                           ( 256u )
+#define EFSP_FOUTTST_TXBUFFSIZE                                         ( 16u )
+#define EFSP_FOUTTST_RINGSIZE                                           ( 16u )
+#define EFSP_FOUTTST_PAYL                                               ( 40u )
+#define EFSP_FOUTTST_MAXLOOP                                            ( 200u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST STRUCT DECLARATION
+ **********************************************************************************************************************/
+struct t_eFSP_MSGE_CrcCtxUser
+{
+    e_eCU_CRC_RES eLastEr;
+    uint32_t uCallN;
+};
+
+/* Every link write on its own line */
+struct t_eFSP_MSGTX_TxCtxUser
+{
+    uint8_t  auLine[EFSP_FOUTTST_LINESIZE];
+    uint32_t uLineL;
+};
+
+struct t_eFSP_MSGTX_TimCtxUser
+{
+    uint32_t uTimRemainingT;
+};
+
+struct t_eFSP_MSGTX_EvtCtxUser
+{
+    uint32_t uEvtCnt;
+    e_eFSP_MSGTX_RES eLastEvt;
+};
+
+typedef struct
+{
+    t_eFSP_MSGTX_Ctx    tMsgTx;
+    t_eFSP_MSGE_CrcCtx  tCrc;
+    t_eFSP_MSGTX_TxCtx  tTx;
+    t_eFSP_MSGTX_TimCtx tTim;
+    uint8_t             auMem[EFSP_FOUTTST_MEMSIZE];
+    uint8_t             auTxBuff[EFSP_FOUTTST_TXBUFFSIZE];
+}t_eFSP_FOUTTST_Link;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST VARIABLE DECLARATION
+ **********************************************************************************************************************/
+static t_eFSP_MSGE_CrcCtx m_tFoutCrc;
+static uint8_t m_auFoutMem[EFSP_FOUTTST_MEMSIZE];
+static uint8_t m_auFoutFrame[EFSP_FOUTTST_FRAMESIZE];
+static t_eFSP_FOUTTST_Link m_tLinkA;
+static t_eFSP_FOUTTST_Link m_tLinkB;
+static t_eFSP_FOUTTST_Link m_tLinkC;
+static t_eFSP_FOUTTST_Link m_tLinkRef;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_FOUTTST_c32SAdapt(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD,
+                                     const uint32_t p_uDLen, uint32_t* const p_puC32Val);
+static bool_t eFSP_FOUTTST_sendMsg(t_eFSP_MSGTX_TxCtx* p_ptCtx, const uint8_t* p_puDataToTx,
+                                   const uint32_t p_uDataToTxL, uint32_t* const p_uDataTxed,
+                                   const uint32_t p_uTimeToTx);
+static bool_t eFSP_FOUTTST_timStart(t_eFSP_MSGTX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal);
+static bool_t eFSP_FOUTTST_timGetRemaining(t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings);
+static void eFSP_FOUTTST_evtCb(t_eFSP_MSGTX_EvtCtx* p_ptCtx, const e_eFSP_MSGTX_RES p_eEvt);
+
+static e_eFSP_FOUT_RES eFSP_FOUTTST_InitFout(t_eFSP_FOUT_Ctx* p_ptCtx, const uint32_t p_uFrameAreaL);
+static bool_t eFSP_FOUTTST_InitLink(t_eFSP_FOUTTST_Link* p_ptLink, const uint32_t p_uTxBuffL);
+static void eFSP_FOUTTST_LoadPayload(uint8_t* p_puData, const uint32_t p_uDataL, const uint32_t p_uSeed);
+static e_eFSP_FOUT_RES eFSP_FOUTTST_NewFoutMsg(t_eFSP_FOUT_Ctx* p_ptCtx, const uint32_t p_uMsgL,
+                                               const uint32_t p_uSeed);
+static bool_t eFSP_FOUTTST_SendRef(const uint32_t p_uMsgL, const uint32_t p_uSeed);
+static e_eFSP_MSGTX_RES eFSP_FOUTTST_DrainChunk(t_eFSP_FOUTTST_Link* p_ptLink);
+static e_eFSP_MSGTX_RES eFSP_FOUTTST_DrainEvent(t_eFSP_FOUTTST_Link* p_ptLink, const uint32_t p_uMaxStepL);
+static e_eFSP_MSGTX_RES eFSP_FOUTTST_DrainRing(t_eFSP_FOUTTST_Link* p_ptLink, t_eFSP_SPSCR_Ctx* p_ptRing);
+static bool_t eFSP_FOUTTST_IsSameLine(const t_eFSP_FOUTTST_Link* p_ptLink, const t_eFSP_FOUTTST_Link* p_ptRef);
+static uint32_t eFSP_FOUTTST_GetRefN(t_eFSP_FOUT_Ctx* p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_FOUTTST_BadPointer(void);
+static void eFSP_FOUTTST_BadInit(void);
+static void eFSP_FOUTTST_BadParamEntr(void);
+static void eFSP_FOUTTST_CorruptContext(void);
+static void eFSP_FOUTTST_General(void);
+static void eFSP_FOUTTST_Restart(void);
+static void eFSP_FOUTTST_OutOfMem(void);
+static void eFSP_FOUTTST_Credit(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_FOUTTST_ExeTest(void)
+{
+	(void)printf("\n\nFOUT TEST START \n\n");
+
+    eFSP_FOUTTST_BadPointer();
+    eFSP_FOUTTST_BadInit();
+    eFSP_FOUTTST_BadParamEntr();
+    eFSP_FOUTTST_CorruptContext();
+    eFSP_FOUTTST_General();
+    eFSP_FOUTTST_Restart();
+    eFSP_FOUTTST_OutOfMem();
+    eFSP_FOUTTST_Credit();
+
+    (void)printf("\n\nFOUT TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_FOUTTST_c32SAdapt(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD,
+                              const uint32_t p_uDLen, uint32_t* const p_puC32Val)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puC32Val ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uCallN++;
+        p_ptCtx->eLastEr = eCU_CRC_32Seed(p_uS, (const uint8_t*)p_puD, p_uDLen, p_puC32Val);
+        if( e_eCU_CRC_RES_OK == p_ptCtx->eLastEr )
+        {
+            l_bRes = true;
+        }
+        else
+        {
+            l_bRes = false;
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_FOUTTST_sendMsg(t_eFSP_MSGTX_TxCtx* p_ptCtx, const uint8_t* p_puDataToTx, const uint32_t p_uDataToTxL,
+                            uint32_t* const p_uDataTxed, const uint32_t p_uTimeToTx)
+{
+    bool_t l_bRes;
+    uint32_t l_uIdx;
+
+    (void)p_uTimeToTx;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToTx ) || ( NULL == p_uDataTxed ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( EFSP_FOUTTST_LINESIZE - p_ptCtx->uLineL ) < p_uDataToTxL )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        for( l_uIdx = 0u; l_uIdx < p_uDataToTxL; l_uIdx++ )
+        {
+            p_ptCtx->auLine[p_ptCtx->uLineL] = p_puDataToTx[l_uIdx];
+            p_ptCtx->uLineL++;
+        }
+
+        *p_uDataTxed = p_uDataToTxL;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_FOUTTST_timStart(t_eFSP_MSGTX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimRemainingT = p_uTimeoutVal;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_FOUTTST_timGetRemaining(t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puRemainings ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_ptCtx->uTimRemainingT > 0u )
+        {
+            p_ptCtx->uTimRemainingT--;
+        }
+
+        *p_puRemainings = p_ptCtx->uTimRemainingT;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+void eFSP_FOUTTST_evtCb(t_eFSP_MSGTX_EvtCtx* p_ptCtx, const e_eFSP_MSGTX_RES p_eEvt)
+{
+    if( NULL != p_ptCtx )
+    {
+        p_ptCtx->uEvtCnt++;
+        p_ptCtx->eLastEvt = p_eEvt;
+    }
+}
+
+e_eFSP_FOUT_RES eFSP_FOUTTST_InitFout(t_eFSP_FOUT_Ctx* p_ptCtx, const uint32_t p_uFrameAreaL)
+{
+    t_eFSP_FOUT_InitData l_tInitData;
+
+    (void)memset(&m_tFoutCrc, 0, sizeof(m_tFoutCrc));
+    (void)memset(&m_auFoutFrame, 0, sizeof(m_auFoutFrame));
+
+    l_tInitData.puIMemArea = m_auFoutMem;
+    l_tInitData.uIMemAreaL = sizeof(m_auFoutMem);
+    l_tInitData.puIFrameArea = m_auFoutFrame;
+    l_tInitData.uIFrameAreaL = p_uFrameAreaL;
+    l_tInitData.fICrc = &eFSP_FOUTTST_c32SAdapt;
+    l_tInitData.ptICbCrcCtx = &m_tFoutCrc;
+
+    return eFSP_FOUT_InitCtx(p_ptCtx, &l_tInitData);
+}
+
+bool_t eFSP_FOUTTST_InitLink(t_eFSP_FOUTTST_Link* p_ptLink, const uint32_t p_uTxBuffL)
+{
+    t_eFSP_MSGTX_InitData l_tInitData;
+
+    (void)memset(p_ptLink, 0, sizeof(t_eFSP_FOUTTST_Link));
+
+    l_tInitData.puIMemArea = p_ptLink->auMem;
+    l_tInitData.uIMemAreaL = sizeof(p_ptLink->auMem);
+    l_tInitData.puITxBuffArea = p_ptLink->auTxBuff;
+    l_tInitData.uITxBuffAreaL = p_uTxBuffL;
+    l_tInitData.fICrc = &eFSP_FOUTTST_c32SAdapt;
+    l_tInitData.ptICbCrcCtx = &p_ptLink->tCrc;
+    l_tInitData.fITx = &eFSP_FOUTTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &p_ptLink->tTx;
+    l_tInitData.tITxTim.ptTimCtx = &p_ptLink->tTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_FOUTTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_FOUTTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    return ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&p_ptLink->tMsgTx, &l_tInitData) );
+}
+
+void eFSP_FOUTTST_LoadPayload(uint8_t* p_puData, const uint32_t p_uDataL, const uint32_t p_uSeed)
+{
+    uint32_t l_uIdx;
+
+    /* The pattern pass on every byte value, so the frame contains escaped bytes too */
+    for( l_uIdx = 0u; l_uIdx < p_uDataL; l_uIdx++ )
+    {
+        p_puData[l_uIdx] = (uint8_t)( ( l_uIdx * 37u ) + p_uSeed );
+    }
+}
+
+e_eFSP_FOUT_RES eFSP_FOUTTST_NewFoutMsg(t_eFSP_FOUT_Ctx* p_ptCtx, const uint32_t p_uMsgL, const uint32_t p_uSeed)
+{
+    e_eFSP_FOUT_RES l_eRes;
+    uint8_t* l_puData;
+    uint32_t l_uMaxL;
+
+    l_puData = NULL;
+    l_uMaxL = 0u;
+    l_eRes = eFSP_FOUT_GetWherePutData(p_ptCtx, &l_puData, &l_uMaxL);
+
+    if( ( e_eFSP_FOUT_RES_OK == l_eRes ) && ( l_uMaxL >= p_uMsgL ) )
+    {
+        eFSP_FOUTTST_LoadPayload(l_puData, p_uMsgL, p_uSeed);
+        l_eRes = eFSP_FOUT_NewMessage(p_ptCtx, p_uMsgL);
+    }
+
+    return l_eRes;
+}
+
+bool_t eFSP_FOUTTST_SendRef(const uint32_t p_uMsgL, const uint32_t p_uSeed)
+{
+    bool_t l_bRes;
+    uint8_t* l_puData;
+    uint32_t l_uMaxL;
+
+    /* Same payload encoded and sent by a plain transmitter */
+    l_bRes = eFSP_FOUTTST_InitLink(&m_tLinkRef, EFSP_FOUTTST_TXBUFFSIZE);
+    l_puData = NULL;
+    l_uMaxL = 0u;
+
+    if( ( true == l_bRes ) &&
+        ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetWherePutData(&m_tLinkRef.tMsgTx, &l_puData, &l_uMaxL) ) &&
+        ( l_uMaxL >= p_uMsgL ) )
+    {
+        eFSP_FOUTTST_LoadPayload(l_puData, p_uMsgL, p_uSeed);
+        l_bRes = ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&m_tLinkRef.tMsgTx, p_uMsgL) ) &&
+                 ( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkRef) );
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_FOUTTST_DrainChunk(t_eFSP_FOUTTST_Link* p_ptLink)
+{
+    e_eFSP_MSGTX_RES l_eRes;
+    uint32_t l_uLoop;
+
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    l_uLoop = 0u;
+    while( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( l_uLoop < EFSP_FOUTTST_MAXLOOP ) )
+    {
+        l_eRes = eFSP_MSGTX_SendChunk(&p_ptLink->tMsgTx);
+        l_uLoop++;
+    }
+
+    return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_FOUTTST_DrainEvent(t_eFSP_FOUTTST_Link* p_ptLink, const uint32_t p_uMaxStepL)
+{
+    e_eFSP_MSGTX_RES l_eRes;
+    const uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uLoop;
+    uint32_t l_uIdx;
+
+    /* The driver write at most p_uMaxStepL bytes every time */
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    l_uLoop = 0u;
+    while( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( l_uLoop < EFSP_FOUTTST_MAXLOOP ) )
+    {
+        l_puData = NULL;
+        l_uDataL = 0u;
+        l_eRes = eFSP_MSGTX_GetChunkToSend(&p_ptLink->tMsgTx, &l_puData, &l_uDataL);
+
+        if( e_eFSP_MSGTX_RES_OK == l_eRes )
+        {
+            if( l_uDataL > p_uMaxStepL )
+            {
+                l_uDataL = p_uMaxStepL;
+            }
+
+            for( l_uIdx = 0u; ( l_uIdx < l_uDataL ) && ( p_ptLink->tTx.uLineL < EFSP_FOUTTST_LINESIZE ); l_uIdx++ )
+            {
+                p_ptLink->tTx.auLine[p_ptLink->tTx.uLineL] = l_puData[l_uIdx];
+                p_ptLink->tTx.uLineL++;
+            }
+
+            l_eRes = eFSP_MSGTX_NotifySent(&p_ptLink->tMsgTx, l_uDataL);
+        }
+
+        l_uLoop++;
+    }
+
+    return l_eRes;
+}
+
+e_eFSP_MSGTX_RES eFSP_FOUTTST_DrainRing(t_eFSP_FOUTTST_Link* p_ptLink, t_eFSP_SPSCR_Ctx* p_ptRing)
+{
+    e_eFSP_MSGTX_RES l_eRes;
+    uint8_t* l_puSpan;
+    uint32_t l_uSpanL;
+    uint32_t l_uLoop;
+    uint32_t l_uIdx;
+    bool_t l_bEnd;
+
+    /* The consumer empty the ring after every top up, and after the end of the frame */
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    l_bEnd = false;
+    l_uLoop = 0u;
+    while( ( false == l_bEnd ) && ( l_uLoop < EFSP_FOUTTST_MAXLOOP ) )
+    {
+        if( e_eFSP_MSGTX_RES_OK == l_eRes )
+        {
+            l_eRes = eFSP_MSGTX_SendChunk(&p_ptLink->tMsgTx);
+        }
+
+        l_puSpan = NULL;
+        l_uSpanL = 0u;
+        (void)eFSP_SPSCR_GetReadSpan(p_ptRing, &l_puSpan, &l_uSpanL);
+
+        if( l_uSpanL > 0u )
+        {
+            for( l_uIdx = 0u; ( l_uIdx < l_uSpanL ) && ( p_ptLink->tTx.uLineL < EFSP_FOUTTST_LINESIZE ); l_uIdx++ )
+            {
+                p_ptLink->tTx.auLine[p_ptLink->tTx.uLineL] = l_puSpan[l_uIdx];
+                p_ptLink->tTx.uLineL++;
+            }
+
+            (void)eFSP_SPSCR_Release(p_ptRing, l_uSpanL);
+        }
+        else if( e_eFSP_MSGTX_RES_OK != l_eRes )
+        {
+            l_bEnd = true;
+        }
+        else
+        {
+            /* Wait the next top up */
+        }
+
+        l_uLoop++;
+    }
+
+    return l_eRes;
+}
+
+bool_t eFSP_FOUTTST_IsSameLine(const t_eFSP_FOUTTST_Link* p_ptLink, const t_eFSP_FOUTTST_Link* p_ptRef)
+{
+    bool_t l_bRes;
+    uint32_t l_uIdx;
+
+    l_bRes = ( ( p_ptLink->tTx.uLineL == p_ptRef->tTx.uLineL ) && ( p_ptRef->tTx.uLineL > 0u ) );
+
+    for( l_uIdx = 0u; ( true == l_bRes ) && ( l_uIdx < p_ptRef->tTx.uLineL ); l_uIdx++ )
+    {
+        if( p_ptLink->tTx.auLine[l_uIdx] != p_ptRef->tTx.auLine[l_uIdx] )
+        {
+            l_bRes = false;
+        }
+    }
+
+    return l_bRes;
+}
+
+uint32_t eFSP_FOUTTST_GetRefN(t_eFSP_FOUT_Ctx* p_ptCtx)
+{
+    uint32_t l_uRefN;
+
+    /* An error is reported as a number of references that no test use */
+    l_uRefN = 0u;
+    if( e_eFSP_FOUT_RES_OK != eFSP_FOUT_GetRefN(p_ptCtx, &l_uRefN) )
+    {
+        l_uRefN = 0xFFFFFFFFu;
+    }
+
+    return l_uRefN;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_FOUTTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    t_eFSP_FOUT_InitData l_tInitData;
+    bool_t l_bIsInit;
+    uint8_t* l_puData;
+    const uint8_t* l_puFrame;
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    l_tInitData.puIMemArea = m_auFoutMem;
+    l_tInitData.uIMemAreaL = sizeof(m_auFoutMem);
+    l_tInitData.puIFrameArea = m_auFoutFrame;
+    l_tInitData.uIFrameAreaL = sizeof(m_auFoutFrame);
+    l_tInitData.fICrc = &eFSP_FOUTTST_c32SAdapt;
+    l_tInitData.ptICbCrcCtx = &m_tFoutCrc;
+
+    /* Function */
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_InitCtx(NULL, &l_tInitData) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_InitCtx(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 2  -- FAIL \n");
+    }
+
+
+    l_tInitData.puIFrameArea = NULL;
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 3  -- FAIL \n");
+    }
+
+
+    l_tInitData.puIFrameArea = m_auFoutFrame;
+    l_tInitData.puIMemArea = NULL;
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 4  -- FAIL \n");
+    }
+
+
+    l_tInitData.puIMemArea = m_auFoutMem;
+    l_tInitData.fICrc = NULL;
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 5  -- FAIL \n");
+    }
+
+
+    l_tInitData.fICrc = &eFSP_FOUTTST_c32SAdapt;
+    l_tInitData.ptICbCrcCtx = NULL;
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 6  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_SetHeader(NULL, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_SetFraming(NULL, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_SetWhitening(NULL, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_SetCompression(NULL, EFSP_HDR_CMPNONE) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_SetFec(NULL, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_GetWherePutData(NULL, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_GetWherePutData(&l_tCtx, NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_GetWherePutData(&l_tCtx, &l_puData, NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_NewMessage(NULL, 1u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_GetRefN(NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_GetRefN(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_Attach(NULL, &l_puFrame, &l_uVal, &l_uVal, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_Attach(&l_tCtx, NULL, &l_uVal, &l_uVal, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, NULL, &l_uVal, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uVal, NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uVal, &l_uVal, NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPOINTER == eFSP_FOUT_Detach(NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 25 -- FAIL \n");
+    }
+
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_NewShared(NULL, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 27 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, NULL) )
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadPointer 28 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    bool_t l_bIsInit;
+    uint8_t* l_puData;
+    const uint8_t* l_puFrame;
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    l_bIsInit = true;
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_FOUTTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_SetFraming(&l_tCtx, EFSP_FRM_ESC) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_SetWhitening(&l_tCtx, EFSP_HDR_WHTNONE) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_SetCompression(&l_tCtx, EFSP_HDR_CMPNONE) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_SetFec(&l_tCtx, EFSP_FEC_NONE) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_GetWherePutData(&l_tCtx, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_GetRefN(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uVal, &l_uVal, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITLIB == eFSP_FOUT_Detach(&l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 11 -- FAIL \n");
+    }
+
+
+    /* A transmitter can not use a fan-out that is not initialized */
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadInit 13 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    const uint8_t* l_puFrame;
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    if( e_eFSP_FOUT_RES_BADPARAM == eFSP_FOUTTST_InitFout(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPARAM == eFSP_FOUT_NewMessage(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPARAM == eFSP_FOUT_SetHeader(&l_tCtx, 3u, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPARAM == eFSP_FOUT_SetFraming(&l_tCtx, 0xFFu) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BADPARAM == eFSP_FOUT_Detach(&l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITMESSAGE == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uVal, &l_uVal, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+
+    /* No frame to send yet */
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOINITMESSAGE == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_BadParamEntr 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_BadParamEntr 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+    if( false == m_tLinkA.tMsgTx.bShHeld )
+    {
+        if( NULL == m_tLinkA.tMsgTx.ptFout )
+        {
+            (void)printf("eFSP_FOUTTST_BadParamEntr 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_BadParamEntr 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_BadParamEntr 10 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    const uint8_t* l_puFrame;
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    l_tCtx.puFrame = NULL;
+    if( e_eFSP_FOUT_RES_CORRUPTCTX == eFSP_FOUT_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_CORRUPTCTX == eFSP_FOUT_GetRefN(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 3  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 4  -- FAIL \n");
+    }
+
+    l_tCtx.uFrameL = sizeof(m_auFoutFrame) + 1u;
+    if( e_eFSP_FOUT_RES_CORRUPTCTX == eFSP_FOUT_SetHeader(&l_tCtx, EFSP_HDR_CRC32, EFSP_HDR_LEN32) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_CORRUPTCTX == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uVal, &l_uVal, &l_uVal) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 6  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 7  -- FAIL \n");
+    }
+
+    l_tCtx.uRefN = 1u;
+    if( e_eFSP_FOUT_RES_CORRUPTCTX == eFSP_FOUT_Detach(&l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 8  -- FAIL \n");
+    }
+
+
+    /* A transmitter can not use a corrupted fan-out */
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 10 -- FAIL \n");
+    }
+
+
+    /* A reference can not exist without its fan-out */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0u) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 13 -- FAIL \n");
+    }
+
+    m_tLinkA.tMsgTx.ptFout = NULL;
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SendChunk(&m_tLinkA.tMsgTx) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 14 -- FAIL \n");
+    }
+
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0u) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 18 -- FAIL \n");
+    }
+
+    m_tLinkA.tMsgTx.uShCntr = m_tLinkA.tMsgTx.uShFrameL + 1u;
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_RestartMessage(&m_tLinkA.tMsgTx) )
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_CorruptContext 19 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_General(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    t_eFSP_SPSCR_Ctx l_tRing;
+    t_eFSP_MSGTX_EvtCtx l_tEvt;
+    uint8_t l_auRingArea[EFSP_FOUTTST_RINGSIZE];
+    uint8_t* l_puData;
+    uint32_t l_uMaxL;
+    uint32_t l_uCrcN;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tRing, 0, sizeof(l_tRing));
+    (void)memset(&l_tEvt, 0, sizeof(l_tEvt));
+
+    /* Encode once */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_General 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 2  -- FAIL \n");
+    }
+
+    l_uCrcN = m_tFoutCrc.uCallN;
+    if( l_uCrcN > 0u )
+    {
+        (void)printf("eFSP_FOUTTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 3  -- FAIL \n");
+    }
+
+
+    /* Three links with different TX buffers and drivers */
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 4  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkB, 7u) )
+    {
+        (void)printf("eFSP_FOUTTST_General 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 5  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkC, 3u) )
+    {
+        (void)printf("eFSP_FOUTTST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_InitCtx(&l_tRing, l_auRingArea, sizeof(l_auRingArea)) )
+    {
+        (void)printf("eFSP_FOUTTST_General 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetRingDst(&m_tLinkC.tMsgTx, &l_tRing) )
+    {
+        (void)printf("eFSP_FOUTTST_General 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetEvtCb(&m_tLinkA.tMsgTx, &eFSP_FOUTTST_evtCb, &l_tEvt) )
+    {
+        (void)printf("eFSP_FOUTTST_General 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_General 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkB.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_General 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkC.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_General 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 12 -- FAIL \n");
+    }
+
+    if( 3u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_General 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 13 -- FAIL \n");
+    }
+
+
+    /* The next payload can be prepared, but the frame can not be replaced */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_GetWherePutData(&l_tCtx, &l_puData, &l_uMaxL) )
+    {
+        (void)printf("eFSP_FOUTTST_General 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_BUSY == eFSP_FOUT_NewMessage(&l_tCtx, EFSP_FOUTTST_PAYL) )
+    {
+        (void)printf("eFSP_FOUTTST_General 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 15 -- FAIL \n");
+    }
+
+
+    /* Every link drain the frame with its own cursor */
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkA) )
+    {
+        if( 2u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_General 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_General 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 16 -- FAIL \n");
+    }
+
+    if( 1u == l_tEvt.uEvtCnt )
+    {
+        if( e_eFSP_MSGTX_RES_MESSAGESENDED == l_tEvt.eLastEvt )
+        {
+            (void)printf("eFSP_FOUTTST_General 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_General 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainEvent(&m_tLinkB, 4u) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_General 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_General 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainRing(&m_tLinkC, &l_tRing) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_General 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_General 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_SendChunk(&m_tLinkA.tMsgTx) )
+    {
+        if( 1u == l_tEvt.uEvtCnt )
+        {
+            (void)printf("eFSP_FOUTTST_General 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_General 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 20 -- FAIL \n");
+    }
+
+
+    /* All the links sent the frame of a plain transmitter, and no CRC is calculated by them */
+    if( true == eFSP_FOUTTST_SendRef(EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_General 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 21 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkA, &m_tLinkRef) )
+    {
+        (void)printf("eFSP_FOUTTST_General 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 22 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkB, &m_tLinkRef) )
+    {
+        (void)printf("eFSP_FOUTTST_General 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 23 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkC, &m_tLinkRef) )
+    {
+        (void)printf("eFSP_FOUTTST_General 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 24 -- FAIL \n");
+    }
+
+    if( l_uCrcN == m_tFoutCrc.uCallN )
+    {
+        (void)printf("eFSP_FOUTTST_General 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 25 -- FAIL \n");
+    }
+
+    if( 0u == m_tLinkA.tCrc.uCallN )
+    {
+        if( 0u == m_tLinkB.tCrc.uCallN )
+        {
+            (void)printf("eFSP_FOUTTST_General 26 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_General 26 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 26 -- FAIL \n");
+    }
+
+    if( 0u == m_tLinkC.tCrc.uCallN )
+    {
+        (void)printf("eFSP_FOUTTST_General 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 27 -- FAIL \n");
+    }
+
+
+    /* Free again */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x11u) )
+    {
+        (void)printf("eFSP_FOUTTST_General 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_General 28 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_Restart(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    const uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint8_t* l_puPay;
+    uint32_t l_uMaxL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Restart in the middle of the frame keep the reference */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x20u) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 2  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_SendRef(EFSP_FOUTTST_PAYL, 0x20u) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 3  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 6u) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetChunkToSend(&m_tLinkA.tMsgTx, &l_puData, &l_uDataL) )
+    {
+        if( 6u == l_uDataL )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NotifySent(&m_tLinkA.tMsgTx, l_uDataL) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&m_tLinkA.tMsgTx) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainEvent(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 9  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkA, &m_tLinkRef) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 10 -- FAIL \n");
+    }
+
+
+    /* A timeout release the reference, a restart take it again if the frame is the same */
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkB, 4u) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkB.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 12 -- FAIL \n");
+    }
+
+    m_tLinkB.tTim.uTimRemainingT = 1u;
+    if( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == eFSP_MSGTX_CheckTimeout(&m_tLinkB.tMsgTx) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_GetChunkToSend(&m_tLinkB.tMsgTx, &l_puData, &l_uDataL) )
+    {
+        if( 0u == l_uDataL )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&m_tLinkB.tMsgTx) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkB) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 16 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkB, &m_tLinkRef) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 17 -- FAIL \n");
+    }
+
+
+    /* The frame is replaced, it can not be restarted anymore */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x21u) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOINITMESSAGE == eFSP_MSGTX_RestartMessage(&m_tLinkB.tMsgTx) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 19 -- FAIL \n");
+    }
+
+
+    /* A message encoded by the link release the shared frame, and can be restarted as before */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkB.tMsgTx, &l_tCtx) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetWherePutData(&m_tLinkB.tMsgTx, &l_puPay, &l_uMaxL) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 21 -- FAIL \n");
+    }
+
+    eFSP_FOUTTST_LoadPayload(l_puPay, EFSP_FOUTTST_PAYL, 0x20u);
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&m_tLinkB.tMsgTx, EFSP_FOUTTST_PAYL) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 22 -- FAIL \n");
+    }
+
+    m_tLinkB.tTx.uLineL = 0u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&m_tLinkB.tMsgTx) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkB) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 24 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkB, &m_tLinkRef) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 25 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 25 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 25 -- FAIL \n");
+    }
+
+
+    /* A new shared frame on the same fan-out keep a single reference */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkB.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_Restart 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkB.tMsgTx, &l_tCtx) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Restart 27 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Restart 27 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Restart 27 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_OutOfMem(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    const uint8_t* l_puFrame;
+    uint32_t l_uFrameL;
+    uint32_t l_uMsgL;
+    uint32_t l_uGen;
+    uint8_t* l_puPay;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    l_uFrameL = 0u;
+
+    /* Get the size of the frame */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uFrameL, &l_uMsgL, &l_uGen) )
+    {
+        if( EFSP_FOUTTST_PAYL == l_uMsgL )
+        {
+            (void)printf("eFSP_FOUTTST_OutOfMem 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_OutOfMem 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_Detach(&l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 4  -- FAIL \n");
+    }
+
+    if( ( l_uFrameL > EFSP_FOUTTST_PAYL ) && ( l_uFrameL <= sizeof(m_auFoutFrame) ) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 5  -- FAIL \n");
+    }
+
+
+    /* The frame area is one byte too small */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, l_uFrameL - 1u) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OUTOFMEM == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_NOINITMESSAGE == eFSP_FOUT_Attach(&l_tCtx, &l_puFrame, &l_uFrameL, &l_uMsgL, &l_uGen) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 8  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOINITMESSAGE == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 10 -- FAIL \n");
+    }
+
+
+    /* The frame area is exactly the frame */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, l_uFrameL) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkA) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 14 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_SendRef(EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 15 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkA, &m_tLinkRef) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 16 -- FAIL \n");
+    }
+
+
+    /* Other stages are done only once too */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_SetHeader(&l_tCtx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_SetFraming(&l_tCtx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_SetWhitening(&l_tCtx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_SetCompression(&l_tCtx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUT_SetFec(&l_tCtx, EFSP_FEC_RS4) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x7Bu) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 23 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkA) )
+    {
+        if( 0u == m_tLinkA.tCrc.uCallN )
+        {
+            (void)printf("eFSP_FOUTTST_OutOfMem 26 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_OutOfMem 26 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 26 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkRef, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 27 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetHeader(&m_tLinkRef.tMsgTx, EFSP_HDR_CRC16, EFSP_HDR_LEN8) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 28 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetFraming(&m_tLinkRef.tMsgTx, EFSP_FRM_COBS) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 29 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetWhitening(&m_tLinkRef.tMsgTx, EFSP_HDR_WHT) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 30 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCompression(&m_tLinkRef.tMsgTx, EFSP_HDR_CMP) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 31 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 31 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetFec(&m_tLinkRef.tMsgTx, EFSP_FEC_RS4) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 32 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 32 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetWherePutData(&m_tLinkRef.tMsgTx, &l_puPay, &l_uMsgL) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 33 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 33 -- FAIL \n");
+    }
+
+    eFSP_FOUTTST_LoadPayload(l_puPay, EFSP_FOUTTST_PAYL, 0x7Bu);
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&m_tLinkRef.tMsgTx, EFSP_FOUTTST_PAYL) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 34 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 34 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkRef) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 35 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 35 -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_IsSameLine(&m_tLinkA, &m_tLinkRef) )
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 36 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_OutOfMem 36 -- FAIL \n");
+    }
+}
+
+void eFSP_FOUTTST_Credit(void)
+{
+    /* Local variable */
+    t_eFSP_FOUT_Ctx l_tCtx;
+    uint32_t l_uFrames;
+    uint32_t l_uBytes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_InitFout(&l_tCtx, sizeof(m_auFoutFrame)) )
+    {
+        (void)printf("eFSP_FOUTTST_Credit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FOUT_RES_OK == eFSP_FOUTTST_NewFoutMsg(&l_tCtx, EFSP_FOUTTST_PAYL, 0x33u) )
+    {
+        (void)printf("eFSP_FOUTTST_Credit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 2  -- FAIL \n");
+    }
+
+    if( true == eFSP_FOUTTST_InitLink(&m_tLinkA, 5u) )
+    {
+        (void)printf("eFSP_FOUTTST_Credit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tLinkA.tMsgTx, 1u, EFSP_FOUTTST_PAYL - 1u) )
+    {
+        (void)printf("eFSP_FOUTTST_Credit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOCREDIT == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Credit 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Credit 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tLinkA.tMsgTx, 1u, EFSP_FOUTTST_PAYL) )
+    {
+        (void)printf("eFSP_FOUTTST_Credit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Credit 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Credit 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&m_tLinkA.tMsgTx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( 0u == l_uFrames ) && ( 0u == l_uBytes ) )
+        {
+            (void)printf("eFSP_FOUTTST_Credit 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Credit 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 8  -- FAIL \n");
+    }
+
+
+    /* The current frame is left untouched */
+    if( e_eFSP_MSGTX_RES_NOCREDIT == eFSP_MSGTX_NewShared(&m_tLinkA.tMsgTx, &l_tCtx) )
+    {
+        if( 1u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Credit 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Credit 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_FOUTTST_DrainChunk(&m_tLinkA) )
+    {
+        if( 0u == eFSP_FOUTTST_GetRefN(&l_tCtx) )
+        {
+            (void)printf("eFSP_FOUTTST_Credit 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FOUTTST_Credit 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FOUTTST_Credit 10 -- FAIL \n");
+    }
+}
@@ -26,6 +26,7 @@ static uint32_t m_uPayloadCounter;
 static uint32_t m_uReadJump;
 static uint32_t m_uReadJumpLong;
 static uint32_t m_uTimRemainingTime;
+static uint32_t m_uTimNowMs;
 static uint32_t m_uTimTimCnt;
 static uint32_t m_uTimTimCntInc;
 
@@ -49,6 +50,12 @@ struct t_eFSP_MSGRX_TimCtxUser
     bool bTxIsError;
 };
 
+struct t_eFSP_MSGRX_EvtCtxUser
+{
+    uint32_t uEvtCnt;
+    e_eFSP_MSGRX_RES eLastEvt;
+};
+
 
 
 /***********************************************************************************************************************
@@ -72,6 +79,9 @@ static bool_t eFSP_MSGRXTST_timGetRemainingCorr ( t_eFSP_MSGRX_TimCtx* p_ptCtx,
 static bool_t eFSP_MSGRXTST_timStartErr ( t_eFSP_MSGRX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal );
 static bool_t eFSP_MSGRXTST_timGetRemainingErr ( t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings );
 static bool_t eFSP_MSGRXTST_timGetRemainingErrCntrl( t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings );
+static void eFSP_MSGRXTST_evtCb ( t_eFSP_MSGRX_EvtCtx* p_ptCtx, const e_eFSP_MSGRX_RES p_eEvt );
+static bool_t eFSP_MSGRXTST_timGetNow ( t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs );
+static bool_t eFSP_MSGRXTST_timGetNowErr ( t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs );
 
 
 
@@ -92,6 +102,15 @@ static void eFSP_MSGRXTST_CornerCase3(void);
 static void eFSP_MSGRXTST_CornerCase4(void);
 static void eFSP_MSGRXTST_CornerCase5(void);
 static void eFSP_MSGRXTST_CornerCase6(void);
+static void eFSP_MSGRXTST_EventDriven(void);
+static void eFSP_MSGRXTST_PushMode(void);
+static void eFSP_MSGRXTST_RingSrc(void);
+static void eFSP_MSGRXTST_DmaSrc(void);
+static void eFSP_MSGRXTST_Clock(void);
+static void eFSP_MSGRXTST_TimerWheel(void);
+static void eFSP_MSGRXTST_LineRate(void);
+static void eFSP_MSGRXTST_SetTimeout(void);
+static void eFSP_MSGRXTST_Credit(void);
 
 
 
@@ -116,10 +135,55 @@ void eFSP_MSGRXTST_ExeTest(void)
     eFSP_MSGRXTST_CornerCase4();
     eFSP_MSGRXTST_CornerCase5();
     eFSP_MSGRXTST_CornerCase6();
+    eFSP_MSGRXTST_EventDriven();
+    eFSP_MSGRXTST_PushMode();
+    eFSP_MSGRXTST_RingSrc();
+    eFSP_MSGRXTST_DmaSrc();
+    eFSP_MSGRXTST_Clock();
+    eFSP_MSGRXTST_TimerWheel();
+    eFSP_MSGRXTST_LineRate();
+    eFSP_MSGRXTST_SetTimeout();
+    eFSP_MSGRXTST_Credit();
 
     (void)printf("\n\nMESSAGE RECEIVER TEST END \n\n");
 }
 
+bool_t eFSP_MSGRXTST_timGetNow ( t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs )
+{
+    bool_t l_bResult;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puNowMs ) )
+    {
+        l_bResult = false;
+    }
+    else
+    {
+        p_ptCtx->bTxIsError = false;
+        *p_puNowMs = m_uTimNowMs;
+        l_bResult = true;
+    }
+
+    return l_bResult;
+}
+
+bool_t eFSP_MSGRXTST_timGetNowErr ( t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs )
+{
+    bool_t l_bResult;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puNowMs ) )
+    {
+        l_bResult = false;
+    }
+    else
+    {
+        p_ptCtx->bTxIsError = true;
+        *p_puNowMs = m_uTimNowMs;
+        l_bResult = false;
+    }
+
+    return l_bResult;
+}
+
 
 
 /***********************************************************************************************************************
@@ -553,6 +617,17 @@ bool_t eFSP_MSGRXTST_timGetRemainingErrCntrl ( t_eFSP_MSGRX_TimCtx* p_ptCtx, uin
     return l_bResult;
 }
 
+void eFSP_MSGRXTST_evtCb ( t_eFSP_MSGRX_EvtCtx* p_ptCtx, const e_eFSP_MSGRX_RES p_eEvt )
+{
+    if( NULL != p_ptCtx )
+    {
+        p_ptCtx->uEvtCnt++;
+        p_ptCtx->eLastEvt = p_eEvt;
+    }
+}
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
  **********************************************************************************************************************/
@@ -4566,4 +4641,1796 @@ void eFSP_MSGRXTST_CornerCase6(void)
     (void)l_tCtxAdapterCrc.eLastEr;
     (void)l_tCtxAdapterRx.bTxIsError;
     (void)l_tCtxAdapterTim.bTxIsError;
+}
+
+void eFSP_MSGRXTST_EventDriven(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_MSGRX_EvtCtx l_tCtxAdapterEvt;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[5u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint8_t* l_puRxPos;
+    uint32_t l_uRxMaxL;
+    uint32_t l_uFrameCntr;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    e_eFSP_MSGRX_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    (void)memset(&l_tCtxAdapterEvt, 0, sizeof(l_tCtxAdapterEvt));
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsg;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 100u;
+    l_tInitData.bINeedWaitFrameStart = false;
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_SetEvtCb(&l_tCtx, &eFSP_MSGRXTST_evtCb, &l_tCtxAdapterEvt) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_BADPOINTER == eFSP_MSGRX_SetEvtCb(&l_tCtx, NULL, &l_tCtxAdapterEvt) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetEvtCb(&l_tCtx, &eFSP_MSGRXTST_evtCb, &l_tCtxAdapterEvt) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 5  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetWhereRxData(&l_tCtx, &l_puRxPos, &l_uRxMaxL) )
+    {
+        if( ( l_auRecBuff == l_puRxPos ) && ( 5u == l_uRxMaxL ) )
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_NotifyRecv(&l_tCtx, 6u) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 7  -- FAIL \n");
+    }
+
+    /* Function, simulate a driver that receive data in chunk */
+    l_eRes = e_eFSP_MSGRX_RES_OK;
+    l_uFrameCntr = 0u;
+    while( ( e_eFSP_MSGRX_RES_OK == l_eRes ) && ( l_uFrameCntr < sizeof(l_auFrame) ) )
+    {
+        l_eRes = eFSP_MSGRX_GetWhereRxData(&l_tCtx, &l_puRxPos, &l_uRxMaxL);
+        if( e_eFSP_MSGRX_RES_OK == l_eRes )
+        {
+            if( l_uRxMaxL > ( sizeof(l_auFrame) - l_uFrameCntr ) )
+            {
+                l_uRxMaxL = sizeof(l_auFrame) - l_uFrameCntr;
+            }
+
+            (void)memcpy(l_puRxPos, &l_auFrame[l_uFrameCntr], l_uRxMaxL);
+            l_uFrameCntr += l_uRxMaxL;
+            l_eRes = eFSP_MSGRX_NotifyRecv(&l_tCtx, l_uRxMaxL);
+        }
+    }
+
+    if( ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == l_eRes ) && ( sizeof(l_auFrame) == l_uFrameCntr ) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 8  -- FAIL \n");
+    }
+
+    if( ( 1u == l_tCtxAdapterEvt.uEvtCnt ) && ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == l_tCtxAdapterEvt.eLastEvt ) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 2u == l_uDataL ) && ( 0xCCu == l_puData[0u] ) && ( 0xCCu == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 10 -- FAIL \n");
+    }
+
+    /* Function, timeout without data received */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 12 -- FAIL \n");
+    }
+
+    m_uTimRemainingTime = 1u;
+    if( e_eFSP_MSGRX_RES_MESSAGETIMEOUT == eFSP_MSGRX_CheckTimeout(&l_tCtx) )
+    {
+        if( ( 2u == l_tCtxAdapterEvt.uEvtCnt ) && ( e_eFSP_MSGRX_RES_MESSAGETIMEOUT == l_tCtxAdapterEvt.eLastEvt ) )
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 13 -- FAIL \n");
+    }
+
+    /* Function, message ended no more timeout to check */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_CheckTimeout(&l_tCtx) )
+    {
+        if( 2u == l_tCtxAdapterEvt.uEvtCnt )
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_EventDriven 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 14 -- FAIL \n");
+    }
+
+    /* Function, bad frame notified */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsgNClean(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 15 -- FAIL \n");
+    }
+
+    l_auFrame[1u] = 0x00u;
+    l_eRes = e_eFSP_MSGRX_RES_OK;
+    l_uFrameCntr = 0u;
+    while( ( e_eFSP_MSGRX_RES_OK == l_eRes ) && ( l_uFrameCntr < sizeof(l_auFrame) ) )
+    {
+        l_eRes = eFSP_MSGRX_GetWhereRxData(&l_tCtx, &l_puRxPos, &l_uRxMaxL);
+        if( e_eFSP_MSGRX_RES_OK == l_eRes )
+        {
+            if( l_uRxMaxL > ( sizeof(l_auFrame) - l_uFrameCntr ) )
+            {
+                l_uRxMaxL = sizeof(l_auFrame) - l_uFrameCntr;
+            }
+
+            (void)memcpy(l_puRxPos, &l_auFrame[l_uFrameCntr], l_uRxMaxL);
+            l_uFrameCntr += l_uRxMaxL;
+            l_eRes = eFSP_MSGRX_NotifyRecv(&l_tCtx, l_uRxMaxL);
+        }
+    }
+
+    if( ( e_eFSP_MSGRX_RES_BADFRAME == l_eRes ) && ( 3u == l_tCtxAdapterEvt.uEvtCnt ) &&
+        ( e_eFSP_MSGRX_RES_BADFRAME == l_tCtxAdapterEvt.eLastEvt ) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 16 -- FAIL \n");
+    }
+
+    /* Function, corrupted event context */
+    l_tCtx.fEvt = NULL;
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_EventDriven 17 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_PushMode(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[1u];
+    uint8_t  l_auFrames[24u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF,
+                                 ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uUsedL;
+    uint32_t l_uCntr;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    e_eFSP_MSGRX_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsg;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 100u;
+    l_tInitData.bINeedWaitFrameStart = true;
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_BADPOINTER == eFSP_MSGRX_InsChunk(&l_tCtx, NULL, sizeof(l_auFrames), &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrames, 0u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 4  -- FAIL \n");
+    }
+
+    /* Function, two frame pushed toghether, the first one is returned */
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrames, sizeof(l_auFrames), &l_uUsedL) )
+    {
+        if( 12u == l_uUsedL )
+        {
+            (void)printf("eFSP_MSGRXTST_PushMode 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_PushMode 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 2u == l_uDataL ) && ( 0xCCu == l_puData[0u] ) && ( 0xCCu == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_MSGRXTST_PushMode 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_PushMode 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 6  -- FAIL \n");
+    }
+
+    /* Function, the remaining frame is pushed one byte at time, like an UART ISR */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 7  -- FAIL \n");
+    }
+
+    l_eRes = e_eFSP_MSGRX_RES_OK;
+    l_uCntr = 12u;
+    while( ( e_eFSP_MSGRX_RES_OK == l_eRes ) && ( l_uCntr < sizeof(l_auFrames) ) )
+    {
+        l_eRes = eFSP_MSGRX_InsChunk(&l_tCtx, &l_auFrames[l_uCntr], 1u, &l_uUsedL);
+        l_uCntr += l_uUsedL;
+    }
+
+    if( ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == l_eRes ) && ( sizeof(l_auFrames) == l_uCntr ) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 8  -- FAIL \n");
+    }
+
+    /* Function, a bad frame is reported */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 9  -- FAIL \n");
+    }
+
+    l_auFrames[1u] = 0x00u;
+    if( e_eFSP_MSGRX_RES_BADFRAME == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrames, 12u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_PushMode 10 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_RingSrc(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_SPSCR_Ctx l_tRing;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[5u];
+    uint8_t  l_auRingArea[8u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uPushedL;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_tRing, 0, sizeof(l_tRing));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    m_uPayloadSize = 0u;
+    m_uPayloadCounter = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsgErr;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 100u;
+    l_tInitData.bINeedWaitFrameStart = false;
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 1  -- FAIL \n");
+    }
+
+    /* Function, the ring must be initialized */
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetRingSrc(&l_tCtx, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 2  -- FAIL \n");
+    }
+
+    (void)eFSP_SPSCR_InitCtx(&l_tRing, l_auRingArea, sizeof(l_auRingArea));
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetRingSrc(&l_tCtx, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 4  -- FAIL \n");
+    }
+
+    /* Function, an empty ring return at once without waiting the end of the session */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        if( m_uTimTimCnt < 5u )
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 5  -- FAIL \n");
+    }
+
+
+
+    /* Function, the producer publish only a part of the frame, the RX callback is never called */
+    (void)eFSP_SPSCR_Push(&l_tRing, l_auFrame, 7u, &l_uPushedL);
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 6  -- FAIL \n");
+    }
+
+    /* Function, the remaining part wrap around the ring */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Push(&l_tRing, &l_auFrame[7u], 5u, &l_uPushedL) )
+    {
+        if( 5u == l_uPushedL )
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 2u == l_uDataL ) && ( 0xCCu == l_puData[0u] ) && ( 0xCCu == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetUsed(&l_tRing, &l_uDataL) )
+    {
+        if( 0u == l_uDataL )
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_RingSrc 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 10 -- FAIL \n");
+    }
+
+    /* Function, back to the RX callback */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetRingSrc(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 11 -- FAIL \n");
+    }
+
+    (void)eFSP_MSGRX_NewMsg(&l_tCtx);
+    if( e_eFSP_MSGRX_RES_RXCLBKERROR == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_RingSrc 12 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_DmaSrc(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_SPSCR_Ctx l_tRing;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[5u];
+    uint8_t  l_auRingArea[8u];
+    uint8_t  l_auDmaArea[12u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint8_t* l_puNextBuff;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_tRing, 0, sizeof(l_tRing));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    (void)memset(&l_auDmaArea, 0, sizeof(l_auDmaArea));
+    m_uPayloadSize = 0u;
+    m_uPayloadCounter = 0u;
+    l_puNextBuff = NULL;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsgErr;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 100u;
+    l_tInitData.bINeedWaitFrameStart = false;
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 1  -- FAIL \n");
+    }
+
+    /* Function, DMA not configured */
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_DmaBuffDone(&l_tCtx, &l_puNextBuff) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 2  -- FAIL \n");
+    }
+
+    /* Function, at least two buffers are needed */
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetDmaSrc(&l_tCtx, l_auDmaArea, 6u, 1u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetDmaSrc(&l_tCtx, l_auDmaArea, 0u, 2u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 4  -- FAIL \n");
+    }
+
+    /* Function, only one source at time */
+    (void)eFSP_SPSCR_InitCtx(&l_tRing, l_auRingArea, sizeof(l_auRingArea));
+    (void)eFSP_MSGRX_SetRingSrc(&l_tCtx, &l_tRing);
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetDmaSrc(&l_tCtx, l_auDmaArea, 6u, 2u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 5  -- FAIL \n");
+    }
+
+    (void)eFSP_MSGRX_SetRingSrc(&l_tCtx, NULL);
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetDmaSrc(&l_tCtx, l_auDmaArea, 6u, 2u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetRingSrc(&l_tCtx, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_DmaBuffPart(&l_tCtx, 7u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 9  -- FAIL \n");
+    }
+
+    /* Function, nothing received yet, the RX callback is never called */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 10 -- FAIL \n");
+    }
+
+    /* Function, the call returned at once without waiting the end of the session */
+    if( m_uTimTimCnt < 5u )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 11 -- FAIL \n");
+    }
+
+
+
+    /* Function, the DMA fill the first buffer and switch to the second one */
+    (void)memcpy(l_auDmaArea, l_auFrame, 6u);
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_DmaBuffDone(&l_tCtx, &l_puNextBuff) ) && ( &l_auDmaArea[6u] == l_puNextBuff ) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 13 -- FAIL \n");
+    }
+
+    /* Function, idle line after a part of the second buffer */
+    (void)memcpy(&l_auDmaArea[6u], &l_auFrame[6u], 3u);
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_DmaBuffPart(&l_tCtx, 3u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 15 -- FAIL \n");
+    }
+
+    /* Function, the second buffer is filled */
+    (void)memcpy(&l_auDmaArea[9u], &l_auFrame[9u], 3u);
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_DmaBuffDone(&l_tCtx, &l_puNextBuff) ) && ( &l_auDmaArea[0u] == l_puNextBuff ) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetDecodedData(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 2u == l_uDataL ) && ( 0xCCu == l_puData[0u] ) && ( 0xCCu == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_MSGRXTST_DmaSrc 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_DmaSrc 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 18 -- FAIL \n");
+    }
+
+    /* Function, the decoder is too slow and the DMA overwrite pending data */
+    (void)eFSP_MSGRX_NewMsg(&l_tCtx);
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_DmaBuffDone(&l_tCtx, &l_puNextBuff) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OUTOFMEM == eFSP_MSGRX_DmaBuffDone(&l_tCtx, &l_puNextBuff) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 21 -- FAIL \n");
+    }
+
+    /* Function, the decoder is synchronized again */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_DmaBuffDone(&l_tCtx, &l_puNextBuff) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 22 -- FAIL \n");
+    }
+
+    /* Function, back to the RX callback */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetDmaSrc(&l_tCtx, NULL, 0u, 0u) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_RXCLBKERROR == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_DmaSrc 24 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_Clock(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[5u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uUsedL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsgErr;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 100u;
+    l_tInitData.bINeedWaitFrameStart = true;
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_SetClock(&l_tCtx, &eFSP_MSGRXTST_timGetNow) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 2  -- FAIL \n");
+    }
+
+    /* Function, clock error */
+    if( e_eFSP_MSGRX_RES_TIMCLBKERROR == eFSP_MSGRX_SetClock(&l_tCtx, &eFSP_MSGRXTST_timGetNowErr) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 3  -- FAIL \n");
+    }
+
+    /* Function, the clock is near the wrap around */
+    m_uTimNowMs = 0xFFFFFF00u;
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetClock(&l_tCtx, &eFSP_MSGRXTST_timGetNow) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 5  -- FAIL \n");
+    }
+
+    /* Function, timeout dosent occour while waiting the SOF */
+    m_uTimNowMs += 5000u;
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 6  -- FAIL \n");
+    }
+
+    /* Function, the deadline is restarted by the SOF */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrame, 5u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 7  -- FAIL \n");
+    }
+
+    m_uTimNowMs += 999u;
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_InsChunk(&l_tCtx, &l_auFrame[5u], 7u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 8  -- FAIL \n");
+    }
+
+    /* Function, frame started and deadline passed */
+    (void)eFSP_MSGRX_NewMsg(&l_tCtx);
+    (void)eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrame, 5u, &l_uUsedL);
+    m_uTimNowMs += 1001u;
+    if( e_eFSP_MSGRX_RES_MESSAGETIMEOUT == eFSP_MSGRX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 9  -- FAIL \n");
+    }
+
+    /* Function, back to the timer with the remaining time */
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetClock(&l_tCtx, NULL) ) && ( 0u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Clock 10 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_TimerWheel(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_TIMW_Ctx l_tTimW;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[20u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_tTimW, 0, sizeof(l_tTimW));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    (void)memcpy(m_auRxPayload, l_auFrame, sizeof(l_auFrame));
+    m_uPayloadSize = 0u;
+    m_uPayloadCounter = 0u;
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsg;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 10u;
+    l_tInitData.bINeedWaitFrameStart = true;
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 1  -- FAIL \n");
+    }
+
+    (void)eFSP_TIMW_InitCtx(&l_tTimW, 0u);
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetTimerWheel(&l_tCtx, &l_tTimW, 3u) )
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 2  -- FAIL \n");
+    }
+
+
+    /* Function, the timeout is armed in the wheel and not in the timer */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tTimW, &l_tCtx.tTimNode, &l_uVal) )
+    {
+        if( ( 1000u == l_uVal ) && ( 0u == m_uTimRemainingTime ) )
+        {
+            (void)printf("eFSP_MSGRXTST_TimerWheel 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_TimerWheel 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 4  -- FAIL \n");
+    }
+
+
+    /* Function, the wheel does not move during the call, so a callback that receive nothing must end the call */
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) ) && ( 0u == m_uPayloadCounter ) )
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 6  -- FAIL \n");
+    }
+
+
+    /* Function, the message is received as soon as the data arrive */
+    m_uPayloadSize = 12u;
+    if( ( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_ReceiveChunk(&l_tCtx) ) && ( 12u == m_uPayloadCounter ) )
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tTimW, 5000u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_MSGRXTST_TimerWheel 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_TimerWheel 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_TimerWheel 8  -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_LineRate(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[20u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uUsedL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    (void)memcpy(m_auRxPayload, l_auFrame, sizeof(l_auFrame));
+    m_uPayloadSize = 9u;
+    m_uPayloadCounter = 0u;
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsg;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 10u;
+    l_tInitData.bINeedWaitFrameStart = true;
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_BADPOINTER == eFSP_MSGRX_SetLineRate(NULL, 100u, 10u) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_SetLineRate(&l_tCtx, 100u, 10u) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetLineRate(&l_tCtx, 4294968u, 10u) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetLineRate(&l_tCtx, 100u, 10u) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 5  -- FAIL \n");
+    }
+
+
+    /* Function, the length is unknown until the header is in */
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) ) && ( 1000u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 6  -- FAIL \n");
+    }
+
+
+    /* Function, 3 missing byte that could be all escaped, 60 ms on the line plus margin */
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_ReceiveChunk(&l_tCtx) ) && ( m_uTimRemainingTime <= 70u ) && ( m_uTimRemainingTime > 50u ) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 7  -- FAIL \n");
+    }
+
+    m_uPayloadSize = 12u;
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 8  -- FAIL \n");
+    }
+
+
+    /* Function, the same with the data pushed */
+    (void)eFSP_MSGRX_NewMsg(&l_tCtx);
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrame, 5u, &l_uUsedL) ) && ( m_uTimRemainingTime > 900u ) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 9  -- FAIL \n");
+    }
+
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InsChunk(&l_tCtx, &l_auFrame[5u], 4u, &l_uUsedL) ) && ( m_uTimRemainingTime <= 70u ) && ( m_uTimRemainingTime > 60u ) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_InsChunk(&l_tCtx, &l_auFrame[9u], 3u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 11 -- FAIL \n");
+    }
+
+
+    /* Function, a long frame is never over the constant timeout */
+    (void)eFSP_MSGRX_SetLineRate(&l_tCtx, 1u, 10u);
+    (void)eFSP_MSGRX_NewMsg(&l_tCtx);
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrame, 9u, &l_uUsedL) ) && ( m_uTimRemainingTime > 900u ) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 12 -- FAIL \n");
+    }
+
+
+    /* Function, back to the constant timeout */
+    (void)eFSP_MSGRX_SetLineRate(&l_tCtx, 0u, 0u);
+    (void)eFSP_MSGRX_NewMsg(&l_tCtx);
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrame, 9u, &l_uUsedL) ) && ( m_uTimRemainingTime > 900u ) )
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_LineRate 13 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_SetTimeout(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[20u];
+    uint8_t  l_auFrame[12u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+    (void)memcpy(m_auRxPayload, l_auFrame, sizeof(l_auFrame));
+    m_uPayloadSize = 12u;
+    m_uPayloadCounter = 0u;
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsg;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 10u;
+    l_tInitData.bINeedWaitFrameStart = true;
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_BADPOINTER == eFSP_MSGRX_SetTimeout(NULL, 300u) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_SetTimeout(&l_tCtx, 300u) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetTimeout(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetTimeout(&l_tCtx, 9u) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetTimeout(&l_tCtx, 300u) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 6  -- FAIL \n");
+    }
+
+
+    /* Function, the new timeout is used when a message is started */
+    if( ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) ) && ( 300u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_ReceiveChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_SetTimeout 8  -- FAIL \n");
+    }
+}
+
+void eFSP_MSGRXTST_Credit(void)
+{
+    /* Local variable */
+    t_eFSP_MSGRX_Ctx l_tCtx;
+    t_eFSP_MSGRX_InitData l_tInitData;
+    f_eFSP_MSGD_CrcCb l_fCrcPTest = &eFSP_MSGRXTST_c32SAdapt;
+    t_eFSP_MSGD_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGRX_RxCtx l_tCtxAdapterRx;
+    t_eFSP_MSGRX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[20u];
+    uint8_t  l_auRecBuff[1u];
+    uint8_t  l_auFrames[24u] = { ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF,
+                                 ECU_SOF, 0x50u, 0x7Bu, 0x0Au, 0x68u, 0x02u, 0x00u, 0x00u, 0x00u, 0xCCu, 0xCCu, ECU_EOF };
+    uint32_t l_uUsedL;
+    uint32_t l_uFrameLim;
+    uint32_t l_uByteLim;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auRecBuff, 0, sizeof(l_auRecBuff));
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puIRxBuffArea = l_auRecBuff;
+    l_tInitData.uIRxBuffAreaL = sizeof(l_auRecBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fIRx = &eFSP_MSGRXTST_receiveMsg;
+    l_tInitData.ptICbRxCtx = &l_tCtxAdapterRx;
+    l_tInitData.tIRxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tIRxTim.fTimStart = &eFSP_MSGRXTST_timStart;
+    l_tInitData.tIRxTim.fTimGetRemain = &eFSP_MSGRXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerRecMs = 100u;
+    l_tInitData.bINeedWaitFrameStart = true;
+
+    /* Function */
+    if( e_eFSP_MSGRX_RES_BADPOINTER == eFSP_MSGRX_SetCreditWindow(NULL, 1u, 1u) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPOINTER == eFSP_MSGRX_GetCreditLimit(&l_tCtx, NULL, &l_uByteLim) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 1u == l_uFrameLim ) && ( EFSP_MSGRX_MAXCREDIT == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_BADPARAM == eFSP_MSGRX_SetCreditWindow(&l_tCtx, EFSP_MSGRX_MAXCREDIT + 1u, 10u) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_SetCreditWindow(&l_tCtx, 2u, 10u) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 2u == l_uFrameLim ) && ( 10u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 8  -- FAIL \n");
+    }
+
+
+    /* Function, the credit is given back only when a received frame is discharged */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 2u == l_uFrameLim ) && ( 10u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrames, 12u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 2u == l_uFrameLim ) && ( 10u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 3u == l_uFrameLim ) && ( 12u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 3u == l_uFrameLim ) && ( 12u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == eFSP_MSGRX_InsChunk(&l_tCtx, &l_auFrames[12u], 12u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsgNClean(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 4u == l_uFrameLim ) && ( 14u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 19 -- FAIL \n");
+    }
+
+
+    /* Function, a frame not received entirely is not given back */
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InsChunk(&l_tCtx, l_auFrames, 6u, &l_uUsedL) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        if( ( 4u == l_uFrameLim ) && ( 14u == l_uByteLim ) )
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 22 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGRXTST_Credit 22 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 22 -- FAIL \n");
+    }
+
+
+    /* Function */
+    l_tCtx.uCredWinFrames = EFSP_MSGRX_MAXCREDIT + 1u;
+    if( e_eFSP_MSGRX_RES_CORRUPTCTX == eFSP_MSGRX_GetCreditLimit(&l_tCtx, &l_uFrameLim, &l_uByteLim) )
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGRXTST_Credit 23 -- FAIL \n");
+    }
 }
\ No newline at end of file
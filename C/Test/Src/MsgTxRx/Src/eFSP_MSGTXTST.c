@@ -26,6 +26,7 @@ static uint8_t  m_auTxBuff[100u];
 static uint32_t m_uTxBuffCounter;
 static uint32_t m_uSendWhen;
 static uint32_t m_uTimRemainingTime;
+static uint32_t m_uTimNowMs;
 
 
 
@@ -47,6 +48,12 @@ struct t_eFSP_MSGTX_TimCtxUser
     bool bTxIsError;
 };
 
+struct t_eFSP_MSGTX_EvtCtxUser
+{
+    uint32_t uEvtCnt;
+    e_eFSP_MSGTX_RES eLastEvt;
+};
+
 
 
 /***********************************************************************************************************************
@@ -69,6 +76,9 @@ static bool_t eFSP_MSGTXTST_timGetRemaining ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint
 static bool_t eFSP_MSGTXTST_timStartErr ( t_eFSP_MSGTX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal );
 static bool_t eFSP_MSGTXTST_timGetRemainingErr ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings );
 static bool_t eFSP_MSGTXTST_timGetRemainingCorr ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings );
+static void eFSP_MSGTXTST_evtCb ( t_eFSP_MSGTX_EvtCtx* p_ptCtx, const e_eFSP_MSGTX_RES p_eEvt );
+static bool_t eFSP_MSGTXTST_timGetNow ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs );
+static bool_t eFSP_MSGTXTST_timGetNowErr ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs );
 
 
 
@@ -86,6 +96,14 @@ static void eFSP_MSGTXTST_BadClBckTim(void);
 static void eFSP_MSGTXTST_CornerCase(void);
 static void eFSP_MSGTXTST_CornerCase2(void);
 static void eFSP_MSGTXTST_CornerCase3(void);
+static void eFSP_MSGTXTST_EventDriven(void);
+static void eFSP_MSGTXTST_RingDst(void);
+static void eFSP_MSGTXTST_Clock(void);
+static void eFSP_MSGTXTST_TimerWheel(void);
+static void eFSP_MSGTXTST_LineRate(void);
+static void eFSP_MSGTXTST_SetTimeout(void);
+static void eFSP_MSGTXTST_Credit(void);
+static void eFSP_MSGTXTST_Pacing(void);
 
 
 
@@ -107,10 +125,54 @@ void eFSP_MSGTXTST_ExeTest(void)
     eFSP_MSGTXTST_CornerCase();
     eFSP_MSGTXTST_CornerCase2();
     eFSP_MSGTXTST_CornerCase3();
+    eFSP_MSGTXTST_EventDriven();
+    eFSP_MSGTXTST_RingDst();
+    eFSP_MSGTXTST_Clock();
+    eFSP_MSGTXTST_TimerWheel();
+    eFSP_MSGTXTST_LineRate();
+    eFSP_MSGTXTST_SetTimeout();
+    eFSP_MSGTXTST_Credit();
+    eFSP_MSGTXTST_Pacing();
 
     (void)printf("\n\nMESSAGE TRANSMITTER TEST END \n\n");
 }
 
+bool_t eFSP_MSGTXTST_timGetNow ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs )
+{
+    bool_t l_bResult;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puNowMs ) )
+    {
+        l_bResult = false;
+    }
+    else
+    {
+        p_ptCtx->bTxIsError = false;
+        *p_puNowMs = m_uTimNowMs;
+        l_bResult = true;
+    }
+
+    return l_bResult;
+}
+
+bool_t eFSP_MSGTXTST_timGetNowErr ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puNowMs )
+{
+    bool_t l_bResult;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puNowMs ) )
+    {
+        l_bResult = false;
+    }
+    else
+    {
+        p_ptCtx->bTxIsError = true;
+        *p_puNowMs = m_uTimNowMs;
+        l_bResult = false;
+    }
+
+    return l_bResult;
+}
+
 
 
 /***********************************************************************************************************************
@@ -409,6 +471,17 @@ bool_t eFSP_MSGTXTST_timGetRemainingCorr ( t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_
 
 
 
+void eFSP_MSGTXTST_evtCb ( t_eFSP_MSGTX_EvtCtx* p_ptCtx, const e_eFSP_MSGTX_RES p_eEvt )
+{
+    if( NULL != p_ptCtx )
+    {
+        p_ptCtx->uEvtCnt++;
+        p_ptCtx->eLastEvt = p_eEvt;
+    }
+}
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
  **********************************************************************************************************************/
@@ -901,6 +974,16 @@ void eFSP_MSGTXTST_BadInit(void)
     {
         (void)printf("eFSP_MSGTXTST_BadInit 5  -- FAIL \n");
     }
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_NOINITLIB == eFSP_MSGTX_NotifySent(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_MSGTXTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_BadInit 6  -- FAIL \n");
+    }
     (void)l_tCtxAdapterCrc.eLastEr;
     (void)l_tCtxAdapterSend.bTxIsError;
     (void)l_tCtxAdapterTim.bTxIsError;
@@ -984,6 +1067,16 @@ void eFSP_MSGTXTST_BadIniMsg(void)
         (void)printf("eFSP_MSGTXTST_BadIniMsg 4  -- FAIL \n");
     }
 
+    /* Function */
+    if( e_eFSP_MSGTX_RES_NOINITMESSAGE == eFSP_MSGTX_NotifySent(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_MSGTXTST_BadIniMsg 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_BadIniMsg 5  -- FAIL \n");
+    }
+
     (void)l_tCtxAdapterCrc.eLastEr;
     (void)l_tCtxAdapterSend.bTxIsError;
     (void)l_tCtxAdapterTim.bTxIsError;
@@ -2643,4 +2736,1952 @@ void eFSP_MSGTXTST_CornerCase3()
         (void)printf("eFSP_MSGTXTST_CornerCase3 8  -- FAIL \n");
     }
 
+}
+
+void eFSP_MSGTXTST_EventDriven(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_MSGTX_EvtCtx l_tCtxAdapterEvt;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    const uint8_t* l_puChunk;
+    uint32_t l_uChunkL;
+    e_eFSP_MSGTX_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    (void)memset(&l_tCtxAdapterEvt, 0, sizeof(l_tCtxAdapterEvt));
+    (void)memset(&m_auTxBuff, 0, sizeof(m_auTxBuff));
+    m_uTxBuffCounter = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetEvtCb(&l_tCtx, &eFSP_MSGTXTST_evtCb, &l_tCtxAdapterEvt) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetEvtCb(&l_tCtx, &eFSP_MSGTXTST_evtCb, NULL) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetEvtCb(&l_tCtx, &eFSP_MSGTXTST_evtCb, &l_tCtxAdapterEvt) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 4  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 5  -- FAIL \n");
+    }
+
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 6  -- FAIL \n");
+    }
+
+    /* Function, the driver can not send more data than the retrived one */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetChunkToSend(&l_tCtx, &l_puChunk, &l_uChunkL) )
+    {
+        if( 3u == l_uChunkL )
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_NotifySent(&l_tCtx, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 8  -- FAIL \n");
+    }
+
+    /* Function, simulate a driver that send one byte at time */
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    while( e_eFSP_MSGTX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MSGTX_GetChunkToSend(&l_tCtx, &l_puChunk, &l_uChunkL);
+        if( e_eFSP_MSGTX_RES_OK == l_eRes )
+        {
+            m_auTxBuff[m_uTxBuffCounter] = l_puChunk[0u];
+            m_uTxBuffCounter++;
+            l_eRes = eFSP_MSGTX_NotifySent(&l_tCtx, 1u);
+        }
+    }
+
+    if( ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes ) && ( 12u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 9  -- FAIL \n");
+    }
+
+    if( ( ECU_SOF == m_auTxBuff[0u] ) && ( 0x01u == m_auTxBuff[9u] ) && ( 0x02u == m_auTxBuff[10u] ) &&
+        ( ECU_EOF == m_auTxBuff[11u] ) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 10 -- FAIL \n");
+    }
+
+    if( ( 1u == l_tCtxAdapterEvt.uEvtCnt ) && ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_tCtxAdapterEvt.eLastEvt ) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 11 -- FAIL \n");
+    }
+
+    /* Function, the event is notified only once */
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_GetChunkToSend(&l_tCtx, &l_puChunk, &l_uChunkL) )
+    {
+        if( ( 0u == l_uChunkL ) && ( 1u == l_tCtxAdapterEvt.uEvtCnt ) )
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 12 -- FAIL \n");
+    }
+
+    /* Function, timeout without data sended */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 14 -- FAIL \n");
+    }
+
+    m_uTimRemainingTime = 1u;
+    if( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        if( ( 2u == l_tCtxAdapterEvt.uEvtCnt ) && ( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == l_tCtxAdapterEvt.eLastEvt ) )
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 15 -- FAIL \n");
+    }
+
+    /* Function, message ended no more timeout to check */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        if( 2u == l_tCtxAdapterEvt.uEvtCnt )
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 16 -- FAIL \n");
+    }
+
+    /* Function, polling API notify the event too */
+    (void)memset(&m_auTxBuff, 0, sizeof(m_auTxBuff));
+    m_uTxBuffCounter = 0u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( ( 3u == l_tCtxAdapterEvt.uEvtCnt ) && ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_tCtxAdapterEvt.eLastEvt ) )
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_EventDriven 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 18 -- FAIL \n");
+    }
+
+    /* Function, disable notification */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetEvtCb(&l_tCtx, NULL, NULL) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 19 -- FAIL \n");
+    }
+
+    /* Function, corrupted event context */
+    l_tCtx.ptEvtCtx = &l_tCtxAdapterEvt;
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_EventDriven 20 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGTXTST_RingDst(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_SPSCR_Ctx l_tRing;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t  l_auRingArea[6u];
+    uint8_t  l_auLine[20u];
+    uint32_t l_uLineL;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint8_t* l_puSpan;
+    uint32_t l_uSpanL;
+    uint32_t l_uUsedL;
+    e_eFSP_MSGTX_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_tRing, 0, sizeof(l_tRing));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    (void)memset(&l_auLine, 0, sizeof(l_auLine));
+    (void)memset(&m_auTxBuff, 0, sizeof(m_auTxBuff));
+    m_uTxBuffCounter = 0u;
+    l_uLineL = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetRingDst(NULL, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetRingDst(&l_tCtx, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 3  -- FAIL \n");
+    }
+
+    /* Function, ring not initialized */
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetRingDst(&l_tCtx, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 4  -- FAIL \n");
+    }
+
+    (void)eFSP_SPSCR_InitCtx(&l_tRing, l_auRingArea, sizeof(l_auRingArea));
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetRingDst(&l_tCtx, &l_tRing) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 5  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 6  -- FAIL \n");
+    }
+
+    /* Function, the ring is filled without calling the TX callback and without waiting the consumer */
+    l_uUsedL = 0u;
+    l_eRes = eFSP_MSGTX_SendChunk(&l_tCtx);
+    (void)eFSP_SPSCR_GetUsed(&l_tRing, &l_uUsedL);
+    if( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( 5u == l_uUsedL ) && ( 0u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 7  -- FAIL \n");
+    }
+
+    /* Function, the ring is full so nothing change */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 8  -- FAIL \n");
+    }
+
+    /* Function, simulate an ISR that drain the ring and a main loop that top it up */
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    while( ( e_eFSP_MSGTX_RES_OK == l_eRes ) && ( l_uLineL < sizeof(l_auLine) ) )
+    {
+        l_uSpanL = 0u;
+        (void)eFSP_SPSCR_GetReadSpan(&l_tRing, &l_puSpan, &l_uSpanL);
+        if( l_uSpanL > 0u )
+        {
+            l_auLine[l_uLineL] = l_puSpan[0u];
+            l_uLineL++;
+            (void)eFSP_SPSCR_Release(&l_tRing, 1u);
+        }
+        l_eRes = eFSP_MSGTX_SendChunk(&l_tCtx);
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 9  -- FAIL \n");
+    }
+
+    /* Function, drain the last part of the frame */
+    l_uSpanL = 1u;
+    while( ( l_uSpanL > 0u ) && ( l_uLineL < sizeof(l_auLine) ) )
+    {
+        l_uSpanL = 0u;
+        (void)eFSP_SPSCR_GetReadSpan(&l_tRing, &l_puSpan, &l_uSpanL);
+        if( l_uSpanL > 0u )
+        {
+            l_auLine[l_uLineL] = l_puSpan[0u];
+            l_uLineL++;
+            (void)eFSP_SPSCR_Release(&l_tRing, 1u);
+        }
+    }
+
+    if( ( 12u == l_uLineL ) && ( ECU_SOF == l_auLine[0u] ) && ( 0x01u == l_auLine[9u] ) &&
+        ( 0x02u == l_auLine[10u] ) && ( ECU_EOF == l_auLine[11u] ) && ( 0u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 10 -- FAIL \n");
+    }
+
+    /* Function, message ended */
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 11 -- FAIL \n");
+    }
+
+    /* Function, back to the TX callback */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetRingDst(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 12 -- FAIL \n");
+    }
+
+    (void)eFSP_MSGTX_RestartMessage(&l_tCtx);
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    while( e_eFSP_MSGTX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MSGTX_SendChunk(&l_tCtx);
+    }
+
+    if( ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes ) && ( 12u == m_uTxBuffCounter ) && ( 0x01u == m_auTxBuff[9u] ) )
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_RingDst 13 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGTXTST_Clock(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    e_eFSP_MSGTX_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    (void)memset(&m_auTxBuff, 0, sizeof(m_auTxBuff));
+    m_uTxBuffCounter = 0u;
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetClock(&l_tCtx, &eFSP_MSGTXTST_timGetNow) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 2  -- FAIL \n");
+    }
+
+    /* Function, clock error */
+    if( e_eFSP_MSGTX_RES_TIMCLBKERROR == eFSP_MSGTX_SetClock(&l_tCtx, &eFSP_MSGTXTST_timGetNowErr) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 3  -- FAIL \n");
+    }
+
+    /* Function, the clock is near the wrap around */
+    m_uTimNowMs = 0xFFFFFF00u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetClock(&l_tCtx, &eFSP_MSGTXTST_timGetNow) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 4  -- FAIL \n");
+    }
+
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 5  -- FAIL \n");
+    }
+
+    /* Function, the deadline is after the wrap around */
+    m_uTimNowMs += 0x200u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 6  -- FAIL \n");
+    }
+
+    m_uTimNowMs += 0x200u;
+    if( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 7  -- FAIL \n");
+    }
+
+    /* Function, the timer is never used with the clock */
+    (void)eFSP_MSGTX_RestartMessage(&l_tCtx);
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    while( e_eFSP_MSGTX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MSGTX_SendChunk(&l_tCtx);
+    }
+
+    if( ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes ) && ( 0u == m_uTimRemainingTime ) && ( 12u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 8  -- FAIL \n");
+    }
+
+    /* Function, back to the timer with the remaining time */
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetClock(&l_tCtx, NULL) ) && ( 1000u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Clock 9  -- FAIL \n");
+    }
+}
+
+void eFSP_MSGTXTST_TimerWheel(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    t_eFSP_TIMW_Ctx l_tTimW;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uVal;
+    e_eFSP_MSGTX_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_tTimW, 0, sizeof(l_tTimW));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    (void)memset(&m_auTxBuff, 0, sizeof(m_auTxBuff));
+    m_uTxBuffCounter = 0u;
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetTimerWheel(NULL, &l_tTimW, 7u) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetTimerWheel(&l_tCtx, &l_tTimW, 7u) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 3  -- FAIL \n");
+    }
+
+
+    /* Function, the wheel is not initialized */
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetTimerWheel(&l_tCtx, &l_tTimW, 7u) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 4  -- FAIL \n");
+    }
+
+    (void)eFSP_TIMW_InitCtx(&l_tTimW, 0u);
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetTimerWheel(&l_tCtx, &l_tTimW, 7u) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 5  -- FAIL \n");
+    }
+
+
+    /* Function, the timeout is armed in the wheel and not in the timer */
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tTimW, &l_tCtx.tTimNode, &l_uVal) )
+    {
+        if( ( 1000u == l_uVal ) && ( 0u == m_uTimRemainingTime ) )
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 7  -- FAIL \n");
+    }
+
+
+    /* Function, the poller wake up only the expired context */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tTimW, 999u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tTimW, 1000u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tTimW, &l_uVal) )
+    {
+        if( 7u == l_uVal )
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 12 -- FAIL \n");
+    }
+
+
+    /* Function, a completed message leave the wheel */
+    (void)eFSP_MSGTX_RestartMessage(&l_tCtx);
+    l_eRes = e_eFSP_MSGTX_RES_OK;
+    while( e_eFSP_MSGTX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MSGTX_SendChunk(&l_tCtx);
+    }
+
+    if( ( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eRes ) && ( 12u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tTimW, 5000u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOFIRED == eFSP_TIMW_PopFired(&l_tTimW, &l_uVal) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 15 -- FAIL \n");
+    }
+
+
+    /* Function, an ongoing timeout is moved back to the timer */
+    (void)eFSP_MSGTX_RestartMessage(&l_tCtx);
+    (void)eFSP_TIMW_Advance(&l_tTimW, 5400u, &l_uVal);
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetTimerWheel(&l_tCtx, NULL, 0u) ) && ( 600u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tTimW, 7000u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_TimerWheel 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 17 -- FAIL \n");
+    }
+
+
+    /* Function, the wheel does not move during the call, so a callback that send nothing must end the call */
+    (void)eFSP_MSGTX_SetTimerWheel(&l_tCtx, &l_tTimW, 7u);
+    (void)eFSP_MSGTX_RestartMessage(&l_tCtx);
+    l_tCtx.fTx = &eFSP_MSGTXTST_sendMsgOnce;
+    m_uTxBuffCounter = 0u;
+    m_uSendWhen = 1u;
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) ) && ( 0u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 18 -- FAIL \n");
+    }
+
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) ) && ( 3u == m_uTxBuffCounter ) )
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_TimerWheel 19 -- FAIL \n");
+    }
+}
+
+
+void eFSP_MSGTXTST_LineRate(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetLineRate(NULL, 1000u, 5u) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetLineRate(&l_tCtx, 1000u, 5u) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetLineRate(&l_tCtx, 4294968u, 5u) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetLineRate(&l_tCtx, 1000u, 5u) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 5  -- FAIL \n");
+    }
+
+
+    /* Function, 12 byte on the line take 12 ms plus margin */
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) ) && ( 17u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 6  -- FAIL \n");
+    }
+
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&l_tCtx) ) && ( 17u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 7  -- FAIL \n");
+    }
+
+
+    /* Function, the time on the line is rounded up */
+    (void)eFSP_MSGTX_SetLineRate(&l_tCtx, 7u, 5u);
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) ) && ( 1000u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 8  -- FAIL \n");
+    }
+
+    (void)eFSP_MSGTX_SetLineRate(&l_tCtx, 13u, 5u);
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) ) && ( 929u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 9  -- FAIL \n");
+    }
+
+
+    /* Function, the margin can not exceed the constant timeout */
+    (void)eFSP_MSGTX_SetLineRate(&l_tCtx, 1000u, 990u);
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) ) && ( 1000u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 10 -- FAIL \n");
+    }
+
+
+    /* Function, back to the constant timeout */
+    (void)eFSP_MSGTX_SetLineRate(&l_tCtx, 0u, 0u);
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) ) && ( 1000u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_LineRate 11 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGTXTST_SetTimeout(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[10u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetTimeout(NULL, 300u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetTimeout(&l_tCtx, 300u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetTimeout(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetTimeout(&l_tCtx, 99u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetTimeout(&l_tCtx, 300u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 6  -- FAIL \n");
+    }
+
+
+    /* Function, the new timeout is used when a message is started */
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    l_puData[0u] = 0x01u;
+    l_puData[1u] = 0x02u;
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) ) && ( 300u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetTimeout(&l_tCtx, 100u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 8  -- FAIL \n");
+    }
+
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&l_tCtx) ) && ( 100u == m_uTimRemainingTime ) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 9  -- FAIL \n");
+    }
+
+
+    /* Function, with the clock the running deadline is not changed */
+    m_uTimNowMs = 0u;
+    (void)eFSP_MSGTX_SetClock(&l_tCtx, &eFSP_MSGTXTST_timGetNow);
+    (void)eFSP_MSGTX_SetTimeout(&l_tCtx, 1000u);
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetTimeout(&l_tCtx, 200u) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 11 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 500u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 12 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 1001u;
+    if( e_eFSP_MSGTX_RES_MESSAGETIMEOUT == eFSP_MSGTX_CheckTimeout(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_SetTimeout 13 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGTXTST_Credit(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[16u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uFrames;
+    uint32_t l_uBytes;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    m_uTimRemainingTime = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetCreditLimit(NULL, 1u, 1u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_GetCredit(&l_tCtx, NULL, &l_uBytes) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 1u, 1u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 4  -- FAIL \n");
+    }
+
+
+    /* Function, without credit flow control nothing is stopped, but the frames are counted */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( EFSP_MSGTX_MAXCREDIT == l_uFrames ) && ( EFSP_MSGTX_MAXCREDIT == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 5  -- FAIL \n");
+    }
+
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    (void)memset(l_puData, 0xA5, l_uDataL);
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 0u, 10u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 2u, EFSP_MSGTX_MAXCREDIT + 3u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( EFSP_MSGTX_MAXCREDIT == l_uFrames ) && ( EFSP_MSGTX_MAXCREDIT == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 9  -- FAIL \n");
+    }
+
+
+    /* Function, only the granted frames and bytes are started */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 2u, 6u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( 1u == l_uFrames ) && ( 4u == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOCREDIT == eFSP_MSGTX_NewMessage(&l_tCtx, 5u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( 0u == l_uFrames ) && ( 0u == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_RestartMessage(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOCREDIT == eFSP_MSGTX_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 16 -- FAIL \n");
+    }
+
+
+    /* Function, an old grant is ignored and a new one reopen the flow */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 1u, 3u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( 0u == l_uFrames ) && ( 0u == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 3u, 10u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( 0u == l_uFrames ) && ( 0u == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 21 -- FAIL \n");
+    }
+
+
+    /* Function, limits wrap around */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 22 -- FAIL \n");
+    }
+
+    l_tCtx.uSentFrames = MAX_UINT32VAL;
+    l_tCtx.uSentBytes = MAX_UINT32VAL - 1u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&l_tCtx, 0u, 3u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetCredit(&l_tCtx, &l_uFrames, &l_uBytes) )
+    {
+        if( ( 1u == l_uFrames ) && ( 5u == l_uBytes ) )
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 24 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Credit 24 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOCREDIT == eFSP_MSGTX_NewMessage(&l_tCtx, 6u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 5u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 26 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_NOCREDIT == eFSP_MSGTX_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 27 -- FAIL \n");
+    }
+
+
+    /* Function, nothing can be sent beyond the credit */
+    l_tCtx.uCredByteLim = l_tCtx.uSentBytes - 1u;
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_NewMessage(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Credit 28 -- FAIL \n");
+    }
+}
+
+void eFSP_MSGTXTST_Pacing(void)
+{
+    /* Local variable */
+    t_eFSP_MSGTX_Ctx l_tCtx;
+    t_eFSP_MSGTX_InitData l_tInitData;
+    f_eFSP_MSGE_CrcCb l_fCrcPTest = &eFSP_MSGTXTST_c32SAdapt;
+    t_eFSP_MSGE_CrcCtx l_tCtxAdapterCrc;
+    t_eFSP_MSGTX_TxCtx l_tCtxAdapterSend;
+    t_eFSP_MSGTX_TimCtx l_tCtxAdapterTim;
+    uint8_t  l_auMemArea[16u];
+    uint8_t  l_auSendBuff[3u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auMemArea, 0, sizeof(l_auMemArea));
+    (void)memset(&l_auSendBuff, 0, sizeof(l_auSendBuff));
+    m_uTimRemainingTime = 0u;
+    m_uTxBuffCounter = 0u;
+    m_uTimNowMs = 0u;
+
+    /* Init */
+    l_tInitData.puIMemArea = l_auMemArea;
+    l_tInitData.uIMemAreaL = sizeof(l_auMemArea);
+    l_tInitData.puITxBuffArea = l_auSendBuff;
+    l_tInitData.uITxBuffAreaL = sizeof(l_auSendBuff);
+    l_tInitData.fICrc = l_fCrcPTest;
+    l_tInitData.ptICbCrcCtx = &l_tCtxAdapterCrc;
+    l_tInitData.fITx = &eFSP_MSGTXTST_sendMsg;
+    l_tInitData.ptICbTxCtx = &l_tCtxAdapterSend;
+    l_tInitData.tITxTim.ptTimCtx = &l_tCtxAdapterTim;
+    l_tInitData.tITxTim.fTimStart = &eFSP_MSGTXTST_timStart;
+    l_tInitData.tITxTim.fTimGetRemain = &eFSP_MSGTXTST_timGetRemaining;
+    l_tInitData.uITimeoutMs = 1000u;
+    l_tInitData.uITimePerSendMs = 100u;
+
+    /* Function */
+    if( e_eFSP_MSGTX_RES_BADPOINTER == eFSP_MSGTX_SetPacing(NULL, 1000u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SetPacing(&l_tCtx, 1000u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetPacing(&l_tCtx, 1000u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetClock(&l_tCtx, &eFSP_MSGTXTST_timGetNow) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetPacing(&l_tCtx, ( MAX_UINT32VAL / 1000u ) + 1u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_BADPARAM == eFSP_MSGTX_SetPacing(&l_tCtx, 1000u, 0u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetPacing(&l_tCtx, 1000u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 8  -- FAIL \n");
+    }
+
+
+    /* Function, the burst is sent at once and then one byte every ms */
+    (void)eFSP_MSGTX_GetWherePutData(&l_tCtx, &l_puData, &l_uDataL);
+    (void)memset(l_puData, 0xA5, l_uDataL);
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 8u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 4u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 4u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 11 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 3u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 7u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 12 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 500u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 11u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetPacing(&l_tCtx, 0u, 0u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 15 -- FAIL \n");
+    }
+
+
+    /* Function, fractions of token are not lost */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetPacing(&l_tCtx, 3u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 16 -- FAIL \n");
+    }
+
+    m_uTxBuffCounter = 0u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&l_tCtx, 8u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 4u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 18 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 800u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 4u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 19 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 1100u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 5u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 20 -- FAIL \n");
+    }
+
+    m_uTimNowMs = 1400u;
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        if( 6u == m_uTxBuffCounter )
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MSGTXTST_Pacing 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 21 -- FAIL \n");
+    }
+
+
+    /* Function, without the clock the pacing is disabled */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetClock(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_MESSAGESENDED == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 23 -- FAIL \n");
+    }
+
+
+    /* Function */
+    l_tCtx.uPaceRate = 1000u;
+    if( e_eFSP_MSGTX_RES_CORRUPTCTX == eFSP_MSGTX_SendChunk(&l_tCtx) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 24 -- FAIL \n");
+    }
+
+    l_tCtx.uPaceRate = 0u;
+    l_tCtx.fTimNow = &eFSP_MSGTXTST_timGetNowErr;
+    if( e_eFSP_MSGTX_RES_TIMCLBKERROR == eFSP_MSGTX_SetPacing(&l_tCtx, 1000u, 4u) )
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MSGTXTST_Pacing 25 -- FAIL \n");
+    }
 }
\ No newline at end of file
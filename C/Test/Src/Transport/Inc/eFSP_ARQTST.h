@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_ARQTST.h
+ *
+ * @brief      Sliding window ARQ test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_ARQTST_H
+#define EFSP_ARQTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the sliding window arq module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_ARQTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_ARQTST_H */
\ No newline at end of file
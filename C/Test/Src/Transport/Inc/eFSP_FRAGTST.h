@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_FRAGTST.h
+ *
+ * @brief      fragmentation and reassembly test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_FRAGTST_H
+#define EFSP_FRAGTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the fragmentation and reassembly module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_FRAGTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_FRAGTST_H */
\ No newline at end of file
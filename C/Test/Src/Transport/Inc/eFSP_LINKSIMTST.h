@@ -0,0 +1,171 @@
+/**
+ * @file       eFSP_LINKSIMTST.h
+ *
+ * @brief      Simulated link shared by the transport tests
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_LINKSIMTST_H
+#define EFSP_LINKSIMTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+#include "eFSP_MSGTX.h"
+#include "eFSP_MSGRX.h"
+#include "eCU_CRC.h"
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_LINKSIMTST_CHANSIZE                                        ( 1024u )
+#define EFSP_LINKSIMTST_LINERATE                                        ( 8u )
+
+
+
+/***********************************************************************************************************************
+ *      TYPEDEFS
+ **********************************************************************************************************************/
+/* One direction of a simulated link: every byte is delivered uLatency ticks after it's sent, and a frame is corrupted
+ * when the pseudo random value of its start of frame is under uLossPerc, or when its bit is set in uLossMask */
+typedef struct
+{
+    uint8_t  auData[EFSP_LINKSIMTST_CHANSIZE];
+    uint32_t auAt[EFSP_LINKSIMTST_CHANSIZE];
+    uint32_t uIns;
+    uint32_t uRet;
+    uint32_t uLatency;
+    uint32_t uLossPerc;
+    uint32_t uLossMask;
+    uint32_t uFrameN;
+    uint32_t uSeed;
+    bool_t   bCorrupt;
+}t_eFSP_LINKSIMTST_Chan;
+
+struct t_eFSP_MSGD_CrcCtxUser
+{
+    e_eCU_CRC_RES eLastEr;
+};
+
+struct t_eFSP_MSGE_CrcCtxUser
+{
+    e_eCU_CRC_RES eLastEr;
+};
+
+struct t_eFSP_MSGRX_RxCtxUser
+{
+    t_eFSP_LINKSIMTST_Chan* ptChan;
+};
+
+struct t_eFSP_MSGRX_TimCtxUser
+{
+    uint32_t uTimRemainingT;
+};
+
+struct t_eFSP_MSGTX_TxCtxUser
+{
+    t_eFSP_LINKSIMTST_Chan* ptChan;
+};
+
+struct t_eFSP_MSGTX_TimCtxUser
+{
+    uint32_t uTimRemainingT;
+};
+
+/* Transmitter and receiver of a node attached to the simulated link */
+typedef struct
+{
+    t_eFSP_MSGTX_Ctx    tMsgTx;
+    t_eFSP_MSGRX_Ctx    tMsgRx;
+    t_eFSP_MSGE_CrcCtx  tCrcTx;
+    t_eFSP_MSGD_CrcCtx  tCrcRx;
+    t_eFSP_MSGTX_TxCtx  tTx;
+    t_eFSP_MSGRX_RxCtx  tRx;
+    t_eFSP_MSGTX_TimCtx tTimTx;
+    t_eFSP_MSGRX_TimCtx tTimRx;
+    uint8_t             auTxMem[64u];
+    uint8_t             auTxBuff[EFSP_LINKSIMTST_LINERATE];
+    uint8_t             auRxMem[64u];
+    uint8_t             auRxBuff[EFSP_LINKSIMTST_LINERATE];
+}t_eFSP_LINKSIMTST_Node;
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Set the current tick of the simulated link
+ *
+ * @param[in]   p_uTick         - New value of the tick
+ *
+ * @return      none
+ */
+void eFSP_LINKSIMTST_SetTick(const uint32_t p_uTick);
+
+/**
+ * @brief       Move the simulated link to the next tick
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_LINKSIMTST_StepTick(void);
+
+/**
+ * @brief       Retrive the current tick of the simulated link
+ *
+ * @param[in]   none
+ *
+ * @return      The current tick
+ */
+uint32_t eFSP_LINKSIMTST_GetTick(void);
+
+/**
+ * @brief       Clear one direction of the simulated link
+ *
+ * @param[in]   p_ptChan        - Direction of the link to clear
+ * @param[in]   p_uLatency      - Ticks needed by a byte to reach the other side
+ * @param[in]   p_uLossPerc     - Percentage of frames corrupted
+ * @param[in]   p_uLossMask     - Mask of the first 32 frames that are always corrupted
+ *
+ * @return      none
+ */
+void eFSP_LINKSIMTST_InitChan(t_eFSP_LINKSIMTST_Chan* p_ptChan, const uint32_t p_uLatency,
+                              const uint32_t p_uLossPerc, const uint32_t p_uLossMask);
+
+/**
+ * @brief       Initialize the transmitter and the receiver of a node, and attach them to the simulated link. One
+ *              callback is done for every call, so a call is a tick and the buffer size is the line rate.
+ *
+ * @param[in]   p_ptNode        - Node to initialize
+ * @param[in]   p_ptTxChan      - Direction of the link used by the transmitter
+ * @param[in]   p_ptRxChan      - Direction of the link used by the receiver
+ *
+ * @return      true if the node is ready to be used
+ */
+bool_t eFSP_LINKSIMTST_InitNode(t_eFSP_LINKSIMTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                                t_eFSP_LINKSIMTST_Chan* p_ptRxChan);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_LINKSIMTST_H */
\ No newline at end of file
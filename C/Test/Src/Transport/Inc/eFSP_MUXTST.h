@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_MUXTST.h
+ *
+ * @brief      logical channel multiplexer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_MUXTST_H
+#define EFSP_MUXTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the logical channel multiplexer module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_MUXTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_MUXTST_H */
\ No newline at end of file
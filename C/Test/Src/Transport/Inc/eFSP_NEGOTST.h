@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_NEGOTST.h
+ *
+ * @brief      Link capability negotiation test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_NEGOTST_H
+#define EFSP_NEGOTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the link capability negotiation module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_NEGOTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_NEGOTST_H */
\ No newline at end of file
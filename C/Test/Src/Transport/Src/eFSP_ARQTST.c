@@ -0,0 +1,2068 @@
+/**
+ * @file       eFSP_ARQTST.c
+ *
+ * @brief      Sliding window ARQ test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_ARQTST.h"
+#include "eFSP_LINKSIMTST.h"
+#include "eFSP_ARQ.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_ARQTST_SLOTL                                               ( 16u )
+#define EFSP_ARQTST_MAXTICK                                             ( 20000u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST STRUCT DECLARATION
+ **********************************************************************************************************************/
+typedef struct
+{
+    t_eFSP_ARQ_Ctx         tArq;
+    t_eFSP_LINKSIMTST_Node tLink;
+    uint8_t                auArqMem[2u * EFSP_ARQ_MAXWINDOW * EFSP_ARQTST_SLOTL];
+}t_eFSP_ARQTST_Node;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST VARIABLE DECLARATION
+ **********************************************************************************************************************/
+static t_eFSP_LINKSIMTST_Chan m_tChanAB;
+static t_eFSP_LINKSIMTST_Chan m_tChanBA;
+static t_eFSP_ARQTST_Node m_tNodeA;
+static t_eFSP_ARQTST_Node m_tNodeB;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_ARQTST_InitNode(t_eFSP_ARQTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                                   t_eFSP_LINKSIMTST_Chan* p_ptRxChan, const uint32_t p_uWindow,
+                                   const uint32_t p_uRtoMs);
+static bool_t eFSP_ARQTST_SendAll(t_eFSP_ARQ_Ctx* p_ptArq, const uint32_t p_uMsgN, uint32_t* const p_puSentN);
+static bool_t eFSP_ARQTST_RecvAll(t_eFSP_ARQ_Ctx* p_ptArq, uint32_t* const p_puRecvN);
+static bool_t eFSP_ARQTST_RunLink(const uint32_t p_uMsgN, const bool_t p_bDuplex, uint32_t* const p_puTicks);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_ARQTST_BadPointer(void);
+static void eFSP_ARQTST_BadInit(void);
+static void eFSP_ARQTST_BadParamEntr(void);
+static void eFSP_ARQTST_CorruptContext(void);
+static void eFSP_ARQTST_General(void);
+static void eFSP_ARQTST_Selective(void);
+static void eFSP_ARQTST_LossyLink(void);
+static void eFSP_ARQTST_Piggyback(void);
+static void eFSP_ARQTST_TxError(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_ARQTST_ExeTest(void)
+{
+	(void)printf("\n\nARQ TEST START \n\n");
+
+    eFSP_ARQTST_BadPointer();
+    eFSP_ARQTST_BadInit();
+    eFSP_ARQTST_BadParamEntr();
+    eFSP_ARQTST_CorruptContext();
+    eFSP_ARQTST_General();
+    eFSP_ARQTST_Selective();
+    eFSP_ARQTST_LossyLink();
+    eFSP_ARQTST_Piggyback();
+    eFSP_ARQTST_TxError();
+
+    (void)printf("\n\nARQ TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_ARQTST_InitNode(t_eFSP_ARQTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                            t_eFSP_LINKSIMTST_Chan* p_ptRxChan, const uint32_t p_uWindow, const uint32_t p_uRtoMs)
+{
+    bool_t l_bRes;
+    t_eFSP_ARQ_InitData l_tInitArq;
+
+    (void)memset(p_ptNode, 0, sizeof(t_eFSP_ARQTST_Node));
+
+    l_tInitArq.ptIMsgTx = &p_ptNode->tLink.tMsgTx;
+    l_tInitArq.ptIMsgRx = &p_ptNode->tLink.tMsgRx;
+    l_tInitArq.puIMemArea = p_ptNode->auArqMem;
+    l_tInitArq.uIMemAreaL = sizeof(p_ptNode->auArqMem);
+    l_tInitArq.uISlotL = EFSP_ARQTST_SLOTL;
+    l_tInitArq.uIWindow = p_uWindow;
+    l_tInitArq.uIRtoMs = p_uRtoMs;
+
+    if( ( true == eFSP_LINKSIMTST_InitNode(&p_ptNode->tLink, p_ptTxChan, p_ptRxChan) ) &&
+        ( e_eFSP_ARQ_RES_OK == eFSP_ARQ_InitCtx(&p_ptNode->tArq, &l_tInitArq) ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_ARQTST_SendAll(t_eFSP_ARQ_Ctx* p_ptArq, const uint32_t p_uMsgN, uint32_t* const p_puSentN)
+{
+    bool_t l_bRes;
+    uint8_t l_auMsg[EFSP_ARQTST_SLOTL];
+    uint32_t l_uIdx;
+    e_eFSP_ARQ_RES l_eRes;
+
+    /* Queue payloads of variable size until the window is full */
+    l_bRes = true;
+    l_eRes = e_eFSP_ARQ_RES_OK;
+    while( ( *p_puSentN < p_uMsgN ) && ( e_eFSP_ARQ_RES_OK == l_eRes ) )
+    {
+        for( l_uIdx = 0u; l_uIdx < EFSP_ARQTST_SLOTL; l_uIdx++ )
+        {
+            l_auMsg[l_uIdx] = (uint8_t)( *p_puSentN + l_uIdx );
+        }
+
+        l_eRes = eFSP_ARQ_Send(p_ptArq, l_auMsg, ( *p_puSentN % EFSP_ARQTST_SLOTL ) + 1u);
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            (*p_puSentN)++;
+        }
+        else if( e_eFSP_ARQ_RES_WINDOWFULL != l_eRes )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Retry at the next tick */
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_ARQTST_RecvAll(t_eFSP_ARQ_Ctx* p_ptArq, uint32_t* const p_puRecvN)
+{
+    bool_t l_bRes;
+    uint8_t l_auRecv[EFSP_ARQTST_SLOTL];
+    uint32_t l_uRecvL;
+    uint32_t l_uIdx;
+    e_eFSP_ARQ_RES l_eRes;
+
+    /* Retrive every payload in order, and check it's the expected one */
+    l_bRes = true;
+    l_eRes = e_eFSP_ARQ_RES_OK;
+    while( ( true == l_bRes ) && ( e_eFSP_ARQ_RES_OK == l_eRes ) )
+    {
+        l_eRes = eFSP_ARQ_Recv(p_ptArq, l_auRecv, sizeof(l_auRecv), &l_uRecvL);
+        if( e_eFSP_ARQ_RES_OK == l_eRes )
+        {
+            if( l_uRecvL != ( ( *p_puRecvN % EFSP_ARQTST_SLOTL ) + 1u ) )
+            {
+                l_bRes = false;
+            }
+
+            for( l_uIdx = 0u; l_uIdx < l_uRecvL; l_uIdx++ )
+            {
+                if( l_auRecv[l_uIdx] != (uint8_t)( *p_puRecvN + l_uIdx ) )
+                {
+                    l_bRes = false;
+                }
+            }
+            (*p_puRecvN)++;
+        }
+        else if( e_eFSP_ARQ_RES_NODATA != l_eRes )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Nothing more in order */
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_ARQTST_RunLink(const uint32_t p_uMsgN, const bool_t p_bDuplex, uint32_t* const p_puTicks)
+{
+    bool_t l_bRes;
+    uint32_t l_uSentAN;
+    uint32_t l_uSentBN;
+    uint32_t l_uRecvAN;
+    uint32_t l_uRecvBN;
+    uint32_t l_uPendAN;
+    uint32_t l_uPendBN;
+    uint32_t l_uMsgBN;
+
+    /* Node A send p_uMsgN payloads to node B, and in duplex mode node B send the same amount to node A */
+    l_bRes = true;
+    l_uSentAN = 0u;
+    l_uSentBN = 0u;
+    l_uRecvAN = 0u;
+    l_uRecvBN = 0u;
+    l_uPendAN = 1u;
+    l_uPendBN = 0u;
+
+    if( true == p_bDuplex )
+    {
+        l_uMsgBN = p_uMsgN;
+    }
+    else
+    {
+        l_uMsgBN = 0u;
+    }
+
+    while( ( true == l_bRes ) && ( eFSP_LINKSIMTST_GetTick() < EFSP_ARQTST_MAXTICK ) &&
+           ( ( l_uRecvBN < p_uMsgN ) || ( l_uRecvAN < l_uMsgBN ) || ( 0u != l_uPendAN ) || ( 0u != l_uPendBN ) ) )
+    {
+        eFSP_LINKSIMTST_StepTick();
+
+        if( ( true != eFSP_ARQTST_SendAll(&m_tNodeA.tArq, p_uMsgN, &l_uSentAN) ) ||
+            ( true != eFSP_ARQTST_SendAll(&m_tNodeB.tArq, l_uMsgBN, &l_uSentBN) ) )
+        {
+            l_bRes = false;
+        }
+
+        if( ( e_eFSP_ARQ_RES_OK != eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick()) ) ||
+            ( e_eFSP_ARQ_RES_OK != eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick()) ) )
+        {
+            l_bRes = false;
+        }
+
+        if( ( true != eFSP_ARQTST_RecvAll(&m_tNodeB.tArq, &l_uRecvBN) ) ||
+            ( true != eFSP_ARQTST_RecvAll(&m_tNodeA.tArq, &l_uRecvAN) ) )
+        {
+            l_bRes = false;
+        }
+
+        if( ( e_eFSP_ARQ_RES_OK != eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uPendAN) ) ||
+            ( e_eFSP_ARQ_RES_OK != eFSP_ARQ_GetPending(&m_tNodeB.tArq, &l_uPendBN) ) )
+        {
+            l_bRes = false;
+        }
+    }
+
+    if( ( l_uRecvBN != p_uMsgN ) || ( l_uRecvAN != l_uMsgBN ) || ( 0u != l_uPendAN ) || ( 0u != l_uPendBN ) )
+    {
+        l_bRes = false;
+    }
+
+    *p_puTicks = eFSP_LINKSIMTST_GetTick();
+
+    return l_bRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_ARQTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_ARQ_Ctx l_tCtx;
+    t_eFSP_ARQ_InitData l_tInitData;
+    t_eFSP_RTTE_Ctx l_tRtte;
+    uint8_t l_auData[4u];
+    uint32_t l_uVal;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_tRtte, 0, sizeof(l_tRtte));
+
+    /* Function */
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_InitCtx(NULL, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_InitCtx(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 2  -- FAIL \n");
+    }
+
+
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitData.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    l_tInitData.puIMemArea = NULL;
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 3  -- FAIL \n");
+    }
+
+    l_tInitData.puIMemArea = m_tNodeA.auArqMem;
+    l_tInitData.ptIMsgTx = NULL;
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 4  -- FAIL \n");
+    }
+
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitData.ptIMsgRx = NULL;
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 5  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_SetRtte(NULL, &l_tRtte) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_SetAckDelay(NULL, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_Send(NULL, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_Send(&l_tCtx, NULL, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_Recv(NULL, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_Recv(&l_tCtx, NULL, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_Recv(&l_tCtx, l_auData, sizeof(l_auData), NULL) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_Process(NULL, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_GetPending(NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPOINTER == eFSP_ARQ_GetPending(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadPointer 17 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_ARQ_Ctx l_tCtx;
+    t_eFSP_RTTE_Ctx l_tRtte;
+    uint8_t l_auData[4u];
+    uint32_t l_uVal;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    (void)eFSP_RTTE_InitCtx(&l_tRtte, 100u, 10u, 1000u);
+
+    /* Function */
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_ARQTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NOINITLIB == eFSP_ARQ_SetRtte(&l_tCtx, &l_tRtte) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NOINITLIB == eFSP_ARQ_SetAckDelay(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NOINITLIB == eFSP_ARQ_Send(&l_tCtx, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NOINITLIB == eFSP_ARQ_Recv(&l_tCtx, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NOINITLIB == eFSP_ARQ_Process(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NOINITLIB == eFSP_ARQ_GetPending(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 7  -- FAIL \n");
+    }
+
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_BadInit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_IsInit(&m_tNodeA.tArq, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_ARQTST_BadInit 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_BadInit 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadInit 9  -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_ARQ_Ctx l_tCtx;
+    t_eFSP_ARQ_InitData l_tInitData;
+    t_eFSP_MSGTX_Ctx l_tMsgTxNoInit;
+    t_eFSP_RTTE_Ctx l_tRtte;
+    uint8_t l_auData[EFSP_ARQTST_SLOTL + 1u];
+
+    /* Clear */
+    (void)memset(&l_tMsgTxNoInit, 0, sizeof(l_tMsgTxNoInit));
+    (void)memset(&l_tRtte, 0, sizeof(l_tRtte));
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitData.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    l_tInitData.puIMemArea = m_tNodeA.auArqMem;
+    l_tInitData.uIMemAreaL = 2u * 4u * EFSP_ARQTST_SLOTL;
+    l_tInitData.uISlotL = EFSP_ARQTST_SLOTL;
+    l_tInitData.uIWindow = 4u;
+    l_tInitData.uIRtoMs = 100u;
+
+    /* Function, window not a power of two or out of range */
+    l_tInitData.uIWindow = 0u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    l_tInitData.uIWindow = 3u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    l_tInitData.uIWindow = 2u * EFSP_ARQ_MAXWINDOW;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    l_tInitData.uIWindow = 4u;
+
+    /* Function, no payload, no timeout or memory too small */
+    l_tInitData.uISlotL = 0u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    l_tInitData.uISlotL = EFSP_ARQTST_SLOTL;
+    l_tInitData.uIRtoMs = 0u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    l_tInitData.uIRtoMs = 100u;
+    l_tInitData.uIMemAreaL = ( 2u * 4u * EFSP_ARQTST_SLOTL ) - 1u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    l_tInitData.uIMemAreaL = MAX_UINT32VAL;
+    l_tInitData.uISlotL = MAX_UINT32VAL / 4u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    l_tInitData.uIMemAreaL = 2u * 4u * EFSP_ARQTST_SLOTL;
+    l_tInitData.uISlotL = EFSP_ARQTST_SLOTL;
+
+    /* Function, the transmitter can not contain a frame or is not initialized */
+    l_tInitData.uIMemAreaL = sizeof(m_tNodeA.auArqMem);
+    l_tInitData.uISlotL = 50u;
+    l_tInitData.uIWindow = 2u;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    l_tInitData.uIMemAreaL = 2u * 4u * EFSP_ARQTST_SLOTL;
+    l_tInitData.uISlotL = EFSP_ARQTST_SLOTL;
+    l_tInitData.uIWindow = 4u;
+    l_tInitData.ptIMsgTx = &l_tMsgTxNoInit;
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+
+    /* Function, valid init */
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 10 -- FAIL \n");
+    }
+
+
+    /* Function, payload too big and estimator not initialized */
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_Send(&l_tCtx, l_auData, EFSP_ARQTST_SLOTL + 1u) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&l_tCtx, l_auData, EFSP_ARQTST_SLOTL) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_BADPARAM == eFSP_ARQ_SetRtte(&l_tCtx, &l_tRtte) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 13 -- FAIL \n");
+    }
+
+    (void)eFSP_RTTE_InitCtx(&l_tRtte, 100u, 10u, 1000u);
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetRtte(&l_tCtx, &l_tRtte) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetRtte(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_BadParamEntr 15 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_CorruptContext(void)
+{
+    /* Local variable */
+    uint8_t l_auData[4u];
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+
+    /* Function, window not a power of two */
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    m_tNodeA.tArq.uWindow = 3u;
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_SetRtte(&m_tNodeA.tArq, NULL) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_SetAckDelay(&m_tNodeA.tArq, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_Recv(&m_tNodeA.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_Process(&m_tNodeA.tArq, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 6  -- FAIL \n");
+    }
+
+
+    /* Function, missing pointer */
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    m_tNodeA.tArq.ptMsgRx = NULL;
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_Process(&m_tNodeA.tArq, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 7  -- FAIL \n");
+    }
+
+
+    /* Function, no payload or no timeout */
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    m_tNodeA.tArq.uSlotL = 0u;
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 8  -- FAIL \n");
+    }
+
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    m_tNodeA.tArq.uRtoMs = 0u;
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 9  -- FAIL \n");
+    }
+
+
+    /* Function, more pending frames than the window */
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    m_tNodeA.tArq.uTxNext = 5u;
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 10 -- FAIL \n");
+    }
+
+
+    /* Function, received frame outside the window */
+    (void)eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u);
+    m_tNodeA.tArq.uRxMask = 0x10u;
+    if( e_eFSP_ARQ_RES_CORRUPTCTX == eFSP_ARQ_Recv(&m_tNodeA.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_CorruptContext 11 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_General(void)
+{
+    /* Local variable */
+    uint8_t l_auData[EFSP_ARQTST_SLOTL];
+    uint32_t l_uVal;
+    uint32_t l_uTicks;
+    uint32_t l_uIdx;
+    e_eFSP_ARQ_RES l_eRes;
+
+    /* Clear */
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+
+    /* Function, the window limit the queued payloads */
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_General 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NODATA == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 8u) )
+    {
+        (void)printf("eFSP_ARQTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_General 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 1u) )
+    {
+        (void)printf("eFSP_ARQTST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, EFSP_ARQTST_SLOTL) )
+    {
+        (void)printf("eFSP_ARQTST_General 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_WINDOWFULL == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 1u) )
+    {
+        (void)printf("eFSP_ARQTST_General 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 9  -- FAIL \n");
+    }
+
+
+    /* Function, a payload is retrived only if it fits */
+    l_eRes = e_eFSP_ARQ_RES_NODATA;
+    for( l_uIdx = 0u; ( l_uIdx < 100u ) && ( e_eFSP_ARQ_RES_NODATA == l_eRes ); l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+        l_eRes = eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, 7u, &l_uVal);
+    }
+    if( e_eFSP_ARQ_RES_BADPARAM == l_eRes )
+    {
+        (void)printf("eFSP_ARQTST_General 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, 8u, &l_uVal) )
+    {
+        if( 8u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 11 -- FAIL \n");
+    }
+
+
+    /* Function, the frames not retrived yet are selectively acknowledged but still keep the window */
+    for( l_uIdx = 0u; l_uIdx < 50u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_SLOT_SACKED == m_tNodeA.tArq.atTxSlot[1u].eState )
+    {
+        (void)printf("eFSP_ARQTST_General 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 13 -- FAIL \n");
+    }
+
+
+    /* Function, retriving them free the window */
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( EFSP_ARQTST_SLOTL == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NODATA == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_General 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 17 -- FAIL \n");
+    }
+
+    for( l_uIdx = 0u; l_uIdx < 30u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_General 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_General 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 18 -- FAIL \n");
+    }
+
+    if( 0u == m_tNodeA.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_General 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 19 -- FAIL \n");
+    }
+
+
+    /* Function, a long exchange wrap around the sequence number */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_General 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 20 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_General 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 21 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_RunLink(600u, false, &l_uTicks) )
+    {
+        (void)printf("eFSP_ARQTST_General 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 22 -- FAIL \n");
+    }
+
+    if( 0u == m_tNodeA.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_General 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_General 23 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_Selective(void)
+{
+    /* Local variable */
+    uint8_t l_auData[EFSP_ARQTST_SLOTL];
+    uint32_t l_uVal;
+    uint32_t l_uIdx;
+
+    /* Clear */
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    eFSP_LINKSIMTST_SetTick(0u);
+
+    /* Function, the first frame is lost and the other ones are buffered by the receiver */
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 5u, 0u, 0x01u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 5u, 0u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_Selective 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_Selective 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 2  -- FAIL \n");
+    }
+
+
+    for( l_uIdx = 0u; l_uIdx < 4u; l_uIdx++ )
+    {
+        l_auData[0u] = (uint8_t)l_uIdx;
+        (void)eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 1u);
+    }
+
+    for( l_uIdx = 0u; l_uIdx < 60u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+
+    if( e_eFSP_ARQ_RES_NODATA == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_Selective 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 3  -- FAIL \n");
+    }
+
+    if( 0x0Eu == m_tNodeB.tArq.uRxMask )
+    {
+        (void)printf("eFSP_ARQTST_Selective 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_SLOT_INFLIGHT == m_tNodeA.tArq.atTxSlot[0u].eState )
+    {
+        (void)printf("eFSP_ARQTST_Selective 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_SLOT_SACKED == m_tNodeA.tArq.atTxSlot[1u].eState )
+    {
+        (void)printf("eFSP_ARQTST_Selective 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_SLOT_SACKED == m_tNodeA.tArq.atTxSlot[3u].eState )
+    {
+        (void)printf("eFSP_ARQTST_Selective 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 7  -- FAIL \n");
+    }
+
+
+    /* Function, only the lost frame is sent again after the timeout */
+    for( l_uIdx = 0u; l_uIdx < 100u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+
+    if( 1u == m_tNodeA.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_Selective 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 0u == l_auData[0u] )
+        {
+            (void)printf("eFSP_ARQTST_Selective 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Selective 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 1u == l_auData[0u] )
+        {
+            (void)printf("eFSP_ARQTST_Selective 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Selective 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 2u == l_auData[0u] )
+        {
+            (void)printf("eFSP_ARQTST_Selective 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Selective 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 3u == l_auData[0u] )
+        {
+            (void)printf("eFSP_ARQTST_Selective 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Selective 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_NODATA == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_ARQTST_Selective 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 13 -- FAIL \n");
+    }
+
+
+    for( l_uIdx = 0u; l_uIdx < 60u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_Selective 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Selective 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Selective 14 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_LossyLink(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tRtte;
+    uint32_t l_uTicksSw;
+    uint32_t l_uTicksSr;
+    uint32_t l_uTicksRtte;
+
+    /* Function, stop and wait on a link with latency and 10% of corrupted frames in both directions */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 20u, 10u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 20u, 10u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 1u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 1u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 2  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_RunLink(40u, false, &l_uTicksSw) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 3  -- FAIL \n");
+    }
+
+    if( 0u != m_tNodeA.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 4  -- FAIL \n");
+    }
+
+
+    /* Function, same link and same losses with a window of 8 frames */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 20u, 10u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 20u, 10u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 5  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 6  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_RunLink(40u, false, &l_uTicksSr) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 7  -- FAIL \n");
+    }
+
+    if( 0u != m_tNodeA.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 8  -- FAIL \n");
+    }
+
+
+    /* Function, the window must at least double the throughput */
+    if( ( 2u * l_uTicksSr ) < l_uTicksSw )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 9  -- FAIL \n");
+    }
+
+
+    /* Function, same link with the timeout taken from the estimator */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 20u, 10u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 20u, 10u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 10 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_InitCtx(&l_tRtte, 150u, 50u, 2000u) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetRtte(&m_tNodeA.tArq, &l_tRtte) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 13 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_RunLink(40u, false, &l_uTicksRtte) )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 14 -- FAIL \n");
+    }
+
+    if( true == l_tRtte.bHasSample )
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_LossyLink 15 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_Piggyback(void)
+{
+    /* Local variable */
+    uint8_t l_auData[EFSP_ARQTST_SLOTL];
+    uint32_t l_uVal;
+    uint32_t l_uIdx;
+    uint32_t l_uTicks;
+
+    /* Clear */
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+
+    /* Function, with no data to carry it the acknowledge is sent alone, but only after the delay */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetAckDelay(&m_tNodeB.tArq, 30u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 4u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 4  -- FAIL \n");
+    }
+
+
+    for( l_uIdx = 0u; l_uIdx < 20u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( 0x01u == m_tNodeB.tArq.uRxMask )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 5  -- FAIL \n");
+    }
+
+    if( 0u == m_tChanBA.uFrameN )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 6  -- FAIL \n");
+    }
+
+
+    for( l_uIdx = 0u; l_uIdx < 30u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( 1u == m_tChanBA.uFrameN )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_SLOT_SACKED == m_tNodeA.tArq.atTxSlot[0u].eState )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 8  -- FAIL \n");
+    }
+
+
+    /* Function, a data frame started before the delay carry the acknowledge */
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeB.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_Piggyback 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Piggyback 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeB.tArq, l_auData, 4u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 10 -- FAIL \n");
+    }
+
+    for( l_uIdx = 0u; l_uIdx < 20u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( 2u == m_tChanBA.uFrameN )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_GetPending(&m_tNodeA.tArq, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_Piggyback 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Piggyback 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Recv(&m_tNodeA.tArq, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        if( 4u == l_uVal )
+        {
+            (void)printf("eFSP_ARQTST_Piggyback 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_ARQTST_Piggyback 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 13 -- FAIL \n");
+    }
+
+
+    /* Function, a chatty bidirectional link use almost only data frames */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 20u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 20u, 0u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 14 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetAckDelay(&m_tNodeA.tArq, 10u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetAckDelay(&m_tNodeB.tArq, 10u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 17 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_RunLink(100u, true, &l_uTicks) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 18 -- FAIL \n");
+    }
+
+    if( 0u == m_tNodeA.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 19 -- FAIL \n");
+    }
+
+    if( 0u == m_tNodeB.tArq.uRetxN )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 20 -- FAIL \n");
+    }
+
+    if( ( m_tChanAB.uFrameN + m_tChanBA.uFrameN ) < 250u )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 21 -- FAIL \n");
+    }
+
+
+    /* Function, same link with losses */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 20u, 10u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 20u, 10u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 22 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 8u, 150u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetAckDelay(&m_tNodeA.tArq, 10u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_SetAckDelay(&m_tNodeB.tArq, 10u) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 25 -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_RunLink(100u, true, &l_uTicks) )
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_Piggyback 26 -- FAIL \n");
+    }
+}
+
+void eFSP_ARQTST_TxError(void)
+{
+    /* Local variable */
+    uint8_t l_auData[EFSP_ARQTST_SLOTL];
+    uint32_t l_uIdx;
+
+    /* Clear */
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+
+    /* Function, a frame refused by the transmitter is not marked as sent */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_ARQTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB, 4u, 100u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeA.tLink.tMsgTx, 0u, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeB.tLink.tMsgTx, 0u, 0u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Send(&m_tNodeA.tArq, l_auData, 4u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 5  -- FAIL \n");
+    }
+
+    eFSP_LINKSIMTST_StepTick();
+    if( e_eFSP_ARQ_RES_MSGTXERROR == eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick()) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 6  -- FAIL \n");
+    }
+
+    if( ( e_eFSP_ARQ_SLOT_QUEUED == m_tNodeA.tArq.atTxSlot[0u].eState ) && ( false == m_tNodeA.tArq.bTxBusy ) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeA.tLink.tMsgTx, 1u, 64u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 8  -- FAIL \n");
+    }
+
+    eFSP_LINKSIMTST_StepTick();
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick()) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 9  -- FAIL \n");
+    }
+
+    if( ( e_eFSP_ARQ_SLOT_INFLIGHT == m_tNodeA.tArq.atTxSlot[0u].eState ) &&
+        ( 2u == m_tNodeA.tArq.atTxSlot[0u].uSentMs ) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 10 -- FAIL \n");
+    }
+
+
+    /* Function, an acknowledge refused by the transmitter is still pending */
+    for( l_uIdx = 0u; l_uIdx < 20u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( 0x01u == m_tNodeB.tArq.uRxMask )
+    {
+        (void)printf("eFSP_ARQTST_TxError 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 11 -- FAIL \n");
+    }
+
+    if( ( true == m_tNodeB.tArq.bAckPend ) && ( 0u == m_tChanBA.uFrameN ) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 12 -- FAIL \n");
+    }
+
+
+    /* Function, a retransmission refused by the transmitter is not counted */
+    for( l_uIdx = 0u; l_uIdx < 100u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( ( e_eFSP_ARQ_SLOT_INFLIGHT == m_tNodeA.tArq.atTxSlot[0u].eState ) &&
+        ( false == m_tNodeA.tArq.atTxSlot[0u].bRetx ) && ( 2u == m_tNodeA.tArq.atTxSlot[0u].uSentMs ) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 13 -- FAIL \n");
+    }
+
+    if( ( 0u == m_tNodeA.tArq.uRetxN ) && ( 1u == m_tChanAB.uFrameN ) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 14 -- FAIL \n");
+    }
+
+
+    /* Function, with credit again both the frame and the acknowledge are sent */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeA.tLink.tMsgTx, 2u, 128u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeB.tLink.tMsgTx, 1u, 64u) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 16 -- FAIL \n");
+    }
+
+    for( l_uIdx = 0u; l_uIdx < 20u; l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+        (void)eFSP_ARQ_Process(&m_tNodeA.tArq, eFSP_LINKSIMTST_GetTick());
+        (void)eFSP_ARQ_Process(&m_tNodeB.tArq, eFSP_LINKSIMTST_GetTick());
+    }
+    if( ( 1u == m_tNodeA.tArq.uRetxN ) && ( 1u == m_tChanBA.uFrameN ) )
+    {
+        (void)printf("eFSP_ARQTST_TxError 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_ARQ_SLOT_SACKED == m_tNodeA.tArq.atTxSlot[0u].eState )
+    {
+        (void)printf("eFSP_ARQTST_TxError 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_ARQTST_TxError 18 -- FAIL \n");
+    }
+}
@@ -0,0 +1,1620 @@
+/**
+ * @file       eFSP_FRAGTST.c
+ *
+ * @brief      Fragmentation and reassembly test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_FRAGTST.h"
+#include "eFSP_FRAG.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_FRAGTST_MSGL                                               ( 1000u )
+#define EFSP_FRAGTST_FRAGL                                              ( 60u )
+#define EFSP_FRAGTST_FRAGN                                              ( 17u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST STRUCT DECLARATION
+ **********************************************************************************************************************/
+struct t_eFSP_FRAG_SinkCtxUser
+{
+    uint8_t* puDest;
+    uint32_t uDestL;
+    uint32_t uCallN;
+    bool_t   bFail;
+};
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST VARIABLE DECLARATION
+ **********************************************************************************************************************/
+static uint8_t m_auMsg[EFSP_FRAGTST_MSGL];
+static uint8_t m_auFrag[EFSP_FRAGTST_FRAGN + 1u][EFSP_FRAG_HEADERSIZE + EFSP_FRAGTST_FRAGL];
+static uint32_t m_auFragL[EFSP_FRAGTST_FRAGN + 1u];
+static uint8_t m_auData[EFSP_FRAGTST_MSGL];
+static uint8_t m_auMap[( EFSP_FRAGTST_FRAGN + 7u ) / 8u];
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_FRAGTST_sinkMsg(t_eFSP_FRAG_SinkCtx* const p_ptCtx, const uint32_t p_uOffset,
+                                   const uint8_t* p_puData, const uint32_t p_uDataL);
+static bool_t eFSP_FRAGTST_SplitMsg(t_eFSP_FRAG_TxCtx* p_ptCtx, const uint32_t p_uDataL, const uint32_t p_uFragL,
+                                    uint32_t* const p_puFragN);
+static void eFSP_FRAGTST_InitRx(t_eFSP_FRAG_RxCtx* p_ptCtx, t_eFSP_FRAG_SinkCtx* p_ptSinkCtx);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_FRAGTST_BadPointer(void);
+static void eFSP_FRAGTST_BadInit(void);
+static void eFSP_FRAGTST_BadParamEntr(void);
+static void eFSP_FRAGTST_CorruptContext(void);
+static void eFSP_FRAGTST_General(void);
+static void eFSP_FRAGTST_OutOfOrder(void);
+static void eFSP_FRAGTST_Sink(void);
+static void eFSP_FRAGTST_BadFrame(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_FRAGTST_ExeTest(void)
+{
+	(void)printf("\n\nFRAG TEST START \n\n");
+
+    eFSP_FRAGTST_BadPointer();
+    eFSP_FRAGTST_BadInit();
+    eFSP_FRAGTST_BadParamEntr();
+    eFSP_FRAGTST_CorruptContext();
+    eFSP_FRAGTST_General();
+    eFSP_FRAGTST_OutOfOrder();
+    eFSP_FRAGTST_Sink();
+    eFSP_FRAGTST_BadFrame();
+
+    (void)printf("\n\nFRAG TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_FRAGTST_sinkMsg(t_eFSP_FRAG_SinkCtx* const p_ptCtx, const uint32_t p_uOffset, const uint8_t* p_puData,
+                            const uint32_t p_uDataL)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puData ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( true == p_ptCtx->bFail ) || ( ( p_uOffset + p_uDataL ) > p_ptCtx->uDestL ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        (void)memcpy(&p_ptCtx->puDest[p_uOffset], p_puData, p_uDataL);
+        p_ptCtx->uCallN++;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_FRAGTST_SplitMsg(t_eFSP_FRAG_TxCtx* p_ptCtx, const uint32_t p_uDataL, const uint32_t p_uFragL,
+                             uint32_t* const p_puFragN)
+{
+    bool_t l_bRes;
+    e_eFSP_FRAG_RES l_eRes;
+
+    /* Split the test message in m_auFrag, the last row is only for the end of the message */
+    *p_puFragN = 0u;
+    l_eRes = eFSP_FRAG_TxNewMsg(p_ptCtx, m_auMsg, p_uDataL, p_uFragL);
+    while( ( e_eFSP_FRAG_RES_OK == l_eRes ) && ( *p_puFragN <= EFSP_FRAGTST_FRAGN ) )
+    {
+        l_eRes = eFSP_FRAG_TxGetFrag(p_ptCtx, m_auFrag[*p_puFragN], sizeof(m_auFrag[0u]), &m_auFragL[*p_puFragN]);
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            (*p_puFragN)++;
+        }
+    }
+
+    if( e_eFSP_FRAG_RES_MESSAGEENDED == l_eRes )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+void eFSP_FRAGTST_InitRx(t_eFSP_FRAG_RxCtx* p_ptCtx, t_eFSP_FRAG_SinkCtx* p_ptSinkCtx)
+{
+    t_eFSP_FRAG_RxInitData l_tInitData;
+
+    /* With a sink context the message is streamed, else it's placed in m_auData */
+    (void)memset(m_auData, 0, sizeof(m_auData));
+
+    if( NULL == p_ptSinkCtx )
+    {
+        l_tInitData.puIDataArea = m_auData;
+        l_tInitData.uIDataAreaL = sizeof(m_auData);
+    }
+    else
+    {
+        p_ptSinkCtx->puDest = m_auData;
+        p_ptSinkCtx->uDestL = sizeof(m_auData);
+        p_ptSinkCtx->uCallN = 0u;
+        p_ptSinkCtx->bFail = false;
+        l_tInitData.puIDataArea = NULL;
+        l_tInitData.uIDataAreaL = 0u;
+    }
+
+    l_tInitData.fISink = &eFSP_FRAGTST_sinkMsg;
+    l_tInitData.ptISinkCtx = p_ptSinkCtx;
+    l_tInitData.puIMapArea = m_auMap;
+    l_tInitData.uIMapAreaL = sizeof(m_auMap);
+
+    (void)eFSP_FRAG_RxInitCtx(p_ptCtx, &l_tInitData);
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_FRAGTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    t_eFSP_FRAG_RxInitData l_tInitData;
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    uint32_t l_uVal2;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tTx, 0, sizeof(l_tTx));
+    (void)memset(&l_tRx, 0, sizeof(l_tRx));
+    l_tInitData.puIDataArea = m_auData;
+    l_tInitData.uIDataAreaL = sizeof(m_auData);
+    l_tInitData.fISink = NULL;
+    l_tInitData.ptISinkCtx = NULL;
+    l_tInitData.puIMapArea = m_auMap;
+    l_tInitData.uIMapAreaL = sizeof(m_auMap);
+
+    /* Function */
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxInitCtx(NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxIsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxIsInit(&l_tTx, NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxNewMsg(NULL, m_auMsg, 10u, 5u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxNewMsg(&l_tTx, NULL, 10u, 5u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxGetFrag(NULL, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxGetFrag(&l_tTx, NULL, sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxGetFragAt(NULL, 0u, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxGetFragAt(&l_tTx, 0u, NULL, sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_TxGetFragAt(&l_tTx, 0u, m_auFrag[0u], sizeof(m_auFrag[0u]), NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 11 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxInitCtx(NULL, &l_tInitData) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxInitCtx(&l_tRx, NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 13 -- FAIL \n");
+    }
+
+    l_tInitData.puIMapArea = NULL;
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxInitCtx(&l_tRx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 14 -- FAIL \n");
+    }
+
+    l_tInitData.puIMapArea = m_auMap;
+    l_tInitData.puIDataArea = NULL;
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxInitCtx(&l_tRx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxIsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxIsInit(&l_tRx, NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxNewMsg(NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxInsFrag(NULL, m_auFrag[0u], sizeof(m_auFrag[0u])) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxInsFrag(&l_tRx, NULL, sizeof(m_auFrag[0u])) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxGetProgress(NULL, &l_uVal, &l_uVal2) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxGetProgress(&l_tRx, NULL, &l_uVal2) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 22 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uVal, NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxGetMsg(NULL, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxGetMsg(&l_tRx, NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPOINTER == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, NULL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadPointer 26 -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    uint32_t l_uVal2;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tTx, 0, sizeof(l_tTx));
+    (void)memset(&l_tRx, 0, sizeof(l_tRx));
+
+    /* Function */
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxIsInit(&l_tTx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 10u, 5u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_TxGetFragAt(&l_tTx, 0u, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxIsInit(&l_tRx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_RxNewMsg(&l_tRx) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], sizeof(m_auFrag[0u])) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uVal, &l_uVal2) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITLIB == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 9  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxInitCtx(&l_tTx) )
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxIsInit(&l_tTx, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 11 -- FAIL \n");
+    }
+
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxIsInit(&l_tRx, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadInit 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadInit 12 -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    t_eFSP_FRAG_RxInitData l_tInitData;
+    uint32_t l_uVal;
+    uint32_t l_uVal2;
+
+    /* Clear */
+    l_tInitData.puIDataArea = m_auData;
+    l_tInitData.uIDataAreaL = sizeof(m_auData);
+    l_tInitData.fISink = NULL;
+    l_tInitData.ptISinkCtx = NULL;
+    l_tInitData.puIMapArea = m_auMap;
+    l_tInitData.uIMapAreaL = sizeof(m_auMap);
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+
+    /* Function, empty message, invalid fragment size or too many fragments */
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 0u, 5u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 10u, 0u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 10u, EFSP_FRAG_MAXFRAGL + 1u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, EFSP_FRAG_MAXFRAGN + 1u, 1u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, EFSP_FRAG_MAXFRAGN, 1u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, MAX_UINT32VAL, EFSP_FRAG_MAXFRAGL) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 0xFFFF0000u, EFSP_FRAG_MAXFRAGL) )
+    {
+        if( EFSP_FRAG_MAXFRAGN == l_tTx.uFragN )
+        {
+            (void)printf("eFSP_FRAGTST_BadParamEntr 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadParamEntr 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+
+    /* Function, no message, buffer too small or index out of the message */
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    if( e_eFSP_FRAG_RES_NOINITMESSAGE == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NOINITMESSAGE == eFSP_FRAG_TxGetFragAt(&l_tTx, 0u, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 12u, 5u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], EFSP_FRAG_HEADERSIZE + 4u, &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], EFSP_FRAG_HEADERSIZE + 5u, &l_uVal) )
+    {
+        if( ( EFSP_FRAG_HEADERSIZE + 5u ) == l_uVal )
+        {
+            (void)printf("eFSP_FRAGTST_BadParamEntr 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadParamEntr 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_TxGetFragAt(&l_tTx, 3u, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxGetFragAt(&l_tTx, 2u, m_auFrag[0u], EFSP_FRAG_HEADERSIZE + 2u, &l_uVal) )
+    {
+        if( ( EFSP_FRAG_HEADERSIZE + 2u ) == l_uVal )
+        {
+            (void)printf("eFSP_FRAGTST_BadParamEntr 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_BadParamEntr 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 14 -- FAIL \n");
+    }
+
+
+    /* Function, empty areas */
+    l_tInitData.uIMapAreaL = 0u;
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_RxInitCtx(&l_tRx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 15 -- FAIL \n");
+    }
+
+    l_tInitData.uIMapAreaL = sizeof(m_auMap);
+    l_tInitData.uIDataAreaL = 0u;
+    if( e_eFSP_FRAG_RES_BADPARAM == eFSP_FRAG_RxInitCtx(&l_tRx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 16 -- FAIL \n");
+    }
+
+    l_tInitData.uIDataAreaL = sizeof(m_auData);
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxInitCtx(&l_tRx, &l_tInitData) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 17 -- FAIL \n");
+    }
+
+
+    /* Function, nothing received */
+    if( e_eFSP_FRAG_RES_NOINITMESSAGE == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uVal, &l_uVal2) )
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadParamEntr 18 -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    uint8_t* l_puData;
+    uint32_t l_uVal;
+    uint32_t l_uVal2;
+
+    /* Function, fragmenter with a wrong number of fragments or index */
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    (void)eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 12u, 5u);
+    l_tTx.uFragN = 2u;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 12u, 5u) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_TxGetFragAt(&l_tTx, 0u, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 3  -- FAIL \n");
+    }
+
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    (void)eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 12u, 5u);
+    l_tTx.uNextIdx = 4u;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 4  -- FAIL \n");
+    }
+
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    (void)eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, 12u, 5u);
+    l_tTx.puData = NULL;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 5  -- FAIL \n");
+    }
+
+
+    /* Function, reassembler without map or with a message that does not fit */
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    l_tRx.puMapArea = NULL;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxNewMsg(&l_tRx) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], sizeof(m_auFrag[0u])) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uVal, &l_uVal2) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uVal) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 9  -- FAIL \n");
+    }
+
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    l_tRx.bHasMsg = true;
+    l_tRx.uDataL = EFSP_FRAGTST_MSGL;
+    l_tRx.uFragL = 1u;
+    l_tRx.uFragN = EFSP_FRAGTST_MSGL;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxNewMsg(&l_tRx) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 10 -- FAIL \n");
+    }
+
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    l_tRx.bHasMsg = true;
+    l_tRx.uDataL = EFSP_FRAGTST_MSGL + 1u;
+    l_tRx.uFragL = EFSP_FRAGTST_FRAGL;
+    l_tRx.uFragN = EFSP_FRAGTST_FRAGN;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxNewMsg(&l_tRx) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 11 -- FAIL \n");
+    }
+
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    l_tRx.bHasMsg = true;
+    l_tRx.uDataL = EFSP_FRAGTST_MSGL;
+    l_tRx.uFragL = EFSP_FRAGTST_FRAGL;
+    l_tRx.uFragN = EFSP_FRAGTST_FRAGN;
+    l_tRx.uRecvN = EFSP_FRAGTST_FRAGN + 1u;
+    if( e_eFSP_FRAG_RES_CORRUPTCTX == eFSP_FRAG_RxNewMsg(&l_tRx) )
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_CorruptContext 12 -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_General(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uFragN;
+    uint32_t l_uRecvN;
+    uint32_t l_uIdx;
+    e_eFSP_FRAG_RES l_eRes;
+
+    /* Clear */
+    for( l_uIdx = 0u; l_uIdx < EFSP_FRAGTST_MSGL; l_uIdx++ )
+    {
+        m_auMsg[l_uIdx] = (uint8_t)( ( l_uIdx * 7u ) + ( l_uIdx >> 8u ) );
+    }
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+
+    /* Function, a message bigger than every fragment is split and reassembled in order */
+    if( true == eFSP_FRAGTST_SplitMsg(&l_tTx, EFSP_FRAGTST_MSGL, EFSP_FRAGTST_FRAGL, &l_uFragN) )
+    {
+        if( EFSP_FRAGTST_FRAGN == l_uFragN )
+        {
+            (void)printf("eFSP_FRAGTST_General 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 1  -- FAIL \n");
+    }
+
+    if( ( EFSP_FRAG_HEADERSIZE + EFSP_FRAGTST_FRAGL ) == m_auFragL[0u] )
+    {
+        if( ( EFSP_FRAG_HEADERSIZE + 40u ) == m_auFragL[EFSP_FRAGTST_FRAGN - 1u] )
+        {
+            (void)printf("eFSP_FRAGTST_General 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 2  -- FAIL \n");
+    }
+
+
+    l_eRes = e_eFSP_FRAG_RES_OK;
+    for( l_uIdx = 0u; ( l_uIdx < ( l_uFragN - 1u ) ) && ( e_eFSP_FRAG_RES_OK == l_eRes ); l_uIdx++ )
+    {
+        l_eRes = eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[l_uIdx], m_auFragL[l_uIdx]);
+    }
+    if( e_eFSP_FRAG_RES_OK == l_eRes )
+    {
+        (void)printf("eFSP_FRAGTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NODATA == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_FRAGTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( ( ( EFSP_FRAGTST_FRAGN - 1u ) == l_uRecvN ) && ( EFSP_FRAGTST_FRAGN == l_uFragN ) )
+        {
+            (void)printf("eFSP_FRAGTST_General 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_MESSAGERECEIVED == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[l_uFragN - 1u], m_auFragL[l_uFragN - 1u]) )
+    {
+        (void)printf("eFSP_FRAGTST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uDataL) )
+    {
+        if( ( m_auData == l_puData ) && ( EFSP_FRAGTST_MSGL == l_uDataL ) )
+        {
+            (void)printf("eFSP_FRAGTST_General 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 7  -- FAIL \n");
+    }
+
+    if( 0 == memcmp(m_auData, m_auMsg, EFSP_FRAGTST_MSGL) )
+    {
+        (void)printf("eFSP_FRAGTST_General 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 8  -- FAIL \n");
+    }
+
+
+    /* Function, a fragment received again is ignored */
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[3u], m_auFragL[3u]) )
+    {
+        (void)printf("eFSP_FRAGTST_General 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( l_uRecvN == l_uFragN )
+        {
+            (void)printf("eFSP_FRAGTST_General 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 10 -- FAIL \n");
+    }
+
+
+    /* Function, after a new message the same fragments are received again */
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxNewMsg(&l_tRx) )
+    {
+        (void)printf("eFSP_FRAGTST_General 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_NODATA == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_FRAGTST_General 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[3u], m_auFragL[3u]) )
+    {
+        (void)printf("eFSP_FRAGTST_General 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( 1u == l_uRecvN )
+        {
+            (void)printf("eFSP_FRAGTST_General 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 14 -- FAIL \n");
+    }
+
+
+    /* Function, a message of a single fragment */
+    if( true == eFSP_FRAGTST_SplitMsg(&l_tTx, 10u, EFSP_FRAGTST_FRAGL, &l_uFragN) )
+    {
+        if( 1u == l_uFragN )
+        {
+            (void)printf("eFSP_FRAGTST_General 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_MESSAGERECEIVED == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], m_auFragL[0u]) )
+    {
+        (void)printf("eFSP_FRAGTST_General 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uDataL) )
+    {
+        if( ( 10u == l_uDataL ) && ( 0 == memcmp(l_puData, m_auMsg, 10u) ) )
+        {
+            (void)printf("eFSP_FRAGTST_General 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_General 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_General 17 -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_OutOfOrder(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uFragN;
+    uint32_t l_uRecvN;
+    uint32_t l_uIdx;
+    uint32_t l_uLen;
+    e_eFSP_FRAG_RES l_eRes;
+
+    /* Clear */
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    (void)eFSP_FRAGTST_SplitMsg(&l_tTx, EFSP_FRAGTST_MSGL, EFSP_FRAGTST_FRAGL, &l_uFragN);
+
+    /* Function, even fragments in reverse order, every one twice */
+    l_eRes = e_eFSP_FRAG_RES_OK;
+    for( l_uIdx = l_uFragN; ( l_uIdx > 0u ) && ( e_eFSP_FRAG_RES_OK == l_eRes ); l_uIdx-- )
+    {
+        if( 0u == ( ( l_uIdx - 1u ) & 0x01u ) )
+        {
+            l_eRes = eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[l_uIdx - 1u], m_auFragL[l_uIdx - 1u]);
+            if( e_eFSP_FRAG_RES_OK == l_eRes )
+            {
+                l_eRes = eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[l_uIdx - 1u], m_auFragL[l_uIdx - 1u]);
+            }
+        }
+    }
+    if( e_eFSP_FRAG_RES_OK == l_eRes )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( ( ( ( EFSP_FRAGTST_FRAGN + 1u ) / 2u ) == l_uRecvN ) )
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 2  -- FAIL \n");
+    }
+
+
+    /* Function, the missing fragments are retrived again from the fragmenter */
+    l_eRes = e_eFSP_FRAG_RES_OK;
+    for( l_uIdx = 1u; ( l_uIdx < l_uFragN ) && ( e_eFSP_FRAG_RES_OK == l_eRes ); l_uIdx += 2u )
+    {
+        l_eRes = eFSP_FRAG_TxGetFragAt(&l_tTx, l_uIdx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uLen);
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            l_eRes = eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], l_uLen);
+        }
+    }
+    if( e_eFSP_FRAG_RES_MESSAGERECEIVED == l_eRes )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uDataL) )
+    {
+        if( ( EFSP_FRAGTST_MSGL == l_uDataL ) && ( 0 == memcmp(l_puData, m_auMsg, EFSP_FRAGTST_MSGL) ) )
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 4  -- FAIL \n");
+    }
+
+
+    /* Function, a fragment of the next message discard the current one */
+    (void)eFSP_FRAG_RxNewMsg(&l_tRx);
+    (void)eFSP_FRAGTST_SplitMsg(&l_tTx, EFSP_FRAGTST_MSGL, EFSP_FRAGTST_FRAGL, &l_uFragN);
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], m_auFragL[0u]) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[1u], m_auFragL[1u]) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 6  -- FAIL \n");
+    }
+
+    if( true == eFSP_FRAGTST_SplitMsg(&l_tTx, EFSP_FRAGTST_MSGL, EFSP_FRAGTST_FRAGL, &l_uFragN) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[5u], m_auFragL[5u]) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( 1u == l_uRecvN )
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 9  -- FAIL \n");
+    }
+
+
+    /* Function, a message with more fragments than the map, or bigger than the area, keep the current one */
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, EFSP_FRAGTST_MSGL, 10u) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uLen) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OUTOFMEM == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], l_uLen) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxNewMsg(&l_tTx, m_auMsg, EFSP_FRAGTST_MSGL + 1u, EFSP_FRAGTST_FRAGL) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_TxGetFrag(&l_tTx, m_auFrag[0u], sizeof(m_auFrag[0u]), &l_uLen) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OUTOFMEM == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], l_uLen) )
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( ( 1u == l_uRecvN ) && ( EFSP_FRAGTST_FRAGN == l_uFragN ) )
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_OutOfOrder 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_OutOfOrder 16 -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_Sink(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    t_eFSP_FRAG_SinkCtx l_tSink;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uFragN;
+    uint32_t l_uRecvN;
+    uint32_t l_uIdx;
+    e_eFSP_FRAG_RES l_eRes;
+
+    /* Clear */
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    eFSP_FRAGTST_InitRx(&l_tRx, &l_tSink);
+    (void)eFSP_FRAGTST_SplitMsg(&l_tTx, EFSP_FRAGTST_MSGL, EFSP_FRAGTST_FRAGL, &l_uFragN);
+
+    /* Function, a sink error leave the fragment missing */
+    l_tSink.bFail = true;
+    if( e_eFSP_FRAG_RES_SINKCLBKERROR == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[4u], m_auFragL[4u]) )
+    {
+        (void)printf("eFSP_FRAGTST_Sink 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_Sink 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        if( 0u == l_uRecvN )
+        {
+            (void)printf("eFSP_FRAGTST_Sink 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_Sink 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_Sink 2  -- FAIL \n");
+    }
+
+    l_tSink.bFail = false;
+
+    /* Function, every fragment is streamed once, at its offset */
+    l_eRes = e_eFSP_FRAG_RES_OK;
+    for( l_uIdx = 0u; ( l_uIdx < l_uFragN ) && ( e_eFSP_FRAG_RES_OK == l_eRes ); l_uIdx++ )
+    {
+        l_eRes = eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[( l_uIdx * 5u ) % l_uFragN], m_auFragL[( l_uIdx * 5u ) % l_uFragN]);
+        if( e_eFSP_FRAG_RES_OK == l_eRes )
+        {
+            l_eRes = eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], m_auFragL[0u]);
+        }
+    }
+    if( e_eFSP_FRAG_RES_MESSAGERECEIVED == l_eRes )
+    {
+        if( EFSP_FRAGTST_FRAGN == l_tSink.uCallN )
+        {
+            (void)printf("eFSP_FRAGTST_Sink 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_Sink 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_Sink 3  -- FAIL \n");
+    }
+
+    if( 0 == memcmp(m_auData, m_auMsg, EFSP_FRAGTST_MSGL) )
+    {
+        (void)printf("eFSP_FRAGTST_Sink 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_Sink 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_OK == eFSP_FRAG_RxGetMsg(&l_tRx, &l_puData, &l_uDataL) )
+    {
+        if( ( NULL == l_puData ) && ( EFSP_FRAGTST_MSGL == l_uDataL ) )
+        {
+            (void)printf("eFSP_FRAGTST_Sink 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_FRAGTST_Sink 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_Sink 5  -- FAIL \n");
+    }
+}
+
+void eFSP_FRAGTST_BadFrame(void)
+{
+    /* Local variable */
+    t_eFSP_FRAG_TxCtx l_tTx;
+    t_eFSP_FRAG_RxCtx l_tRx;
+    uint8_t l_auFrag[EFSP_FRAG_HEADERSIZE + EFSP_FRAGTST_FRAGL];
+    uint32_t l_uFragN;
+    uint32_t l_uRecvN;
+
+    /* Clear */
+    (void)eFSP_FRAG_TxInitCtx(&l_tTx);
+    eFSP_FRAGTST_InitRx(&l_tRx, NULL);
+    (void)eFSP_FRAGTST_SplitMsg(&l_tTx, EFSP_FRAGTST_MSGL, EFSP_FRAGTST_FRAGL, &l_uFragN);
+
+    /* Function, only the header */
+    if( e_eFSP_FRAG_RES_BADFRAME == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], EFSP_FRAG_HEADERSIZE) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 1  -- FAIL \n");
+    }
+
+
+    /* Function, payload not coherent with the header */
+    if( e_eFSP_FRAG_RES_BADFRAME == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[0u], m_auFragL[0u] - 1u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_FRAG_RES_BADFRAME == eFSP_FRAG_RxInsFrag(&l_tRx, m_auFrag[l_uFragN - 1u], m_auFragL[l_uFragN - 1u] + 1u) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 3  -- FAIL \n");
+    }
+
+
+    /* Function, index out of the message, no fragment size or no message size */
+    (void)memcpy(l_auFrag, m_auFrag[0u], sizeof(l_auFrag));
+    l_auFrag[1u] = (uint8_t)EFSP_FRAGTST_FRAGN;
+    if( e_eFSP_FRAG_RES_BADFRAME == eFSP_FRAG_RxInsFrag(&l_tRx, l_auFrag, sizeof(l_auFrag)) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 4  -- FAIL \n");
+    }
+
+    (void)memcpy(l_auFrag, m_auFrag[0u], sizeof(l_auFrag));
+    l_auFrag[3u] = 0u;
+    if( e_eFSP_FRAG_RES_BADFRAME == eFSP_FRAG_RxInsFrag(&l_tRx, l_auFrag, sizeof(l_auFrag)) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 5  -- FAIL \n");
+    }
+
+    (void)memcpy(l_auFrag, m_auFrag[0u], sizeof(l_auFrag));
+    l_auFrag[5u] = 0u;
+    l_auFrag[6u] = 0u;
+    if( e_eFSP_FRAG_RES_BADFRAME == eFSP_FRAG_RxInsFrag(&l_tRx, l_auFrag, sizeof(l_auFrag)) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 6  -- FAIL \n");
+    }
+
+
+    /* Function, nothing started */
+    if( e_eFSP_FRAG_RES_NOINITMESSAGE == eFSP_FRAG_RxGetProgress(&l_tRx, &l_uRecvN, &l_uFragN) )
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_FRAGTST_BadFrame 7  -- FAIL \n");
+    }
+}
+
@@ -0,0 +1,357 @@
+/**
+ * @file       eFSP_LINKSIMTST.c
+ *
+ * @brief      Simulated link shared by the transport tests
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_LINKSIMTST.h"
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST VARIABLE DECLARATION
+ **********************************************************************************************************************/
+static uint32_t m_uLinkTick;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_LINKSIMTST_c32SAdaptRx(t_eFSP_MSGD_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD,
+                                          const uint32_t p_uDLen, uint32_t* const p_puC32Val);
+static bool_t eFSP_LINKSIMTST_c32SAdaptTx(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD,
+                                          const uint32_t p_uDLen, uint32_t* const p_puC32Val);
+static bool_t eFSP_LINKSIMTST_sendMsg(t_eFSP_MSGTX_TxCtx* p_ptCtx, const uint8_t* p_puDataToTx,
+                                      const uint32_t p_uDataToTxL, uint32_t* const p_uDataTxed,
+                                      const uint32_t p_uTimeToTx);
+static bool_t eFSP_LINKSIMTST_receiveMsg(t_eFSP_MSGRX_RxCtx* p_ptCtx, uint8_t* p_puDataToRx,
+                                         uint32_t* const p_puDataRxedL, const uint32_t p_uDataRxMax,
+                                         const uint32_t p_uTimeToRx);
+static bool_t eFSP_LINKSIMTST_timStartTx(t_eFSP_MSGTX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal);
+static bool_t eFSP_LINKSIMTST_timGetRemainingTx(t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings);
+static bool_t eFSP_LINKSIMTST_timStartRx(t_eFSP_MSGRX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal);
+static bool_t eFSP_LINKSIMTST_timGetRemainingRx(t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_LINKSIMTST_SetTick(const uint32_t p_uTick)
+{
+    m_uLinkTick = p_uTick;
+}
+
+void eFSP_LINKSIMTST_StepTick(void)
+{
+    m_uLinkTick++;
+}
+
+uint32_t eFSP_LINKSIMTST_GetTick(void)
+{
+    return m_uLinkTick;
+}
+
+void eFSP_LINKSIMTST_InitChan(t_eFSP_LINKSIMTST_Chan* p_ptChan, const uint32_t p_uLatency,
+                              const uint32_t p_uLossPerc, const uint32_t p_uLossMask)
+{
+    (void)memset(p_ptChan, 0, sizeof(t_eFSP_LINKSIMTST_Chan));
+    p_ptChan->uLatency = p_uLatency;
+    p_ptChan->uLossPerc = p_uLossPerc;
+    p_ptChan->uLossMask = p_uLossMask;
+    p_ptChan->uSeed = 0x1234u;
+}
+
+bool_t eFSP_LINKSIMTST_InitNode(t_eFSP_LINKSIMTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                                t_eFSP_LINKSIMTST_Chan* p_ptRxChan)
+{
+    bool_t l_bRes;
+    t_eFSP_MSGTX_InitData l_tInitTx;
+    t_eFSP_MSGRX_InitData l_tInitRx;
+
+    (void)memset(p_ptNode, 0, sizeof(t_eFSP_LINKSIMTST_Node));
+    (void)memset(&l_tInitTx, 0, sizeof(t_eFSP_MSGTX_InitData));
+    (void)memset(&l_tInitRx, 0, sizeof(t_eFSP_MSGRX_InitData));
+    p_ptNode->tTx.ptChan = p_ptTxChan;
+    p_ptNode->tRx.ptChan = p_ptRxChan;
+
+    /* One callback for every call, so a call is a tick and the buffer size is the line rate */
+    l_tInitTx.puIMemArea = p_ptNode->auTxMem;
+    l_tInitTx.uIMemAreaL = sizeof(p_ptNode->auTxMem);
+    l_tInitTx.puITxBuffArea = p_ptNode->auTxBuff;
+    l_tInitTx.uITxBuffAreaL = sizeof(p_ptNode->auTxBuff);
+    l_tInitTx.fICrc = &eFSP_LINKSIMTST_c32SAdaptTx;
+    l_tInitTx.ptICbCrcCtx = &p_ptNode->tCrcTx;
+    l_tInitTx.fITx = &eFSP_LINKSIMTST_sendMsg;
+    l_tInitTx.ptICbTxCtx = &p_ptNode->tTx;
+    l_tInitTx.tITxTim.ptTimCtx = &p_ptNode->tTimTx;
+    l_tInitTx.tITxTim.fTimStart = &eFSP_LINKSIMTST_timStartTx;
+    l_tInitTx.tITxTim.fTimGetRemain = &eFSP_LINKSIMTST_timGetRemainingTx;
+    l_tInitTx.uITimeoutMs = 1000u;
+    l_tInitTx.uITimePerSendMs = 1u;
+
+    l_tInitRx.puIMemArea = p_ptNode->auRxMem;
+    l_tInitRx.uIMemAreaL = sizeof(p_ptNode->auRxMem);
+    l_tInitRx.puIRxBuffArea = p_ptNode->auRxBuff;
+    l_tInitRx.uIRxBuffAreaL = sizeof(p_ptNode->auRxBuff);
+    l_tInitRx.fICrc = &eFSP_LINKSIMTST_c32SAdaptRx;
+    l_tInitRx.ptICbCrcCtx = &p_ptNode->tCrcRx;
+    l_tInitRx.fIRx = &eFSP_LINKSIMTST_receiveMsg;
+    l_tInitRx.ptICbRxCtx = &p_ptNode->tRx;
+    l_tInitRx.tIRxTim.ptTimCtx = &p_ptNode->tTimRx;
+    l_tInitRx.tIRxTim.fTimStart = &eFSP_LINKSIMTST_timStartRx;
+    l_tInitRx.tIRxTim.fTimGetRemain = &eFSP_LINKSIMTST_timGetRemainingRx;
+    l_tInitRx.uITimeoutMs = 1000u;
+    l_tInitRx.uITimePerRecMs = 1u;
+    l_tInitRx.bINeedWaitFrameStart = true;
+
+    if( ( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_InitCtx(&p_ptNode->tMsgTx, &l_tInitTx) ) &&
+        ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_InitCtx(&p_ptNode->tMsgRx, &l_tInitRx) ) &&
+        ( e_eFSP_MSGRX_RES_OK == eFSP_MSGRX_NewMsg(&p_ptNode->tMsgRx) ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_LINKSIMTST_c32SAdaptRx(t_eFSP_MSGD_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD,
+                                   const uint32_t p_uDLen, uint32_t* const p_puC32Val)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puC32Val ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->eLastEr = eCU_CRC_32Seed(p_uS, (const uint8_t*)p_puD, p_uDLen, p_puC32Val);
+        if( e_eCU_CRC_RES_OK == p_ptCtx->eLastEr )
+        {
+            l_bRes = true;
+        }
+        else
+        {
+            l_bRes = false;
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_c32SAdaptTx(t_eFSP_MSGE_CrcCtx* p_ptCtx, const uint32_t p_uS, const uint8_t* p_puD,
+                                   const uint32_t p_uDLen, uint32_t* const p_puC32Val)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puC32Val ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->eLastEr = eCU_CRC_32Seed(p_uS, (const uint8_t*)p_puD, p_uDLen, p_puC32Val);
+        if( e_eCU_CRC_RES_OK == p_ptCtx->eLastEr )
+        {
+            l_bRes = true;
+        }
+        else
+        {
+            l_bRes = false;
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_sendMsg(t_eFSP_MSGTX_TxCtx* p_ptCtx, const uint8_t* p_puDataToTx, const uint32_t p_uDataToTxL,
+                               uint32_t* const p_uDataTxed, const uint32_t p_uTimeToTx)
+{
+    bool_t l_bRes;
+    t_eFSP_LINKSIMTST_Chan* l_ptChan;
+    uint32_t l_uIdx;
+    uint8_t l_uByte;
+
+    (void)p_uTimeToTx;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToTx ) || ( NULL == p_uDataTxed ) )
+    {
+        l_bRes = false;
+    }
+    else if( ( p_ptCtx->ptChan->uIns - p_ptCtx->ptChan->uRet + p_uDataToTxL ) > EFSP_LINKSIMTST_CHANSIZE )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_ptChan = p_ptCtx->ptChan;
+
+        for( l_uIdx = 0u; l_uIdx < p_uDataToTxL; l_uIdx++ )
+        {
+            l_uByte = p_puDataToTx[l_uIdx];
+
+            if( ECU_SOF == l_uByte )
+            {
+                /* New frame, decide if it will be lost */
+                l_ptChan->uSeed = ( l_ptChan->uSeed * 1103515245u ) + 12345u;
+                l_ptChan->bCorrupt = ( ( ( l_ptChan->uSeed >> 16u ) % 100u ) < l_ptChan->uLossPerc );
+                if( ( l_ptChan->uFrameN < 32u ) && ( 0u != ( l_ptChan->uLossMask & ( 1u << l_ptChan->uFrameN ) ) ) )
+                {
+                    l_ptChan->bCorrupt = true;
+                }
+                l_ptChan->uFrameN++;
+            }
+            else if( ( true == l_ptChan->bCorrupt ) && ( ECU_EOF != l_uByte ) && ( ECU_ESC != l_uByte ) &&
+                     ( ECU_SOF != ( l_uByte ^ 1u ) ) && ( ECU_EOF != ( l_uByte ^ 1u ) ) &&
+                     ( ECU_ESC != ( l_uByte ^ 1u ) ) )
+            {
+                /* Flip a bit without creating a special char, so only the CRC can see it */
+                l_uByte ^= 1u;
+                l_ptChan->bCorrupt = false;
+            }
+            else
+            {
+                /* Byte sent as is */
+            }
+
+            l_ptChan->auData[l_ptChan->uIns % EFSP_LINKSIMTST_CHANSIZE] = l_uByte;
+            l_ptChan->auAt[l_ptChan->uIns % EFSP_LINKSIMTST_CHANSIZE] = m_uLinkTick + l_ptChan->uLatency;
+            l_ptChan->uIns++;
+        }
+
+        *p_uDataTxed = p_uDataToTxL;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_receiveMsg(t_eFSP_MSGRX_RxCtx* p_ptCtx, uint8_t* p_puDataToRx,
+                                  uint32_t* const p_puDataRxedL, const uint32_t p_uDataRxMax,
+                                  const uint32_t p_uTimeToRx)
+{
+    bool_t l_bRes;
+    t_eFSP_LINKSIMTST_Chan* l_ptChan;
+    uint32_t l_uRxL;
+
+    (void)p_uTimeToRx;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToRx ) || ( NULL == p_puDataRxedL ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        l_ptChan = p_ptCtx->ptChan;
+        l_uRxL = 0u;
+
+        /* Only the bytes already arrived */
+        while( ( l_uRxL < p_uDataRxMax ) && ( l_ptChan->uRet != l_ptChan->uIns ) &&
+               ( l_ptChan->auAt[l_ptChan->uRet % EFSP_LINKSIMTST_CHANSIZE] <= m_uLinkTick ) )
+        {
+            p_puDataToRx[l_uRxL] = l_ptChan->auData[l_ptChan->uRet % EFSP_LINKSIMTST_CHANSIZE];
+            l_ptChan->uRet++;
+            l_uRxL++;
+        }
+
+        *p_puDataRxedL = l_uRxL;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_timStartTx(t_eFSP_MSGTX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimRemainingT = p_uTimeoutVal;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_timGetRemainingTx(t_eFSP_MSGTX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puRemainings ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_ptCtx->uTimRemainingT > 0u )
+        {
+            p_ptCtx->uTimRemainingT--;
+        }
+
+        *p_puRemainings = p_ptCtx->uTimRemainingT;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_timStartRx(t_eFSP_MSGRX_TimCtx* p_ptCtx, const uint32_t p_uTimeoutVal)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimRemainingT = p_uTimeoutVal;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_LINKSIMTST_timGetRemainingRx(t_eFSP_MSGRX_TimCtx* p_ptCtx, uint32_t* const p_puRemainings)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puRemainings ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_ptCtx->uTimRemainingT > 0u )
+        {
+            p_ptCtx->uTimRemainingT--;
+        }
+
+        *p_puRemainings = p_ptCtx->uTimRemainingT;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
@@ -0,0 +1,1647 @@
+/**
+ * @file       eFSP_MUXTST.c
+ *
+ * @brief      Logical channel multiplexer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_MUXTST.h"
+#include "eFSP_LINKSIMTST.h"
+#include "eFSP_MUX.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_MUXTST_PAYL                                                ( 16u )
+#define EFSP_MUXTST_AREAL                                               ( 512u )
+#define EFSP_MUXTST_NCHAN                                               ( 4u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST STRUCT DECLARATION
+ **********************************************************************************************************************/
+typedef struct
+{
+    t_eFSP_MUX_Ctx         tMux;
+    t_eFSP_LINKSIMTST_Node tLink;
+    uint8_t                auTxArea[EFSP_MUXTST_NCHAN][EFSP_MUXTST_AREAL];
+    uint8_t                auRxArea[EFSP_MUXTST_NCHAN][EFSP_MUXTST_AREAL];
+}t_eFSP_MUXTST_Node;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST VARIABLE DECLARATION
+ **********************************************************************************************************************/
+static t_eFSP_LINKSIMTST_Chan m_tChanAB;
+static t_eFSP_LINKSIMTST_Chan m_tChanBA;
+static t_eFSP_MUXTST_Node m_tNodeA;
+static t_eFSP_MUXTST_Node m_tNodeB;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_MUXTST_InitNode(t_eFSP_MUXTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                                   t_eFSP_LINKSIMTST_Chan* p_ptRxChan);
+static bool_t eFSP_MUXTST_OpenChan(t_eFSP_MUXTST_Node* p_ptNode, const uint32_t p_uChanId, const uint32_t p_uTxAreaL,
+                                   const uint32_t p_uRxAreaL, const uint32_t p_uWeight);
+static bool_t eFSP_MUXTST_RunTicks(const uint32_t p_uTicks);
+static void eFSP_MUXTST_FillPayload(uint8_t* p_puData, const uint32_t p_uDataL, const uint8_t p_uSeed);
+static bool_t eFSP_MUXTST_IsPayload(const uint8_t* p_puData, const uint32_t p_uDataL, const uint8_t p_uSeed);
+static bool_t eFSP_MUXTST_Saturate(t_eFSP_MUX_Ctx* p_ptMux, const uint32_t p_uChanId);
+static bool_t eFSP_MUXTST_Drain(t_eFSP_MUX_Ctx* p_ptMux, const uint32_t p_uChanId, uint32_t* const p_puRecvN);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_MUXTST_BadPointer(void);
+static void eFSP_MUXTST_BadInit(void);
+static void eFSP_MUXTST_BadParamEntr(void);
+static void eFSP_MUXTST_CorruptContext(void);
+static void eFSP_MUXTST_General(void);
+static void eFSP_MUXTST_Fairness(void);
+static void eFSP_MUXTST_TxError(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_MUXTST_ExeTest(void)
+{
+	(void)printf("\n\nMUX TEST START \n\n");
+
+    eFSP_MUXTST_BadPointer();
+    eFSP_MUXTST_BadInit();
+    eFSP_MUXTST_BadParamEntr();
+    eFSP_MUXTST_CorruptContext();
+    eFSP_MUXTST_General();
+    eFSP_MUXTST_Fairness();
+    eFSP_MUXTST_TxError();
+
+    (void)printf("\n\nMUX TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_MUXTST_InitNode(t_eFSP_MUXTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                            t_eFSP_LINKSIMTST_Chan* p_ptRxChan)
+{
+    bool_t l_bRes;
+    t_eFSP_MUX_InitData l_tInitMux;
+
+    (void)memset(p_ptNode, 0, sizeof(t_eFSP_MUXTST_Node));
+
+    l_tInitMux.ptIMsgTx = &p_ptNode->tLink.tMsgTx;
+    l_tInitMux.ptIMsgRx = &p_ptNode->tLink.tMsgRx;
+
+    if( ( true == eFSP_LINKSIMTST_InitNode(&p_ptNode->tLink, p_ptTxChan, p_ptRxChan) ) &&
+        ( e_eFSP_MUX_RES_OK == eFSP_MUX_InitCtx(&p_ptNode->tMux, &l_tInitMux) ) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_MUXTST_OpenChan(t_eFSP_MUXTST_Node* p_ptNode, const uint32_t p_uChanId, const uint32_t p_uTxAreaL,
+                            const uint32_t p_uRxAreaL, const uint32_t p_uWeight)
+{
+    bool_t l_bRes;
+    t_eFSP_MUX_ChanData l_tChanData;
+
+    l_tChanData.puITxArea = p_ptNode->auTxArea[p_uChanId];
+    l_tChanData.uITxAreaL = p_uTxAreaL;
+    l_tChanData.puIRxArea = p_ptNode->auRxArea[p_uChanId];
+    l_tChanData.uIRxAreaL = p_uRxAreaL;
+    l_tChanData.uIWeight = p_uWeight;
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_OpenChan(&p_ptNode->tMux, p_uChanId, &l_tChanData) )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_MUXTST_RunTicks(const uint32_t p_uTicks)
+{
+    bool_t l_bRes;
+    uint32_t l_uIdx;
+
+    l_bRes = true;
+    for( l_uIdx = 0u; ( l_uIdx < p_uTicks ) && ( true == l_bRes ); l_uIdx++ )
+    {
+        eFSP_LINKSIMTST_StepTick();
+
+        if( ( e_eFSP_MUX_RES_OK != eFSP_MUX_Process(&m_tNodeA.tMux) ) ||
+            ( e_eFSP_MUX_RES_OK != eFSP_MUX_Process(&m_tNodeB.tMux) ) )
+        {
+            l_bRes = false;
+        }
+    }
+
+    return l_bRes;
+}
+
+void eFSP_MUXTST_FillPayload(uint8_t* p_puData, const uint32_t p_uDataL, const uint8_t p_uSeed)
+{
+    uint32_t l_uIdx;
+
+    for( l_uIdx = 0u; l_uIdx < p_uDataL; l_uIdx++ )
+    {
+        p_puData[l_uIdx] = (uint8_t)( p_uSeed + l_uIdx );
+    }
+}
+
+bool_t eFSP_MUXTST_IsPayload(const uint8_t* p_puData, const uint32_t p_uDataL, const uint8_t p_uSeed)
+{
+    bool_t l_bRes;
+    uint32_t l_uIdx;
+
+    l_bRes = true;
+    for( l_uIdx = 0u; l_uIdx < p_uDataL; l_uIdx++ )
+    {
+        if( p_puData[l_uIdx] != (uint8_t)( p_uSeed + l_uIdx ) )
+        {
+            l_bRes = false;
+        }
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_MUXTST_Saturate(t_eFSP_MUX_Ctx* p_ptMux, const uint32_t p_uChanId)
+{
+    bool_t l_bRes;
+    uint8_t l_auData[EFSP_MUXTST_PAYL];
+    e_eFSP_MUX_RES l_eRes;
+
+    /* Queue payloads of the same size until the queue of the channel is full */
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), (uint8_t)p_uChanId);
+    l_eRes = e_eFSP_MUX_RES_OK;
+    while( e_eFSP_MUX_RES_OK == l_eRes )
+    {
+        l_eRes = eFSP_MUX_Send(p_ptMux, p_uChanId, l_auData, sizeof(l_auData));
+    }
+
+    if( e_eFSP_MUX_RES_QUEUEFULL == l_eRes )
+    {
+        l_bRes = true;
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_MUXTST_Drain(t_eFSP_MUX_Ctx* p_ptMux, const uint32_t p_uChanId, uint32_t* const p_puRecvN)
+{
+    bool_t l_bRes;
+    uint8_t l_auData[EFSP_MUXTST_PAYL];
+    uint32_t l_uDataL;
+    e_eFSP_MUX_RES l_eRes;
+
+    /* Retrive every payload of the channel, and check it's the one queued by eFSP_MUXTST_Saturate */
+    l_bRes = true;
+    l_eRes = e_eFSP_MUX_RES_OK;
+    while( ( true == l_bRes ) && ( e_eFSP_MUX_RES_OK == l_eRes ) )
+    {
+        l_eRes = eFSP_MUX_Recv(p_ptMux, p_uChanId, l_auData, sizeof(l_auData), &l_uDataL);
+        if( e_eFSP_MUX_RES_OK == l_eRes )
+        {
+            if( ( sizeof(l_auData) != l_uDataL ) ||
+                ( true != eFSP_MUXTST_IsPayload(l_auData, l_uDataL, (uint8_t)p_uChanId) ) )
+            {
+                l_bRes = false;
+            }
+            (*p_puRecvN)++;
+        }
+        else if( e_eFSP_MUX_RES_NODATA != l_eRes )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Nothing more */
+        }
+    }
+
+    return l_bRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_MUXTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_MUX_Ctx l_tCtx;
+    t_eFSP_MUX_InitData l_tInitData;
+    t_eFSP_MUX_ChanData l_tChanData;
+    uint8_t l_auData[4u];
+    uint32_t l_uVal;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    l_tChanData.puITxArea = m_tNodeA.auTxArea[0u];
+    l_tChanData.uITxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.puIRxArea = m_tNodeA.auRxArea[0u];
+    l_tChanData.uIRxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.uIWeight = EFSP_MUXTST_PAYL;
+
+    /* Function */
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_InitCtx(NULL, &l_tInitData) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_InitCtx(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 2  -- FAIL \n");
+    }
+
+    l_tInitData.ptIMsgTx = NULL;
+    l_tInitData.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 3  -- FAIL \n");
+    }
+
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitData.ptIMsgRx = NULL;
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 4  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_OpenChan(NULL, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_OpenChan(&l_tCtx, 0u, NULL) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 8  -- FAIL \n");
+    }
+
+    l_tChanData.puITxArea = NULL;
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_OpenChan(&m_tNodeA.tMux, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 9  -- FAIL \n");
+    }
+
+    l_tChanData.puITxArea = m_tNodeA.auTxArea[0u];
+    l_tChanData.puIRxArea = NULL;
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_OpenChan(&m_tNodeA.tMux, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_Send(NULL, 0u, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_Send(&l_tCtx, 0u, NULL, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_Recv(NULL, 0u, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_Recv(&l_tCtx, 0u, NULL, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_Recv(&l_tCtx, 0u, l_auData, sizeof(l_auData), NULL) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPOINTER == eFSP_MUX_Process(NULL) )
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadPointer 16 -- FAIL \n");
+    }
+}
+
+void eFSP_MUXTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_MUX_Ctx l_tCtx;
+    t_eFSP_MUX_ChanData l_tChanData;
+    uint8_t l_auData[4u];
+    uint32_t l_uVal;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    l_tChanData.puITxArea = m_tNodeA.auTxArea[0u];
+    l_tChanData.uITxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.puIRxArea = m_tNodeA.auRxArea[0u];
+    l_tChanData.uIRxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.uIWeight = EFSP_MUXTST_PAYL;
+
+    /* Function */
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_MUXTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NOINITLIB == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NOINITLIB == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_MUXTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NOINITLIB == eFSP_MUX_Recv(&l_tCtx, 0u, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_MUXTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NOINITLIB == eFSP_MUX_Process(&l_tCtx) )
+    {
+        (void)printf("eFSP_MUXTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 5  -- FAIL \n");
+    }
+
+
+    if( true == eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_MUXTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_IsInit(&m_tNodeA.tMux, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_MUXTST_BadInit 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_BadInit 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadInit 7  -- FAIL \n");
+    }
+}
+
+void eFSP_MUXTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_MUX_Ctx l_tCtx;
+    t_eFSP_MUX_InitData l_tInitData;
+    t_eFSP_MUX_ChanData l_tChanData;
+    t_eFSP_MSGTX_Ctx l_tMsgTxNoInit;
+    uint8_t l_auData[64u];
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_tMsgTxNoInit, 0, sizeof(l_tMsgTxNoInit));
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitData.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    l_tChanData.puITxArea = m_tNodeA.auTxArea[0u];
+    l_tChanData.uITxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.puIRxArea = m_tNodeA.auRxArea[0u];
+    l_tChanData.uIRxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.uIWeight = EFSP_MUXTST_PAYL;
+
+    /* Function, the transmitter is not initialized */
+    l_tInitData.ptIMsgTx = &l_tMsgTxNoInit;
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+
+    /* Function, invalid channel ID, weight or area too small */
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_OpenChan(&l_tCtx, EFSP_MUX_MAXCHAN, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    l_tChanData.uIWeight = 0u;
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    l_tChanData.uIWeight = EFSP_MUX_MAXWEIGHT + 1u;
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    l_tChanData.uIWeight = EFSP_MUX_MAXWEIGHT;
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    l_tChanData.uIWeight = EFSP_MUXTST_PAYL;
+    l_tChanData.uITxAreaL = EFSP_MUX_LENSIZE + 1u;
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+    l_tChanData.uITxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.uIRxAreaL = EFSP_MUX_LENSIZE + 1u;
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+    l_tChanData.uIRxAreaL = EFSP_MUXTST_AREAL;
+
+    /* Function, channel ID not valid or not open */
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Send(&l_tCtx, EFSP_MUX_MAXCHAN, l_auData, 4u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Send(&l_tCtx, 1u, l_auData, 4u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Recv(&l_tCtx, EFSP_MUX_MAXCHAN, l_auData, 4u, &l_uVal) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Recv(&l_tCtx, 1u, l_auData, 4u, &l_uVal) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 12 -- FAIL \n");
+    }
+
+
+    /* Function, no payload, payload bigger than the transmitter or than the queue */
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, 0u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, l_tCtx.uMaxPayL + 1u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, l_tCtx.uMaxPayL) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 15 -- FAIL \n");
+    }
+
+    l_tChanData.uITxAreaL = 20u;
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_OpenChan(&l_tCtx, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, 18u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, 17u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_QUEUEFULL == eFSP_MUX_Send(&l_tCtx, 0u, l_auData, 1u) )
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_BadParamEntr 19 -- FAIL \n");
+    }
+}
+
+void eFSP_MUXTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_MUX_ChanData l_tChanData;
+    uint8_t l_auData[4u];
+    uint32_t l_uVal;
+
+    /* Clear */
+    (void)memset(&l_auData, 0, sizeof(l_auData));
+    l_tChanData.puITxArea = m_tNodeA.auTxArea[0u];
+    l_tChanData.uITxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.puIRxArea = m_tNodeA.auRxArea[0u];
+    l_tChanData.uIRxAreaL = EFSP_MUXTST_AREAL;
+    l_tChanData.uIWeight = EFSP_MUXTST_PAYL;
+
+    /* Function, current channel out of range */
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    m_tNodeA.tMux.uCurChan = EFSP_MUX_MAXCHAN;
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_OpenChan(&m_tNodeA.tMux, 0u, &l_tChanData) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Recv(&m_tNodeA.tMux, 0u, l_auData, sizeof(l_auData), &l_uVal) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 4  -- FAIL \n");
+    }
+
+
+    /* Function, missing pointer or no payload */
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    m_tNodeA.tMux.ptMsgRx = NULL;
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 5  -- FAIL \n");
+    }
+
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    m_tNodeA.tMux.uMaxPayL = 0u;
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 6  -- FAIL \n");
+    }
+
+
+    /* Function, open channel without weight or with a deficit that can not be reached */
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    m_tNodeA.tMux.atChan[1u].uWeight = 0u;
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 7  -- FAIL \n");
+    }
+
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    m_tNodeA.tMux.atChan[1u].uDeficit = MAX_UINT32VAL;
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 8  -- FAIL \n");
+    }
+
+
+    /* Function, the size of a queued payload is bigger than the queued data */
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 1u, l_auData, sizeof(l_auData)) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 9  -- FAIL \n");
+    }
+
+    m_tNodeA.auTxArea[1u][0u] = 5u;
+    if( e_eFSP_MUX_RES_CORRUPTCTX == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_CorruptContext 10 -- FAIL \n");
+    }
+}
+
+void eFSP_MUXTST_General(void)
+{
+    /* Local variable */
+    uint8_t l_auData[EFSP_MUXTST_PAYL];
+    uint8_t l_auRecv[EFSP_MUXTST_PAYL];
+    uint32_t l_uRecvL;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    (void)memset(&l_auRecv, 0, sizeof(l_auRecv));
+
+    /* Function, three channels on both side, a fourth one open only on node A */
+    if( true == eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_MUXTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB) )
+    {
+        (void)printf("eFSP_MUXTST_General 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 2  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeA, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 3  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeA, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 4  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeA, 2u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 5  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeA, 3u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 6  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeB, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 7  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeB, 1u, EFSP_MUXTST_AREAL, 20u, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 8  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeB, 2u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 9  -- FAIL \n");
+    }
+
+
+    /* Function, nothing received yet */
+    if( e_eFSP_MUX_RES_NODATA == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_General 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 10 -- FAIL \n");
+    }
+
+
+    /* Function, a payload on every channel */
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x10u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, 3u) )
+    {
+        (void)printf("eFSP_MUXTST_General 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 11 -- FAIL \n");
+    }
+
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x20u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 1u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 12 -- FAIL \n");
+    }
+
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x30u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 2u, l_auData, 7u) )
+    {
+        (void)printf("eFSP_MUXTST_General 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 13 -- FAIL \n");
+    }
+
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x40u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 2u, l_auData, 1u) )
+    {
+        (void)printf("eFSP_MUXTST_General 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 14 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_RunTicks(100u) )
+    {
+        (void)printf("eFSP_MUXTST_General 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 15 -- FAIL \n");
+    }
+
+
+    /* Function, every payload is on its channel, in order */
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( 3u == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x10u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NODATA == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_General 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_BADPARAM == eFSP_MUX_Recv(&m_tNodeB.tMux, 1u, l_auRecv, EFSP_MUXTST_PAYL - 1u, &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_General 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 1u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( EFSP_MUXTST_PAYL == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x20u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 2u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( 7u == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x30u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 2u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( 1u == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x40u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 21 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 21 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NODATA == eFSP_MUX_Recv(&m_tNodeB.tMux, 2u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_General 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 22 -- FAIL \n");
+    }
+
+
+    /* Function, a channel not open on the receiver and a full receive area discard the frame */
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x50u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 3u, l_auData, 4u) )
+    {
+        (void)printf("eFSP_MUXTST_General 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 23 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 1u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 24 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 24 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 1u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 25 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 25 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, 2u) )
+    {
+        (void)printf("eFSP_MUXTST_General 26 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 26 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_RunTicks(100u) )
+    {
+        (void)printf("eFSP_MUXTST_General 27 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 27 -- FAIL \n");
+    }
+
+    if( 1u == m_tNodeB.tMux.atChan[3u].uDropN )
+    {
+        (void)printf("eFSP_MUXTST_General 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 28 -- FAIL \n");
+    }
+
+    if( 1u == m_tNodeB.tMux.atChan[1u].uDropN )
+    {
+        (void)printf("eFSP_MUXTST_General 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 29 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 1u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( EFSP_MUXTST_PAYL == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x50u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 30 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 30 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 30 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NODATA == eFSP_MUX_Recv(&m_tNodeB.tMux, 1u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_General 31 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 31 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( 2u == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x50u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 32 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 32 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 32 -- FAIL \n");
+    }
+
+
+    /* Function, the other direction */
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x60u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeB.tMux, 2u, l_auData, 5u) )
+    {
+        (void)printf("eFSP_MUXTST_General 33 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 33 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_RunTicks(100u) )
+    {
+        (void)printf("eFSP_MUXTST_General 34 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 34 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeA.tMux, 2u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( 5u == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x60u) ) )
+        {
+            (void)printf("eFSP_MUXTST_General 35 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_General 35 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 35 -- FAIL \n");
+    }
+
+
+    /* Function, open again discard every queued payload */
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, 5u) )
+    {
+        (void)printf("eFSP_MUXTST_General 36 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 36 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeA, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_General 37 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 37 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_RunTicks(100u) )
+    {
+        (void)printf("eFSP_MUXTST_General 38 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 38 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NODATA == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_General 39 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_General 39 -- FAIL \n");
+    }
+}
+
+void eFSP_MUXTST_Fairness(void)
+{
+    /* Local variable */
+    uint8_t l_auRecv[EFSP_MUXTST_PAYL];
+    uint32_t l_uRecvL;
+    uint32_t l_uBulkN;
+    uint32_t l_uCtrlN;
+    uint32_t l_uIdx;
+    bool_t l_bRes;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    (void)memset(&l_auRecv, 0, sizeof(l_auRecv));
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    (void)eFSP_MUXTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeB, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeB, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+
+    /* Function, a control payload queued after a bulk transfer is not delayed by the whole bulk queue */
+    if( true == eFSP_MUXTST_Saturate(&m_tNodeA.tMux, 0u) )
+    {
+        (void)printf("eFSP_MUXTST_Fairness 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_Fairness 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 1u, l_auRecv, 4u) )
+    {
+        (void)printf("eFSP_MUXTST_Fairness 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_Fairness 2  -- FAIL \n");
+    }
+
+    l_bRes = true;
+    l_uBulkN = 0u;
+    l_uCtrlN = 0u;
+    for( l_uIdx = 0u; ( l_uIdx < 1000u ) && ( true == l_bRes ) && ( 0u == l_uCtrlN ); l_uIdx++ )
+    {
+        l_bRes = eFSP_MUXTST_RunTicks(1u);
+        if( true == l_bRes )
+        {
+            l_bRes = eFSP_MUXTST_Drain(&m_tNodeB.tMux, 0u, &l_uBulkN);
+        }
+        if( ( true == l_bRes ) &&
+            ( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 1u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) ) )
+        {
+            l_uCtrlN++;
+        }
+    }
+    if( true == l_bRes )
+    {
+        if( ( 1u == l_uCtrlN ) && ( l_uBulkN <= 1u ) )
+        {
+            (void)printf("eFSP_MUXTST_Fairness 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_Fairness 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_Fairness 3  -- FAIL \n");
+    }
+
+
+    /* Function, two saturated channels share the link as their weights */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    (void)eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA);
+    (void)eFSP_MUXTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, 2u * EFSP_MUXTST_PAYL);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeA, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeB, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+    (void)eFSP_MUXTST_OpenChan(&m_tNodeB, 1u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL);
+
+    l_bRes = true;
+    l_uBulkN = 0u;
+    l_uCtrlN = 0u;
+    for( l_uIdx = 0u; ( l_uIdx < 3000u ) && ( true == l_bRes ); l_uIdx++ )
+    {
+        l_bRes = eFSP_MUXTST_Saturate(&m_tNodeA.tMux, 0u);
+        if( true == l_bRes )
+        {
+            l_bRes = eFSP_MUXTST_Saturate(&m_tNodeA.tMux, 1u);
+        }
+        if( true == l_bRes )
+        {
+            l_bRes = eFSP_MUXTST_RunTicks(1u);
+        }
+        if( true == l_bRes )
+        {
+            l_bRes = eFSP_MUXTST_Drain(&m_tNodeB.tMux, 0u, &l_uBulkN);
+        }
+        if( true == l_bRes )
+        {
+            l_bRes = eFSP_MUXTST_Drain(&m_tNodeB.tMux, 1u, &l_uCtrlN);
+        }
+    }
+    if( true == l_bRes )
+    {
+        if( ( l_uCtrlN > 20u ) && ( ( l_uBulkN + 2u ) >= ( 2u * l_uCtrlN ) ) && ( l_uBulkN <= ( ( 2u * l_uCtrlN ) + 2u ) ) )
+        {
+            (void)printf("eFSP_MUXTST_Fairness 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_Fairness 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_Fairness 4  -- FAIL \n");
+    }
+}
+
+void eFSP_MUXTST_TxError(void)
+{
+    /* Local variable */
+    uint8_t l_auData[EFSP_MUXTST_PAYL];
+    uint8_t l_auRecv[EFSP_MUXTST_PAYL];
+    uint32_t l_uRecvL;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    (void)memset(&l_auRecv, 0, sizeof(l_auRecv));
+
+    /* Function, the queue of node A can hold only two payloads */
+    if( true == eFSP_MUXTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 2  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeA, 0u, 40u, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 3  -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_OpenChan(&m_tNodeB, 0u, EFSP_MUXTST_AREAL, EFSP_MUXTST_AREAL, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 4  -- FAIL \n");
+    }
+
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x40u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 5  -- FAIL \n");
+    }
+
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x41u);
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 6  -- FAIL \n");
+    }
+
+
+    /* Function, without credit the payload and the deficit are left in the queue and the frame is retried later */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeA.tLink.tMsgTx, 0u, 0u) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Process(&m_tNodeA.tMux) )
+    {
+        if( ( true == m_tNodeA.tMux.atChan[0u].bTxHead ) && ( EFSP_MUXTST_PAYL == m_tNodeA.tMux.atChan[0u].uDeficit ) &&
+            ( false == m_tNodeA.tMux.bTxBusy ) )
+        {
+            (void)printf("eFSP_MUXTST_TxError 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_TxError 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 9  -- FAIL \n");
+    }
+
+    eFSP_MUXTST_FillPayload(l_auData, sizeof(l_auData), 0x42u);
+    if( e_eFSP_MUX_RES_QUEUEFULL == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 10 -- FAIL \n");
+    }
+
+
+    /* Function, once the credit is granted the same payload is sent, and the next one wrap around the queue */
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_SetCreditLimit(&m_tNodeA.tLink.tMsgTx, 3u, 3u * ( EFSP_MUXTST_PAYL + 1u ) ) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 11 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_RunTicks(1u) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Send(&m_tNodeA.tMux, 0u, l_auData, EFSP_MUXTST_PAYL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 13 -- FAIL \n");
+    }
+
+    if( true == eFSP_MUXTST_RunTicks(100u) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( EFSP_MUXTST_PAYL == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x40u) ) )
+        {
+            (void)printf("eFSP_MUXTST_TxError 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_TxError 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( EFSP_MUXTST_PAYL == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x41u) ) )
+        {
+            (void)printf("eFSP_MUXTST_TxError 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_TxError 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_OK == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        if( ( EFSP_MUXTST_PAYL == l_uRecvL ) && ( true == eFSP_MUXTST_IsPayload(l_auRecv, l_uRecvL, 0x42u) ) )
+        {
+            (void)printf("eFSP_MUXTST_TxError 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_MUXTST_TxError 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_MUX_RES_NODATA == eFSP_MUX_Recv(&m_tNodeB.tMux, 0u, l_auRecv, sizeof(l_auRecv), &l_uRecvL) )
+    {
+        (void)printf("eFSP_MUXTST_TxError 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_MUXTST_TxError 18 -- FAIL \n");
+    }
+}
+
@@ -0,0 +1,1426 @@
+/**
+ * @file       eFSP_NEGOTST.c
+ *
+ * @brief      Link capability negotiation test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_NEGOTST.h"
+#include "eFSP_LINKSIMTST.h"
+#include "eFSP_NEGO.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_NEGOTST_MAXPAYL                                            ( 40u )
+#define EFSP_NEGOTST_MAXWINDOW                                          ( 8u )
+#define EFSP_NEGOTST_RETRYMS                                            ( 40u )
+#define EFSP_NEGOTST_LINGERMS                                           ( 120u )
+#define EFSP_NEGOTST_MAXTICK                                            ( 5000u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST STRUCT DECLARATION
+ **********************************************************************************************************************/
+typedef struct
+{
+    t_eFSP_NEGO_Ctx        tNego;
+    t_eFSP_ARQ_Ctx         tArq;
+    t_eFSP_LINKSIMTST_Node tLink;
+    uint8_t                auArqMem[2u * EFSP_NEGOTST_MAXWINDOW * EFSP_NEGOTST_MAXPAYL];
+}t_eFSP_NEGOTST_Node;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST VARIABLE DECLARATION
+ **********************************************************************************************************************/
+static t_eFSP_LINKSIMTST_Chan m_tChanAB;
+static t_eFSP_LINKSIMTST_Chan m_tChanBA;
+static t_eFSP_NEGOTST_Node m_tNodeA;
+static t_eFSP_NEGOTST_Node m_tNodeB;
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSP_NEGOTST_InitNode(t_eFSP_NEGOTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                                    t_eFSP_LINKSIMTST_Chan* p_ptRxChan);
+static void eFSP_NEGOTST_FullCaps(t_eFSP_NEGO_Caps* p_ptCaps, const uint32_t p_uMaxPayL, const uint32_t p_uWindow);
+static e_eFSP_NEGO_RES eFSP_NEGOTST_InitNego(t_eFSP_NEGOTST_Node* p_ptNode, const t_eFSP_NEGO_Caps* p_ptCaps);
+static bool_t eFSP_NEGOTST_RunNego(const uint32_t p_uStartBTick);
+static bool_t eFSP_NEGOTST_Exchange(t_eFSP_NEGOTST_Node* p_ptTxNode, t_eFSP_NEGOTST_Node* p_ptRxNode,
+                                    const uint32_t p_uMsgL);
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_NEGOTST_BadPointer(void);
+static void eFSP_NEGOTST_BadInit(void);
+static void eFSP_NEGOTST_BadParamEntr(void);
+static void eFSP_NEGOTST_CorruptContext(void);
+static void eFSP_NEGOTST_General(void);
+static void eFSP_NEGOTST_Mismatch(void);
+static void eFSP_NEGOTST_NoCommon(void);
+static void eFSP_NEGOTST_LateLossy(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_NEGOTST_ExeTest(void)
+{
+	(void)printf("\n\nNEGO TEST START \n\n");
+
+    eFSP_NEGOTST_BadPointer();
+    eFSP_NEGOTST_BadInit();
+    eFSP_NEGOTST_BadParamEntr();
+    eFSP_NEGOTST_CorruptContext();
+    eFSP_NEGOTST_General();
+    eFSP_NEGOTST_Mismatch();
+    eFSP_NEGOTST_NoCommon();
+    eFSP_NEGOTST_LateLossy();
+
+    (void)printf("\n\nNEGO TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST FUNCTION IMPLEMENTATION
+ **********************************************************************************************************************/
+bool_t eFSP_NEGOTST_InitNode(t_eFSP_NEGOTST_Node* p_ptNode, t_eFSP_LINKSIMTST_Chan* p_ptTxChan,
+                             t_eFSP_LINKSIMTST_Chan* p_ptRxChan)
+{
+    bool_t l_bRes;
+
+    /* The negotiation context is initialized by every test with its own capabilities */
+    (void)memset(p_ptNode, 0, sizeof(t_eFSP_NEGOTST_Node));
+    l_bRes = eFSP_LINKSIMTST_InitNode(&p_ptNode->tLink, p_ptTxChan, p_ptRxChan);
+
+    return l_bRes;
+}
+
+void eFSP_NEGOTST_FullCaps(t_eFSP_NEGO_Caps* p_ptCaps, const uint32_t p_uMaxPayL, const uint32_t p_uWindow)
+{
+    p_ptCaps->uMaxPayL = p_uMaxPayL;
+    p_ptCaps->uCrcMask = EFSP_NEGO_CRCNONE | EFSP_NEGO_CRC16 | EFSP_NEGO_CRC32;
+    p_ptCaps->uLenMask = EFSP_NEGO_LEN8 | EFSP_NEGO_LEN16 | EFSP_NEGO_LEN32 | EFSP_NEGO_LENVAR;
+    p_ptCaps->uFrmMask = EFSP_NEGO_FRMESC | EFSP_NEGO_FRMCOBS | EFSP_NEGO_FRMTRSP;
+    p_ptCaps->uFeatMask = EFSP_NEGO_FEATCMP;
+    p_ptCaps->uWindow = p_uWindow;
+}
+
+e_eFSP_NEGO_RES eFSP_NEGOTST_InitNego(t_eFSP_NEGOTST_Node* p_ptNode, const t_eFSP_NEGO_Caps* p_ptCaps)
+{
+    t_eFSP_NEGO_InitData l_tInitNego;
+
+    /* The default profile of the encoder is the base profile */
+    l_tInitNego.ptIMsgTx = &p_ptNode->tLink.tMsgTx;
+    l_tInitNego.ptIMsgRx = &p_ptNode->tLink.tMsgRx;
+    l_tInitNego.tICaps = *p_ptCaps;
+    l_tInitNego.uIBaseCrcL = EFSP_HDR_CRC32;
+    l_tInitNego.uIBaseLenL = EFSP_HDR_LEN32;
+    l_tInitNego.uIBaseFrm = EFSP_FRM_ESC;
+    l_tInitNego.uIRetryMs = EFSP_NEGOTST_RETRYMS;
+    l_tInitNego.uILingerMs = EFSP_NEGOTST_LINGERMS;
+
+    return eFSP_NEGO_InitCtx(&p_ptNode->tNego, &l_tInitNego);
+}
+
+bool_t eFSP_NEGOTST_RunNego(const uint32_t p_uStartBTick)
+{
+    bool_t l_bRes;
+    e_eFSP_NEGO_RES l_eResA;
+    e_eFSP_NEGO_RES l_eResB;
+
+    /* Node B is switched on at p_uStartBTick, node A is running since the start */
+    l_bRes = true;
+    l_eResA = e_eFSP_NEGO_RES_OK;
+    l_eResB = e_eFSP_NEGO_RES_OK;
+
+    while( ( true == l_bRes ) && ( eFSP_LINKSIMTST_GetTick() < EFSP_NEGOTST_MAXTICK ) &&
+           ( ( e_eFSP_NEGO_RES_LINKUP != l_eResA ) || ( e_eFSP_NEGO_RES_LINKUP != l_eResB ) ) )
+    {
+        eFSP_LINKSIMTST_StepTick();
+
+        l_eResA = eFSP_NEGO_Process(&m_tNodeA.tNego, eFSP_LINKSIMTST_GetTick());
+
+        if( eFSP_LINKSIMTST_GetTick() >= p_uStartBTick )
+        {
+            l_eResB = eFSP_NEGO_Process(&m_tNodeB.tNego, eFSP_LINKSIMTST_GetTick());
+        }
+
+        if( ( ( e_eFSP_NEGO_RES_OK != l_eResA ) && ( e_eFSP_NEGO_RES_LINKUP != l_eResA ) ) ||
+            ( ( e_eFSP_NEGO_RES_OK != l_eResB ) && ( e_eFSP_NEGO_RES_LINKUP != l_eResB ) ) )
+        {
+            l_bRes = false;
+        }
+    }
+
+    if( ( e_eFSP_NEGO_RES_LINKUP != l_eResA ) || ( e_eFSP_NEGO_RES_LINKUP != l_eResB ) )
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+bool_t eFSP_NEGOTST_Exchange(t_eFSP_NEGOTST_Node* p_ptTxNode, t_eFSP_NEGOTST_Node* p_ptRxNode, const uint32_t p_uMsgL)
+{
+    bool_t l_bRes;
+    bool_t l_bSent;
+    bool_t l_bRecv;
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    uint32_t l_uIdx;
+    uint32_t l_uStartTick;
+    e_eFSP_MSGTX_RES l_eResTx;
+    e_eFSP_MSGRX_RES l_eResRx;
+
+    /* Send a compressible payload with the agreed settings, and check the peer decode it */
+    l_bRes = false;
+    l_bSent = false;
+    l_bRecv = false;
+    l_uStartTick = eFSP_LINKSIMTST_GetTick();
+
+    if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_GetWherePutData(&p_ptTxNode->tLink.tMsgTx, &l_puData, &l_uDataL) )
+    {
+        if( l_uDataL >= p_uMsgL )
+        {
+            for( l_uIdx = 0u; l_uIdx < p_uMsgL; l_uIdx++ )
+            {
+                l_puData[l_uIdx] = (uint8_t)( l_uIdx / 4u );
+            }
+
+            if( e_eFSP_MSGTX_RES_OK == eFSP_MSGTX_NewMessage(&p_ptTxNode->tLink.tMsgTx, p_uMsgL) )
+            {
+                l_bRes = true;
+            }
+        }
+    }
+
+    while( ( true == l_bRes ) && ( false == l_bRecv ) &&
+           ( ( eFSP_LINKSIMTST_GetTick() - l_uStartTick ) < EFSP_NEGOTST_MAXTICK ) )
+    {
+        eFSP_LINKSIMTST_StepTick();
+
+        if( false == l_bSent )
+        {
+            l_eResTx = eFSP_MSGTX_SendChunk(&p_ptTxNode->tLink.tMsgTx);
+            if( e_eFSP_MSGTX_RES_MESSAGESENDED == l_eResTx )
+            {
+                l_bSent = true;
+            }
+            else if( e_eFSP_MSGTX_RES_OK != l_eResTx )
+            {
+                l_bRes = false;
+            }
+            else
+            {
+                /* Frame not completed yet */
+            }
+        }
+
+        l_eResRx = eFSP_MSGRX_ReceiveChunk(&p_ptRxNode->tLink.tMsgRx);
+        if( e_eFSP_MSGRX_RES_MESSAGERECEIVED == l_eResRx )
+        {
+            l_bRecv = true;
+        }
+        else if( ( e_eFSP_MSGRX_RES_OK != l_eResRx ) && ( e_eFSP_MSGRX_RES_FRAMERESTART != l_eResRx ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Frame not completed yet */
+        }
+    }
+
+    if( ( true == l_bRes ) && ( true == l_bRecv ) )
+    {
+        if( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_GetDecodedData(&p_ptRxNode->tLink.tMsgRx, &l_puData, &l_uDataL) )
+        {
+            l_bRes = false;
+        }
+        else if( l_uDataL != p_uMsgL )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            for( l_uIdx = 0u; l_uIdx < p_uMsgL; l_uIdx++ )
+            {
+                if( l_puData[l_uIdx] != (uint8_t)( l_uIdx / 4u ) )
+                {
+                    l_bRes = false;
+                }
+            }
+        }
+
+        if( e_eFSP_MSGRX_RES_OK != eFSP_MSGRX_NewMsg(&p_ptRxNode->tLink.tMsgRx) )
+        {
+            l_bRes = false;
+        }
+    }
+    else
+    {
+        l_bRes = false;
+    }
+
+    return l_bRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_NEGOTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Ctx l_tCtx;
+    t_eFSP_NEGO_InitData l_tInitData;
+    t_eFSP_NEGO_Link l_tLink;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tInitData, 0, sizeof(l_tInitData));
+
+    /* Function */
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_InitCtx(NULL, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_InitCtx(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 2  -- FAIL \n");
+    }
+
+
+    eFSP_NEGOTST_FullCaps(&l_tInitData.tICaps, EFSP_NEGOTST_MAXPAYL, EFSP_NEGOTST_MAXWINDOW);
+    l_tInitData.uIRetryMs = EFSP_NEGOTST_RETRYMS;
+    l_tInitData.uILingerMs = EFSP_NEGOTST_LINGERMS;
+    l_tInitData.ptIMsgTx = NULL;
+    l_tInitData.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 3  -- FAIL \n");
+    }
+
+
+    l_tInitData.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitData.ptIMsgRx = NULL;
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 4  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_Process(NULL, 0u) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_GetLink(NULL, &l_tLink) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_BADPOINTER == eFSP_NEGO_GetLink(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadPointer 9  -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Ctx l_tCtx;
+    t_eFSP_NEGO_Link l_tLink;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    l_bIsInit = true;
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_NEGOTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_NEGOTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_NOINITLIB == eFSP_NEGO_Process(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_NEGOTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_NOINITLIB == eFSP_NEGO_GetLink(&l_tCtx, &l_tLink) )
+    {
+        (void)printf("eFSP_NEGOTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadInit 3  -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Ctx l_tCtx;
+    t_eFSP_NEGO_InitData l_tInitData;
+    t_eFSP_NEGO_InitData l_tInitGood;
+    t_eFSP_MSGTX_Ctx l_tMsgTx;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tMsgTx, 0, sizeof(l_tMsgTx));
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+
+    /* Function */
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+
+    l_tInitGood.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitGood.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    eFSP_NEGOTST_FullCaps(&l_tInitGood.tICaps, EFSP_NEGOTST_MAXPAYL, EFSP_NEGOTST_MAXWINDOW);
+    l_tInitGood.uIBaseCrcL = EFSP_HDR_CRC32;
+    l_tInitGood.uIBaseLenL = EFSP_HDR_LEN32;
+    l_tInitGood.uIBaseFrm = EFSP_FRM_ESC;
+    l_tInitGood.uIRetryMs = EFSP_NEGOTST_RETRYMS;
+    l_tInitGood.uILingerMs = EFSP_NEGOTST_LINGERMS;
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.tICaps.uMaxPayL = 0u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.tICaps.uWindow = 0u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.tICaps.uWindow = 3u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 4  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.tICaps.uWindow = 2u * EFSP_ARQ_MAXWINDOW;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 5  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.uIBaseCrcL = 3u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 6  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.uIBaseLenL = 3u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 7  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.uIBaseFrm = 3u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 8  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.uIRetryMs = 0u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 9  -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    l_tInitData.uILingerMs = 0u;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 10 -- FAIL \n");
+    }
+
+
+    /* The transmitter must be initialized */
+    l_tInitData = l_tInitGood;
+    l_tInitData.ptIMsgTx = &l_tMsgTx;
+    if( e_eFSP_NEGO_RES_BADPARAM == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 11 -- FAIL \n");
+    }
+
+
+    l_tInitData = l_tInitGood;
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_InitCtx(&l_tCtx, &l_tInitData) )
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_BadParamEntr 12 -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Caps l_tCaps;
+    t_eFSP_NEGO_Link l_tLink;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    eFSP_NEGOTST_FullCaps(&l_tCaps, EFSP_NEGOTST_MAXPAYL, EFSP_NEGOTST_MAXWINDOW);
+
+    /* Function */
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCaps) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 2  -- FAIL \n");
+    }
+
+
+    m_tNodeA.tNego.ptMsgTx = NULL;
+    if( e_eFSP_NEGO_RES_CORRUPTCTX == eFSP_NEGO_Process(&m_tNodeA.tNego, 1u) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 3  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCaps) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 4  -- FAIL \n");
+    }
+
+    m_tNodeA.tNego.tLocal.uWindow = 3u;
+    if( e_eFSP_NEGO_RES_CORRUPTCTX == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLink) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 5  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCaps) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 6  -- FAIL \n");
+    }
+
+    m_tNodeA.tNego.uBaseFrm = 3u;
+    if( e_eFSP_NEGO_RES_CORRUPTCTX == eFSP_NEGO_Process(&m_tNodeA.tNego, 1u) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 7  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCaps) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 8  -- FAIL \n");
+    }
+
+    m_tNodeA.tNego.uRetryMs = 0u;
+    if( e_eFSP_NEGO_RES_CORRUPTCTX == eFSP_NEGO_Process(&m_tNodeA.tNego, 1u) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 9  -- FAIL \n");
+    }
+
+
+    /* The peer is known once the agreement is done */
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCaps) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 10 -- FAIL \n");
+    }
+
+    m_tNodeA.tNego.eState = e_eFSP_NEGO_ST_LINGER;
+    if( e_eFSP_NEGO_RES_CORRUPTCTX == eFSP_NEGO_Process(&m_tNodeA.tNego, 1u) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 11 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCaps) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 12 -- FAIL \n");
+    }
+
+    m_tNodeA.tNego.eState = (e_eFSP_NEGO_ST)( e_eFSP_NEGO_ST_LINKUP + 1 );
+    if( e_eFSP_NEGO_RES_CORRUPTCTX == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLink) )
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_CorruptContext 13 -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_General(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Caps l_tCapsA;
+    t_eFSP_NEGO_Caps l_tCapsB;
+    t_eFSP_NEGO_Link l_tLinkA;
+    t_eFSP_NEGO_Link l_tLinkB;
+    t_eFSP_ARQ_InitData l_tInitArq;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    eFSP_NEGOTST_FullCaps(&l_tCapsA, EFSP_NEGOTST_MAXPAYL, EFSP_NEGOTST_MAXWINDOW);
+    eFSP_NEGOTST_FullCaps(&l_tCapsB, EFSP_NEGOTST_MAXPAYL + 8u, EFSP_NEGOTST_MAXWINDOW / 2u);
+
+    /* Function */
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_NEGOTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB) )
+    {
+        (void)printf("eFSP_NEGOTST_General 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCapsA) )
+    {
+        (void)printf("eFSP_NEGOTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeB, &l_tCapsB) )
+    {
+        (void)printf("eFSP_NEGOTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 4  -- FAIL \n");
+    }
+
+
+    l_bIsInit = false;
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_IsInit(&m_tNodeA.tNego, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_NEGOTST_General 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_NEGOTST_General 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_LINKDOWN == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLinkA) )
+    {
+        (void)printf("eFSP_NEGOTST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 6  -- FAIL \n");
+    }
+
+
+    /* Hello, answer and confirmation, the confirmation is never answered */
+    if( true == eFSP_NEGOTST_RunNego(0u) )
+    {
+        (void)printf("eFSP_NEGOTST_General 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 7  -- FAIL \n");
+    }
+
+    if( eFSP_LINKSIMTST_GetTick() < ( 3u * EFSP_NEGOTST_LINGERMS ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 8  -- FAIL \n");
+    }
+
+    if( ( 3u == m_tChanAB.uFrameN ) && ( 3u == m_tChanBA.uFrameN ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_LINKUP == eFSP_NEGO_Process(&m_tNodeA.tNego, eFSP_LINKSIMTST_GetTick()) )
+    {
+        (void)printf("eFSP_NEGOTST_General 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 10 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLinkA) )
+    {
+        (void)printf("eFSP_NEGOTST_General 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeB.tNego, &l_tLinkB) )
+    {
+        (void)printf("eFSP_NEGOTST_General 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 12 -- FAIL \n");
+    }
+
+    if( ( EFSP_NEGOTST_MAXPAYL == l_tLinkA.uMaxPayL ) && ( ( EFSP_NEGOTST_MAXWINDOW / 2u ) == l_tLinkA.uWindow ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 13 -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_CRC32 == l_tLinkA.uCrcL ) && ( EFSP_HDR_LEN8 == l_tLinkA.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 14 -- FAIL \n");
+    }
+
+    if( ( EFSP_FRM_TRSP == l_tLinkA.uFrm ) && ( EFSP_HDR_CMP == l_tLinkA.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 15 -- FAIL \n");
+    }
+
+    if( ( l_tLinkA.uMaxPayL == l_tLinkB.uMaxPayL ) && ( l_tLinkA.uWindow == l_tLinkB.uWindow ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 16 -- FAIL \n");
+    }
+
+    if( ( l_tLinkA.uCrcL == l_tLinkB.uCrcL ) && ( l_tLinkA.uLenL == l_tLinkB.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 17 -- FAIL \n");
+    }
+
+    if( ( l_tLinkA.uFrm == l_tLinkB.uFrm ) && ( l_tLinkA.uCmpL == l_tLinkB.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 18 -- FAIL \n");
+    }
+
+
+    /* The settings are applied on both sides */
+    if( ( EFSP_FRM_TRSP == m_tNodeA.tLink.tMsgTx.tMsgeCtx.uFrm ) &&
+        ( EFSP_HDR_LEN8 == m_tNodeA.tLink.tMsgTx.tMsgeCtx.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 19 -- FAIL \n");
+    }
+
+    if( ( EFSP_FRM_TRSP == m_tNodeB.tLink.tMsgTx.tMsgeCtx.uFrm ) &&
+        ( EFSP_HDR_CMP == m_tNodeB.tLink.tMsgTx.tMsgeCtx.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_General 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 20 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeA, &m_tNodeB, l_tLinkA.uMaxPayL) )
+    {
+        (void)printf("eFSP_NEGOTST_General 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 21 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeB, &m_tNodeA, 5u) )
+    {
+        (void)printf("eFSP_NEGOTST_General 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 22 -- FAIL \n");
+    }
+
+
+    /* An ARQ can use the agreed window and payload */
+    l_tInitArq.ptIMsgTx = &m_tNodeA.tLink.tMsgTx;
+    l_tInitArq.ptIMsgRx = &m_tNodeA.tLink.tMsgRx;
+    l_tInitArq.puIMemArea = m_tNodeA.auArqMem;
+    l_tInitArq.uIMemAreaL = sizeof(m_tNodeA.auArqMem);
+    l_tInitArq.uISlotL = l_tLinkA.uMaxPayL - EFSP_ARQ_PIGGYHEADERSIZE;
+    l_tInitArq.uIWindow = l_tLinkA.uWindow;
+    l_tInitArq.uIRtoMs = 100u;
+    if( e_eFSP_ARQ_RES_OK == eFSP_ARQ_InitCtx(&m_tNodeA.tArq, &l_tInitArq) )
+    {
+        (void)printf("eFSP_NEGOTST_General 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_General 23 -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_Mismatch(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Caps l_tCapsA;
+    t_eFSP_NEGO_Caps l_tCapsB;
+    t_eFSP_NEGO_Link l_tLinkA;
+    t_eFSP_NEGO_Link l_tLinkB;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 3u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 1u, 0u, 0u);
+    eFSP_NEGOTST_FullCaps(&l_tCapsA, EFSP_NEGOTST_MAXPAYL, 2u);
+    eFSP_NEGOTST_FullCaps(&l_tCapsB, 300u, EFSP_NEGOTST_MAXWINDOW);
+    l_tCapsA.uCrcMask = EFSP_NEGO_CRC16 | EFSP_NEGO_CRC32;
+    l_tCapsB.uCrcMask = EFSP_NEGO_CRCNONE | EFSP_NEGO_CRC16;
+    l_tCapsA.uLenMask = EFSP_NEGO_LEN16 | EFSP_NEGO_LEN32;
+    l_tCapsB.uLenMask = EFSP_NEGO_LEN8 | EFSP_NEGO_LEN16;
+    l_tCapsA.uFrmMask = EFSP_NEGO_FRMESC | EFSP_NEGO_FRMCOBS;
+    l_tCapsB.uFrmMask = EFSP_NEGO_FRMCOBS | EFSP_NEGO_FRMTRSP;
+    l_tCapsA.uFeatMask = 0u;
+
+    /* Function */
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCapsA) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeB, &l_tCapsB) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 4  -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_RunNego(0u) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 5  -- FAIL \n");
+    }
+
+
+    /* Best option in common for every category */
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLinkA) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeB.tNego, &l_tLinkB) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 7  -- FAIL \n");
+    }
+
+    if( ( EFSP_NEGOTST_MAXPAYL == l_tLinkA.uMaxPayL ) && ( 2u == l_tLinkA.uWindow ) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 8  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_CRC16 == l_tLinkA.uCrcL ) && ( EFSP_HDR_LEN16 == l_tLinkA.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 9  -- FAIL \n");
+    }
+
+    if( ( EFSP_FRM_COBS == l_tLinkA.uFrm ) && ( EFSP_HDR_CMPNONE == l_tLinkA.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 10 -- FAIL \n");
+    }
+
+    if( ( l_tLinkA.uMaxPayL == l_tLinkB.uMaxPayL ) && ( l_tLinkA.uWindow == l_tLinkB.uWindow ) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 11 -- FAIL \n");
+    }
+
+    if( ( l_tLinkA.uCrcL == l_tLinkB.uCrcL ) && ( l_tLinkA.uLenL == l_tLinkB.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 12 -- FAIL \n");
+    }
+
+    if( ( l_tLinkA.uFrm == l_tLinkB.uFrm ) && ( l_tLinkA.uCmpL == l_tLinkB.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 13 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeA, &m_tNodeB, 17u) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 14 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeB, &m_tNodeA, l_tLinkB.uMaxPayL) )
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_Mismatch 15 -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_NoCommon(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Caps l_tCapsA;
+    t_eFSP_NEGO_Caps l_tCapsB;
+    t_eFSP_NEGO_Link l_tLinkA;
+    t_eFSP_NEGO_Link l_tLinkB;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0u);
+    eFSP_NEGOTST_FullCaps(&l_tCapsA, EFSP_NEGOTST_MAXPAYL, 1u);
+    eFSP_NEGOTST_FullCaps(&l_tCapsB, EFSP_NEGOTST_MAXPAYL, 1u);
+    l_tCapsA.uCrcMask = EFSP_NEGO_CRC32;
+    l_tCapsB.uCrcMask = EFSP_NEGO_CRC16;
+    l_tCapsA.uLenMask = EFSP_NEGO_LEN8;
+    l_tCapsB.uLenMask = EFSP_NEGO_LENVAR;
+    l_tCapsA.uFrmMask = EFSP_NEGO_FRMCOBS;
+    l_tCapsB.uFrmMask = EFSP_NEGO_FRMTRSP;
+    l_tCapsB.uFeatMask = 0u;
+
+    /* Function */
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCapsA) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeB, &l_tCapsB) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 4  -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_RunNego(0u) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 5  -- FAIL \n");
+    }
+
+
+    /* Nothing in common, the base profile is kept */
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLinkA) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeB.tNego, &l_tLinkB) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 7  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_CRC32 == l_tLinkA.uCrcL ) && ( EFSP_HDR_LEN32 == l_tLinkA.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 8  -- FAIL \n");
+    }
+
+    if( ( EFSP_FRM_ESC == l_tLinkA.uFrm ) && ( EFSP_HDR_CMPNONE == l_tLinkA.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 9  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_CRC32 == l_tLinkB.uCrcL ) && ( EFSP_HDR_LEN32 == l_tLinkB.uLenL ) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 10 -- FAIL \n");
+    }
+
+    if( ( EFSP_FRM_ESC == l_tLinkB.uFrm ) && ( 1u == l_tLinkB.uWindow ) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 11 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeA, &m_tNodeB, 9u) )
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_NoCommon 12 -- FAIL \n");
+    }
+}
+
+void eFSP_NEGOTST_LateLossy(void)
+{
+    /* Local variable */
+    t_eFSP_NEGO_Caps l_tCapsA;
+    t_eFSP_NEGO_Caps l_tCapsB;
+    t_eFSP_NEGO_Link l_tLinkA;
+    t_eFSP_NEGO_Link l_tLinkB;
+
+    /* Clear */
+    eFSP_LINKSIMTST_SetTick(0u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanAB, 2u, 0u, 0x00000003u);
+    eFSP_LINKSIMTST_InitChan(&m_tChanBA, 2u, 0u, 0x00000006u);
+    eFSP_NEGOTST_FullCaps(&l_tCapsA, EFSP_NEGOTST_MAXPAYL, EFSP_NEGOTST_MAXWINDOW);
+    eFSP_NEGOTST_FullCaps(&l_tCapsB, EFSP_NEGOTST_MAXPAYL, EFSP_NEGOTST_MAXWINDOW);
+
+    /* Function */
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeA, &m_tChanAB, &m_tChanBA) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 1  -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_InitNode(&m_tNodeB, &m_tChanBA, &m_tChanAB) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeA, &l_tCapsA) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGOTST_InitNego(&m_tNodeB, &l_tCapsB) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 4  -- FAIL \n");
+    }
+
+
+    /* Node B start late, the first frames of both nodes are lost, the answers and confirmations too */
+    if( true == eFSP_NEGOTST_RunNego(2u * EFSP_NEGOTST_RETRYMS) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeA.tNego, &l_tLinkA) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_NEGO_RES_OK == eFSP_NEGO_GetLink(&m_tNodeB.tNego, &l_tLinkB) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 7  -- FAIL \n");
+    }
+
+    if( ( EFSP_FRM_TRSP == l_tLinkA.uFrm ) && ( EFSP_FRM_TRSP == l_tLinkB.uFrm ) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 8  -- FAIL \n");
+    }
+
+    if( ( EFSP_HDR_CMP == l_tLinkA.uCmpL ) && ( EFSP_HDR_CMP == l_tLinkB.uCmpL ) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 9  -- FAIL \n");
+    }
+
+    if( ( EFSP_NEGOTST_MAXWINDOW == l_tLinkA.uWindow ) && ( EFSP_NEGOTST_MAXWINDOW == l_tLinkB.uWindow ) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 10 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeA, &m_tNodeB, 23u) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 11 -- FAIL \n");
+    }
+
+    if( true == eFSP_NEGOTST_Exchange(&m_tNodeB, &m_tNodeA, 31u) )
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_NEGOTST_LateLossy 12 -- FAIL \n");
+    }
+}
@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_RTTETST.h
+ *
+ * @brief      Round trip time estimator test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_RTTETST_H
+#define EFSP_RTTETST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the round trip time estimator module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_RTTETST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_RTTETST_H */
\ No newline at end of file
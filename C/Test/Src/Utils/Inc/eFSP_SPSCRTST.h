@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_SPSCRTST.h
+ *
+ * @brief      Ring buffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_SPSCRTST_H
+#define EFSP_SPSCRTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the ring buffer module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_SPSCRTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_SPSCRTST_H */
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file       eFSP_TIMWTST.h
+ *
+ * @brief      Timer wheel test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+#ifndef EFSP_TIMWTST_H
+#define EFSP_TIMWTST_H
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TYPE.h"
+
+
+
+
+/***********************************************************************************************************************
+ * GLOBAL PROTOTYPES
+ **********************************************************************************************************************/
+/**
+ * @brief       Test the timer wheel module
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSP_TIMWTST_ExeTest(void);
+
+
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+
+
+#endif /* EFSP_TIMWTST_H */
\ No newline at end of file
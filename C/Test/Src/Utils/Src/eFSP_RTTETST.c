@@ -0,0 +1,875 @@
+/**
+ * @file       eFSP_RTTETST.c
+ *
+ * @brief      Round trip time estimator test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_RTTETST.h"
+#include "eFSP_RTTE.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_RTTETST_BadPointer(void);
+static void eFSP_RTTETST_BadInit(void);
+static void eFSP_RTTETST_BadParamEntr(void);
+static void eFSP_RTTETST_CorruptContext(void);
+static void eFSP_RTTETST_General(void);
+static void eFSP_RTTETST_Bounds(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_RTTETST_ExeTest(void)
+{
+	(void)printf("\n\nRTT ESTIMATOR TEST START \n\n");
+
+    eFSP_RTTETST_BadPointer();
+    eFSP_RTTETST_BadInit();
+    eFSP_RTTETST_BadParamEntr();
+    eFSP_RTTETST_CorruptContext();
+    eFSP_RTTETST_General();
+    eFSP_RTTETST_Bounds();
+
+    (void)printf("\n\nRTT ESTIMATOR TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_RTTETST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tCtx;
+    uint32_t l_uVal;
+    uint32_t l_uValB;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_InitCtx(NULL, 100u, 10u, 1000u) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_AddSample(NULL, 10u) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_Backoff(NULL) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_GetRto(NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_GetRto(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_GetRtt(NULL, &l_uVal, &l_uValB) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_GetRtt(&l_tCtx, NULL, &l_uValB) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPOINTER == eFSP_RTTE_GetRtt(&l_tCtx, &l_uVal, NULL) )
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadPointer 10 -- FAIL \n");
+    }
+}
+
+void eFSP_RTTETST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tCtx;
+    uint32_t l_uVal;
+    uint32_t l_uValB;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_RTTETST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_NOINITLIB == eFSP_RTTE_AddSample(&l_tCtx, 10u) )
+    {
+        (void)printf("eFSP_RTTETST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_NOINITLIB == eFSP_RTTE_Backoff(&l_tCtx) )
+    {
+        (void)printf("eFSP_RTTETST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_NOINITLIB == eFSP_RTTE_GetRto(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_RTTETST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_NOINITLIB == eFSP_RTTE_GetRtt(&l_tCtx, &l_uVal, &l_uValB) )
+    {
+        (void)printf("eFSP_RTTETST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 5  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u) )
+    {
+        (void)printf("eFSP_RTTETST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_RTTETST_BadInit 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_BadInit 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadInit 7  -- FAIL \n");
+    }
+}
+
+void eFSP_RTTETST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tCtx;
+
+    /* Function */
+    if( e_eFSP_RTTE_RES_BADPARAM == eFSP_RTTE_InitCtx(&l_tCtx, 100u, 0u, 1000u) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPARAM == eFSP_RTTE_InitCtx(&l_tCtx, 100u, 200u, 150u) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPARAM == eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, EFSP_RTTE_MAXRTOMS + 1u) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPARAM == eFSP_RTTE_InitCtx(&l_tCtx, 5u, 10u, 1000u) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_BADPARAM == eFSP_RTTE_InitCtx(&l_tCtx, 2000u, 10u, 1000u) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_InitCtx(&l_tCtx, 10u, 10u, 10u) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_InitCtx(&l_tCtx, 1u, 1u, EFSP_RTTE_MAXRTOMS) )
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_BadParamEntr 7  -- FAIL \n");
+    }
+}
+
+void eFSP_RTTETST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tCtx;
+    uint32_t l_uVal;
+    uint32_t l_uValB;
+
+    /* Function, timeout under the lower bound */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u);
+    l_tCtx.uRtoMs = 5u;
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_AddSample(&l_tCtx, 10u) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_Backoff(&l_tCtx) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_GetRto(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_GetRtt(&l_tCtx, &l_uVal, &l_uValB) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 4  -- FAIL \n");
+    }
+
+
+    /* Function, inverted bounds */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u);
+    l_tCtx.uMinRtoMs = 2000u;
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_GetRto(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 5  -- FAIL \n");
+    }
+
+
+    /* Function, smoothed values over the upper bound */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u);
+    l_tCtx.uSRttQ = 8008u;
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_GetRto(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 6  -- FAIL \n");
+    }
+
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u);
+    l_tCtx.uRttVarQ = 4004u;
+    if( e_eFSP_RTTE_RES_CORRUPTCTX == eFSP_RTTE_GetRto(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_CorruptContext 7  -- FAIL \n");
+    }
+}
+
+void eFSP_RTTETST_General(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tCtx;
+    uint32_t l_uRto;
+    uint32_t l_uSRtt;
+    uint32_t l_uRttVar;
+    uint32_t l_uI;
+
+    /* Function, the initial timeout is used until the first sample */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u) )
+    {
+        (void)printf("eFSP_RTTETST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 100u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 2  -- FAIL \n");
+    }
+
+
+    /* Function, first sample: SRTT = R, RTTVAR = R / 2 */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 40u) )
+    {
+        (void)printf("eFSP_RTTETST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRtt(&l_tCtx, &l_uSRtt, &l_uRttVar) )
+    {
+        if( ( 40u == l_uSRtt ) && ( 20u == l_uRttVar ) )
+        {
+            (void)printf("eFSP_RTTETST_General 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 120u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 5  -- FAIL \n");
+    }
+
+
+    /* Function, a stable link reduce the variance */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 40u) )
+    {
+        (void)printf("eFSP_RTTETST_General 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRtt(&l_tCtx, &l_uSRtt, &l_uRttVar) )
+    {
+        if( ( 40u == l_uSRtt ) && ( 15u == l_uRttVar ) )
+        {
+            (void)printf("eFSP_RTTETST_General 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 100u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 8  -- FAIL \n");
+    }
+
+
+    /* Function, a slower answer move the mean by 1/8 and the deviation by 1/4 */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 80u) )
+    {
+        (void)printf("eFSP_RTTETST_General 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRtt(&l_tCtx, &l_uSRtt, &l_uRttVar) )
+    {
+        if( ( 45u == l_uSRtt ) && ( 21u == l_uRttVar ) )
+        {
+            (void)printf("eFSP_RTTETST_General 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 130u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 11 -- FAIL \n");
+    }
+
+
+    /* Function, every lost exchange double the timeout up to the upper bound */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_Backoff(&l_tCtx) )
+    {
+        (void)printf("eFSP_RTTETST_General 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 260u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 13 -- FAIL \n");
+    }
+
+    (void)eFSP_RTTE_Backoff(&l_tCtx);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 520u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 14 -- FAIL \n");
+    }
+
+    (void)eFSP_RTTE_Backoff(&l_tCtx);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 1000u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 15 -- FAIL \n");
+    }
+
+    (void)eFSP_RTTE_Backoff(&l_tCtx);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 1000u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 16 -- FAIL \n");
+    }
+
+
+    /* Function, the backoff is not part of the estimation and a new sample end it */
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 45u) )
+    {
+        (void)printf("eFSP_RTTETST_General 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 109u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_General 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 18 -- FAIL \n");
+    }
+
+
+    /* Function, a faster link lower the timeout */
+    for( l_uI = 0u; l_uI < 100u; l_uI++ )
+    {
+        (void)eFSP_RTTE_AddSample(&l_tCtx, 20u);
+    }
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRtt(&l_tCtx, &l_uSRtt, &l_uRttVar) )
+    {
+        if( ( 20u == l_uSRtt ) && ( 0u == l_uRttVar ) )
+        {
+            (void)printf("eFSP_RTTETST_General 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 19 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( ( l_uRto > 20u ) && ( l_uRto < 25u ) )
+        {
+            (void)printf("eFSP_RTTETST_General 20 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_General 20 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_General 20 -- FAIL \n");
+    }
+}
+
+void eFSP_RTTETST_Bounds(void)
+{
+    /* Local variable */
+    t_eFSP_RTTE_Ctx l_tCtx;
+    uint32_t l_uRto;
+    uint32_t l_uSRtt;
+    uint32_t l_uRttVar;
+
+    /* Function, the lower bound hide a too fast link */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 100u, 50u, 1000u);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_RTTETST_Bounds 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 50u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_Bounds 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_Bounds 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 2  -- FAIL \n");
+    }
+
+
+    /* Function, the timeout is never zero even without variance */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 5u, 1u, 1000u);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_RTTETST_Bounds 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 1u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_Bounds 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_Bounds 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 4  -- FAIL \n");
+    }
+
+
+    /* Function, a sample over the upper bound is limited */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 100u, 10u, 1000u);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, 5000u) )
+    {
+        (void)printf("eFSP_RTTETST_Bounds 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRtt(&l_tCtx, &l_uSRtt, &l_uRttVar) )
+    {
+        if( ( 1000u == l_uSRtt ) && ( 500u == l_uRttVar ) )
+        {
+            (void)printf("eFSP_RTTETST_Bounds 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_Bounds 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( 1000u == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_Bounds 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_Bounds 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 7  -- FAIL \n");
+    }
+
+
+    /* Function, biggest values can not overflow */
+    (void)eFSP_RTTE_InitCtx(&l_tCtx, 1u, 1u, EFSP_RTTE_MAXRTOMS);
+    (void)eFSP_RTTE_AddSample(&l_tCtx, 0u);
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, MAX_UINT32VAL) )
+    {
+        (void)printf("eFSP_RTTETST_Bounds 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_AddSample(&l_tCtx, MAX_UINT32VAL) )
+    {
+        (void)printf("eFSP_RTTETST_Bounds 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( EFSP_RTTE_MAXRTOMS == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_Bounds 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_Bounds 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_Backoff(&l_tCtx) )
+    {
+        (void)printf("eFSP_RTTETST_Bounds 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_RTTE_RES_OK == eFSP_RTTE_GetRto(&l_tCtx, &l_uRto) )
+    {
+        if( EFSP_RTTE_MAXRTOMS == l_uRto )
+        {
+            (void)printf("eFSP_RTTETST_Bounds 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_RTTETST_Bounds 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_RTTETST_Bounds 12 -- FAIL \n");
+    }
+}
@@ -0,0 +1,622 @@
+/**
+ * @file       eFSP_SPSCRTST.c
+ *
+ * @brief      Ring buffer test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_SPSCRTST.h"
+#include "eFSP_SPSCR.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_SPSCRTST_BadPointer(void);
+static void eFSP_SPSCRTST_BadInit(void);
+static void eFSP_SPSCRTST_BadParamEntr(void);
+static void eFSP_SPSCRTST_CorruptContext(void);
+static void eFSP_SPSCRTST_General(void);
+static void eFSP_SPSCRTST_Wrap(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_SPSCRTST_ExeTest(void)
+{
+	(void)printf("\n\nRING BUFFER TEST START \n\n");
+
+    eFSP_SPSCRTST_BadPointer();
+    eFSP_SPSCRTST_BadInit();
+    eFSP_SPSCRTST_BadParamEntr();
+    eFSP_SPSCRTST_CorruptContext();
+    eFSP_SPSCRTST_General();
+    eFSP_SPSCRTST_Wrap();
+
+    (void)printf("\n\nRING BUFFER TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_SPSCRTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_SPSCR_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_InitCtx(NULL, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_InitCtx(&l_tCtx, NULL, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_GetWriteSpan(NULL, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_GetWriteSpan(&l_tCtx, NULL, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_GetWriteSpan(&l_tCtx, &l_puData, NULL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_CommitWrite(NULL, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_Push(&l_tCtx, NULL, 1u, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, NULL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_Release(NULL, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_BADPOINTER == eFSP_SPSCR_GetUsed(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadPointer 12 -- FAIL \n");
+    }
+}
+
+void eFSP_SPSCRTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_SPSCR_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    l_tCtx.puBuff = l_auMemArea;
+    l_tCtx.uBuffL = sizeof(l_auMemArea);
+
+    /* Function */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_SPSCRTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_NOINITLIB == eFSP_SPSCR_GetWriteSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_NOINITLIB == eFSP_SPSCR_CommitWrite(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_NOINITLIB == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_NOINITLIB == eFSP_SPSCR_Release(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_NOINITLIB == eFSP_SPSCR_GetUsed(&l_tCtx, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadInit 6  -- FAIL \n");
+    }
+}
+
+void eFSP_SPSCRTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_SPSCR_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+
+    /* Function */
+    if( e_eFSP_SPSCR_RES_BADPARAM == eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+    /* Function, can not commit more than the free space */
+    if( e_eFSP_SPSCR_RES_BADPARAM == eFSP_SPSCR_CommitWrite(&l_tCtx, 5u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    /* Function, can not release more than the stored data */
+    if( e_eFSP_SPSCR_RES_BADPARAM == eFSP_SPSCR_Release(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_BadParamEntr 4  -- FAIL \n");
+    }
+}
+
+void eFSP_SPSCRTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_SPSCR_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Function */
+    (void)eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.puBuff = NULL;
+    if( e_eFSP_SPSCR_RES_CORRUPTCTX == eFSP_SPSCR_GetWriteSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 1  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.uBuffL = 1u;
+    if( e_eFSP_SPSCR_RES_CORRUPTCTX == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 2  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.uWrIdx = sizeof(l_auMemArea);
+    if( e_eFSP_SPSCR_RES_CORRUPTCTX == eFSP_SPSCR_CommitWrite(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 3  -- FAIL \n");
+    }
+
+    /* Function */
+    (void)eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    l_tCtx.uRdIdx = sizeof(l_auMemArea);
+    if( e_eFSP_SPSCR_RES_CORRUPTCTX == eFSP_SPSCR_Release(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_CorruptContext 4  -- FAIL \n");
+    }
+}
+
+void eFSP_SPSCRTST_General(void)
+{
+    /* Local variable */
+    t_eFSP_SPSCR_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auData[5u] = { 0x01u, 0x02u, 0x03u, 0x04u, 0x05u };
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Function */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea)) )
+    {
+        (void)printf("eFSP_SPSCRTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 1  -- FAIL \n");
+    }
+
+    /* Function, one byte is always left empty */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetWriteSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( l_auMemArea == l_puData ) && ( 4u == l_uDataL ) )
+        {
+            (void)printf("eFSP_SPSCRTST_General 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 2  -- FAIL \n");
+    }
+
+    /* Function, write without commit is not visible */
+    l_puData[0u] = 0xAAu;
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( 0u == l_uDataL )
+        {
+            (void)printf("eFSP_SPSCRTST_General 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_CommitWrite(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_General 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 1u == l_uDataL ) && ( 0xAAu == l_puData[0u] ) )
+        {
+            (void)printf("eFSP_SPSCRTST_General 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 5  -- FAIL \n");
+    }
+
+    /* Function, ring become full */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Push(&l_tCtx, l_auData, sizeof(l_auData), &l_uDataL) )
+    {
+        if( 3u == l_uDataL )
+        {
+            (void)printf("eFSP_SPSCRTST_General 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetUsed(&l_tCtx, &l_uDataL) )
+    {
+        if( 4u == l_uDataL )
+        {
+            (void)printf("eFSP_SPSCRTST_General 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetWriteSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( 0u == l_uDataL )
+        {
+            (void)printf("eFSP_SPSCRTST_General 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 8  -- FAIL \n");
+    }
+
+    /* Function, consume the data */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 4u == l_uDataL ) && ( 0xAAu == l_puData[0u] ) && ( 0x01u == l_puData[1u] ) &&
+            ( 0x02u == l_puData[2u] ) && ( 0x03u == l_puData[3u] ) )
+        {
+            (void)printf("eFSP_SPSCRTST_General 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Release(&l_tCtx, 4u) )
+    {
+        (void)printf("eFSP_SPSCRTST_General 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetUsed(&l_tCtx, &l_uDataL) )
+    {
+        if( 0u == l_uDataL )
+        {
+            (void)printf("eFSP_SPSCRTST_General 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_General 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_General 11 -- FAIL \n");
+    }
+}
+
+void eFSP_SPSCRTST_Wrap(void)
+{
+    /* Local variable */
+    t_eFSP_SPSCR_Ctx l_tCtx;
+    uint8_t  l_auMemArea[5u];
+    uint8_t  l_auData[4u] = { 0x01u, 0x02u, 0x03u, 0x04u };
+    uint8_t* l_puData;
+    uint32_t l_uDataL;
+
+    /* Init, move the index near the end of the buffer */
+    (void)eFSP_SPSCR_InitCtx(&l_tCtx, l_auMemArea, sizeof(l_auMemArea));
+    (void)eFSP_SPSCR_Push(&l_tCtx, l_auData, 3u, &l_uDataL);
+    (void)eFSP_SPSCR_Release(&l_tCtx, 3u);
+
+    /* Function, the data is splitted in two span */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Push(&l_tCtx, l_auData, sizeof(l_auData), &l_uDataL) )
+    {
+        if( 4u == l_uDataL )
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( 2u == l_uDataL ) && ( 0x01u == l_puData[0u] ) && ( 0x02u == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Release(&l_tCtx, 2u) )
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetReadSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( l_auMemArea == l_puData ) && ( 2u == l_uDataL ) && ( 0x03u == l_puData[0u] ) &&
+            ( 0x04u == l_puData[1u] ) )
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 4  -- FAIL \n");
+    }
+
+    /* Function, partial release */
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_Release(&l_tCtx, 1u) )
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_SPSCR_RES_OK == eFSP_SPSCR_GetWriteSpan(&l_tCtx, &l_puData, &l_uDataL) )
+    {
+        if( ( &l_auMemArea[2u] == l_puData ) && ( 3u == l_uDataL ) )
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_SPSCRTST_Wrap 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_SPSCRTST_Wrap 6  -- FAIL \n");
+    }
+}
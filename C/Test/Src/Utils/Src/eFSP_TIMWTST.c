@@ -0,0 +1,1211 @@
+/**
+ * @file       eFSP_TIMWTST.c
+ *
+ * @brief      Timer wheel test
+ *
+ * @author     Lorenzo Rosin
+ *
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *      INCLUDES
+ **********************************************************************************************************************/
+#include "eFSP_TIMWTST.h"
+#include "eFSP_TIMW.h"
+#include <stdio.h>
+
+
+
+/***********************************************************************************************************************
+ *      DEFINES
+ **********************************************************************************************************************/
+#define EFSP_TIMWTST_MANYNODE                                           ( 300u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static void eFSP_TIMWTST_BadPointer(void);
+static void eFSP_TIMWTST_BadInit(void);
+static void eFSP_TIMWTST_BadParamEntr(void);
+static void eFSP_TIMWTST_CorruptContext(void);
+static void eFSP_TIMWTST_General(void);
+static void eFSP_TIMWTST_Cascade(void);
+static void eFSP_TIMWTST_Wrap(void);
+static void eFSP_TIMWTST_Many(void);
+
+
+
+/***********************************************************************************************************************
+ *   GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+void eFSP_TIMWTST_ExeTest(void)
+{
+	(void)printf("\n\nTIMER WHEEL TEST START \n\n");
+
+    eFSP_TIMWTST_BadPointer();
+    eFSP_TIMWTST_BadInit();
+    eFSP_TIMWTST_BadParamEntr();
+    eFSP_TIMWTST_CorruptContext();
+    eFSP_TIMWTST_General();
+    eFSP_TIMWTST_Cascade();
+    eFSP_TIMWTST_Wrap();
+    eFSP_TIMWTST_Many();
+
+    (void)printf("\n\nTIMER WHEEL TEST END \n\n");
+}
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+void eFSP_TIMWTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNode;
+    uint32_t l_uVal;
+    bool_t l_bIsInit;
+
+    /* Function */
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_InitCtx(NULL, 0u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_InitNode(NULL, 0u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_Start(NULL, &l_tNode, 1u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_Start(&l_tCtx, NULL, 1u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_Cancel(NULL, &l_tNode) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_Cancel(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_GetRemain(NULL, &l_tNode, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_GetRemain(&l_tCtx, NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNode, NULL) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_Advance(NULL, 0u, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_Advance(&l_tCtx, 0u, NULL) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_PopFired(NULL, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_BADPOINTER == eFSP_TIMW_PopFired(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadPointer 15 -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_BadInit(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNode;
+    uint32_t l_uVal;
+    bool_t l_bIsInit;
+
+    /* Clear */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)eFSP_TIMW_InitNode(&l_tNode, 0u);
+
+    /* Function */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( false == l_bIsInit )
+        {
+            (void)printf("eFSP_TIMWTST_BadInit 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_BadInit 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOINITLIB == eFSP_TIMW_Start(&l_tCtx, &l_tNode, 1u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOINITLIB == eFSP_TIMW_Cancel(&l_tCtx, &l_tNode) )
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOINITLIB == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNode, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOINITLIB == eFSP_TIMW_Advance(&l_tCtx, 1u, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOINITLIB == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 6  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_InitCtx(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_IsInit(&l_tCtx, &l_bIsInit) )
+    {
+        if( true == l_bIsInit )
+        {
+            (void)printf("eFSP_TIMWTST_BadInit 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_BadInit 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadInit 8  -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_BadParamEntr(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNode;
+    uint32_t l_uVal;
+
+    /* Function */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 100u);
+    (void)eFSP_TIMW_InitNode(&l_tNode, 0u);
+
+    /* Function, the timeout can not be compared with a free running tick */
+    if( e_eFSP_TIMW_RES_BADPARAM == eFSP_TIMW_Start(&l_tCtx, &l_tNode, 0x80000000u) )
+    {
+        (void)printf("eFSP_TIMWTST_BadParamEntr 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadParamEntr 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNode, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_BadParamEntr 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_BadParamEntr 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadParamEntr 2  -- FAIL \n");
+    }
+
+
+    /* Function, the tick can not go back */
+    if( e_eFSP_TIMW_RES_BADPARAM == eFSP_TIMW_Advance(&l_tCtx, 99u, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_BadParamEntr 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadParamEntr 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 100u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_BadParamEntr 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_BadParamEntr 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_BadParamEntr 4  -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_CorruptContext(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNode;
+    t_eFSP_TIMW_Node l_tNodeB;
+    uint32_t l_uVal;
+
+    /* Function, the head of the fired list has a previous element */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 0u);
+    (void)eFSP_TIMW_InitNode(&l_tNode, 0u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeB, 0u);
+    (void)eFSP_TIMW_Start(&l_tCtx, &l_tNode, 0u);
+    l_tNode.ptPrev = &l_tNodeB;
+    if( e_eFSP_TIMW_RES_CORRUPTCTX == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_CorruptContext 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_CorruptContext 1  -- FAIL \n");
+    }
+
+
+    /* Function, nothing armed but something in the current slot */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 0u);
+    (void)eFSP_TIMW_InitNode(&l_tNode, 0u);
+    l_tCtx.aptLvl0[0u] = &l_tNode;
+    if( e_eFSP_TIMW_RES_CORRUPTCTX == eFSP_TIMW_Start(&l_tCtx, &l_tNodeB, 1u) )
+    {
+        (void)printf("eFSP_TIMWTST_CorruptContext 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_CorruptContext 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_CORRUPTCTX == eFSP_TIMW_Advance(&l_tCtx, 1u, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_CorruptContext 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_CorruptContext 3  -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_General(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNodeA;
+    t_eFSP_TIMW_Node l_tNodeB;
+    t_eFSP_TIMW_Node l_tNodeC;
+    uint32_t l_uVal;
+
+    /* Init */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 0u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeA, 1u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeB, 2u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeC, 3u);
+
+    /* Function, a zero timeout fire immediately */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeA, 10u) )
+    {
+        (void)printf("eFSP_TIMWTST_General 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeB, 5u) )
+    {
+        (void)printf("eFSP_TIMWTST_General 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeC, 0u) )
+    {
+        (void)printf("eFSP_TIMWTST_General 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOFIRED == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_General 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNodeA, &l_uVal) )
+    {
+        if( 10u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 6  -- FAIL \n");
+    }
+
+
+    /* Function, only the expired node is fired */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 4u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 5u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNodeB, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNodeA, &l_uVal) )
+    {
+        if( 5u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 10 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOFIRED == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_General 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 12 -- FAIL \n");
+    }
+
+
+    /* Function, a canceled node never fire */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Cancel(&l_tCtx, &l_tNodeA) )
+    {
+        (void)printf("eFSP_TIMWTST_General 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 20u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 14 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOFIRED == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_General 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 15 -- FAIL \n");
+    }
+
+
+    /* Function, restarting a node move the deadline */
+    (void)eFSP_TIMW_Start(&l_tCtx, &l_tNodeA, 3u);
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeA, 7u) )
+    {
+        (void)printf("eFSP_TIMWTST_General 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 26u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 17 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 27u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 18 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 18 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 18 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_General 19 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_General 19 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 19 -- FAIL \n");
+    }
+
+
+    /* Function, a fired node can be canceled before being popped */
+    (void)eFSP_TIMW_Start(&l_tCtx, &l_tNodeC, 0u);
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Cancel(&l_tCtx, &l_tNodeC) )
+    {
+        (void)printf("eFSP_TIMWTST_General 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 20 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_NOFIRED == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        (void)printf("eFSP_TIMWTST_General 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 21 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Cancel(&l_tCtx, &l_tNodeC) )
+    {
+        (void)printf("eFSP_TIMWTST_General 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_General 22 -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_Cascade(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNodeA;
+    t_eFSP_TIMW_Node l_tNodeB;
+    t_eFSP_TIMW_Node l_tNodeC;
+    uint32_t l_uVal;
+
+    /* Init */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 0u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeA, 1u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeB, 2u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeC, 3u);
+
+    /* Function, one node for every level and one out of the wheel range */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeA, 1000u) )
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeB, 100000u) )
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeC, 2000000u) )
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 3  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 999u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNodeA, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 1000u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 7  -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 99999u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 100000u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 10 -- FAIL \n");
+    }
+
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNodeC, &l_uVal) )
+    {
+        if( 1900000u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 11 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 1999999u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 12 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 2000000u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 13 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 3u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 14 -- FAIL \n");
+    }
+
+
+    /* Function, an empty wheel jump directly to the current tick */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0x70000000u, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 15 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeA, 300u) )
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 16 -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0x7000012Cu, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Cascade 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Cascade 17 -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_Wrap(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_tNodeA;
+    t_eFSP_TIMW_Node l_tNodeB;
+    uint32_t l_uVal;
+
+    /* Init, the tick is near the wrap around */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 0xFFFFFF00u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeA, 1u);
+    (void)eFSP_TIMW_InitNode(&l_tNodeB, 2u);
+
+    /* Function */
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeA, 0x200u) )
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 1  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Start(&l_tCtx, &l_tNodeB, 0x20000u) )
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 2  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0xFFFFFFFFu, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 3  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_GetRemain(&l_tCtx, &l_tNodeA, &l_uVal) )
+    {
+        if( 0x101u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 4  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0xFFu, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 5  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0x100u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 6  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 7  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0x1FEFFu, &l_uVal) )
+    {
+        if( 0u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 8  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_Advance(&l_tCtx, 0x1FF00u, &l_uVal) )
+    {
+        if( 1u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 9  -- FAIL \n");
+    }
+
+    if( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+    {
+        if( 2u == l_uVal )
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_TIMWTST_Wrap 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Wrap 10 -- FAIL \n");
+    }
+}
+
+void eFSP_TIMWTST_Many(void)
+{
+    /* Local variable */
+    t_eFSP_TIMW_Ctx l_tCtx;
+    t_eFSP_TIMW_Node l_atNode[EFSP_TIMWTST_MANYNODE];
+    uint32_t l_uIdx;
+    uint32_t l_uVal;
+    uint32_t l_uFiredN;
+    uint32_t l_uIdSum;
+    bool_t l_bOrder;
+
+    /* Init, every node has a different timeout, half of them are canceled */
+    (void)eFSP_TIMW_InitCtx(&l_tCtx, 0u);
+    for( l_uIdx = 0u; l_uIdx < EFSP_TIMWTST_MANYNODE; l_uIdx++ )
+    {
+        (void)eFSP_TIMW_InitNode(&l_atNode[l_uIdx], l_uIdx);
+        (void)eFSP_TIMW_Start(&l_tCtx, &l_atNode[l_uIdx], ( l_uIdx + 1u ) * 7u);
+    }
+
+    for( l_uIdx = 1u; l_uIdx < EFSP_TIMWTST_MANYNODE; l_uIdx += 2u )
+    {
+        (void)eFSP_TIMW_Cancel(&l_tCtx, &l_atNode[l_uIdx]);
+    }
+
+    /* Function, move the wheel with a coarse step, the expired nodes are fired in order of deadline */
+    l_uFiredN = 0u;
+    l_uIdSum = 0u;
+    l_bOrder = true;
+    for( l_uIdx = 1u; l_uIdx <= ( ( EFSP_TIMWTST_MANYNODE * 7u ) / 14u ); l_uIdx++ )
+    {
+        (void)eFSP_TIMW_Advance(&l_tCtx, l_uIdx * 14u, &l_uVal);
+        if( 1u != l_uVal )
+        {
+            l_bOrder = false;
+        }
+
+        while( e_eFSP_TIMW_RES_OK == eFSP_TIMW_PopFired(&l_tCtx, &l_uVal) )
+        {
+            l_uFiredN++;
+            l_uIdSum += l_uVal;
+        }
+    }
+
+    if( ( ( EFSP_TIMWTST_MANYNODE / 2u ) == l_uFiredN ) && ( true == l_bOrder ) )
+    {
+        (void)printf("eFSP_TIMWTST_Many 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Many 1  -- FAIL \n");
+    }
+
+    if( ( ( ( EFSP_TIMWTST_MANYNODE / 2u ) * ( EFSP_TIMWTST_MANYNODE - 2u ) ) / 2u ) == l_uIdSum )
+    {
+        (void)printf("eFSP_TIMWTST_Many 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_TIMWTST_Many 2  -- FAIL \n");
+    }
+}